@@ -51,6 +51,11 @@ void AlsaSound::SoundLoop()
   {
     while (m_thread_status.load() == ALSAThreadStatus::RUNNING)
     {
+      if (m_use_mmap)
+      {
+        MmapWritePeriod();
+        continue;
+      }
       m_mixer->Mix(mix_buffer, frames_to_deliver);
       int rc = snd_pcm_writei(handle, mix_buffer, frames_to_deliver);
       if (rc == -EPIPE)
@@ -85,7 +90,177 @@ void AlsaSound::Clear(bool muted)
   cv.notify_one();  // Notify thread that status has changed
 }
 
+// Mix one period straight into the device's DMA buffer, skipping the
+// intermediate copy snd_pcm_writei would make.
+void AlsaSound::MmapWritePeriod()
+{
+  if (snd_pcm_state(handle) == SND_PCM_STATE_XRUN)
+    snd_pcm_prepare(handle);
+
+  snd_pcm_sframes_t avail = snd_pcm_avail_update(handle);
+  if (avail < 0)
+  {
+    snd_pcm_recover(handle, static_cast<int>(avail), 1);
+    return;
+  }
+  if (static_cast<snd_pcm_uframes_t>(avail) < frames_to_deliver)
+  {
+    // Sleep until the hardware has consumed at least one period. The short
+    // timeout keeps the thread responsive to pause/stop requests.
+    int err = snd_pcm_wait(handle, 10);
+    if (err < 0)
+      snd_pcm_recover(handle, err, 1);
+    return;
+  }
+
+  const snd_pcm_channel_area_t* areas;
+  snd_pcm_uframes_t offset;
+  snd_pcm_uframes_t frames = frames_to_deliver;
+  int err = snd_pcm_mmap_begin(handle, &areas, &offset, &frames);
+  if (err < 0)
+  {
+    snd_pcm_recover(handle, err, 1);
+    return;
+  }
+  if (frames == 0)
+    return;
+
+  s16* dst = reinterpret_cast<s16*>(static_cast<u8*>(areas[0].addr) +
+                                    (areas[0].first + offset * areas[0].step) / 8);
+  m_mixer->Mix(dst, frames);
+
+  snd_pcm_sframes_t committed = snd_pcm_mmap_commit(handle, offset, frames);
+  if (committed < 0 || static_cast<snd_pcm_uframes_t>(committed) != frames)
+  {
+    snd_pcm_recover(handle, committed < 0 ? static_cast<int>(committed) : -EPIPE, 1);
+    return;
+  }
+
+  // mmap streams do not start on their own; kick the device once the first
+  // period has been written.
+  if (snd_pcm_state(handle) == SND_PCM_STATE_PREPARED &&
+      snd_pcm_avail_update(handle) < static_cast<snd_pcm_sframes_t>(frames_to_deliver))
+    snd_pcm_start(handle);
+}
+
 bool AlsaSound::AlsaInit()
+{
+  // The direct path negotiates mmap access and the smallest period the
+  // device claims to sustain; anything refusing it (dmix, pulse plugin, odd
+  // hardware) gets the old buffered setup instead.
+  m_use_mmap = AlsaInitLowLatency();
+  if (m_use_mmap)
+    return true;
+
+  if (handle)
+  {
+    snd_pcm_close(handle);
+    handle = nullptr;
+  }
+  NOTICE_LOG(AUDIO, "ALSA low-latency mmap setup not available, using the buffered path.");
+  return AlsaInitBuffered();
+}
+
+bool AlsaSound::AlsaInitLowLatency()
+{
+  unsigned int sample_rate = m_mixer->GetSampleRate();
+  int err;
+  int dir;
+  snd_pcm_sw_params_t* swparams;
+  snd_pcm_hw_params_t* hwparams;
+  snd_pcm_uframes_t period_size, buffer_size;
+  unsigned int periods;
+
+  err = snd_pcm_open(&handle, "default", SND_PCM_STREAM_PLAYBACK, 0);
+  if (err < 0)
+  {
+    ERROR_LOG(AUDIO, "Audio open error: %s", snd_strerror(err));
+    return false;
+  }
+
+  snd_pcm_hw_params_alloca(&hwparams);
+
+  err = snd_pcm_hw_params_any(handle, hwparams);
+  if (err < 0)
+    return false;
+
+  err = snd_pcm_hw_params_set_access(handle, hwparams, SND_PCM_ACCESS_MMAP_INTERLEAVED);
+  if (err < 0)
+    return false;
+
+  err = snd_pcm_hw_params_set_format(handle, hwparams, SND_PCM_FORMAT_S16_LE);
+  if (err < 0)
+    return false;
+
+  dir = 0;
+  err = snd_pcm_hw_params_set_rate_near(handle, hwparams, &sample_rate, &dir);
+  if (err < 0)
+    return false;
+
+  err = snd_pcm_hw_params_set_channels(handle, hwparams, CHANNEL_COUNT);
+  if (err < 0)
+    return false;
+
+  // Ask for the smallest period the device will give us, with a floor of 64
+  // frames (~1.3ms at 48kHz) - drivers advertising tinier periods wake the
+  // thread faster than scheduling jitter allows it to be serviced.
+  period_size = 64;
+  dir = 0;
+  err = snd_pcm_hw_params_set_period_size_near(handle, hwparams, &period_size, &dir);
+  if (err < 0)
+    return false;
+
+  // One period playing, one queued, one being mixed.
+  periods = 3;
+  dir = 0;
+  err = snd_pcm_hw_params_set_periods_near(handle, hwparams, &periods, &dir);
+  if (err < 0)
+    return false;
+
+  err = snd_pcm_hw_params(handle, hwparams);
+  if (err < 0)
+    return false;
+
+  err = snd_pcm_hw_params_get_period_size(hwparams, &period_size, &dir);
+  if (err < 0)
+    return false;
+
+  err = snd_pcm_hw_params_get_buffer_size(hwparams, &buffer_size);
+  if (err < 0)
+    return false;
+
+  frames_to_deliver = period_size;
+
+  snd_pcm_sw_params_alloca(&swparams);
+
+  err = snd_pcm_sw_params_current(handle, swparams);
+  if (err < 0)
+    return false;
+
+  // The stream is started explicitly once the first period is committed.
+  err = snd_pcm_sw_params_set_start_threshold(handle, swparams, buffer_size);
+  if (err < 0)
+    return false;
+
+  err = snd_pcm_sw_params_set_avail_min(handle, swparams, period_size);
+  if (err < 0)
+    return false;
+
+  err = snd_pcm_sw_params(handle, swparams);
+  if (err < 0)
+    return false;
+
+  err = snd_pcm_prepare(handle);
+  if (err < 0)
+    return false;
+
+  NOTICE_LOG(AUDIO,
+             "ALSA mmap initialized: %ld frame periods x %d, %ld frame buffer (%.1fms at %uHz).",
+             period_size, periods, buffer_size, 1000.0 * buffer_size / sample_rate, sample_rate);
+  return true;
+}
+
+bool AlsaSound::AlsaInitBuffered()
 {
   unsigned int sample_rate = m_mixer->GetSampleRate();
   int err;
@@ -48,7 +48,10 @@ private:
 	};
 
 	bool AlsaInit();
+	bool AlsaInitLowLatency();
+	bool AlsaInitBuffered();
 	void AlsaShutdown();
+	void MmapWritePeriod();
 
 	s16 mix_buffer[BUFFER_SIZE_MAX * CHANNEL_COUNT];
 	std::thread thread;
@@ -58,5 +61,7 @@ private:
 
 	snd_pcm_t* handle;
 	unsigned int frames_to_deliver;
+	// mmap access negotiated: the mixer renders straight into the DMA buffer.
+	bool m_use_mmap = false;
 #endif
 };
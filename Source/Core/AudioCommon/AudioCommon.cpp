@@ -16,6 +16,7 @@
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Core/ConfigManager.h"
+#include "Core/Movie.h"
 
 // This shouldn't be a global, at least not here.
 std::unique_ptr<SoundStream> g_sound_stream;
@@ -169,6 +170,11 @@ void SendAIBuffer(const short* samples, unsigned int num_samples)
 	if (!g_sound_stream)
 		return;
 
+	// Nobody is listening during a verification turbo replay, so skip the
+	// mixer (and with it resampling and timestretching) entirely.
+	if (Movie::IsTurboPlayback())
+		return;
+
 	if (SConfig::GetInstance().m_DumpAudio && !s_audio_dump_start)
 		StartAudioDump();
 	else if (!SConfig::GetInstance().m_DumpAudio && s_audio_dump_start)
@@ -6,9 +6,12 @@
 
 #include <array>
 #include <atomic>
+#include <thread>
 
 #include "AudioCommon/WaveFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
 
 #include <soundtouch/STTypes.h>
 #include <soundtouch/SoundTouch.h>
@@ -64,29 +67,70 @@ private:
 
 	private:
 		CMixer* m_mixer;
-		unsigned m_input_sample_rate;
-		std::array<short, MAX_SAMPLES * 2> m_buffer{};
-		std::atomic<u32> m_indexW{ 0 };
-		std::atomic<u32> m_indexR{ 0 };
+		// Sample rate and volume are control state: written by the CPU thread,
+		// snapshotted with single relaxed loads at the top of Mix.
+		std::atomic<unsigned> m_input_sample_rate;
 		// Volume ranges from 0-256
 		std::atomic<s32> m_LVolume{ 256 };
 		std::atomic<s32> m_RVolume{ 256 };
+		std::array<short, MAX_SAMPLES * 2> m_buffer{};
+		// Single-producer single-consumer ring: the CPU thread only advances
+		// m_indexW (released after the data is in m_buffer), the audio thread
+		// only advances m_indexR (released after the data has been read out).
+		// Each index gets its own cache line so a backend running at tiny
+		// period sizes never ping-pongs a line with the emulation thread.
+		alignas(64) std::atomic<u32> m_indexW{ 0 };
+		alignas(64) std::atomic<u32> m_indexR{ 0 };
+		// Consumer-only state, deliberately on the consumer's cache line.
 		float m_numLeftI = 0.0f;
 		u32 m_frac = 0;
 	};
 
-	void StretchAudio(const short* in, unsigned int num_in, short* out, unsigned int num_out);
+	// Native-endian stereo sample fifo between the audio thread and the
+	// stretch worker. Same single-producer single-consumer scheme as
+	// MixerFifo, but carries already-mixed samples and reports how much it
+	// actually moved so the caller can handle overflow/underflow.
+	class StretchFifo final
+	{
+	public:
+		// Both return the number of sample pairs actually transferred.
+		unsigned int Push(const short* samples, unsigned int num_samples);
+		unsigned int Pop(short* samples, unsigned int num_samples);
+		unsigned int AvailableSamples() const;
+		unsigned int FreeSamples() const;
+
+	private:
+		std::array<short, MAX_SAMPLES * 2> m_buffer{};
+		alignas(64) std::atomic<u32> m_indexW{ 0 };
+		alignas(64) std::atomic<u32> m_indexR{ 0 };
+	};
+
+	void StretchWorkerThread();
+	void StretchAudio(const short* in, unsigned int num_in, unsigned int num_out);
 
 	MixerFifo m_dma_mixer{ this, 32000 };
 	MixerFifo m_streaming_mixer{ this, 48000 };
 	MixerFifo m_wiimote_speaker_mixer{ this, 3000 };
 	unsigned int m_sampleRate;
 
-	bool m_is_stretching = false;
+	// SoundTouch runs on its own worker thread so the WSOLA search never
+	// stalls the latency-critical backend callback. The audio thread mixes
+	// into m_stretch_in and pops finished samples from m_stretch_out; the
+	// worker owns m_sound_touch and m_stretch_ratio exclusively.
+	bool m_is_stretching = false;  // audio thread only
 	soundtouch::SoundTouch m_sound_touch;
 	double m_stretch_ratio = 1.0;
-	std::array<short, 2> m_last_stretched_sample = {};
+	std::array<short, 2> m_last_stretched_sample = {};  // audio thread only
 	std::array<short, MAX_SAMPLES * 2> m_stretch_buffer;
+	std::thread m_stretch_thread;
+	Common::Event m_stretch_trigger;
+	Common::Flag m_stretch_exit;
+	Common::Flag m_stretch_reset;
+	StretchFifo m_stretch_in;
+	StretchFifo m_stretch_out;
+	// Total output samples the backend has asked for while stretching; the
+	// worker diffs this against its last seen value to derive the ratio.
+	std::atomic<u32> m_stretch_out_requested{ 0 };
 
 	WaveFileWriter m_wave_writer_dtk;
 	WaveFileWriter m_wave_writer_dsp;
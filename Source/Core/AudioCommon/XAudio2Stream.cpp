@@ -13,6 +13,25 @@
 #error You are building this module against the wrong version of DirectX. You probably need to remove DXSDK_DIR from your include path.
 #endif
 
+const int NUM_BUFFERS = 3;
+const int SAMPLES_PER_BUFFER = 96;
+
+const int NUM_CHANNELS = 2;
+const int BUFFER_SIZE = SAMPLES_PER_BUFFER * NUM_CHANNELS;
+const int BUFFER_SIZE_BYTES = BUFFER_SIZE * sizeof(s16);
+
+// The voice is driven entirely by OnBufferEnd: every callback mixes exactly
+// one period and resubmits the buffer that just finished, so audio is
+// produced on hardware period boundaries rather than a polled schedule. The
+// queue depth - the output latency - adapts to measured delivery jitter: it
+// starts at two periods (one playing, one queued) and grows by one whenever a
+// callback finds the queue drained; a long starvation-free stretch shrinks it
+// back.
+const int MIN_QUEUED_BUFFERS = 2;
+// ~10 seconds of clean callbacks at 2ms per period before giving a period of
+// latency back.
+const int SHRINK_AFTER_CLEAN_CALLBACKS = 5000;
+
 struct StreamingVoiceContext : public IXAudio2VoiceCallback
 {
 private:
@@ -21,6 +40,14 @@ private:
   IXAudio2SourceVoice* m_source_voice;
   std::unique_ptr<BYTE[]> xaudio_buffer;
 
+  // Queue depth bookkeeping; only touched from the constructor and the
+  // XAudio2 callback thread (callbacks for one voice are serialized).
+  int m_queued;
+  int m_target_depth;
+  int m_clean_callbacks;
+  PBYTE m_free_buffers[NUM_BUFFERS];
+  int m_num_free;
+
   void SubmitBuffer(PBYTE buf_data);
 
 public:
@@ -40,13 +67,6 @@ public:
   STDMETHOD_(void, OnBufferEnd)(void* context);
 };
 
-const int NUM_BUFFERS = 3;
-const int SAMPLES_PER_BUFFER = 96;
-
-const int NUM_CHANNELS = 2;
-const int BUFFER_SIZE = SAMPLES_PER_BUFFER * NUM_CHANNELS;
-const int BUFFER_SIZE_BYTES = BUFFER_SIZE * sizeof(s16);
-
 void StreamingVoiceContext::SubmitBuffer(PBYTE buf_data)
 {
   XAUDIO2_BUFFER buf = {};
@@ -60,7 +80,8 @@ void StreamingVoiceContext::SubmitBuffer(PBYTE buf_data)
 StreamingVoiceContext::StreamingVoiceContext(IXAudio2* pXAudio2, CMixer* pMixer,
                                              Common::Event& pSyncEvent)
     : m_mixer(pMixer), m_sound_sync_event(pSyncEvent),
-      xaudio_buffer(new BYTE[NUM_BUFFERS * BUFFER_SIZE_BYTES]())
+      xaudio_buffer(new BYTE[NUM_BUFFERS * BUFFER_SIZE_BYTES]()), m_queued(0),
+      m_target_depth(MIN_QUEUED_BUFFERS), m_clean_callbacks(0), m_num_free(0)
 {
   WAVEFORMATEXTENSIBLE wfx = {};
 
@@ -86,9 +107,21 @@ StreamingVoiceContext::StreamingVoiceContext(IXAudio2* pXAudio2, CMixer* pMixer,
 
   m_source_voice->Start();
 
-  // start buffers with silence
+  // start at the minimum depth with silence; the rest of the pool is held in
+  // reserve for when starvation asks for a deeper queue
   for (int i = 0; i != NUM_BUFFERS; ++i)
-    SubmitBuffer(xaudio_buffer.get() + (i * BUFFER_SIZE_BYTES));
+  {
+    PBYTE buf = xaudio_buffer.get() + (i * BUFFER_SIZE_BYTES);
+    if (i < MIN_QUEUED_BUFFERS)
+    {
+      SubmitBuffer(buf);
+      m_queued++;
+    }
+    else
+    {
+      m_free_buffers[m_num_free++] = buf;
+    }
+  }
 }
 
 StreamingVoiceContext::~StreamingVoiceContext()
@@ -119,11 +152,44 @@ void StreamingVoiceContext::OnBufferEnd(void* context)
   if (!m_source_voice || !context)
     return;
 
-  // m_sound_sync_event->Wait(); // sync
-  // m_sound_sync_event->Spin(); // or tight sync
+  // A callback that finds the queue already drained means the voice is about
+  // to play silence: the current depth doesn't absorb the delivery jitter, so
+  // keep one more period queued from now on.
+  XAUDIO2_VOICE_STATE state;
+  m_source_voice->GetState(&state, XAUDIO2_VOICE_NOSAMPLESPLAYED);
+  if (state.BuffersQueued == 0 && m_target_depth < NUM_BUFFERS)
+  {
+    m_target_depth++;
+    m_clean_callbacks = 0;
+  }
+  else if (++m_clean_callbacks >= SHRINK_AFTER_CLEAN_CALLBACKS)
+  {
+    m_clean_callbacks = 0;
+    if (m_target_depth > MIN_QUEUED_BUFFERS)
+      m_target_depth--;
+  }
+
+  m_queued--;
+  if (m_queued >= m_target_depth)
+  {
+    // Shrinking: retire this buffer instead of refilling it.
+    m_free_buffers[m_num_free++] = static_cast<BYTE*>(context);
+    return;
+  }
 
+  // Mix exactly one hardware period and hand the buffer straight back.
   m_mixer->Mix(static_cast<short*>(context), SAMPLES_PER_BUFFER);
   SubmitBuffer(static_cast<BYTE*>(context));
+  m_queued++;
+
+  // Growing: pull reserve buffers until the new depth is reached.
+  while (m_queued < m_target_depth && m_num_free > 0)
+  {
+    PBYTE buf = m_free_buffers[--m_num_free];
+    m_mixer->Mix(reinterpret_cast<short*>(buf), SAMPLES_PER_BUFFER);
+    SubmitBuffer(buf);
+    m_queued++;
+  }
 }
 
 HMODULE XAudio2::m_xaudio2_dll = nullptr;
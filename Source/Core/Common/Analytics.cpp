@@ -4,12 +4,15 @@
 
 #include <cmath>
 #include <cstdio>
+#include <lzo/lzo1x.h>
 #include <string>
+#include <vector>
 #include <curl/curl.h>
 
 #include "Common/Analytics.h"
 #include "Common/CommonTypes.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 
 namespace Common
 {
@@ -19,6 +22,21 @@ namespace
 // Increment for any change to the wire format.
 constexpr u8 WIRE_FORMAT_VERSION = 0;
 
+// First byte of a serialized batch: 'B' when the payload is LZO1X compressed,
+// 'R' when it is shipped raw because compression failed. The payload is a
+// varint report count followed by length-prefixed reports.
+constexpr u8 BATCH_COMPRESSED = 'B';
+constexpr u8 BATCH_RAW = 'R';
+
+// Upper bound on reports retained while the backend is slow or absent. Past
+// it, the oldest reports are dropped: fresh events describe what the emulator
+// is doing now, and bounded memory matters more than a complete history.
+constexpr size_t PENDING_REPORTS_LIMIT = 100;
+
+// How long the reporter thread lingers after the first event of a burst
+// before serializing, so one upload covers the whole burst.
+constexpr int BATCH_WINDOW_MS = 250;
+
 // Identifiers for the value types supported by the analytics reporting wire
 // format.
 enum class TypeId : u8
@@ -144,14 +162,50 @@ AnalyticsReporter::~AnalyticsReporter()
 void AnalyticsReporter::Send(AnalyticsReportBuilder&& report)
 {
 	// Put a bound on the size of the queue to avoid uncontrolled memory growth.
-	constexpr u32 QUEUE_SIZE_LIMIT = 25;
-	if (m_reports_queue.Size() < QUEUE_SIZE_LIMIT)
+	// The queue is single-producer/single-consumer, so the oldest entry can't
+	// be dropped from here; the drop-oldest backpressure is applied where it is
+	// safe, on the reporter thread (see ThreadProc).
+	if (m_reports_queue.Size() < PENDING_REPORTS_LIMIT)
 	{
 		m_reports_queue.Push(report.Consume());
 		m_reporter_event.Set();
 	}
 }
 
+// Serializes m_pending_reports into one upload: the batch marker byte, a
+// varint with the decompressed payload size, and the (normally compressed)
+// payload. Individual reports keep their own WIRE_FORMAT_VERSION byte.
+std::string AnalyticsReporter::SerializeBatch()
+{
+	std::string payload;
+	AppendVarInt(&payload, m_pending_reports.size());
+	for (const std::string& report : m_pending_reports)
+	{
+		AppendBytes(&payload, reinterpret_cast<const u8*>(report.data()),
+			static_cast<u32>(report.size()));
+	}
+
+	std::string batch;
+	std::vector<u8> out(payload.size() + payload.size() / 16 + 64 + 3);
+	std::vector<u8> wrkmem(LZO1X_1_MEM_COMPRESS);
+	lzo_uint out_len = 0;
+	if (lzo_init() == LZO_E_OK &&
+		lzo1x_1_compress(reinterpret_cast<const u8*>(payload.data()), payload.size(), out.data(),
+			&out_len, wrkmem.data()) == LZO_E_OK)
+	{
+		batch.push_back(BATCH_COMPRESSED);
+		AppendVarInt(&batch, payload.size());
+		AppendBytes(&batch, out.data(), static_cast<u32>(out_len), false);
+	}
+	else
+	{
+		batch.push_back(BATCH_RAW);
+		AppendVarInt(&batch, payload.size());
+		batch += payload;
+	}
+	return batch;
+}
+
 void AnalyticsReporter::ThreadProc()
 {
 	while (true)
@@ -162,26 +216,31 @@ void AnalyticsReporter::ThreadProc()
 			return;
 		}
 
-		while (!m_reports_queue.Empty())
+		// Linger a little so a burst of events ends up in one upload instead of
+		// one HTTP round trip each.
+		SleepCurrentThread(BATCH_WINDOW_MS);
+
+		// Drain everything that has accumulated, dropping the oldest pending
+		// reports past the bound. This also keeps memory bounded while no
+		// backend is set (i.e. the user has not given consent yet).
+		std::string report;
+		while (m_reports_queue.Pop(report))
+		{
+			m_pending_reports.push_back(std::move(report));
+			if (m_pending_reports.size() > PENDING_REPORTS_LIMIT)
+				m_pending_reports.pop_front();
+		}
+
+		std::shared_ptr<AnalyticsReportingBackend> backend(m_backend);
+		if (!backend || m_pending_reports.empty())
+			continue;
+
+		backend->Send(SerializeBatch());
+		m_pending_reports.clear();
+
+		if (m_reporter_stop_request.IsSet())
 		{
-			std::shared_ptr<AnalyticsReportingBackend> backend(m_backend);
-
-			if (backend)
-			{
-				std::string report;
-				m_reports_queue.Pop(report);
-				backend->Send(std::move(report));
-			}
-			else
-			{
-				break;
-			}
-
-			// Recheck after each report sent.
-			if (m_reporter_stop_request.IsSet())
-			{
-				return;
-			}
+			return;
 		}
 	}
 }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -47,7 +48,8 @@ class AnalyticsReportingBackend
 {
 public:
 	virtual ~AnalyticsReportingBackend() {}
-	// Called from the AnalyticsReporter backend thread.
+	// Called from the AnalyticsReporter backend thread, with a serialized and
+	// compressed batch of reports (see AnalyticsReporter::SerializeBatch).
 	virtual void Send(std::string report) = 0;
 };
 
@@ -150,6 +152,7 @@ public:
 	void Send(AnalyticsReportBuilder& report) { Send(std::move(report)); }
 protected:
 	void ThreadProc();
+	std::string SerializeBatch();
 
 	std::shared_ptr<AnalyticsReportingBackend> m_backend;
 	AnalyticsReportBuilder m_base_builder;
@@ -158,6 +161,9 @@ protected:
 	Common::Event m_reporter_event;
 	Common::Flag m_reporter_stop_request;
 	FifoQueue<std::string> m_reports_queue;
+	// Reports drained from the queue but not yet shipped, owned by the reporter
+	// thread. Bounded with drop-oldest backpressure; see ThreadProc.
+	std::deque<std::string> m_pending_reports;
 };
 
 // Analytics backend to be used for debugging purpose, which dumps reports to
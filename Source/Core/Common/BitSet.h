@@ -6,6 +6,7 @@
 #include <initializer_list>
 #include <type_traits>
 #include "BitHelpers.h"
+#include "BitUtils.h"
 
 // namespace avoids conflict with OS X Carbon; don't use BitSet<T> directly
 namespace BS
@@ -80,9 +81,10 @@ public:
 			}
 			else
 			{
-				int bit = LeastSignificantSetBit(m_val);
-				m_val &= ~(1 << bit);
-				m_bit = bit;
+				// Clearing via the bit index would truncate the mask to the width
+				// of int and break 64-bit sets; clear the lowest set bit instead.
+				m_bit = LeastSignificantSetBit(m_val);
+				m_val = Common::ClearLowestSetBit(m_val);
 			}
 			return *this;
 		}
@@ -8,6 +8,8 @@
 #include <cstddef>
 #include <type_traits>
 
+#include "Common/BitHelpers.h"
+
 namespace Common
 {
 ///
@@ -99,4 +101,43 @@ constexpr Result ExtractBits(const T src) noexcept
 
 	return ExtractBits<T, Result>(src, begin, end);
 }
+
+///
+/// Isolates the lowest set bit of a value.
+///
+/// @param  value The value to isolate the lowest set bit of.
+///
+/// @tparam T     The type of the value. Must be unsigned.
+///
+/// @return A value with only the lowest set bit of the input set,
+///         or zero if no bits were set.
+///
+template <typename T>
+constexpr T IsolateLowestSetBit(const T value) noexcept
+{
+	static_assert(std::is_unsigned<T>::value, "IsolateLowestSetBit must be used with unsigned types");
+
+	return static_cast<T>(value & (~value + 1));
+}
+
+///
+/// Clears the lowest set bit of a value. Together with
+/// LeastSignificantSetBit this forms the scan step used to walk the set
+/// bits of a wide mask one tzcnt at a time; unlike shifting by the bit
+/// index it stays correct for 64-bit masks.
+///
+/// @param  value The value to clear the lowest set bit of.
+///
+/// @tparam T     The type of the value. Must be unsigned.
+///
+/// @return The input value with its lowest set bit cleared,
+///         or zero if no bits were set.
+///
+template <typename T>
+constexpr T ClearLowestSetBit(const T value) noexcept
+{
+	static_assert(std::is_unsigned<T>::value, "ClearLowestSetBit must be used with unsigned types");
+
+	return static_cast<T>(value & (value - 1));
+}
 }  // namespace Common
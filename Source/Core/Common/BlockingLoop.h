@@ -10,6 +10,8 @@
 
 #include "Common/Event.h"
 #include "Common/Flag.h"
+#include "Common/Thread.h"
+#include "Common/WaitProfiler.h"
 
 namespace Common
 {
@@ -26,6 +28,14 @@ public:
 		m_stopped.Set();
 	}
 
+	// Names this loop's hand-off for adaptive spin tuning and the wait
+	// statistics (see WaitProfiler.h). Call before the first Wait().
+	void SetWaitSiteName(const char* name)
+	{
+		m_wait_site = GetWaitSite(name);
+		m_done_event.SetWaitSite(m_wait_site);
+	}
+
 	~BlockingLoop()
 	{
 		Stop();
@@ -57,6 +67,23 @@ public:
 		if (IsDone())
 			return;
 
+		// Adaptive spin: under heavy hand-off traffic the worker usually
+		// finishes within microseconds, so check for a short while before
+		// paying for the mutex and the kernel wait below. Named loops learn
+		// their spin budget at runtime (see WaitProfiler.h).
+		const u32 spin_limit =
+			m_wait_site ? m_wait_site->spin_limit.load(std::memory_order_relaxed) : 128;
+		for (u32 i = 0; i < spin_limit; i++)
+		{
+			if (IsDone())
+			{
+				if (m_wait_site)
+					m_wait_site->RecordSpinHit(i);
+				return;
+			}
+			YieldCPU();
+		}
+
 		// notifying this event will only wake up one thread, so use a mutex here to
 		// allow only one waiting thread. And in this way, we get an event free wakeup
 		// but for the first thread for free
@@ -242,6 +269,8 @@ private:
 	std::atomic<int> m_running_state; // must be of type RUNNING_TYPE
 
 	Flag m_may_sleep; // If this is set, we fall back from the busy loop to an event based synchronization.
+
+	WaitSite* m_wait_site = nullptr;
 };
 
 }
@@ -16,21 +16,37 @@
 #include <concrt.h>
 #endif
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <mutex>
 
 #include "Common/Flag.h"
+#include "Common/Thread.h"
+#include "Common/Timer.h"
+#include "Common/WaitProfiler.h"
 
 namespace Common {
 
 class Event final
 {
 public:
+	// Attaches a named tuning/statistics site (see WaitProfiler.h). Wait()
+	// then spins adaptively before parking on the condition variable, and the
+	// site collects measured wake latencies. Call before the event is used.
+	void SetWaitSite(WaitSite* site)
+	{
+		m_site = site;
+	}
+
 	void Set()
 	{
 		if (m_flag.TestAndSet())
 		{
+			// Timestamp the signal for a parked waiter, so the waiter can
+			// measure how long the kernel took to get it running again.
+			if (m_site && m_parked.load(std::memory_order_relaxed))
+				m_signal_time.store(Timer::GetTimeUs(), std::memory_order_relaxed);
 			std::lock_guard<std::mutex> lk(m_mutex);
 			m_condvar.notify_one();
 		}
@@ -41,11 +57,39 @@ public:
 		if (m_flag.TestAndClear())
 			return;
 
-		std::unique_lock<std::mutex> lk(m_mutex);
-		m_condvar.wait(lk, [&]
+		if (m_site)
 		{
-			return m_flag.TestAndClear();
-		});
+			// At heavy hand-off cadences the signal usually arrives within
+			// microseconds; burn the learned spin budget before paying for a
+			// kernel wait and its wake latency.
+			const u32 spin_limit = m_site->spin_limit.load(std::memory_order_relaxed);
+			for (u32 i = 0; i < spin_limit; i++)
+			{
+				if (m_flag.TestAndClear())
+				{
+					m_site->RecordSpinHit(i);
+					return;
+				}
+				YieldCPU();
+			}
+			m_signal_time.store(0, std::memory_order_relaxed);
+			m_parked.store(true, std::memory_order_relaxed);
+		}
+
+		{
+			std::unique_lock<std::mutex> lk(m_mutex);
+			m_condvar.wait(lk, [&]
+			{
+				return m_flag.TestAndClear();
+			});
+		}
+
+		if (m_site)
+		{
+			m_parked.store(false, std::memory_order_relaxed);
+			const u64 signal_time = m_signal_time.load(std::memory_order_relaxed);
+			m_site->RecordPark(signal_time != 0 ? Timer::GetTimeUs() - signal_time : 0);
+		}
 	}
 
 	template<class Rep, class Period>
@@ -76,6 +120,10 @@ private:
 	Flag m_flag;
 	std::condition_variable m_condvar;
 	std::mutex m_mutex;
+
+	WaitSite* m_site = nullptr;
+	std::atomic<bool> m_parked{false};
+	std::atomic<u64> m_signal_time{0};
 };
 
 }  // namespace Common
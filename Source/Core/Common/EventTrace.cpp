@@ -0,0 +1,155 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "Common/EventTrace.h"
+#include "Common/FileUtil.h"
+#include "Common/Timer.h"
+
+namespace Common
+{
+namespace Trace
+{
+struct Event
+{
+	const char* name;
+	u64 timestamp;  // usecs, scope begin for 'X'
+	s64 data;       // duration for 'X', value for 'C'
+	u32 tid;
+	char phase;     // chrome trace phase: 'X' complete scope, 'C' counter
+};
+
+// Power of two so the ring wrap is a mask. 256k events cover several seconds
+// of a busy frame loop in 8 MB; older entries are simply overwritten.
+static const u32 RING_SIZE = 1 << 18;
+
+static std::vector<Event> s_events;
+static std::atomic<u32> s_event_count{0};
+static std::atomic<bool> s_enabled{false};
+
+// Thread names are registered once per thread at startup, so a mutex is fine.
+static std::mutex s_thread_names_lock;
+static std::map<u32, std::string> s_thread_names;
+
+// Dense per-thread ids; chrome trace tids only need to be stable and unique.
+static u32 CurrentTid()
+{
+	static std::atomic<u32> s_next_tid{1};
+	static thread_local u32 tid = s_next_tid.fetch_add(1);
+	return tid;
+}
+
+void Start()
+{
+	if (s_enabled.load(std::memory_order_relaxed))
+		return;
+	s_events.resize(RING_SIZE);
+	s_event_count.store(0, std::memory_order_relaxed);
+	s_enabled.store(true, std::memory_order_release);
+}
+
+void Stop()
+{
+	s_enabled.store(false, std::memory_order_release);
+}
+
+bool IsEnabled()
+{
+	return s_enabled.load(std::memory_order_relaxed);
+}
+
+void SetThreadName(const char* name)
+{
+	u32 tid = CurrentTid();
+	std::lock_guard<std::mutex> lk(s_thread_names_lock);
+	s_thread_names[tid] = name;
+}
+
+static void AddEvent(const char* name, u64 timestamp, s64 data, char phase)
+{
+	u32 index = s_event_count.fetch_add(1, std::memory_order_relaxed) & (RING_SIZE - 1);
+	Event& ev = s_events[index];
+	ev.name = name;
+	ev.timestamp = timestamp;
+	ev.data = data;
+	ev.tid = CurrentTid();
+	ev.phase = phase;
+}
+
+void AddCompleteEvent(const char* name, u64 begin, u64 end)
+{
+	if (!IsEnabled())
+		return;
+	AddEvent(name, begin, s64(end - begin), 'X');
+}
+
+void AddCounter(const char* name, s64 value)
+{
+	if (!IsEnabled())
+		return;
+	AddEvent(name, Common::Timer::GetTimeUs(), value, 'C');
+}
+
+bool WriteChromeTrace(const std::string& filename)
+{
+	// Snapshot the count first; recording may still be running, in which case
+	// the slots past the snapshot are simply left out.
+	u32 count = std::min(s_event_count.load(std::memory_order_acquire), RING_SIZE);
+
+	File::IOFile f(filename, "w");
+	if (!f)
+		return false;
+
+	fprintf(f.GetHandle(), "{\"traceEvents\":[\n");
+	{
+		std::lock_guard<std::mutex> lk(s_thread_names_lock);
+		for (const auto& entry : s_thread_names)
+		{
+			fprintf(f.GetHandle(),
+			        "{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_name\","
+			        "\"args\":{\"name\":\"%s\"}},\n",
+			        entry.first, entry.second.c_str());
+		}
+	}
+	for (u32 i = 0; i < count; i++)
+	{
+		const Event& ev = s_events[i];
+		if (ev.phase == 'X')
+		{
+			fprintf(f.GetHandle(),
+			        "{\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%" PRIu64 ",\"dur\":%" PRId64
+			        ",\"name\":\"%s\"}%s\n",
+			        ev.tid, ev.timestamp, ev.data, ev.name, i + 1 < count ? "," : "");
+		}
+		else
+		{
+			fprintf(f.GetHandle(),
+			        "{\"ph\":\"C\",\"pid\":1,\"tid\":%u,\"ts\":%" PRIu64 ",\"name\":\"%s\","
+			        "\"args\":{\"value\":%" PRId64 "}}%s\n",
+			        ev.tid, ev.timestamp, ev.name, ev.data, i + 1 < count ? "," : "");
+		}
+	}
+	fprintf(f.GetHandle(), "]}\n");
+	return true;
+}
+
+ScopedEvent::ScopedEvent(const char* name) : m_name(name), m_begin(0)
+{
+	if (IsEnabled())
+		m_begin = Common::Timer::GetTimeUs();
+}
+
+ScopedEvent::~ScopedEvent()
+{
+	if (m_begin)
+		AddCompleteEvent(m_name, m_begin, Common::Timer::GetTimeUs());
+}
+}
+}
@@ -0,0 +1,63 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// Lightweight cross-thread event tracing. Scopes and counters from the CPU,
+// GPU and audio threads land in one fixed-size ring buffer and can be dumped
+// as a chrome://tracing JSON file, so one timeline shows where every thread
+// spent a frame. Recording an event is an atomic increment plus a few plain
+// stores; when tracing is off the macros cost a single relaxed load.
+//
+// Scopes recorded through Common::Profiler (the PROFILE macro) are mirrored
+// into the trace automatically, so existing instrumentation shows up without
+// any changes.
+namespace Trace
+{
+void Start();
+void Stop();
+bool IsEnabled();
+
+// Associates a human-readable name with the calling thread in the exported
+// timeline. Common::SetCurrentThreadName calls this for you.
+void SetThreadName(const char* name);
+
+// begin/end are Common::Timer::GetTimeUs() timestamps. name must outlive the
+// trace (in practice: a string literal or a Profiler's name).
+void AddCompleteEvent(const char* name, u64 begin, u64 end);
+void AddCounter(const char* name, s64 value);
+
+bool WriteChromeTrace(const std::string& filename);
+
+class ScopedEvent
+{
+public:
+	explicit ScopedEvent(const char* name);
+	~ScopedEvent();
+
+private:
+	const char* m_name;
+	u64 m_begin;
+};
+}
+}
+
+// Records the enclosing scope as one timeline slice on the current thread.
+// name must be a string literal.
+#define TRACE_EVENT(name) Common::Trace::ScopedEvent trace_scoped_event_(name)
+
+// Records the current value of a per-frame statistic; the trace viewer draws
+// these as a graph track.
+#define TRACE_COUNTER(name, value)                                                                 \
+	do                                                                                               \
+	{                                                                                                \
+		if (Common::Trace::IsEnabled())                                                                \
+			Common::Trace::AddCounter(name, static_cast<s64>(value));                                    \
+	} while (0)
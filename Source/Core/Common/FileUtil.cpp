@@ -391,6 +391,21 @@ u64 GetSize(const std::string& filename)
 	return 0;
 }
 
+// Returns the modification time of filename, or 0 on failure
+u64 GetModTime(const std::string& filename)
+{
+	struct stat buf;
+#ifdef _WIN32
+	if (_tstat64(UTF8ToTStr(filename).c_str(), &buf) == 0)
+#else
+	if (stat(filename.c_str(), &buf) == 0)
+#endif
+		return buf.st_mtime;
+
+	WARN_LOG(COMMON, "GetModTime: Stat failed %s: %s", filename.c_str(), GetLastErrorMsg().c_str());
+	return 0;
+}
+
 // Overloaded GetSize, accepts file descriptor
 u64 GetSize(const int fd)
 {
@@ -803,6 +818,8 @@ static void RebuildUserDirectories(unsigned int dir_index)
 			s_user_paths[D_MEMORYWATCHER_IDX] + MEMORYWATCHER_LOCATIONS;
 		s_user_paths[F_MEMORYWATCHERSOCKET_IDX] =
 			s_user_paths[D_MEMORYWATCHER_IDX] + MEMORYWATCHER_SOCKET;
+		s_user_paths[F_MEMORYWATCHERSHM_IDX] =
+			s_user_paths[D_MEMORYWATCHER_IDX] + MEMORYWATCHER_SHM;
 
 		// The shader cache has moved to the cache directory, so remove the old one.
 		// TODO: remove that someday.
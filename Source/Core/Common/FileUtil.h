@@ -65,6 +65,7 @@ enum
 	F_GCSRAM_IDX,
 	F_MEMORYWATCHERLOCATIONS_IDX,
 	F_MEMORYWATCHERSOCKET_IDX,
+	F_MEMORYWATCHERSHM_IDX,
 	F_WIISDCARD_IDX,
 	NUM_PATH_INDICES
 };
@@ -90,6 +91,9 @@ bool IsDirectory(const std::string& filename);
 // Returns the size of filename (64bit)
 u64 GetSize(const std::string& filename);
 
+// Returns the modification time of filename, or 0 on failure
+u64 GetModTime(const std::string& filename);
+
 // Overloaded GetSize, accepts file descriptor
 u64 GetSize(const int fd);
 
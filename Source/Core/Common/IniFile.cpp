@@ -10,6 +10,7 @@
 #include <cstring>
 #include <fstream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -18,6 +19,23 @@
 #include "Common/FileUtil.h"
 #include "Common/StringUtil.h"
 
+namespace
+{
+// Parsed-file cache. The same handful of INIs (Dolphin.ini, GFX.ini, the
+// game-ini layers) are loaded over and over at boot and from the game list;
+// caching the parsed form against size and modification time makes a reload
+// one stat plus a copy instead of a reparse. Guarded by a mutex because the
+// game list scans on worker threads.
+struct CachedIniFile
+{
+	u64 size;
+	u64 mtime;
+	IniFile contents;
+};
+std::mutex s_ini_cache_mutex;
+std::map<std::string, CachedIniFile> s_ini_cache;
+}
+
 void IniFile::ParseLine(const std::string& line, std::string* keyOut, std::string* valueOut)
 {
 	if (line[0] == '#')
@@ -397,6 +415,49 @@ bool IniFile::Load(const std::string& filename, bool keep_current_data)
 {
 	if (!keep_current_data)
 		sections.clear();
+
+	if (!File::Exists(filename))
+		return false;
+
+	const u64 size = File::GetSize(filename);
+	const u64 mtime = File::GetModTime(filename);
+	{
+		std::lock_guard<std::mutex> lk(s_ini_cache_mutex);
+		auto it = s_ini_cache.find(filename);
+		if (it != s_ini_cache.end() && it->second.size == size && it->second.mtime == mtime)
+		{
+			MergeFrom(it->second.contents);
+			return true;
+		}
+	}
+
+	IniFile fresh;
+	if (!ParseFromDisk(filename, &fresh))
+		return false;
+
+	{
+		std::lock_guard<std::mutex> lk(s_ini_cache_mutex);
+		s_ini_cache[filename] = CachedIniFile{ size, mtime, fresh };
+	}
+
+	MergeFrom(fresh);
+	return true;
+}
+
+void IniFile::MergeFrom(const IniFile& other)
+{
+	for (const Section& other_section : other.sections)
+	{
+		Section* section = GetOrCreateSection(other_section.name);
+		for (const std::string& key : other_section.keys_order)
+			section->Set(key, other_section.values.find(key)->second);
+		for (const std::string& line : other_section.m_lines)
+			section->m_lines.push_back(line);
+	}
+}
+
+bool IniFile::ParseFromDisk(const std::string& filename, IniFile* result)
+{
 	// first section consists of the comments before the first real section
 
 	// Open file
@@ -443,7 +504,7 @@ bool IniFile::Load(const std::string& filename, bool keep_current_data)
 				{
 					// New section!
 					std::string sub = line.substr(1, endpos - 1);
-					current_section = GetOrCreateSection(sub);
+					current_section = result->GetOrCreateSection(sub);
 				}
 			}
 			else
@@ -503,7 +564,16 @@ bool IniFile::Save(const std::string& filename)
 
 	out.close();
 
-	return File::RenameSync(temp, filename);
+	if (!File::RenameSync(temp, filename))
+		return false;
+
+	// Drop any cached parse; a rewrite within the same second could otherwise
+	// keep serving the old contents.
+	{
+		std::lock_guard<std::mutex> lk(s_ini_cache_mutex);
+		s_ini_cache.erase(filename);
+	}
+	return true;
 }
 
 // Unit test. TODO: Move to the real unit test framework.
@@ -148,5 +148,8 @@ private:
 	const Section* GetSection(const std::string& section) const;
 	Section* GetSection(const std::string& section);
 
+	static bool ParseFromDisk(const std::string& filename, IniFile* result);
+	void MergeFrom(const IniFile& other);
+
 	static const std::string& NULL_STRING;
 };
@@ -28,6 +28,9 @@
 */
 
 #include <x86intrin.h>
+#ifndef __AVX2__
+#define FUNCTION_TARGET_AVX2 [[gnu::target("avx2")]]
+#endif
 #ifndef __SSE4_2__
 #define FUNCTION_TARGET_SSE42 [[gnu::target("sse4.2")]]
 #endif
@@ -74,6 +77,9 @@
 * version without the macro around a #ifdef guard. Be careful when using intrinsics, as all use
 * should still be placed around a #ifdef _M_X86 if the file is compiled on all architectures.
 */
+#ifndef FUNCTION_TARGET_AVX2
+#define FUNCTION_TARGET_AVX2
+#endif
 #ifndef FUNCTION_TARGET_SSE42
 #define FUNCTION_TARGET_SSE42
 #endif
@@ -79,6 +79,12 @@ void GenericLog(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE type, const char*
 #endif
 	;
 
+// Per-set copy of "enabled ? level : 0", kept up to date by LogManager. The
+// macro below reads it without synchronization so a disabled log site costs a
+// single compare, before any call or argument setup happens; a message raced
+// across a concurrent level change is at worst dropped or admitted once.
+extern volatile unsigned char g_log_level_cache[LogTypes::NUMBER_OF_LOGS];
+
 #if defined LOGGING || defined _DEBUG || defined DEBUGFAST
 #define MAX_LOGLEVEL LogTypes::LOG_LEVELS::LDEBUG
 #else
@@ -87,10 +93,10 @@ void GenericLog(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE type, const char*
 #endif  // loglevel
 #endif  // logging
 
-// Let the compiler optimize this out
+// Let the compiler optimize the levels above MAX_LOGLEVEL out entirely
 #define GENERIC_LOG(t, v, ...)                                                                     \
   {                                                                                                \
-    if (v <= MAX_LOGLEVEL)                                                                         \
+    if (v <= MAX_LOGLEVEL && v <= g_log_level_cache[t])                                            \
       GenericLog(v, t, __FILE__, __LINE__, __VA_ARGS__);                                           \
   }
 
@@ -2,8 +2,10 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <chrono>
 #include <cstdarg>
 #include <cstring>
+#include <ctime>
 #include <mutex>
 #include <ostream>
 #include <set>
@@ -16,6 +18,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/Logging/LogManager.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 #include "Common/Timer.h"
 
 void GenericLog(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE type, const char* file, int line,
@@ -30,6 +33,10 @@ void GenericLog(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE type, const char*
 
 LogManager* LogManager::m_logManager = nullptr;
 
+// Zero-initialized, so every log site is rejected by the macro in Log.h
+// until the LogManager exists (GenericLog dropped those messages anyway).
+volatile unsigned char g_log_level_cache[LogTypes::NUMBER_OF_LOGS];
+
 static size_t DeterminePathCutOffPoint()
 {
 	constexpr const char* pattern = DIR_SEP "Source" DIR_SEP "Core" DIR_SEP;
@@ -114,11 +121,28 @@ LogManager::LogManager()
 			container->AddListener(LogListener::CONSOLE_LISTENER);
 	}
 
+	for (int i = 0; i < LogTypes::NUMBER_OF_LOGS; i++)
+		UpdateLevelCache(static_cast<LogTypes::LOG_TYPE>(i));
+
 	m_path_cutoff_point = DeterminePathCutOffPoint();
+
+	for (size_t i = 0; i < QUEUE_ELEMENTS; i++)
+		m_queue[i].sequence.store(i, std::memory_order_relaxed);
+	m_drain_running.store(true, std::memory_order_release);
+	m_drain_thread = std::thread(&LogManager::DrainThreadFunc, this);
 }
 
 LogManager::~LogManager()
 {
+	// The drain loop only exits once the ring is empty, so pending messages
+	// still reach the listeners before they are torn down below.
+	m_drain_running.store(false, std::memory_order_release);
+	m_drain_wakeup.Set();
+	m_drain_thread.join();
+
+	for (int i = 0; i < LogTypes::NUMBER_OF_LOGS; i++)
+		g_log_level_cache[i] = 0;
+
 	for (LogContainer* container : m_Log)
 		delete container;
 
@@ -127,25 +151,114 @@ LogManager::~LogManager()
 	delete m_listeners[LogListener::FILE_LISTENER];
 }
 
+void LogManager::UpdateLevelCache(LogTypes::LOG_TYPE type)
+{
+	const LogContainer* log = m_Log[type];
+	g_log_level_cache[type] =
+		log->IsEnabled() ? static_cast<unsigned char>(log->GetLevel()) : 0;
+}
+
 void LogManager::Log(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE type, const char* file,
 	int line, const char* format, va_list args)
 {
-	char temp[MAX_MSGLEN];
 	LogContainer* log = m_Log[type];
 
 	if (!log->IsEnabled() || level > log->GetLevel() || !log->HasListeners())
 		return;
 
-	CharArrayFromFormatV(temp, MAX_MSGLEN, format, args);
+	// Claim a ring slot. Each slot's sequence number tells a free slot apart
+	// from one the drain thread has not consumed yet, so producers on any
+	// thread can race for slots without a lock.
+	u64 pos = m_enqueue_pos.load(std::memory_order_relaxed);
+	LogEntry* entry;
+	while (true)
+	{
+		entry = &m_queue[pos & (QUEUE_ELEMENTS - 1)];
+		const s64 dif =
+			static_cast<s64>(entry->sequence.load(std::memory_order_acquire) - pos);
+		if (dif == 0)
+		{
+			if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (dif < 0)
+		{
+			// Ring overflow. Dropping is the lesser evil: blocking here would
+			// stall the very thread whose timing is being examined. The drain
+			// thread reports the loss once it catches up.
+			m_dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		else
+		{
+			pos = m_enqueue_pos.load(std::memory_order_relaxed);
+		}
+	}
+
+	// The message text has to be formatted here - a %s argument may not
+	// outlive the call - but it goes straight into the slot, so the hot path
+	// never allocates. Everything else is raw captures for the drain thread.
+	entry->level = level;
+	entry->type = type;
+	entry->file = file;
+	entry->line = line;
+	time(&entry->ctime);
+	entry->ms = Common::Timer::GetTimeMs() % 1000;
+	CharArrayFromFormatV(entry->message, MAX_MSGLEN, format, args);
+	entry->sequence.store(pos + 1, std::memory_order_release);
 
-	const char* path_to_print = file + m_path_cutoff_point;
+	m_drain_wakeup.Set();
+}
+
+void LogManager::FormatAndRoute(const LogEntry& entry)
+{
+	struct tm* local_time = localtime(&entry.ctime);
+	char timestamp[8];
+	strftime(timestamp, sizeof(timestamp), "%M:%S", local_time);
 
-	std::string msg = StringFromFormat(
-		"%s %s:%u %c[%s]: %s\n", Common::Timer::GetTimeFormatted().c_str(), path_to_print, line,
-		LogTypes::LOG_LEVEL_TO_CHAR[(int)level], log->GetShortName().c_str(), temp);
+	LogContainer* log = m_Log[entry.type];
+	std::string msg = StringFromFormat("%s:%03u %s:%u %c[%s]: %s\n", timestamp, entry.ms,
+		entry.file + m_path_cutoff_point, entry.line, LogTypes::LOG_LEVEL_TO_CHAR[(int)entry.level],
+		log->GetShortName().c_str(), entry.message);
 
 	for (auto listener_id : *log)
-		m_listeners[listener_id]->Log(level, msg.c_str());
+		m_listeners[listener_id]->Log(entry.level, msg.c_str());
+}
+
+void LogManager::DrainThreadFunc()
+{
+	Common::SetCurrentThreadName("Log drain");
+
+	while (true)
+	{
+		LogEntry& entry = m_queue[m_dequeue_pos & (QUEUE_ELEMENTS - 1)];
+		if (static_cast<s64>(entry.sequence.load(std::memory_order_acquire) -
+			(m_dequeue_pos + 1)) >= 0)
+		{
+			FormatAndRoute(entry);
+			// Hand the slot back to the producers.
+			entry.sequence.store(m_dequeue_pos + QUEUE_ELEMENTS, std::memory_order_release);
+			m_dequeue_pos++;
+			continue;
+		}
+
+		// The ring is empty; report any overflow since the last idle phase.
+		const u64 dropped = m_dropped.load(std::memory_order_relaxed);
+		if (dropped != m_dropped_reported)
+		{
+			std::string msg = StringFromFormat(
+				"Log ring overflowed, %llu message(s) dropped\n",
+				static_cast<unsigned long long>(dropped - m_dropped_reported));
+			m_dropped_reported = dropped;
+			for (LogListener* listener : m_listeners)
+				if (listener)
+					listener->Log(LogTypes::LNOTICE, msg.c_str());
+		}
+
+		if (!m_drain_running.load(std::memory_order_acquire))
+			break;
+		m_drain_wakeup.WaitFor(std::chrono::milliseconds(100));
+	}
 }
 
 void LogManager::Init()
@@ -5,14 +5,18 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstdarg>
+#include <ctime>
 #include <fstream>
 #include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 
 #include "Common/BitSet.h"
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
 #include "Common/Logging/Log.h"
 #include "Common/NonCopyable.h"
 
@@ -84,11 +88,42 @@ class ConsoleListener;
 class LogManager : NonCopyable
 {
 private:
+	// A message as captured at the log site. The expensive part of a log
+	// call - building the timestamp and header strings and routing to the
+	// listeners - is deferred to a drain thread; the caller only claims a
+	// slot in a bounded lock-free ring and formats its own text into it.
+	struct LogEntry
+	{
+		// Slot state for the ring below (Vyukov-style bounded queue).
+		std::atomic<u64> sequence;
+		LogTypes::LOG_LEVELS level;
+		LogTypes::LOG_TYPE type;
+		const char* file;  // always a __FILE__ literal, so the pointer stays valid
+		int line;
+		time_t ctime;
+		u32 ms;
+		char message[MAX_MSGLEN];
+	};
+	static constexpr size_t QUEUE_ELEMENTS = 256;  // must be a power of two
+
 	LogContainer* m_Log[LogTypes::NUMBER_OF_LOGS];
 	static LogManager* m_logManager;  // Singleton. Ugh.
 	std::array<LogListener*, LogListener::NUMBER_OF_LISTENERS> m_listeners;
 	size_t m_path_cutoff_point = 0;
 
+	std::array<LogEntry, QUEUE_ELEMENTS> m_queue;
+	std::atomic<u64> m_enqueue_pos{0};
+	u64 m_dequeue_pos = 0;          // drain thread only
+	std::atomic<u64> m_dropped{0};  // messages lost to ring overflow
+	u64 m_dropped_reported = 0;     // drain thread only
+	std::thread m_drain_thread;
+	std::atomic<bool> m_drain_running{false};
+	Common::Event m_drain_wakeup;
+
+	void DrainThreadFunc();
+	void FormatAndRoute(const LogEntry& entry);
+	void UpdateLevelCache(LogTypes::LOG_TYPE type);
+
 	LogManager();
 	~LogManager();
 
@@ -100,9 +135,14 @@ public:
 	void SetLogLevel(LogTypes::LOG_TYPE type, LogTypes::LOG_LEVELS level)
 	{
 		m_Log[type]->SetLevel(level);
+		UpdateLevelCache(type);
 	}
 
-	void SetEnable(LogTypes::LOG_TYPE type, bool enable) { m_Log[type]->SetEnable(enable); }
+	void SetEnable(LogTypes::LOG_TYPE type, bool enable)
+	{
+		m_Log[type]->SetEnable(enable);
+		UpdateLevelCache(type);
+	}
 	bool IsEnabled(LogTypes::LOG_TYPE type, LogTypes::LOG_LEVELS level = LogTypes::LNOTICE) const
 	{
 		return m_Log[type]->IsEnabled() && m_Log[type]->GetLevel() >= level;
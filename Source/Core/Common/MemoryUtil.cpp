@@ -225,6 +225,29 @@ void UnWriteProtectMemory(void* ptr, size_t size, bool allowExecute)
 		PanicAlert("UnWriteProtectMemory failed!\n%s", GetLastErrorMsg().c_str());
 }
 
+void AdviseWillNeed(void* ptr, size_t size)
+{
+#ifdef _WIN32
+	// There is no prefetch call available before Windows 8; the pre-touch pass
+	// in PreTouchMemory covers it.
+#else
+	madvise(ptr, size, MADV_WILLNEED);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+	madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+#endif
+}
+
+void PreTouchMemory(const void* ptr, size_t size)
+{
+	// 4KB covers every platform we run on; on larger page sizes this just reads
+	// the same page a few times.
+	const size_t page_size = 4096;
+	const volatile u8* page = static_cast<const volatile u8*>(ptr);
+	for (size_t offset = 0; offset < size; offset += page_size)
+		(void)page[offset];
+}
+
 std::string MemUsage()
 {
 #ifdef _WIN32
@@ -17,6 +17,12 @@ void FreeAlignedMemory(void* ptr);
 void ReadProtectMemory(void* ptr, size_t size);
 void WriteProtectMemory(void* ptr, size_t size, bool executable = false);
 void UnWriteProtectMemory(void* ptr, size_t size, bool allowExecute = false);
+// Hints to the kernel that the range is about to be accessed, so it can fault
+// pages in (and consider huge pages for them) ahead of use. Best effort.
+void AdviseWillNeed(void* ptr, size_t size);
+// Reads one byte per page of the range, forcing its page-table entries to be
+// established on the calling thread instead of via later soft faults.
+void PreTouchMemory(const void* ptr, size_t size);
 std::string MemUsage();
 size_t MemPhysical();
 
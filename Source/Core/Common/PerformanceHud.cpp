@@ -0,0 +1,116 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <atomic>
+
+#include "Common/StringUtil.h"
+#include "Common/Timer.h"
+#include "Common/PerformanceHud.h"
+
+namespace PerfHud
+{
+static const u32 HISTORY_LENGTH = 120;
+static const u32 BAR_CELLS = 20;
+static const u32 FRAMES_PER_SPARK = 4;
+
+static const char* const s_slot_names[SLOT_COUNT] = {
+	"CPU  ", "Idle ", "JIT  ", "Tex  ", "Draw ", "Audio", "Wait ",
+};
+
+static std::atomic<bool> s_enabled{false};
+static std::atomic<u64> s_current[SLOT_COUNT];
+
+// Written by EndFrame and read by Render, both on the video thread.
+static u32 s_history[SLOT_COUNT][HISTORY_LENGTH];
+static u32 s_history_pos;
+static u64 s_last_frame_time;
+
+bool IsEnabled()
+{
+	return s_enabled.load(std::memory_order_relaxed);
+}
+
+void Toggle()
+{
+	s_enabled.store(!s_enabled.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void AddTime(Slot slot, u64 us)
+{
+	s_current[slot].fetch_add(us, std::memory_order_relaxed);
+}
+
+void EndFrame()
+{
+	// Drain the accumulators even while hidden, so enabling the HUD does not
+	// start with everything that piled up since it was last open.
+	u64 frame[SLOT_COUNT];
+	for (int slot = 0; slot < SLOT_COUNT; slot++)
+		frame[slot] = s_current[slot].exchange(0, std::memory_order_relaxed);
+
+	const u64 now = Common::Timer::GetTimeUs();
+	const u64 interval = s_last_frame_time != 0 ? now - s_last_frame_time : 0;
+	s_last_frame_time = now;
+
+	if (!IsEnabled())
+		return;
+
+	// The CPU thread has no per-frame scope of its own; its busy time is the
+	// frame interval minus what the throttle slept away. SyncGPU waits still
+	// count as busy, so this is an upper bound.
+	frame[SLOT_CPU] = interval > frame[SLOT_CPU_IDLE] ? interval - frame[SLOT_CPU_IDLE] : 0;
+
+	for (int slot = 0; slot < SLOT_COUNT; slot++)
+		s_history[slot][s_history_pos] = (u32)std::min<u64>(frame[slot], 0xFFFFFFFFull);
+	s_history_pos = (s_history_pos + 1) % HISTORY_LENGTH;
+}
+
+std::string Render(u32 target_refresh_rate)
+{
+	const u32 budget_us = target_refresh_rate != 0 ? 1000000 / target_refresh_rate : 16667;
+	static const char ramp[] = " .:-=+*#%@";
+
+	std::string str = "\n";
+	for (int slot = 0; slot < SLOT_COUNT; slot++)
+	{
+		const u32 last = s_history[slot][(s_history_pos + HISTORY_LENGTH - 1) % HISTORY_LENGTH];
+
+		// A full bar is one frame budget; '+' flags overruns.
+		char bar[BAR_CELLS + 2];
+		const u32 cells = std::min<u32>((u32)((u64)last * BAR_CELLS / budget_us), BAR_CELLS);
+		for (u32 i = 0; i < BAR_CELLS; i++)
+			bar[i] = i < cells ? '=' : ' ';
+		bar[BAR_CELLS] = last > budget_us ? '+' : ' ';
+		bar[BAR_CELLS + 1] = '\0';
+
+		// Sparkline, oldest frame first, showing the worst frame of each group
+		// so single hitches cannot hide in the downsampling.
+		std::string spark;
+		for (u32 group = 0; group < HISTORY_LENGTH; group += FRAMES_PER_SPARK)
+		{
+			u32 worst = 0;
+			for (u32 i = 0; i < FRAMES_PER_SPARK; i++)
+				worst = std::max(worst, s_history[slot][(s_history_pos + group + i) % HISTORY_LENGTH]);
+			spark += ramp[std::min<u32>((u32)((u64)worst * 9 / budget_us), 9)];
+		}
+
+		str += StringFromFormat("%s %6.2fms [%s] %s\n", s_slot_names[slot], last / 1000.0, bar,
+			spark.c_str());
+	}
+	return str;
+}
+
+ScopedTimer::ScopedTimer(Slot slot) : m_slot(slot), m_begin(0)
+{
+	if (IsEnabled())
+		m_begin = Common::Timer::GetTimeUs();
+}
+
+ScopedTimer::~ScopedTimer()
+{
+	if (m_begin != 0)
+		AddTime(m_slot, Common::Timer::GetTimeUs() - m_begin);
+}
+}  // namespace PerfHud
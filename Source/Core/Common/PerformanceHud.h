@@ -0,0 +1,54 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// Text performance HUD rendered through the debug text overlay: one bar per
+// subsystem showing its share of the frame budget, plus a sparkline over the
+// last 120 frames so a single hitch stays visible for a couple of seconds.
+// Subsystems report measured times from their own threads; reporting is a
+// relaxed atomic add, and a single load when the HUD is hidden.
+namespace PerfHud
+{
+enum Slot
+{
+	SLOT_CPU = 0,       // CPU thread busy time (frame interval minus throttle sleep)
+	SLOT_CPU_IDLE,      // time the CPU thread slept in the throttle
+	SLOT_JIT,           // JIT block compilation
+	SLOT_TEXTURE,       // texture decode + upload
+	SLOT_DRAW,          // video thread present (SwapImpl)
+	SLOT_AUDIO,         // audio mixing
+	SLOT_PRESENT_WAIT,  // frame pacer wait before the present
+	SLOT_COUNT
+};
+
+bool IsEnabled();
+void Toggle();
+
+// Adds us microseconds to this frame's bucket for the slot. Thread-safe.
+void AddTime(Slot slot, u64 us);
+
+// Rotates the accumulators into the history. Once per presented frame, video
+// thread only.
+void EndFrame();
+
+// Builds the HUD text block. Video thread only.
+std::string Render(u32 target_refresh_rate);
+
+// Times the enclosing scope into a slot when the HUD is visible.
+class ScopedTimer
+{
+public:
+	explicit ScopedTimer(Slot slot);
+	~ScopedTimer();
+
+private:
+	Slot m_slot;
+	u64 m_begin;  // 0 when the HUD is hidden
+};
+}  // namespace PerfHud
@@ -10,6 +10,7 @@
 #include <ios>
 #include <sstream>
 
+#include "Common/EventTrace.h"
 #include "Common/Profiler.h"
 #include "Common/Timer.h"
 
@@ -108,6 +109,10 @@ void Profiler::Stop()
 
 		u64 diff = end - m_time;
 
+		// Mirror the scope into the event trace so PROFILE sites show up on
+		// the timeline without their own instrumentation.
+		Trace::AddCompleteEvent(m_name.c_str(), m_time, end);
+
 		m_usecs += diff;
 		m_usecs_min = std::min(m_usecs_min, diff);
 		m_usecs_max = std::max(m_usecs_max, diff);
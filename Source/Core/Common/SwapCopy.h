@@ -0,0 +1,78 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+
+#include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
+#include "Common/Swap.h"
+
+namespace Common
+{
+// Byteswapping copies for bulk big-endian transfers (DSP parameter blocks,
+// DMA-style consumers). dst and src must not overlap. On x86 these swap
+// 16 bytes per iteration with SSE2 instead of one element at a time; the
+// scalar loop handles the tail (and everything on other architectures).
+
+inline void CopySwapped(u16* dst, const u16* src, size_t count)
+{
+	size_t i = 0;
+#if defined(_M_X86)
+	for (; i + 8 <= count; i += 8)
+	{
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+		v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+	}
+#endif
+	for (; i < count; i++)
+		dst[i] = swap16(src[i]);
+}
+
+inline void CopySwapped(u32* dst, const u32* src, size_t count)
+{
+	size_t i = 0;
+#if defined(_M_X86)
+	for (; i + 4 <= count; i += 4)
+	{
+		// Swap the bytes within each 16-bit lane, then the 16-bit halves
+		// within each 32-bit lane; together that is a full 32-bit byteswap.
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+		v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+		v = _mm_or_si128(_mm_slli_epi32(v, 16), _mm_srli_epi32(v, 16));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+	}
+#endif
+	for (; i < count; i++)
+		dst[i] = swap32(src[i]);
+}
+
+inline void CopySwapped(u64* dst, const u64* src, size_t count)
+{
+	size_t i = 0;
+#if defined(_M_X86)
+	for (; i + 2 <= count; i += 2)
+	{
+		// As above, but reverse the four 16-bit units of each 64-bit lane.
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+		v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+		v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+		v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+	}
+#endif
+	for (; i < count; i++)
+		dst[i] = swap64(src[i]);
+}
+
+// Fallback for any other element type.
+template <typename T>
+void CopySwapped(T* dst, const T* src, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+		dst[i] = FromBigEndian(src[i]);
+}
+}  // Namespace Common
@@ -2,6 +2,7 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <cstring>
 #include <map>
 #include <string>
@@ -26,6 +27,39 @@ void SymbolDB::Clear(const char* prefix)
 	// TODO: honor prefix
 	functions.clear();
 	checksumToFunction.clear();
+	m_address_index.clear();
+	m_address_index_dirty = true;
+}
+
+void SymbolDB::RebuildAddressIndex()
+{
+	m_address_index.clear();
+	m_address_index.reserve(functions.size());
+	// `functions` is keyed by start address, so the index comes out sorted.
+	for (auto& func : functions)
+	{
+		Symbol& symbol = func.second;
+		const u32 size = symbol.size > 0 ? (u32)symbol.size : 4;
+		m_address_index.push_back({symbol.address, symbol.address + size, &symbol});
+	}
+	m_address_index_dirty = false;
+}
+
+Symbol* SymbolDB::LookupAddressIndex(u32 addr)
+{
+	if (m_address_index_dirty)
+		RebuildAddressIndex();
+
+	// Find the first range starting past addr; the one before it is the only
+	// candidate that can contain it.
+	auto iter = std::upper_bound(m_address_index.begin(), m_address_index.end(), addr,
+		[](u32 a, const AddressRange& range) { return a < range.start; });
+	if (iter == m_address_index.begin())
+		return nullptr;
+	--iter;
+	if (addr < iter->end)
+		return iter->symbol;
+	return nullptr;
 }
 
 void SymbolDB::Index()
@@ -83,4 +117,5 @@ std::vector<Symbol*> SymbolDB::GetSymbolsFromHash(u32 hash)
 void SymbolDB::AddCompleteSymbol(const Symbol& symbol)
 {
 	functions.emplace(symbol.address, symbol);
+	m_address_index_dirty = true;
 }
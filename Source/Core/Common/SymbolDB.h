@@ -64,6 +64,21 @@ protected:
 	XFuncMap functions;
 	XFuncPtrMap checksumToFunction;
 
+	// Flat, sorted address-range view of `functions`, rebuilt lazily after
+	// mutations. Containment queries (which function covers this address?)
+	// binary-search it instead of walking the whole map.
+	struct AddressRange
+	{
+		u32 start;
+		u32 end;  // exclusive
+		Symbol* symbol;
+	};
+	std::vector<AddressRange> m_address_index;
+	bool m_address_index_dirty = true;
+
+	void RebuildAddressIndex();
+	Symbol* LookupAddressIndex(u32 addr);
+
 public:
 	SymbolDB() {}
 	virtual ~SymbolDB() {}
@@ -5,6 +5,7 @@
 #include "Common/Thread.h"
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
+#include "Common/EventTrace.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -93,6 +94,7 @@ void SetCurrentThreadName(const char* szThreadName)
 	__except (EXCEPTION_CONTINUE_EXECUTION)
 	{
 	}
+	Trace::SetThreadName(szThreadName);
 }
 
 #else  // !WIN32, so must be POSIX threads
@@ -149,6 +151,7 @@ void SetCurrentThreadName(const char* szThreadName)
 	// API.
 	__itt_thread_set_name(szThreadName);
 #endif
+	Trace::SetThreadName(szThreadName);
 }
 
 #endif
@@ -153,4 +153,65 @@ void AsyncWorker::ExecuteAsync(std::function<void()> &&func)
 	ThreadPool::NotifyWorkPending();
 }
 
+void OrderedWorkBatch::Add(std::function<void()> &&work, std::function<void()> &&commit)
+{
+	Job job;
+	job.work = std::move(work);
+	job.commit = std::move(commit);
+	m_jobs.push_back(std::move(job));
+}
+
+void OrderedWorkBatch::RunPending(State &state)
+{
+	const s32 count = (s32)state.jobs.size();
+	while (true)
+	{
+		s32 index = state.nextjob.fetch_add(1);
+		if (index >= count)
+			break;
+		if (state.jobs[index].work)
+			state.jobs[index].work();
+		state.done[index].store(1, std::memory_order_release);
+	}
+}
+
+void OrderedWorkBatch::Run()
+{
+	const s32 count = (s32)m_jobs.size();
+	if (count == 0)
+		return;
+	std::shared_ptr<State> state = std::make_shared<State>();
+	state->jobs = std::move(m_jobs);
+	m_jobs.clear();
+	state->done.reset(new std::atomic<s32>[count]);
+	for (s32 i = 0; i < count; i++)
+	{
+		state->done[i].store(0);
+	}
+	state->nextjob.store(0);
+	// One runner per job beyond the one the caller claims, capped at the
+	// machine width; surplus runners find the counter exhausted and return.
+	s32 runners = count - 1;
+	s32 maxrunners = cpu_info.logical_cpu_count;
+	runners = runners > maxrunners ? maxrunners : runners;
+	for (s32 i = 0; i < runners; i++)
+	{
+		AsyncWorker::ExecuteAsync([state]()
+		{
+			RunPending(*state);
+		});
+	}
+	RunPending(*state);
+	for (s32 i = 0; i < count; i++)
+	{
+		size_t loopcount = 0;
+		while (state->done[i].load(std::memory_order_acquire) == 0)
+		{
+			cYield(loopcount++);
+		}
+		if (state->jobs[i].commit)
+			state->jobs[i].commit();
+	}
+}
+
 
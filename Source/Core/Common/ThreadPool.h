@@ -31,6 +31,7 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <vector>
 #include "Common/Thread.h"
@@ -469,4 +470,39 @@ public:
 	bool NextTask() override;
 	static void ExecuteAsync(std::function<void()> &&func);
 };
+
+// A batch of jobs whose side effects must land in a fixed order no matter how
+// many pool workers pick them up (or none at all). Work functions are claimed
+// through a shared counter and may run out of order into private state; Run()
+// then replays the commit functions on the calling thread in Add() order, so
+// the observable result is identical across any worker count. That is the
+// property netplay needs before a decode/mix stage may go parallel.
+class OrderedWorkBatch final
+{
+public:
+	// work may run on any thread; commit runs on the Run() caller, in Add()
+	// order. Either may be empty.
+	void Add(std::function<void()> &&work, std::function<void()> &&commit);
+	// Executes all queued jobs (the caller participates, so an empty or busy
+	// pool only costs parallelism) and commits them in order. The batch is
+	// empty again when this returns and can be refilled.
+	void Run();
+private:
+	struct Job
+	{
+		std::function<void()> work;
+		std::function<void()> commit;
+	};
+	// Each Run() hands its jobs to a state block owned jointly with the pool
+	// runners, so a runner that gets dequeued after the batch is gone only
+	// finds an exhausted claim counter.
+	struct State
+	{
+		std::vector<Job> jobs;
+		std::unique_ptr<std::atomic<s32>[]> done;
+		std::atomic<s32> nextjob;
+	};
+	static void RunPending(State &state);
+	std::vector<Job> m_jobs;
+};
 }
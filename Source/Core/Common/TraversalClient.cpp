@@ -310,7 +310,7 @@ bool EnsureTraversalClient(const std::string& server, u16 server_port, u16 liste
 		ENetAddress addr = { ENET_HOST_ANY, listen_port };
 		ENetHost* host = enet_host_create(&addr,  // address
 			50,     // peerCount
-			1,      // channelLimit
+			3,      // channelLimit - must cover netplay's CHANNEL_COUNT
 			0,      // incomingBandwidth
 			0);     // outgoingBandwidth
 		if (!host)
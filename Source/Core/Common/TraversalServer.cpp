@@ -19,9 +19,19 @@
 
 #define DEBUG 0
 #define NUMBER_OF_TRIES 5
+#define NUMBER_OF_PACKET_TYPES 8
+#define CLIENT_EXPIRY_TIME 30000000 // 30s
+#define SWEEP_INTERVAL 5000000 // 5s
+#define STATS_INTERVAL 60000000 // 60s
 
 static u64 currentTime;
 
+static u64 statPacketsReceived[NUMBER_OF_PACKET_TYPES];
+static u64 statPacketsDropped[NUMBER_OF_PACKET_TYPES];
+static u64 statHandleTime[NUMBER_OF_PACKET_TYPES];
+static u64 statShortPackets;
+static u64 statExpiredClients;
+
 struct OutgoingPacketInfo
 {
 	TraversalPacket packet;
@@ -48,28 +58,22 @@ struct EvictFindResult
 template <typename K, typename V>
 EvictFindResult<V> EvictFind(std::unordered_map<K, EvictEntry<V>>& map, const K& key, bool refresh = false)
 {
-	retry:
-	const u64 expiryTime = 30 * 1000000; // 30s
 	EvictFindResult<V> result;
-	if (map.bucket_count())
+	auto it = map.find(key);
+	if (it != map.end())
 	{
-		auto bucket = map.bucket(key);
-		auto it = map.begin(bucket);
-		for (; it != map.end(bucket); ++it)
+		if (currentTime - it->second.updateTime > CLIENT_EXPIRY_TIME)
 		{
-			if (currentTime - it->second.updateTime > expiryTime)
-			{
-				map.erase(it->first);
-				goto retry;
-			}
-			if (it->first == key)
-			{
-				if (refresh)
-					it->second.updateTime = currentTime;
-				result.found = true;
-				result.value = &it->second.value;
-				return result;
-			}
+			// expired but not yet reclaimed by the periodic sweep
+			map.erase(it);
+		}
+		else
+		{
+			if (refresh)
+				it->second.updateTime = currentTime;
+			result.found = true;
+			result.value = &it->second.value;
+			return result;
 		}
 	}
 #if DEBUG
@@ -92,6 +96,26 @@ V* EvictSet(std::unordered_map<K, EvictEntry<V>>& map, const K& key)
 	return &result.value;
 }
 
+// Reclaims every expired entry in one pass.  EvictFind only drops an expired
+// entry when its exact key is looked up again, so without this sweep a client
+// that stops pinging and is never connected to would stay in the table forever.
+template <typename K, typename V>
+static void EvictSweep(std::unordered_map<K, EvictEntry<V>>& map)
+{
+	for (auto it = map.begin(); it != map.end();)
+	{
+		if (currentTime - it->second.updateTime > CLIENT_EXPIRY_TIME)
+		{
+			statExpiredClients++;
+			it = map.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+
 namespace std
 {
 	template <>
@@ -268,11 +292,32 @@ static void ResendPackets()
 	}
 }
 
+static void PrintStats()
+{
+	static const char* typeNames[NUMBER_OF_PACKET_TYPES] = {
+		"Ack", "Ping", "HelloFromClient", "HelloFromServer",
+		"ConnectPlease", "PleaseSendPacket", "ConnectReady", "ConnectFailed",
+	};
+	printf("stats: %zu clients connected, %zu packets in flight, %llu clients expired, %llu short packets\n",
+		   connectedClients.size(), outgoingPackets.size(),
+		   (long long) statExpiredClients, (long long) statShortPackets);
+	for (int type = 0; type < NUMBER_OF_PACKET_TYPES; type++)
+	{
+		if (!statPacketsReceived[type])
+			continue;
+		printf("stats: %s: %llu received, %llu dropped, %llu us handling\n",
+			   typeNames[type], (long long) statPacketsReceived[type],
+			   (long long) statPacketsDropped[type], (long long) statHandleTime[type]);
+	}
+}
+
 static void HandlePacket(TraversalPacket* packet, sockaddr_in6* addr)
 {
 #if DEBUG
 	printf("<- %d %llu %s\n", packet->type, (long long)packet->requestId, SenderName(addr));
 #endif
+	if (packet->type < NUMBER_OF_PACKET_TYPES)
+		statPacketsReceived[packet->type]++;
 	bool packetOk = true;
 	switch (packet->type)
 	{
@@ -280,7 +325,10 @@ static void HandlePacket(TraversalPacket* packet, sockaddr_in6* addr)
 			{
 			auto it = outgoingPackets.find(packet->requestId);
 			if (it == outgoingPackets.end())
+			{
+				statPacketsDropped[TraversalPacketAck]++;
 				break;
+			}
 
 			OutgoingPacketInfo* info = &it->second;
 
@@ -308,6 +356,8 @@ static void HandlePacket(TraversalPacket* packet, sockaddr_in6* addr)
 		{
 		auto r = EvictFind(connectedClients, packet->ping.hostId, true);
 		packetOk = r.found;
+		if (!r.found)
+			statPacketsDropped[TraversalPacketPing]++;
 		break;
 		}
 	case TraversalPacketHelloFromClient:
@@ -346,6 +396,7 @@ static void HandlePacket(TraversalPacket* packet, sockaddr_in6* addr)
 		auto r = EvictFind(connectedClients, hostId);
 		if (!r.found)
 		{
+			statPacketsDropped[TraversalPacketConnectPlease]++;
 			TraversalPacket* reply = AllocPacket(*addr);
 			reply->type = TraversalPacketConnectFailed;
 			reply->connectFailed.requestId = packet->requestId;
@@ -361,6 +412,8 @@ static void HandlePacket(TraversalPacket* packet, sockaddr_in6* addr)
 		}
 	default:
 		fprintf(stderr, "received unknown packet type %d from %s\n", packet->type, SenderName(addr));
+		if (packet->type < NUMBER_OF_PACKET_TYPES)
+			statPacketsDropped[packet->type]++;
 	}
 	if (packet->type != TraversalPacketAck)
 	{
@@ -424,6 +477,15 @@ int main()
 		return 1;
 	}
 
+	if (gettimeofday(&tv, nullptr) < 0)
+	{
+		perror("gettimeofday");
+		return 1;
+	}
+	currentTime = (u64) tv.tv_sec * 1000000 + tv.tv_usec;
+	u64 lastSweepTime = currentTime;
+	u64 lastStatsTime = currentTime;
+
 	while (true)
 	{
 		sockaddr_in6 raddr;
@@ -448,12 +510,25 @@ int main()
 		}
 		else if ((size_t) rv < sizeof(packet))
 		{
+			statShortPackets++;
 			fprintf(stderr, "received short packet from %s\n", SenderName(&raddr));
 		}
 		else
 		{
 			HandlePacket(&packet, &raddr);
+			if (packet.type < NUMBER_OF_PACKET_TYPES && gettimeofday(&tv, nullptr) == 0)
+				statHandleTime[packet.type] += (u64) tv.tv_sec * 1000000 + tv.tv_usec - currentTime;
 		}
 		ResendPackets();
+		if (currentTime - lastSweepTime >= SWEEP_INTERVAL)
+		{
+			EvictSweep(connectedClients);
+			lastSweepTime = currentTime;
+		}
+		if (currentTime - lastStatsTime >= STATS_INTERVAL)
+		{
+			PrintStats();
+			lastStatsTime = currentTime;
+		}
 	}
 }
@@ -0,0 +1,63 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "Common/StringUtil.h"
+#include "Common/WaitProfiler.h"
+
+namespace Common
+{
+static std::mutex s_wait_site_lock;
+
+static std::map<std::string, WaitSite*>& GetSiteMap()
+{
+	// Leaked on purpose: waits can still be in flight during static teardown.
+	static auto* const sites = new std::map<std::string, WaitSite*>();
+	return *sites;
+}
+
+WaitSite* GetWaitSite(const char* name)
+{
+	std::lock_guard<std::mutex> lk(s_wait_site_lock);
+	auto& sites = GetSiteMap();
+	auto iter = sites.find(name);
+	if (iter == sites.end())
+		iter = sites.emplace(name, new WaitSite(name)).first;
+	return iter->second;
+}
+
+std::string GetWaitStatistics()
+{
+	std::vector<WaitSite*> sites;
+	{
+		std::lock_guard<std::mutex> lk(s_wait_site_lock);
+		for (const auto& entry : GetSiteMap())
+			sites.push_back(entry.second);
+	}
+	std::sort(sites.begin(), sites.end(), [](const WaitSite* a, const WaitSite* b) {
+		return a->max_wake_latency_us.load(std::memory_order_relaxed) >
+			b->max_wake_latency_us.load(std::memory_order_relaxed);
+	});
+
+	std::string str = "Wait sites (worst wake latency first):\n";
+	for (const WaitSite* site : sites)
+	{
+		const u64 waits = site->waits.load(std::memory_order_relaxed);
+		const u64 parks = site->parks.load(std::memory_order_relaxed);
+		const u64 timed = site->timed_parks.load(std::memory_order_relaxed);
+		str += StringFromFormat(
+			"%s: %llu waits, %llu parked, avg wake %llu us, max wake %llu us, spin limit %u\n",
+			site->name, (unsigned long long)waits, (unsigned long long)parks,
+			(unsigned long long)(timed ?
+				site->total_wake_latency_us.load(std::memory_order_relaxed) / timed : 0),
+			(unsigned long long)site->max_wake_latency_us.load(std::memory_order_relaxed),
+			site->spin_limit.load(std::memory_order_relaxed));
+	}
+	return str;
+}
+}  // namespace Common
@@ -0,0 +1,81 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <atomic>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// Per-call-site state for the adaptive spin-then-park waits in Event and
+// BlockingLoop. Each named hand-off (Fifo SyncGPU, the audio stretch worker,
+// ...) gets its own site, whose spin budget is tuned at runtime: spinning
+// that consistently catches the hand-off early shrinks the budget, having to
+// park in the kernel grows it. The same site also collects measured wake
+// latencies (signaller timestamp to waiter resume) so the hand-offs hurting
+// the frame budget can be named instead of guessed at.
+//
+// Sites are interned by name and never freed, so raw pointers to them are
+// safe to cache anywhere.
+struct WaitSite
+{
+	explicit WaitSite(const char* name_) : name(name_) {}
+
+	static const u32 SPIN_LIMIT_MIN = 32;
+	static const u32 SPIN_LIMIT_MAX = 8192;
+
+	// Spinning observed the hand-off after iters iterations. Shrink the limit
+	// when far less than the current budget keeps being enough.
+	void RecordSpinHit(u32 iters)
+	{
+		waits.fetch_add(1, std::memory_order_relaxed);
+		spin_hits.fetch_add(1, std::memory_order_relaxed);
+		const u32 limit = spin_limit.load(std::memory_order_relaxed);
+		if (iters * 4 < limit && limit > SPIN_LIMIT_MIN)
+			spin_limit.store(limit - (limit >> 3), std::memory_order_relaxed);
+	}
+
+	// Spinning gave up and the wait went to the kernel. wake_latency_us is the
+	// measured signal-to-resume time, or 0 when the signal raced the park and
+	// no timestamp was taken. Grow the limit so the next waits have a better
+	// chance of catching the hand-off while still spinning.
+	void RecordPark(u64 wake_latency_us)
+	{
+		waits.fetch_add(1, std::memory_order_relaxed);
+		parks.fetch_add(1, std::memory_order_relaxed);
+		const u32 limit = spin_limit.load(std::memory_order_relaxed);
+		if (limit < SPIN_LIMIT_MAX)
+			spin_limit.store(limit + (limit >> 1) + 16, std::memory_order_relaxed);
+
+		if (wake_latency_us == 0)
+			return;
+		timed_parks.fetch_add(1, std::memory_order_relaxed);
+		total_wake_latency_us.fetch_add(wake_latency_us, std::memory_order_relaxed);
+		u64 prev = max_wake_latency_us.load(std::memory_order_relaxed);
+		while (wake_latency_us > prev &&
+			!max_wake_latency_us.compare_exchange_weak(prev, wake_latency_us,
+				std::memory_order_relaxed))
+		{
+		}
+	}
+
+	const char* name;
+	std::atomic<u32> spin_limit{SPIN_LIMIT_MIN};
+	std::atomic<u64> waits{0};
+	std::atomic<u64> spin_hits{0};
+	std::atomic<u64> parks{0};
+	std::atomic<u64> timed_parks{0};
+	std::atomic<u64> total_wake_latency_us{0};
+	std::atomic<u64> max_wake_latency_us{0};
+};
+
+// Returns the site registered under this name, creating it on first use.
+WaitSite* GetWaitSite(const char* name);
+
+// One line per site, worst measured wake latency first.
+std::string GetWaitStatistics();
+}  // namespace Common
@@ -44,12 +44,15 @@ static inline void __cpuid(int info[4], int function_id)
 }
 
 #define _XCR_XFEATURE_ENABLED_MASK 0
-static u64 _xgetbv(u32 index)
+// Renamed to avoid clashing with the _xgetbv intrinsic newer GCC provides
+// unconditionally.
+static u64 dolphin_xgetbv(u32 index)
 {
 	u32 eax, edx;
 	__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
 	return ((u64)edx << 32) | eax;
 }
+#define _xgetbv dolphin_xgetbv
 
 #endif // ifndef _WIN32
 
@@ -1148,6 +1148,19 @@ public:
 		ABI_CallFunction(func);
 	}
 
+	template <typename FunctionPointer>
+	void ABI_CallFunctionPCA(int bits, FunctionPointer func, const void* param1, u32 param2,
+		const Gen::OpArg& arg3)
+	{
+		// Move arg3 first, as it might be held in one of the other parameter
+		// registers.
+		if (!arg3.IsSimpleReg(ABI_PARAM3))
+			MOV(bits, R(ABI_PARAM3), arg3);
+		MOV(64, R(ABI_PARAM1), Imm64(reinterpret_cast<u64>(param1)));
+		MOV(32, R(ABI_PARAM2), Imm32(param2));
+		ABI_CallFunction(func);
+	}
+
 	// Helper method for ABI functions related to calling functions. May be used by itself as well.
 	void MOVTwo(int bits, X64Reg dst1, X64Reg src1, s32 offset, X64Reg dst2, X64Reg src2);
 
@@ -1176,6 +1189,14 @@ public:
 		auto trampoline = &XEmitter::CallLambdaTrampoline<T, Args...>;
 		ABI_CallFunctionPC(trampoline, reinterpret_cast<const void*>(f), p1);
 	}
+
+	template <typename T, typename... Args>
+	void ABI_CallLambdaCA(int bits, const std::function<T(Args...)>* f, u32 p1,
+		const Gen::OpArg& arg2)
+	{
+		auto trampoline = &XEmitter::CallLambdaTrampoline<T, Args...>;
+		ABI_CallFunctionPCA(bits, trampoline, reinterpret_cast<const void*>(f), p1, arg2);
+	}
 };  // class XEmitter
 
 class X64CodeBlock : public CodeBlock<XEmitter>
@@ -106,6 +106,24 @@ struct ARAddr
 	operator u32() const { return address; }
 };
 
+// Most codes are nothing but plain RAM writes or fills. Classifying them once
+// on activation lets RunCodeLocked skip the per-line decoding (zero codes,
+// conditionals, fill & slide) on every subsequent frame.
+static bool IsSimpleRamWriteCode(const ARCode& code)
+{
+	for (const AREntry& entry : code.ops)
+	{
+		const ARAddr addr(entry.cmd_addr);
+		if (addr == 0)  // zero code
+			return false;
+		if (addr >= 0x00002000 && addr < 0x00003000)  // AR self modification
+			return false;
+		if (addr.type != 0x00 || addr.subtype != SUB_RAM_WRITE)
+			return false;
+	}
+	return !code.ops.empty();
+}
+
 // ----------------------
 // AR Remote Functions
 void ApplyCodes(const std::vector<ARCode>& codes)
@@ -119,6 +137,9 @@ void ApplyCodes(const std::vector<ARCode>& codes)
 	std::copy_if(codes.begin(), codes.end(), std::back_inserter(s_active_codes),
 		[](const ARCode& code) { return code.active; });
 	s_active_codes.shrink_to_fit();
+
+	for (ARCode& code : s_active_codes)
+		code.simple_ram_writes = IsSimpleRamWriteCode(code);
 }
 
 void AddCode(ARCode code)
@@ -128,6 +149,7 @@ void AddCode(ARCode code)
 
 	if (code.active)
 	{
+		code.simple_ram_writes = IsSimpleRamWriteCode(code);
 		std::lock_guard<std::mutex> guard(s_lock);
 		s_disable_logging = false;
 		s_active_codes.emplace_back(std::move(code));
@@ -787,6 +809,18 @@ static bool RunCodeLocked(const ARCode& arcode)
 
 	s_current_code = &arcode;
 
+	// Once logging is off (after the first frame), codes classified as plain
+	// RAM writes skip the per-line decoding below entirely.
+	if (arcode.simple_ram_writes && s_disable_logging)
+	{
+		for (const AREntry& entry : arcode.ops)
+		{
+			if (!Subtype_RamWriteAndFill(ARAddr(entry.cmd_addr), entry.value))
+				return false;
+		}
+		return true;
+	}
+
 	LogInfo("Code Name: %s", arcode.name.c_str());
 	LogInfo("Number of codes: %zu", arcode.ops.size());
 
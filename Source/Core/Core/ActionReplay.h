@@ -30,6 +30,9 @@ struct ARCode
 	std::vector<AREntry> ops;
 	bool active;
 	bool user_defined;
+	// Cached on activation: every op is a plain RAM write/fill, so the
+	// interpreter can take a fast path which skips per-line decoding.
+	bool simple_ram_writes = false;
 };
 
 void RunAllActive();
@@ -34,9 +34,12 @@
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/PowerPC/SignatureDB/SignatureDB.h"
 
+#include "Common/ThreadPool.h"
+
 #include "DiscIO/Enums.h"
 #include "DiscIO/NANDContentLoader.h"
 #include "DiscIO/Volume.h"
+#include "DiscIO/VolumeCreator.h"
 
 bool CBoot::DVDRead(u64 dvd_offset, u32 output_address, u32 length, bool decrypt)
 {
@@ -47,6 +50,55 @@ bool CBoot::DVDRead(u64 dvd_offset, u32 output_address, u32 length, bool decrypt
 	return true;
 }
 
+void CBoot::PrefetchVolume(const std::string& filename)
+{
+	Common::AsyncWorker::ExecuteAsync(std::function<void()>([filename]() {
+		// A private reader: DVDInterface may not have opened the volume yet,
+		// and this way there is no shared state to lock. The reads here only
+		// matter for their side effect of pulling the file's blocks into the
+		// OS cache, which the real boot reads then hit.
+		std::unique_ptr<DiscIO::IVolume> volume = DiscIO::CreateVolumeFromFilename(filename);
+		if (!volume)
+			return;
+
+		const bool is_wii = volume->GetVolumeType() == DiscIO::Platform::WII_DISC;
+		const u32 shift = is_wii ? 2 : 0;
+
+		std::vector<u8> buffer;
+		const auto prefetch = [&](u64 offset, u64 size) {
+			// Bound each extent so a corrupt header can't make us slurp the
+			// whole image.
+			static constexpr u64 MAX_PREFETCH_SIZE = 16 * 1024 * 1024;
+			size = std::min(size, MAX_PREFETCH_SIZE);
+			if (size == 0)
+				return;
+			buffer.resize(size);
+			volume->Read(offset, size, buffer.data(), is_wii);
+		};
+
+		// Disc header, then the apploader right behind it.
+		u32 apploader_size = 0;
+		u32 trailer_size = 0;
+		volume->ReadSwapped(0x2454, &apploader_size, is_wii);
+		volume->ReadSwapped(0x2458, &trailer_size, is_wii);
+		prefetch(0, 0x2440);
+		prefetch(0x2440, u64(0x20) + apploader_size + trailer_size);
+
+		// FST.
+		u32 fst_offset = 0;
+		u32 fst_size = 0;
+		volume->ReadSwapped(0x0424, &fst_offset, is_wii);
+		volume->ReadSwapped(0x0428, &fst_size, is_wii);
+		prefetch(u64(fst_offset) << shift, u64(fst_size) << shift);
+
+		// Main DOL; its real size needs the DOL header parsed, so just warm a
+		// window from its start.
+		u32 dol_offset = 0;
+		volume->ReadSwapped(0x0420, &dol_offset, is_wii);
+		prefetch(u64(dol_offset) << shift, 4 * 1024 * 1024);
+	}));
+}
+
 void CBoot::Load_FST(bool is_wii)
 {
 	if (!DVDInterface::IsDiscInside())
@@ -152,9 +204,13 @@ bool CBoot::LoadMapFromFilename()
 {
 	std::string strMapFilename;
 	bool found = FindMapFile(&strMapFilename, nullptr);
-	if (found && g_symbolDB.LoadMap(strMapFilename))
+	if (found)
 	{
-		UpdateDebugger_MapLoaded();
+		// Defer the parse until the debugger or profiler first asks for
+		// symbols; large map files otherwise stall booting for seconds.
+		// PPCSymbolDB re-runs the HLE patch pass and notifies the host once
+		// the map actually gets loaded.
+		g_symbolDB.ScheduleLoadMap(strMapFilename);
 		return true;
 	}
 
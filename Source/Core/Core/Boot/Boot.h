@@ -23,6 +23,13 @@ public:
 	static bool BootUp();
 	static bool IsElfWii(const std::string& filename);
 
+	// Kicks off a background read of the extents BootUp will need from a disc
+	// image (header, apploader, FST, main DOL), so they are already in the OS
+	// file cache by the time the serial boot path gets to them. Safe to call
+	// whether or not the file turns out to be a disc image; it never touches
+	// emulated state.
+	static void PrefetchVolume(const std::string& filename);
+
 	// Tries to find a map file for the current game by looking first in the
 	// local user directory, then in the shared user directory.
 	//
@@ -0,0 +1,116 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonPaths.h"
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+
+#include "Core/Boot/BootAssetCache.h"
+#include "Core/ConfigManager.h"
+#include "Core/HW/EXI/EXI_DeviceIPL.h"
+
+namespace BootAssetCache
+{
+static std::map<std::string, std::vector<u8>> s_assets;
+static std::thread s_preload_thread;
+static std::mutex s_mutex;
+static bool s_preloaded = false;
+
+// Only the worker touches s_assets until GetFile/Clear joins it, so the
+// staging itself needs no locking.
+static void PreloadFile(const std::string& filename)
+{
+	if (filename.empty())
+		return;
+
+	File::IOFile file(filename, "rb");
+	if (!file)
+		return;
+
+	std::vector<u8> data(static_cast<size_t>(file.GetSize()));
+	if (!file.ReadBytes(data.data(), data.size()))
+		return;
+
+	INFO_LOG(BOOT, "Preloaded boot asset %s (%u bytes)", filename.c_str(),
+		static_cast<u32>(data.size()));
+	s_assets.emplace(filename, std::move(data));
+}
+
+static void PreloadThreadFunc()
+{
+	Common::SetCurrentThreadName("Boot asset preload");
+
+	const SConfig& config = SConfig::GetInstance();
+	if (config.bHLE_BS2)
+	{
+		// CEXIIPL prefers fonts out of a real IPL dump and only falls back to
+		// the bundled replacements; stage whichever it is going to pick.
+		std::string ipl_dump =
+			ExpansionInterface::CEXIIPL::FindIPLDump(File::GetUserPath(D_GCUSER_IDX));
+		if (ipl_dump.empty())
+			ipl_dump = ExpansionInterface::CEXIIPL::FindIPLDump(File::GetSysDirectory() + GC_SYS_DIR);
+
+		if (!ipl_dump.empty())
+		{
+			PreloadFile(ipl_dump);
+		}
+		else
+		{
+			PreloadFile(File::GetSysDirectory() + GC_SYS_DIR + DIR_SEP + FONT_SHIFT_JIS);
+			PreloadFile(File::GetSysDirectory() + GC_SYS_DIR + DIR_SEP + FONT_WINDOWS_1252);
+		}
+	}
+	else
+	{
+		PreloadFile(config.m_strBootROM);
+	}
+
+	PreloadFile(config.m_strSRAM);
+}
+
+void Preload()
+{
+	std::lock_guard<std::mutex> guard(s_mutex);
+	if (s_preload_thread.joinable())
+		s_preload_thread.join();
+	s_assets.clear();
+	s_preloaded = true;
+	s_preload_thread = std::thread(PreloadThreadFunc);
+}
+
+bool GetFile(const std::string& filename, std::vector<u8>* data)
+{
+	std::lock_guard<std::mutex> guard(s_mutex);
+	if (!s_preloaded)
+		return false;
+	if (s_preload_thread.joinable())
+		s_preload_thread.join();
+
+	auto iter = s_assets.find(filename);
+	if (iter == s_assets.end())
+		return false;
+
+	// Copy instead of move: the IPL dump is read twice (once per font).
+	*data = iter->second;
+	return true;
+}
+
+void Clear()
+{
+	std::lock_guard<std::mutex> guard(s_mutex);
+	if (s_preload_thread.joinable())
+		s_preload_thread.join();
+	s_assets.clear();
+	s_preloaded = false;
+}
+}
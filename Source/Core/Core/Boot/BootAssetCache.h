@@ -0,0 +1,28 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+// Preloads the small local assets the cold-boot sequence reads (IPL fonts or
+// bootrom dump, SRAM image) on a worker thread started from Core::Init, so
+// the CPU thread doesn't stall on disk while it brings up the hardware.
+// Consumers ask by file name and fall back to normal file IO on a miss.
+namespace BootAssetCache
+{
+// Kicks off the preload worker. Safe to call again for the next boot.
+void Preload();
+
+// Copies the preloaded contents of filename into data. Blocks until the
+// preload worker is done; returns false if the file wasn't staged (or
+// Preload was never called), in which case the caller should hit the disk.
+bool GetFile(const std::string& filename, std::vector<u8>* data);
+
+// Frees the staged assets once boot is complete.
+void Clear();
+}
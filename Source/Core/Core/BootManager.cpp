@@ -90,9 +90,13 @@ private:
 	float m_EmulationSpeed;
 	bool m_audio_stretch;
 	int m_audio_stretch_max_latency = 80;
+	bool bDeterministicAudioTiming;
 
 	float m_OCFactor;
 	bool m_OCEnable;
+	bool m_OCGovernorEnable;
+	float m_OCGovernorMin;
+	float m_OCGovernorMax;
 	std::string strBackend;
 	std::string sBackend;
 	std::string m_strGPUDeterminismMode;
@@ -129,8 +133,12 @@ void ConfigCache::SaveConfig(const SConfig& config)
 	m_wii_language = config.m_wii_language;
 	iVideoRate = config.iVideoRate;
 	m_OCFactor = config.m_OCFactor;
+	m_OCGovernorEnable = config.m_OCGovernorEnable;
+	m_OCGovernorMin = config.m_OCGovernorMin;
+	m_OCGovernorMax = config.m_OCGovernorMax;
 	m_audio_stretch = config.m_audio_stretch;
 	m_audio_stretch_max_latency = config.m_audio_stretch_max_latency;
+	bDeterministicAudioTiming = config.bDeterministicAudioTiming;
 	m_OCEnable = config.m_OCEnable;
 
 	std::copy(std::begin(g_wiimote_sources), std::end(g_wiimote_sources), std::begin(iWiimoteSource));
@@ -171,6 +179,7 @@ void ConfigCache::RestoreConfig(SConfig* config)
 	config->iVideoRate = iVideoRate;
 	config->bHalfAudioRate = bHalfAudioRate;
 	config->m_audio_stretch = m_audio_stretch;
+	config->bDeterministicAudioTiming = bDeterministicAudioTiming;
 	config->m_audio_stretch_max_latency = m_audio_stretch_max_latency;
 	// Only change these back if they were actually set by game ini, since they can be changed while a
 	// game is running.
@@ -211,6 +220,9 @@ void ConfigCache::RestoreConfig(SConfig* config)
 	config->m_strGPUDeterminismMode = m_strGPUDeterminismMode;
 	config->m_OCFactor = m_OCFactor;
 	config->m_OCEnable = m_OCEnable;
+	config->m_OCGovernorEnable = m_OCGovernorEnable;
+	config->m_OCGovernorMin = m_OCGovernorMin;
+	config->m_OCGovernorMax = m_OCGovernorMax;
 	VideoBackendBase::ActivateBackend(config->m_strVideoBackend);
 }
 
@@ -222,6 +234,8 @@ static GPUDeterminismMode ParseGPUDeterminismMode(const std::string& mode)
 		return GPU_DETERMINISM_AUTO;
 	if (mode == "none")
 		return GPU_DETERMINISM_NONE;
+	if (mode == "bounded-sync")
+		return GPU_DETERMINISM_BOUNDED_SYNC;
 	if (mode == "fake-completion")
 		return GPU_DETERMINISM_FAKE_COMPLETION;
 
@@ -272,6 +286,7 @@ bool BootCore(const std::string& _rFilename)
 		core_section->Get("HalfAudioRate", &StartUp.bHalfAudioRate, StartUp.bHalfAudioRate);
 		core_section->Get("AudioStretch", &StartUp.m_audio_stretch, StartUp.m_audio_stretch);
 		core_section->Get("AudioStretchMaxLatency", &StartUp.m_audio_stretch_max_latency, StartUp.m_audio_stretch_max_latency);
+		core_section->Get("DeterministicAudioTiming", &StartUp.bDeterministicAudioTiming, StartUp.bDeterministicAudioTiming);
 		core_section->Get("SyncGPU", &StartUp.bSyncGPU, StartUp.bSyncGPU);
 		core_section->Get("FastDiscSpeed", &StartUp.bFastDiscSpeed, StartUp.bFastDiscSpeed);
 		core_section->Get("DSPHLE", &StartUp.bDSPHLE, StartUp.bDSPHLE);
@@ -293,6 +308,12 @@ bool BootCore(const std::string& _rFilename)
 			StartUp.m_strGPUDeterminismMode);
 		core_section->Get("Overclock", &StartUp.m_OCFactor, StartUp.m_OCFactor);
 		core_section->Get("OverclockEnable", &StartUp.m_OCEnable, StartUp.m_OCEnable);
+		core_section->Get("OverclockGovernor", &StartUp.m_OCGovernorEnable,
+			StartUp.m_OCGovernorEnable);
+		core_section->Get("OverclockGovernorMin", &StartUp.m_OCGovernorMin,
+			StartUp.m_OCGovernorMin);
+		core_section->Get("OverclockGovernorMax", &StartUp.m_OCGovernorMax,
+			StartUp.m_OCGovernorMax);
 
 		for (unsigned int i = 0; i < SerialInterface::MAX_SI_CHANNELS; ++i)
 		{
@@ -347,6 +368,10 @@ bool BootCore(const std::string& _rFilename)
 		StartUp.bFastDiscSpeed = Movie::IsFastDiscSpeed();
 		StartUp.iCPUCore = Movie::GetCPUMode();
 		StartUp.bSyncGPU = Movie::IsSyncGPU();
+		// Turbo verification runs must reproduce the recording bit-for-bit, so
+		// a dual core movie without SyncGPU gets it forced on for the replay.
+		if (SConfig::GetInstance().m_MovieTurboPlayback && StartUp.bCPUThread)
+			StartUp.bSyncGPU = true;
 		if (!StartUp.bWii)
 			StartUp.SelectedLanguage = Movie::GetLanguage();
 		for (int i = 0; i < 2; ++i)
@@ -378,6 +403,7 @@ bool BootCore(const std::string& _rFilename)
 		StartUp.m_DSPEnableJIT = g_NetPlaySettings.m_DSPEnableJIT;
 		StartUp.m_OCEnable = g_NetPlaySettings.m_OCEnable;
 		StartUp.m_OCFactor = g_NetPlaySettings.m_OCFactor;
+		StartUp.bDeterministicAudioTiming = g_NetPlaySettings.m_DeterministicAudioTiming;
 		StartUp.m_EXIDevice[0] = g_NetPlaySettings.m_EXIDevice[0];
 		StartUp.m_EXIDevice[1] = g_NetPlaySettings.m_EXIDevice[1];
 		config_cache.bSetEXIDevice[0] = true;
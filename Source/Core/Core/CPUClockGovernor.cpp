@@ -0,0 +1,86 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <atomic>
+
+#include "Core/CPUClockGovernor.h"
+#include "Core/ConfigManager.h"
+#include "Core/Movie.h"
+#include "Core/NetPlayProto.h"
+
+namespace CPUClockGovernor
+{
+// The loop moves in small steps and demands consecutive good windows before
+// raising, so the factor ramps instead of oscillating across a performance
+// cliff; the audio time stretcher only ever sees gradual speed changes.
+static const float RAISE_THRESHOLD = 0.98f;
+static const float LOWER_THRESHOLD = 0.95f;
+static const float RAISE_STEP = 0.05f;
+static const float LOWER_STEP = 0.10f;
+static const u32 RAISE_WINDOWS = 2;
+
+static std::atomic<float> s_factor{1.0f};
+static u32 s_good_windows = 0;
+
+// The governor tracks measured host speed, so its factor drifts differently
+// on every machine. The static overclock factor is a synced setting under
+// netplay and recorded into movies; the governor is neither, so it must stay
+// out of the clock whenever determinism matters.
+static bool IsActive()
+{
+	if (NetPlay::IsNetPlayRunning() || Movie::IsMovieActive())
+		return false;
+	return SConfig::GetInstance().m_OCGovernorEnable;
+}
+
+void Init()
+{
+	const SConfig& config = SConfig::GetInstance();
+	float factor = config.m_OCEnable ? config.m_OCFactor : 1.0f;
+	if (IsActive())
+		factor = std::min(std::max(factor, config.m_OCGovernorMin), config.m_OCGovernorMax);
+	s_factor.store(factor);
+	s_good_windows = 0;
+}
+
+void Update(float speed)
+{
+	const SConfig& config = SConfig::GetInstance();
+	if (!IsActive())
+		return;
+
+	float factor = s_factor.load();
+	if (speed >= RAISE_THRESHOLD)
+	{
+		// Full speed; take more headroom once it has held for a while.
+		if (++s_good_windows >= RAISE_WINDOWS)
+		{
+			s_good_windows = 0;
+			factor += RAISE_STEP;
+		}
+	}
+	else if (speed < LOWER_THRESHOLD)
+	{
+		// Lagging; back off faster than we ramp up.
+		s_good_windows = 0;
+		factor -= LOWER_STEP;
+	}
+	else
+	{
+		s_good_windows = 0;
+	}
+
+	factor = std::min(std::max(factor, config.m_OCGovernorMin), config.m_OCGovernorMax);
+	s_factor.store(factor);
+}
+
+float GetOverclockFactor()
+{
+	const SConfig& config = SConfig::GetInstance();
+	if (IsActive())
+		return s_factor.load();
+	return config.m_OCEnable ? config.m_OCFactor : 1.0f;
+}
+}
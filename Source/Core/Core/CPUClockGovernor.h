@@ -0,0 +1,25 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+// Dynamic emulated CPU clock scaling. Instead of the static overclock factor,
+// a governor nudges the emulated clock up while the host keeps full speed and
+// backs it down toward (or below) stock when emulation starts lagging, within
+// per-game bounds from the ini layer. Meant for weak hardware, where a fixed
+// factor is either wasted headroom or a stutter.
+namespace CPUClockGovernor
+{
+// Resets the governor to the configured starting factor; called on boot.
+void Init();
+
+// Feeds one measurement window (ratio of emulated to real time, 1.0 = full
+// speed) into the control loop. Called from the CPU thread about once per
+// second from Core::VideoThrottle.
+void Update(float speed);
+
+// The overclock factor CoreTiming should apply right now. Falls back to the
+// static m_OCEnable/m_OCFactor behavior when the governor is disabled.
+float GetOverclockFactor();
+}
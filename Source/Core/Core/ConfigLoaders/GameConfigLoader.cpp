@@ -92,6 +92,10 @@ static std::map<std::pair<std::string, std::string>, ConfigLocation> ini_to_loca
 	// Speedhacks
 	{{"Speedhacks", ""}, {Config::System::Main, "Speedhacks", ""}},
 
+	// Performance profiles
+	{{"Performance", ""}, {Config::System::Main, "Performance", ""}},
+	{{"Performance_Profiles", ""}, {Config::System::Main, "Performance_Profiles", ""}},
+
 	// Debugger values
 	{{"Watches", ""}, {Config::System::Debugger, "Watches", ""}},
 	{{"BreakPoints", ""}, {Config::System::Debugger, "BreakPoints", ""}},
@@ -30,6 +30,7 @@
 #include "Core/IOS/ES/Formats.h"
 #include "Core/IOS/USB/Bluetooth/BTBase.h"
 #include "Core/PatchEngine.h"
+#include "Core/PerfProfile.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "VideoCommon/HiresTextures.h"
@@ -113,6 +114,7 @@ void SConfig::SaveGeneralSettings(IniFile& ini)
 	general->Set("LastFilename", m_LastFilename);
 	general->Set("ShowLag", m_ShowLag);
 	general->Set("ShowFrameCount", m_ShowFrameCount);
+	general->Set("NetPlayInputPrediction", m_NetPlayInputPrediction);
 
 	// ISO folders
 	// Clear removed folders
@@ -233,6 +235,7 @@ void SConfig::SaveCoreSettings(IniFile& ini)
 	core->Set("TimingVariance", iTimingVariance);
 	core->Set("CPUCore", iCPUCore);
 	core->Set("Fastmem", bFastmem);
+	core->Set("JITTieredCompile", bJITTieredCompile);
 	core->Set("CPUThread", bCPUThread);
 	core->Set("DSPHLE", bDSPHLE);
 	core->Set("SyncOnSkipIdle", bSyncGPUOnSkipIdleHack);
@@ -251,6 +254,7 @@ void SConfig::SaveCoreSettings(IniFile& ini)
 	core->Set("DPL2Decoder", bDPL2Decoder);
 	core->Set("AudioStretch", m_audio_stretch);
 	core->Set("AudioStretchMaxLatency", m_audio_stretch_max_latency);
+	core->Set("DeterministicAudioTiming", bDeterministicAudioTiming);
 	core->Set("Latency", iLatency);
 	core->Set("MemcardAPath", m_strMemoryCardA);
 	core->Set("MemcardBPath", m_strMemoryCardB);
@@ -266,6 +270,7 @@ void SConfig::SaveCoreSettings(IniFile& ini)
 		core->Set(StringFromFormat("AdapterRumble%i", i), m_AdapterRumble[i]);
 		core->Set(StringFromFormat("SimulateKonga%i", i), m_AdapterKonga[i]);
 	}
+	core->Set("AdapterLatencyMatch", m_AdapterLatencyMatch);
 	core->Set("WiiSDCard", m_WiiSDCard);
 	core->Set("WiiKeyboard", m_WiiKeyboard);
 	core->Set("WiimoteContinuousScanning", m_WiimoteContinuousScanning);
@@ -276,6 +281,9 @@ void SConfig::SaveCoreSettings(IniFile& ini)
 	core->Set("FrameSkip", m_FrameSkip);
 	core->Set("Overclock", m_OCFactor);
 	core->Set("OverclockEnable", m_OCEnable);
+	core->Set("OverclockGovernor", m_OCGovernorEnable);
+	core->Set("OverclockGovernorMin", m_OCGovernorMin);
+	core->Set("OverclockGovernorMax", m_OCGovernorMax);
 	core->Set("GFXBackend", m_strVideoBackend);
 	core->Set("GPUDeterminismMode", m_strGPUDeterminismMode);
 	core->Set("PerfMapDir", m_perfDir);
@@ -289,6 +297,7 @@ void SConfig::SaveMovieSettings(IniFile& ini)
 	IniFile::Section* movie = ini.GetOrCreateSection("Movie");
 
 	movie->Set("PauseMovie", m_PauseMovie);
+	movie->Set("TurboPlayback", m_MovieTurboPlayback);
 	movie->Set("Author", m_strMovieAuthor);
 	movie->Set("DumpFrames", m_DumpFrames);
 	movie->Set("DumpFramesSilent", m_DumpFramesSilent);
@@ -435,6 +444,7 @@ void SConfig::LoadGeneralSettings(IniFile& ini)
 	general->Get("LastFilename", &m_LastFilename);
 	general->Get("ShowLag", &m_ShowLag, false);
 	general->Get("ShowFrameCount", &m_ShowFrameCount, false);
+	general->Get("NetPlayInputPrediction", &m_NetPlayInputPrediction, false);
 #ifdef USE_GDBSTUB
 #ifndef _WIN32
 	general->Get("GDBSocket", &gdb_socket, "");
@@ -559,6 +569,7 @@ void SConfig::LoadCoreSettings(IniFile& ini)
 	core->Get("CPUCore", &iCPUCore, PowerPC::CORE_INTERPRETER);
 #endif
 	core->Get("Fastmem", &bFastmem, true);
+	core->Get("JITTieredCompile", &bJITTieredCompile, false);
 	core->Get("DSPHLE", &bDSPHLE, true);
 	core->Get("TimingVariance", &iTimingVariance, 40);
 	core->Get("CPUThread", &bCPUThread, true);
@@ -573,6 +584,7 @@ void SConfig::LoadCoreSettings(IniFile& ini)
 	core->Get("Latency", &iLatency, 2);
 	core->Get("AudioStretch", &m_audio_stretch, false);
 	core->Get("AudioStretchMaxLatency", &m_audio_stretch_max_latency, 80);
+	core->Get("DeterministicAudioTiming", &bDeterministicAudioTiming, false);
 	core->Get("MemcardAPath", &m_strMemoryCardA);
 	core->Get("MemcardBPath", &m_strMemoryCardB);
 	core->Get("AgpCartAPath", &m_strGbaCartA);
@@ -590,6 +602,7 @@ void SConfig::LoadCoreSettings(IniFile& ini)
 		core->Get(StringFromFormat("AdapterRumble%i", i), &m_AdapterRumble[i], true);
 		core->Get(StringFromFormat("SimulateKonga%i", i), &m_AdapterKonga[i], false);
 	}
+	core->Get("AdapterLatencyMatch", &m_AdapterLatencyMatch, false);
 	core->Get("WiiSDCard", &m_WiiSDCard, false);
 	core->Get("WiiKeyboard", &m_WiiKeyboard, false);
 	core->Get("WiimoteContinuousScanning", &m_WiimoteContinuousScanning, false);
@@ -597,6 +610,7 @@ void SConfig::LoadCoreSettings(IniFile& ini)
 	core->Get("RunCompareServer", &bRunCompareServer, false);
 	core->Get("RunCompareClient", &bRunCompareClient, false);
 	core->Get("MMU", &bMMU, false);
+	core->Get("MemoizePureFunctions", &bMemoizePureFunctions, false);
 	core->Get("BBDumpPort", &iBBDumpPort, -1);
 	core->Get("SyncGPU", &bSyncGPU, false);
 	core->Get("SyncGpuMaxDistance", &iSyncGpuMaxDistance, 200000);
@@ -610,6 +624,9 @@ void SConfig::LoadCoreSettings(IniFile& ini)
 	core->Get("EmulationSpeed", &m_EmulationSpeed, 1.0f);
 	core->Get("Overclock", &m_OCFactor, 1.0f);
 	core->Get("OverclockEnable", &m_OCEnable, false);
+	core->Get("OverclockGovernor", &m_OCGovernorEnable, false);
+	core->Get("OverclockGovernorMin", &m_OCGovernorMin, 1.0f);
+	core->Get("OverclockGovernorMax", &m_OCGovernorMax, 1.5f);
 	core->Get("FrameSkip", &m_FrameSkip, 0);
 	core->Get("GFXBackend", &m_strVideoBackend, "");
 	core->Get("GPUDeterminismMode", &m_strGPUDeterminismMode, "auto");
@@ -625,6 +642,7 @@ void SConfig::LoadMovieSettings(IniFile& ini)
 	IniFile::Section* movie = ini.GetOrCreateSection("Movie");
 
 	movie->Get("PauseMovie", &m_PauseMovie, false);
+	movie->Get("TurboPlayback", &m_MovieTurboPlayback, false);
 	movie->Get("Author", &m_strMovieAuthor, "");
 	movie->Get("DumpFrames", &m_DumpFrames, false);
 	movie->Get("DumpFramesSilent", &m_DumpFramesSilent, false);
@@ -817,9 +835,11 @@ void SConfig::LoadDefaults()
 	bRunCompareServer = false;
 	bDSPHLE = true;
 	bFastmem = true;
+	bJITTieredCompile = false;
 	bFPRF = false;
 	bAccurateNaNs = false;
 	bMMU = false;
+	bMemoizePureFunctions = false;
 	bDCBZOFF = false;
 	bLowDCBZHack = false;
 	iBBDumpPort = -1;
@@ -836,6 +856,7 @@ void SConfig::LoadDefaults()
 	iLatency = 14;
 	m_audio_stretch = false;
 	m_audio_stretch_max_latency = 80;
+	bDeterministicAudioTiming = false;
 
 	iPosX = INT_MIN;
 	iPosY = INT_MIN;
@@ -1161,6 +1182,9 @@ IniFile SConfig::LoadGameIni(const std::string& id, u16 revision)
 		game_ini.Load(File::GetSysDirectory() + GAMESETTINGS_DIR DIR_SEP + filename, true);
 	for (const std::string& filename : GetGameIniFilenames(id, revision))
 		game_ini.Load(File::GetUserPath(D_GAMESETTINGS_IDX) + filename, true);
+	// Fold the title's active performance profile into the regular sections so
+	// every game ini consumer picks the overrides up transparently.
+	PerfProfile::ApplyActiveProfile(&game_ini);
 	return game_ini;
 }
 
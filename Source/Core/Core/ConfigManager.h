@@ -44,8 +44,11 @@ enum GPUDeterminismMode
 {
 	GPU_DETERMINISM_AUTO,
 	GPU_DETERMINISM_NONE,
-	// This is currently the only mode.  There will probably be at least
-	// one more at some point.
+	// Keep the dual-core GPU thread, but bound how far the threads may drift
+	// apart to the SyncGPU cycle budget whenever determinism is requested.
+	// Cheaper than fake-completion, but only limits divergence rather than
+	// eliminating it.
+	GPU_DETERMINISM_BOUNDED_SYNC,
 	GPU_DETERMINISM_FAKE_COMPLETION,
 };
 
@@ -80,6 +83,7 @@ struct SConfig : NonCopyable
 	// JIT (shared between JIT and JITIL)
 	bool bJITNoBlockCache = false;
 	bool bJITNoBlockLinking = false;
+	bool bJITTieredCompile = false;
 	bool bJITOff = false;
 	bool bJITLoadStoreOff = false;
 	bool bJITLoadStorelXzOff = false;
@@ -115,11 +119,15 @@ struct SConfig : NonCopyable
 	int iLatency = 14;
 	bool m_audio_stretch = false;
 	int m_audio_stretch_max_latency = 80;
+	bool bDeterministicAudioTiming = false;
 
 	bool bRunCompareServer = false;
 	bool bRunCompareClient = false;
 
 	bool bMMU = false;
+	// Answer repeated calls to pure guest functions (identified through the
+	// symbol database) from a host-side cache. See PowerPC/FunctionMemo.h.
+	bool bMemoizePureFunctions = false;
 	bool bDCBZOFF = false;
 	bool bLowDCBZHack = false;
 	int iBBDumpPort = 0;
@@ -266,6 +274,10 @@ struct SConfig : NonCopyable
 	float m_EmulationSpeed;
 	bool m_OCEnable;
 	float m_OCFactor;
+	// Dynamic CPU clock governor; bounds the factor it may pick.
+	bool m_OCGovernorEnable;
+	float m_OCGovernorMin;
+	float m_OCGovernorMax;
 	// other interface settings
 	bool m_InterfaceToolbar;
 	bool m_InterfaceStatusbar;
@@ -308,8 +320,14 @@ struct SConfig : NonCopyable
 
 	std::string m_WirelessMac;
 	bool m_PauseMovie;
+	// Replay movies unthrottled with presentation and audio mixing elided,
+	// for regression rigs that only care about the final verification.
+	bool m_MovieTurboPlayback;
 	bool m_ShowLag;
 	bool m_ShowFrameCount;
+	// Serve predicted remote inputs in netplay instead of stalling on the pad
+	// buffer, reconciling through rollback when the real inputs arrive.
+	bool m_NetPlayInputPrediction;
 	bool m_ShowRTC;
 	std::string m_strMovieAuthor;
 	unsigned int m_FrameSkip;
@@ -335,6 +353,9 @@ struct SConfig : NonCopyable
 	bool m_BackgroundInput;
 	bool m_AdapterRumble[4];
 	bool m_AdapterKonga[4];
+	// Delay wired pads on the GC adapter so every port has the effective input
+	// latency of the slowest (wireless) pad on the station
+	bool m_AdapterLatencyMatch;
 
 	// Network settings
 	bool m_SSLDumpRead;
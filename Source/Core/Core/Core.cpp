@@ -27,9 +27,11 @@
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
 #include "Common/Timer.h"
+#include "Common/WaitProfiler.h"
 
 #include "Core/Analytics.h"
 #include "Core/BootManager.h"
+#include "Core/CPUClockGovernor.h"
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
 #include "Core/DSPEmulator.h"
@@ -39,6 +41,7 @@
 #include "Core/MemoryWatcher.h"
 #endif
 #include "Core/Boot/Boot.h"
+#include "Core/Boot/BootAssetCache.h"
 #include "Core/FifoPlayer/FifoPlayer.h"
 #include "Core/HLE/HLE.h"
 #include "Core/HW/CPU.h"
@@ -148,6 +151,8 @@ void FrameUpdateOnCPUThread()
 {
 	if (NetPlay::IsNetPlayRunning())
 		NetPlayClient::SendTimeBase();
+
+	::State::ReplayRingFrameUpdate();
 }
 
 // Display messages and return values
@@ -248,6 +253,10 @@ bool Init()
 
 	s_window_handle = Host_GetRenderHandle();
 
+	// Start staging IPL fonts/bootrom and SRAM in the background so the
+	// boot sequence on the emu thread doesn't wait on the disk for them.
+	BootAssetCache::Preload();
+
 	// Start the emu thread
 	s_emu_thread = std::thread(EmuThread);
 
@@ -366,19 +375,18 @@ static void CpuThread()
 	CPUSetInitialExecutionState();
 
 #ifdef USE_GDBSTUB
+	// The stub accepts connections from its own thread, so the core starts
+	// running right away and is only halted once a debugger attaches.
 #ifndef _WIN32
 	if (!_CoreParameter.gdb_socket.empty())
 	{
 		gdb_init_local(_CoreParameter.gdb_socket.data());
-		gdb_break();
 	}
 	else
 #endif
 		if (_CoreParameter.iGDBPort > 0)
 		{
 			gdb_init(_CoreParameter.iGDBPort);
-			// break at next instruction (the first instruction)
-			gdb_break();
 		}
 #endif
 
@@ -468,8 +476,16 @@ static void EmuThread()
 	// For a time this acts as the CPU thread...
 	DeclareAsCPUThread();
 
+	// Start pulling the boot volume's hot extents into the OS file cache
+	// while the video backend and hardware are still initializing, so the
+	// serial boot reads below mostly hit cache.
+	if (core_parameter.m_BootType == SConfig::BOOT_ISO)
+		CBoot::PrefetchVolume(core_parameter.m_strFilename);
+
 	Movie::Init();
 
+	CPUClockGovernor::Init();
+
 	HW::Init();
 
 	if (!video_backend->Initialize(s_window_handle))
@@ -537,6 +553,9 @@ static void EmuThread()
 
 	CBoot::BootUp();
 
+	// Boot is done with the staged assets; free them.
+	BootAssetCache::Clear();
+
 	// This adds the SyncGPU handler to CoreTiming, so now CoreTiming::Advance might block.
 	Fifo::Prepare();
 
@@ -645,6 +664,10 @@ static void EmuThread()
 
 	BootManager::RestoreConfig();
 
+	// The per-site wake latency numbers only mean something for the run that
+	// just ended, so dump them while they are fresh.
+	INFO_LOG(COMMON, "%s", Common::GetWaitStatistics().c_str());
+
 	INFO_LOG(CONSOLE, "Stop [Video Thread]\t\t---- Shutdown complete ----");
 	Movie::Shutdown();
 	PatchEngine::Shutdown();
@@ -819,6 +842,11 @@ void VideoThrottle()
 	{
 		UpdateTitle();
 
+		// Feed the measured speed of the closing window into the clock governor.
+		if (ElapseTime >= 1000)
+			CPUClockGovernor::Update((float)(s_drawn_video.load() * 1000.0 /
+				(VideoInterface::GetTargetRefreshRate() * ElapseTime)));
+
 		// Reset counter
 		s_timer.Update();
 		s_drawn_frame.store(0);
@@ -4,9 +4,11 @@
 
 #include <algorithm>
 #include <cinttypes>
+#include <limits>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "Common/Assert.h"
@@ -16,6 +18,7 @@
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
 
+#include "Core/CPUClockGovernor.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -30,6 +33,10 @@ struct EventType
 {
 	TimedCallback callback;
 	const std::string* name;
+
+	// Number of times an event of this type has been scheduled since the counters
+	// were last dumped. Not saved in savestates; this is purely a profiling aid.
+	u64 scheduled_count;
 };
 
 struct Event
@@ -68,6 +75,7 @@ static float s_last_OC_factor;
 static constexpr int MAX_SLICE_LENGTH = 20000;
 
 static s64 s_idled_cycles;
+static u64 s_idle_skips;
 static u32 s_fake_dec_start_value;
 static u64 s_fake_dec_start_ticks;
 
@@ -108,7 +116,7 @@ EventType* RegisterEvent(const std::string& name, TimedCallback callback)
 		"during Init to avoid breaking save states.",
 		name.c_str());
 
-	auto info = s_event_types.emplace(name, EventType{ callback, nullptr });
+	auto info = s_event_types.emplace(name, EventType{ callback, nullptr, 0 });
 	EventType* event_type = &info.first->second;
 	event_type->name = &info.first->first;
 	return event_type;
@@ -122,12 +130,13 @@ void UnregisterAllEvents()
 
 void Init()
 {
-	s_last_OC_factor = SConfig::GetInstance().m_OCEnable ? SConfig::GetInstance().m_OCFactor : 1.0f;
+	s_last_OC_factor = CPUClockGovernor::GetOverclockFactor();
 	g.last_OC_factor_inverted = 1.0f / s_last_OC_factor;
 	PowerPC::ppcState.downcount = CyclesToDowncount(MAX_SLICE_LENGTH);
 	g.slice_length = MAX_SLICE_LENGTH;
 	g.global_timer = 0;
 	s_idled_cycles = 0;
+	s_idle_skips = 0;
 
 	// The time between CoreTiming being intialized and the first call to Advance() is considered
 	// the slice boundary between slice -1 and slice 0. Dispatcher loops must call Advance() before
@@ -137,6 +146,11 @@ void Init()
 
 	s_event_fifo_id = 0;
 	s_ev_lost = RegisterEvent("_lost_event", &EmptyTimedCallback);
+
+	// Events are stored by value in the heap, so the only allocation ScheduleEvent can
+	// perform is growing the vector. Reserving up front keeps the steady state allocation
+	// free; the queue rarely holds more than a couple dozen events.
+	s_event_queue.reserve(128);
 }
 
 void Shutdown()
@@ -144,6 +158,13 @@ void Shutdown()
 	std::lock_guard<std::mutex> lk(s_ts_write_lock);
 	MoveEvents();
 	ClearPendingEvents();
+	LogEventTypeCounts();
+	if (s_idle_skips != 0 && g.global_timer != 0)
+	{
+		INFO_LOG(POWERPC, "Idle skipping: %" PRIu64 " skips, %" PRId64 " cycles (%.1f%% of %" PRId64
+			" total)",
+			s_idle_skips, s_idled_cycles, 100.0 * s_idled_cycles / g.global_timer, g.global_timer);
+	}
 	UnregisterAllEvents();
 }
 
@@ -247,6 +268,8 @@ void ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata,
 	{
 		s64 timeout = GetTicks() + cycles_into_future;
 
+		event_type->scheduled_count++;
+
 		// If this event needs to be scheduled before the next advance(), force one early
 		if (!s_is_global_timer_sane)
 			ForceExceptionCheck(cycles_into_future);
@@ -264,6 +287,7 @@ void ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata,
 		}
 
 		std::lock_guard<std::mutex> lk(s_ts_write_lock);
+		event_type->scheduled_count++;
 		s_ts_queue.Push(Event{ g.global_timer + cycles_into_future, 0, userdata, event_type });
 	}
 }
@@ -330,7 +354,7 @@ void Advance()
 
 	int cyclesExecuted = g.slice_length - DowncountToCycles(PowerPC::ppcState.downcount);
 	g.global_timer += cyclesExecuted;
-	s_last_OC_factor = SConfig::GetInstance().m_OCEnable ? SConfig::GetInstance().m_OCFactor : 1.0f;
+	s_last_OC_factor = CPUClockGovernor::GetOverclockFactor();
 	g.last_OC_factor_inverted = 1.0f / s_last_OC_factor;
 	g.slice_length = MAX_SLICE_LENGTH;
 
@@ -364,6 +388,24 @@ void Advance()
 	PowerPC::CheckExternalExceptions();
 }
 
+void LogEventTypeCounts()
+{
+	std::vector<std::pair<u64, const std::string*>> counts;
+	for (auto& type : s_event_types)
+	{
+		if (type.second.scheduled_count)
+			counts.emplace_back(type.second.scheduled_count, type.second.name);
+		type.second.scheduled_count = 0;
+	}
+
+	std::sort(counts.begin(), counts.end(), std::greater<std::pair<u64, const std::string*>>());
+	for (const auto& count : counts)
+	{
+		INFO_LOG(POWERPC, "Event \"%s\" was scheduled %" PRIu64 " times", count.second->c_str(),
+			count.first);
+	}
+}
+
 void LogPendingEvents()
 {
 	auto clone = s_event_queue;
@@ -395,6 +437,26 @@ void Idle()
 		Fifo::FlushGpu();
 	}
 
+	s_idle_skips++;
+
+	// Advance() caps slices at MAX_SLICE_LENGTH, so giving back only the rest
+	// of the current slice crosses a long idle gap in 20000-cycle hops,
+	// re-entering the idle block and the event queue machinery on every hop.
+	// Stretch the current slice so the next Advance() lands exactly on the
+	// next scheduled event and the whole gap is skipped in one step.
+	MoveEvents();
+	if (!s_event_queue.empty())
+	{
+		const s64 now =
+			g.global_timer + g.slice_length - DowncountToCycles(PowerPC::ppcState.downcount);
+		const s64 gap = s_event_queue.front().time - now;
+		if (gap > 0 && gap <= std::numeric_limits<int>::max() - g.slice_length)
+		{
+			g.slice_length += static_cast<int>(gap);
+			s_idled_cycles += gap;
+		}
+	}
+
 	s_idled_cycles += DowncountToCycles(PowerPC::ppcState.downcount);
 	PowerPC::ppcState.downcount = 0;
 }
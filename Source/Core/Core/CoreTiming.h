@@ -94,6 +94,11 @@ void ClearPendingEvents();
 
 void LogPendingEvents();
 
+// Logs how many times each event type was scheduled since the last dump (or boot) and
+// resets the counters, most frequent first. Useful for tracking down devices that spam
+// the scheduler; called automatically on Shutdown.
+void LogEventTypeCounts();
+
 std::string GetScheduledEventsSummary();
 
 void AdjustEventQueueTimes(u32 new_ppc_clock, u32 old_ppc_clock);
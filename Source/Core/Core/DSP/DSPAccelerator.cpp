@@ -13,6 +13,37 @@
 
 namespace DSP
 {
+// Ucode inner loops hammer the accelerator one sample at a time, and every
+// byte used to take a full Host::ReadHostMemory round trip. Since playback
+// overwhelmingly walks the buffer sequentially, fetch ARAM in small blocks
+// and serve the per-sample reads from the block. The window holds raw bytes
+// only - YN1/YN2/PRED_SCALE and the accelerator address registers still
+// update per sample, so all architecturally visible state is bit-identical.
+// Repointing the accelerator (any write to its registers) or writing through
+// the d3 path drops the window, which also covers the usual streaming
+// pattern where the CPU DMAs fresh data into ARAM before pointing us at it.
+static u8 s_prefetch_buffer[32];
+static u32 s_prefetch_addr;
+static u32 s_prefetch_size;  // 0 = nothing prefetched
+
+void dsp_accelerator_invalidate_prefetch()
+{
+	s_prefetch_size = 0;
+}
+
+static u8 ReadMemoryPrefetched(u32 byte_addr)
+{
+	const u32 offset = byte_addr - s_prefetch_addr;
+	if (offset >= s_prefetch_size)
+	{
+		s_prefetch_addr = byte_addr;
+		s_prefetch_size = sizeof(s_prefetch_buffer);
+		Host::ReadHostMemoryBlock(s_prefetch_buffer, byte_addr, s_prefetch_size);
+		return s_prefetch_buffer[0];
+	}
+	return s_prefetch_buffer[offset];
+}
+
 // The hardware adpcm decoder :)
 static s16 ADPCM_Step(u32& _rSamplePos)
 {
@@ -20,7 +51,7 @@ static s16 ADPCM_Step(u32& _rSamplePos)
 
 	if ((_rSamplePos & 15) == 0)
 	{
-		g_dsp.ifx_regs[DSP_PRED_SCALE] = Host::ReadHostMemory((_rSamplePos & ~15) >> 1);
+		g_dsp.ifx_regs[DSP_PRED_SCALE] = ReadMemoryPrefetched((_rSamplePos & ~15) >> 1);
 		_rSamplePos += 2;
 	}
 
@@ -30,8 +61,8 @@ static s16 ADPCM_Step(u32& _rSamplePos)
 	s32 coef1 = pCoefTable[coef_idx * 2 + 0];
 	s32 coef2 = pCoefTable[coef_idx * 2 + 1];
 
-	int temp = (_rSamplePos & 1) ? (Host::ReadHostMemory(_rSamplePos >> 1) & 0xF) :
-		(Host::ReadHostMemory(_rSamplePos >> 1) >> 4);
+	int temp = (_rSamplePos & 1) ? (ReadMemoryPrefetched(_rSamplePos >> 1) & 0xF) :
+		(ReadMemoryPrefetched(_rSamplePos >> 1) >> 4);
 
 	if (temp >= 8)
 		temp -= 16;
@@ -62,11 +93,11 @@ u16 dsp_read_aram_d3()
 	switch (g_dsp.ifx_regs[DSP_FORMAT])
 	{
 	case 0x5:  // u8 reads
-		val = Host::ReadHostMemory(Address);
+		val = ReadMemoryPrefetched(Address);
 		Address++;
 		break;
 	case 0x6:  // u16 reads
-		val = (Host::ReadHostMemory(Address * 2) << 8) | Host::ReadHostMemory(Address * 2 + 1);
+		val = (ReadMemoryPrefetched(Address * 2) << 8) | ReadMemoryPrefetched(Address * 2 + 1);
 		Address++;
 		break;
 	default:
@@ -96,6 +127,7 @@ void dsp_write_aram_d3(u16 value)
 	switch (g_dsp.ifx_regs[DSP_FORMAT])
 	{
 	case 0xA:  // u16 writes
+		dsp_accelerator_invalidate_prefetch();
 		Host::WriteHostMemory(value >> 8, Address * 2);
 		Host::WriteHostMemory(value & 0xFF, Address * 2 + 1);
 		Address++;
@@ -140,14 +172,14 @@ u16 dsp_read_accelerator()
 		val = ADPCM_Step(Address);
 		break;
 	case 0x0A:  // 16-bit PCM audio
-		val = (Host::ReadHostMemory(Address * 2) << 8) | Host::ReadHostMemory(Address * 2 + 1);
+		val = (ReadMemoryPrefetched(Address * 2) << 8) | ReadMemoryPrefetched(Address * 2 + 1);
 		g_dsp.ifx_regs[DSP_YN2] = g_dsp.ifx_regs[DSP_YN1];
 		g_dsp.ifx_regs[DSP_YN1] = val;
 		step_size_bytes = 2;
 		Address++;
 		break;
 	case 0x19:  // 8-bit PCM audio
-		val = Host::ReadHostMemory(Address) << 8;
+		val = ReadMemoryPrefetched(Address) << 8;
 		g_dsp.ifx_regs[DSP_YN2] = g_dsp.ifx_regs[DSP_YN1];
 		g_dsp.ifx_regs[DSP_YN1] = val;
 		step_size_bytes = 2;
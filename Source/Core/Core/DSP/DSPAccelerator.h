@@ -10,6 +10,10 @@ namespace DSP
 {
 u16 dsp_read_accelerator();
 
+// Drops the sequential-read prefetch window; must be called whenever the
+// accelerator is repointed or its backing memory is written from the DSP side.
+void dsp_accelerator_invalidate_prefetch();
+
 u16 dsp_read_aram_d3();
 void dsp_write_aram_d3(u16 value);
 }  // namespace DSP
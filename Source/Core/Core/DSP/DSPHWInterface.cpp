@@ -24,6 +24,7 @@ static void gdsp_do_dma();
 void gdsp_ifx_init()
 {
 	g_dsp.ifx_regs.fill(0);
+	dsp_accelerator_invalidate_prefetch();
 
 	g_dsp.mbox[MAILBOX_CPU].store(0);
 	g_dsp.mbox[MAILBOX_DSP].store(0);
@@ -151,6 +152,20 @@ void gdsp_ifx_write(u32 addr, u32 val)
 		dsp_step_accelerator();
 		break;
 		*/
+
+	case DSP_FORMAT:
+	case DSP_ACCAH:
+	case DSP_ACCAL:
+	case DSP_ACSAH:
+	case DSP_ACSAL:
+	case DSP_ACEAH:
+	case DSP_ACEAL:
+		// The accelerator prefetch window keys off the current read address,
+		// so repointing the accelerator has to drop it.
+		dsp_accelerator_invalidate_prefetch();
+		g_dsp.ifx_regs[addr & 0xFF] = val;
+		break;
+
 	default:
 		if ((addr & 0xff) >= 0xa0)
 		{
@@ -18,6 +18,7 @@ namespace DSP
 namespace Host
 {
 u8 ReadHostMemory(u32 addr);
+void ReadHostMemoryBlock(u8* dst, u32 addr, u32 size);
 void WriteHostMemory(u8 value, u32 addr);
 void OSD_AddMessage(const std::string& str, u32 ms);
 bool OnThread();
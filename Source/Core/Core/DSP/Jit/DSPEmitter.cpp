@@ -270,7 +270,7 @@ void DSPEmitter::Compile(u16 start_addr)
 			DSPJitRegCache c(m_gpr);
 			HandleLoop();
 			m_gpr.SaveRegs();
-			if (!Host::OnThread() && Analyzer::GetCodeFlags(start_addr) & Analyzer::CODE_IDLE_SKIP)
+			if (Analyzer::GetCodeFlags(start_addr) & Analyzer::CODE_IDLE_SKIP)
 			{
 				MOV(16, R(EAX), Imm16(DSP_IDLE_SKIP_CYCLES));
 			}
@@ -304,7 +304,7 @@ void DSPEmitter::Compile(u16 start_addr)
 				DSPJitRegCache c(m_gpr);
 				// don't update g_dsp.pc -- the branch insn already did
 				m_gpr.SaveRegs();
-				if (!Host::OnThread() && Analyzer::GetCodeFlags(start_addr) & Analyzer::CODE_IDLE_SKIP)
+				if (Analyzer::GetCodeFlags(start_addr) & Analyzer::CODE_IDLE_SKIP)
 				{
 					MOV(16, R(EAX), Imm16(DSP_IDLE_SKIP_CYCLES));
 				}
@@ -367,7 +367,7 @@ void DSPEmitter::Compile(u16 start_addr)
 	}
 
 	m_gpr.SaveRegs();
-	if (!Host::OnThread() && Analyzer::GetCodeFlags(start_addr) & Analyzer::CODE_IDLE_SKIP)
+	if (Analyzer::GetCodeFlags(start_addr) & Analyzer::CODE_IDLE_SKIP)
 	{
 		MOV(16, R(EAX), Imm16(DSP_IDLE_SKIP_CYCLES));
 	}
@@ -477,12 +477,12 @@ Gen::OpArg DSPEmitter::M_SDSP_external_interrupt_waiting()
 
 Gen::OpArg DSPEmitter::M_SDSP_r_st(size_t index)
 {
-	return MDisp(R15, static_cast<int>(offsetof(SDSP, r.st[index])));
+	return MDisp(R15, static_cast<int>(offsetof(SDSP, r.st[0]) + sizeof(g_dsp.r.st[0]) * (index)));
 }
 
 Gen::OpArg DSPEmitter::M_SDSP_reg_stack_ptr(size_t index)
 {
-	return MDisp(R15, static_cast<int>(offsetof(SDSP, reg_stack_ptr[index])));
+	return MDisp(R15, static_cast<int>(offsetof(SDSP, reg_stack_ptr[0]) + sizeof(g_dsp.reg_stack_ptr[0]) * (index)));
 }
 
 }  // namespace x86
@@ -131,11 +131,12 @@ void DSPEmitter::WriteBlockLink(u16 dest)
 void DSPEmitter::r_jcc(const UDSPInstruction opc)
 {
 	u16 dest = dsp_imem_read(m_compile_pc + 1);
-	const DSPOPCTemplate* opcode = GetOpTemplate(opc);
 
-	// If the block is unconditional, attempt to link block
-	if (opcode->uncond_branch)
-		WriteBlockLink(dest);
+	// Attempt to link the taken edge. For conditional branches this code is
+	// emitted inside the condition's guarded region, so the link only fires
+	// when the branch is actually taken; register state flows through the
+	// canonical allocation just like on unconditional links.
+	WriteBlockLink(dest);
 	MOV(16, M_SDSP_pc(), Imm16(dest));
 	WriteBranchExit();
 }
@@ -177,11 +178,9 @@ void DSPEmitter::r_call(const UDSPInstruction opc)
 	MOV(16, R(DX), Imm16(m_compile_pc + 2));
 	dsp_reg_store_stack(StackRegister::Call);
 	u16 dest = dsp_imem_read(m_compile_pc + 1);
-	const DSPOPCTemplate* opcode = GetOpTemplate(opc);
 
-	// If the block is unconditional, attempt to link block
-	if (opcode->uncond_branch)
-		WriteBlockLink(dest);
+	// Attempt to link the taken edge, conditional or not (see r_jcc).
+	WriteBlockLink(dest);
 	MOV(16, M_SDSP_pc(), Imm16(dest));
 	WriteBranchExit();
 }
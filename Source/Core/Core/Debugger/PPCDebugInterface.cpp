@@ -180,6 +180,7 @@ int PPCDebugInterface::GetColor(unsigned int address)
 		0xd0FFd0,  // light green
 		0xFFFFd0,  // light yellow
 	};
+	g_symbolDB.EnsureMapLoaded();
 	Symbol* symbol = g_symbolDB.GetSymbolFromAddr(address);
 	if (!symbol)
 		return 0xFFFFFF;
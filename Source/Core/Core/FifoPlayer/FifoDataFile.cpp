@@ -91,6 +91,11 @@ bool FifoDataFile::Save(const std::string& filename)
 
 	header.flags = m_Flags;
 
+	// Freshly recorded files carry no analysis section yet; the playback
+	// analyzer appends one via SaveAnalysis on first open.
+	header.analysisOffset = 0;
+	header.analysisSize = 0;
+
 	file.Seek(0, SEEK_SET);
 	file.WriteBytes(&header, sizeof(FileHeader));
 
@@ -200,11 +205,96 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
 		dataFile->AddFrame(dstFrame);
 	}
 
+	// Files written before the analysis section existed can hold junk in the
+	// trailing header fields, so the section is validated before use; a
+	// missing or invalid section just means the analyzer runs the full pass
+	// and writes a fresh one.
+	dataFile->m_Path = filename;
+	if (header.analysisOffset != 0 && header.analysisSize != 0)
+		ReadAnalysis(header, file, dataFile.get());
+
 	file.Close();
 
 	return dataFile;
 }
 
+void FifoDataFile::ReadAnalysis(const FifoFileStruct::FileHeader& header, File::IOFile& file,
+	FifoDataFile* dataFile)
+{
+	file.Seek(header.analysisOffset, SEEK_SET);
+
+	FileAnalysisHeader sectionHeader;
+	if (!file.ReadBytes(&sectionHeader, sizeof(sectionHeader)))
+		return;
+	if (sectionHeader.version != ANALYSIS_VERSION ||
+		sectionHeader.frameCount != dataFile->GetFrameCount())
+		return;
+
+	std::vector<FrameAnalysisInfo> analysis(sectionHeader.frameCount);
+	for (FrameAnalysisInfo& frame : analysis)
+	{
+		FileAnalysisFrameInfo srcFrame;
+		if (!file.ReadBytes(&srcFrame, sizeof(srcFrame)))
+			return;
+
+		frame.objectStarts.resize(srcFrame.numObjectStarts);
+		frame.objectEnds.resize(srcFrame.numObjectEnds);
+		frame.numMemoryUpdates = srcFrame.numMemoryUpdates;
+		if (!file.ReadArray(frame.objectStarts.data(), frame.objectStarts.size()) ||
+			!file.ReadArray(frame.objectEnds.data(), frame.objectEnds.size()))
+		{
+			return;
+		}
+	}
+
+	dataFile->m_Analysis = std::move(analysis);
+	dataFile->m_HasAnalysis = true;
+}
+
+bool FifoDataFile::SaveAnalysis(const std::vector<FrameAnalysisInfo>& analysis)
+{
+	if (m_Path.empty() || analysis.size() != m_Frames.size())
+		return false;
+
+	File::IOFile file;
+	if (!file.Open(m_Path, "r+b"))
+		return false;
+
+	// Only annotate the file this capture was actually read from.
+	FileHeader header;
+	if (!file.ReadBytes(&header, sizeof(header)) || header.fileId != FILE_ID ||
+		header.frameCount != m_Frames.size())
+	{
+		return false;
+	}
+
+	file.Seek(0, SEEK_END);
+	const u64 analysisOffset = file.Tell();
+
+	FileAnalysisHeader sectionHeader;
+	sectionHeader.version = ANALYSIS_VERSION;
+	sectionHeader.frameCount = static_cast<u32>(analysis.size());
+	file.WriteBytes(&sectionHeader, sizeof(sectionHeader));
+
+	for (const FrameAnalysisInfo& frame : analysis)
+	{
+		FileAnalysisFrameInfo dstFrame;
+		dstFrame.numObjectStarts = static_cast<u32>(frame.objectStarts.size());
+		dstFrame.numObjectEnds = static_cast<u32>(frame.objectEnds.size());
+		dstFrame.numMemoryUpdates = frame.numMemoryUpdates;
+		file.WriteBytes(&dstFrame, sizeof(dstFrame));
+		file.WriteArray(frame.objectStarts.data(), frame.objectStarts.size());
+		file.WriteArray(frame.objectEnds.data(), frame.objectEnds.size());
+	}
+
+	header.analysisOffset = analysisOffset;
+	header.analysisSize = static_cast<u32>(file.Tell() - analysisOffset);
+	file.Seek(0, SEEK_SET);
+	file.WriteBytes(&header, sizeof(header));
+
+	return file.Close();
+}
+
 void FifoDataFile::PadFile(size_t numBytes, File::IOFile& file)
 {
 	for (size_t i = 0; i < numBytes; ++i)
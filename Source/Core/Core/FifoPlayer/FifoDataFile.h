@@ -14,6 +14,10 @@ namespace File
 {
 class IOFile;
 }
+namespace FifoFileStruct
+{
+union FileHeader;
+}
 
 struct MemoryUpdate
 {
@@ -71,6 +75,22 @@ public:
 	u32 GetFrameCount() const { return static_cast<u32>(m_Frames.size()); }
 	bool Save(const std::string& filename);
 
+	// Cached playback analysis (per-frame object boundaries), stored in the
+	// capture file so reopening doesn't pay the full command walk again.
+	struct FrameAnalysisInfo
+	{
+		std::vector<u32> objectStarts;
+		std::vector<u32> objectEnds;
+		u32 numMemoryUpdates = 0;
+	};
+
+	bool HasAnalysis() const { return m_HasAnalysis; }
+	const std::vector<FrameAnalysisInfo>& GetAnalysis() const { return m_Analysis; }
+	// Appends the analysis as a versioned section to the file this capture
+	// was loaded from and records it in the header, so the next Load skips
+	// the analysis pass entirely.
+	bool SaveAnalysis(const std::vector<FrameAnalysisInfo>& analysis);
+
 	static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly);
 
 private:
@@ -87,6 +107,8 @@ private:
 	u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
 	static void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
 		std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
+	static void ReadAnalysis(const FifoFileStruct::FileHeader& header, File::IOFile& file,
+		FifoDataFile* dataFile);
 
 	u32 m_BPMem[BP_MEM_SIZE];
 	u32 m_CPMem[CP_MEM_SIZE];
@@ -98,4 +120,8 @@ private:
 	u32 m_Version = 0;
 
 	std::vector<FifoFrameInfo> m_Frames;
+
+	std::string m_Path;
+	std::vector<FrameAnalysisInfo> m_Analysis;
+	bool m_HasAnalysis = false;
 };
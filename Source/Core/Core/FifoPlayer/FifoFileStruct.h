@@ -13,6 +13,9 @@ enum
 	FILE_ID = 0x0d01f1f0,
 	VERSION_NUMBER = 4,
 	MIN_LOADER_VERSION = 1,
+	// Version of the appended analysis section; bumped whenever the playback
+	// analyzer's output changes so stale indices are recomputed.
+	ANALYSIS_VERSION = 1,
 };
 
 #pragma pack(push, 4)
@@ -37,6 +40,12 @@ union FileHeader
 		u32 flags;
 		u64 texMemOffset;
 		u32 texMemSize;
+		// Offset and size of the cached analysis section, or 0 if the file
+		// carries none. Loaders that predate these fields ignore them; files
+		// written before them may hold junk here, so the section itself is
+		// validated before use.
+		u64 analysisOffset;
+		u32 analysisSize;
 	};
 	u32 rawData[32];
 };
@@ -64,5 +73,21 @@ struct FileMemoryUpdate
 	u8 type;
 };
 
+// Cached playback analysis, appended after the capture data. The section is
+// a FileAnalysisHeader followed by one FileAnalysisFrameInfo per frame, each
+// immediately followed by its object start and end offset arrays.
+struct FileAnalysisHeader
+{
+	u32 version;
+	u32 frameCount;
+};
+
+struct FileAnalysisFrameInfo
+{
+	u32 numObjectStarts;
+	u32 numObjectEnds;
+	u32 numMemoryUpdates;
+};
+
 #pragma pack(pop)
 }
@@ -4,6 +4,8 @@
 
 #include "Core/FifoPlayer/FifoPlaybackAnalyzer.h"
 
+#include <algorithm>
+
 #include "Common/CommonTypes.h"
 #include "Core/FifoPlayer/FifoAnalyzer.h"
 #include "Core/FifoPlayer/FifoDataFile.h"
@@ -22,6 +24,28 @@ struct CmdData
 void FifoPlaybackAnalyzer::AnalyzeFrames(FifoDataFile* file,
 	std::vector<AnalyzedFrameInfo>& frameInfo)
 {
+	// A capture that already carries an analysis section skips the command
+	// walk entirely: the object boundaries come from the index and the memory
+	// updates are the recorded per-frame lists the walk would have copied.
+	if (file->HasAnalysis())
+	{
+		const std::vector<FifoDataFile::FrameAnalysisInfo>& analysis = file->GetAnalysis();
+		frameInfo.clear();
+		frameInfo.resize(file->GetFrameCount());
+		for (u32 frameIdx = 0; frameIdx < file->GetFrameCount(); ++frameIdx)
+		{
+			const FifoFrameInfo& frame = file->GetFrame(frameIdx);
+			AnalyzedFrameInfo& analyzed = frameInfo[frameIdx];
+			analyzed.objectStarts = analysis[frameIdx].objectStarts;
+			analyzed.objectEnds = analysis[frameIdx].objectEnds;
+			u32 numUpdates = std::min(analysis[frameIdx].numMemoryUpdates,
+				static_cast<u32>(frame.memoryUpdates.size()));
+			analyzed.memoryUpdates.assign(frame.memoryUpdates.begin(),
+				frame.memoryUpdates.begin() + numUpdates);
+		}
+		return;
+	}
+
 	u32* cpMem = file->GetCPMem();
 	FifoAnalyzer::LoadCPReg(0x50, cpMem[0x50], s_CpMem);
 	FifoAnalyzer::LoadCPReg(0x60, cpMem[0x60], s_CpMem);
@@ -97,4 +121,16 @@ void FifoPlaybackAnalyzer::AnalyzeFrames(FifoDataFile* file,
 		if (analyzed.objectEnds.size() < analyzed.objectStarts.size())
 			analyzed.objectEnds.push_back(cmdStart);
 	}
+
+	// Cache the finished analysis in the capture so the walk above is paid
+	// once per file. The error path above returns before reaching this, so a
+	// broken capture never gets a (partial) index written.
+	std::vector<FifoDataFile::FrameAnalysisInfo> index(frameInfo.size());
+	for (size_t i = 0; i < frameInfo.size(); ++i)
+	{
+		index[i].objectStarts = frameInfo[i].objectStarts;
+		index[i].objectEnds = frameInfo[i].objectEnds;
+		index[i].numMemoryUpdates = static_cast<u32>(frameInfo[i].memoryUpdates.size());
+	}
+	file->SaveAnalysis(index);
 }
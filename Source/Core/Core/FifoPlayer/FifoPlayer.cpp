@@ -9,7 +9,10 @@
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
+#include "Common/Timer.h"
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
 #include "Core/FifoPlayer/FifoAnalyzer.h"
@@ -24,6 +27,7 @@
 #include "Core/PowerPC/PowerPC.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
+#include "VideoCommon/VideoBackendBase.h"
 
 // We need to include TextureDecoder.h for the texMem array.
 // TODO: Move texMem somewhere else so this isn't an issue.
@@ -122,11 +126,25 @@ private:
 	FifoPlayer* m_parent;
 };
 
+void FifoPlayer::SetBenchmark(u32 loop_count, const std::string& report_path)
+{
+	m_BenchmarkLoops = loop_count;
+	m_BenchmarkLoopsDone = 0;
+	m_BenchmarkLastFrameTime = 0;
+	m_BenchmarkReportPath = report_path;
+	m_BenchmarkFrameTimes.clear();
+}
+
 CPU::State FifoPlayer::AdvanceFrame()
 {
 	if (m_CurrentFrame >= m_FrameRangeEnd)
 	{
-		if (!m_Loop)
+		if (m_BenchmarkLoops != 0 && ++m_BenchmarkLoopsDone >= m_BenchmarkLoops)
+		{
+			WriteBenchmarkReport();
+			return CPU::State::PowerDown;
+		}
+		if (!m_Loop && m_BenchmarkLoops == 0)
 			return CPU::State::PowerDown;
 		// If there are zero frames in the range then sleep instead of busy spinning
 		if (m_FrameRangeStart >= m_FrameRangeEnd)
@@ -149,10 +167,53 @@ CPU::State FifoPlayer::AdvanceFrame()
 
 	WriteFrame(m_File->GetFrame(m_CurrentFrame), m_FrameInfo[m_CurrentFrame]);
 
+	if (m_BenchmarkLoops != 0)
+	{
+		// Time from the end of one frame's fifo writes to the next. The writes
+		// block on the GPU consuming the data, so this includes the backend cost.
+		const u64 now = Common::Timer::GetTimeUs();
+		if (m_BenchmarkLastFrameTime != 0)
+			m_BenchmarkFrameTimes.push_back(now - m_BenchmarkLastFrameTime);
+		m_BenchmarkLastFrameTime = now;
+	}
+
 	++m_CurrentFrame;
 	return CPU::State::Running;
 }
 
+void FifoPlayer::WriteBenchmarkReport()
+{
+	if (m_BenchmarkReportPath.empty() || m_BenchmarkFrameTimes.empty())
+		return;
+
+	std::vector<u64> sorted = m_BenchmarkFrameTimes;
+	std::sort(sorted.begin(), sorted.end());
+	auto percentile = [&sorted](u32 p) {
+		size_t idx = (sorted.size() * p) / 100;
+		return sorted[std::min(idx, sorted.size() - 1)] / 1000.0;
+	};
+	double sum = 0.0;
+	for (u64 t : sorted)
+		sum += t;
+	const double avg_ms = sum / sorted.size() / 1000.0;
+
+	std::string report = "{\n";
+	report += StringFromFormat("  \"video_backend\": \"%s\",\n", g_video_backend->GetName().c_str());
+	report += StringFromFormat("  \"loops\": %u,\n", m_BenchmarkLoops);
+	report += StringFromFormat("  \"frames\": %zu,\n", sorted.size());
+	report += StringFromFormat("  \"average_ms\": %.3f,\n", avg_ms);
+	report += StringFromFormat("  \"p50_ms\": %.3f,\n", percentile(50));
+	report += StringFromFormat("  \"p95_ms\": %.3f,\n", percentile(95));
+	report += StringFromFormat("  \"p99_ms\": %.3f\n", percentile(99));
+	report += "}\n";
+
+	File::IOFile file(m_BenchmarkReportPath, "w");
+	if (!file.WriteBytes(report.data(), report.size()))
+		ERROR_LOG(VIDEO, "Failed to write benchmark report to %s", m_BenchmarkReportPath.c_str());
+	else
+		NOTICE_LOG(VIDEO, "Benchmark report written to %s", m_BenchmarkReportPath.c_str());
+}
+
 std::unique_ptr<CPUCoreBase> FifoPlayer::GetCPUCore()
 {
 	if (!m_File || m_File->GetFrameCount() == 0)
@@ -89,6 +89,11 @@ public:
 	// If enabled then all memory updates happen at once before the first frame
 	// Default is disabled
 	void SetEarlyMemoryUpdates(bool enabled) { m_EarlyMemoryUpdates = enabled; }
+	// Headless benchmark mode: play the frame range loop_count times while
+	// timing every frame, then write a JSON report (frame count, average and
+	// p50/p95/p99 frame times) to report_path and power down. Overrides the
+	// loop setting from the config.
+	void SetBenchmark(u32 loop_count, const std::string& report_path);
 	// Callbacks
 	void SetFileLoadedCallback(CallbackFunc callback) { m_FileLoadedCb = callback; }
 	void SetFrameWrittenCallback(CallbackFunc callback) { m_FrameWrittenCb = callback; }
@@ -133,8 +138,16 @@ private:
 	static bool IsIdleSet();
 	static bool IsHighWatermarkSet();
 
+	void WriteBenchmarkReport();
+
 	bool m_Loop;
 
+	u32 m_BenchmarkLoops = 0;
+	u32 m_BenchmarkLoopsDone = 0;
+	u64 m_BenchmarkLastFrameTime = 0;
+	std::string m_BenchmarkReportPath;
+	std::vector<u64> m_BenchmarkFrameTimes;
+
 	u32 m_CurrentFrame = 0;
 	u32 m_FrameRangeStart = 0;
 	u32 m_FrameRangeEnd = 0;
@@ -13,10 +13,15 @@
 #include "Core/FifoPlayer/FifoAnalyzer.h"
 #include "Core/FifoPlayer/FifoRecordAnalyzer.h"
 #include "Core/HW/Memmap.h"
+#include "VideoCommon/RenderBase.h"
 
 static FifoRecorder instance;
 static std::recursive_mutex sMutex;
 
+// Frames per flight recording segment; a dump holds between one and two
+// segments worth of the most recent frames.
+static const u32 FLIGHT_SEGMENT_FRAMES = 30;
+
 FifoRecorder::FifoRecorder() : m_Ram(Memory::RAM_SIZE), m_ExRam(Memory::EXRAM_SIZE)
 {
 }
@@ -40,13 +45,18 @@ void FifoRecorder::StartRecording(s32 numFrames, CallbackFunc finishedCb)
 
 	m_File->SetIsWii(SConfig::GetInstance().bWii);
 
-	if (!m_IsRecording)
+	if (!m_IsRecording || m_IsFlightRecording)
 	{
 		m_WasRecording = false;
 		m_IsRecording = true;
 		m_RecordFramesRemaining = numFrames;
 	}
 
+	// A regular recording replaces a running flight recording.
+	m_IsFlightRecording = false;
+	delete m_FlightPrevFile;
+	m_FlightPrevFile = nullptr;
+
 	m_RequestedRecordingEnd = false;
 	m_FinishedCb = finishedCb;
 }
@@ -56,6 +66,63 @@ void FifoRecorder::StopRecording()
 	m_RequestedRecordingEnd = true;
 }
 
+void FifoRecorder::StartFlightRecording()
+{
+	std::lock_guard<std::recursive_mutex> lk(sMutex);
+
+	// Don't interfere with a regular recording in progress.
+	if (m_IsRecording && !m_IsFlightRecording)
+		return;
+
+	StartRecording(0, nullptr);
+	m_IsFlightRecording = true;
+}
+
+void FifoRecorder::StopFlightRecording()
+{
+	std::lock_guard<std::recursive_mutex> lk(sMutex);
+
+	if (!m_IsFlightRecording)
+		return;
+
+	m_IsFlightRecording = false;
+	m_RequestedRecordingEnd = true;
+}
+
+bool FifoRecorder::SaveFlightRecording(const std::string& filename)
+{
+	std::lock_guard<std::recursive_mutex> lk(sMutex);
+
+	if (!m_IsFlightRecording || !m_File)
+		return false;
+
+	// Both retained segments are self-contained (the memory shadows are reset
+	// at every rotation), and the older one's register snapshot stays valid
+	// across the newer one because the fifo data replays all register writes
+	// in between. So the dump is simply the older snapshot plus all frames.
+	FifoDataFile* base = m_FlightPrevFile ? m_FlightPrevFile : m_File;
+	FifoDataFile merged;
+	merged.SetIsWii(m_File->GetIsWii());
+	memcpy(merged.GetBPMem(), base->GetBPMem(), FifoDataFile::BP_MEM_SIZE * 4);
+	memcpy(merged.GetCPMem(), base->GetCPMem(), FifoDataFile::CP_MEM_SIZE * 4);
+	memcpy(merged.GetXFMem(), base->GetXFMem(), FifoDataFile::XF_MEM_SIZE * 4);
+	memcpy(merged.GetXFRegs(), base->GetXFRegs(), FifoDataFile::XF_REGS_SIZE * 4);
+	memcpy(merged.GetTexMem(), base->GetTexMem(), FifoDataFile::TEX_MEM_SIZE);
+
+	if (m_FlightPrevFile)
+	{
+		for (u32 i = 0; i < m_FlightPrevFile->GetFrameCount(); ++i)
+			merged.AddFrame(m_FlightPrevFile->GetFrame(i));
+	}
+	for (u32 i = 0; i < m_File->GetFrameCount(); ++i)
+		merged.AddFrame(m_File->GetFrame(i));
+
+	if (merged.GetFrameCount() == 0)
+		return false;
+
+	return merged.Save(filename);
+}
+
 void FifoRecorder::WriteGPCommand(const u8* data, u32 size)
 {
 	if (!m_SkipNextData)
@@ -86,6 +153,22 @@ void FifoRecorder::WriteGPCommand(const u8* data, u32 size)
 			// The file will be responsible for freeing the memory allocated for each frame's fifoData
 			m_File->AddFrame(m_CurrentFrame);
 
+			// Flight recording: once the segment is full, retire it and start a
+			// new one. Resetting the memory shadows makes the new segment
+			// re-record every piece of memory on first use, so it stays valid
+			// after the segment before it is dropped; the register snapshot is
+			// taken fresh at this frame boundary for the same reason.
+			if (m_IsFlightRecording && m_File->GetFrameCount() >= FLIGHT_SEGMENT_FRAMES)
+			{
+				delete m_FlightPrevFile;
+				m_FlightPrevFile = m_File;
+				m_File = new FifoDataFile;
+				m_File->SetIsWii(SConfig::GetInstance().bWii);
+				std::fill(m_Ram.begin(), m_Ram.end(), 0);
+				std::fill(m_ExRam.begin(), m_ExRam.end(), 0);
+				Renderer::RecordVideoMemory();
+			}
+
 			if (m_FinishedCb && m_RequestedRecordingEnd)
 				m_FinishedCb();
 		}
@@ -19,6 +19,16 @@ public:
 	void StartRecording(s32 numFrames, CallbackFunc finishedCb);
 	void StopRecording();
 
+	// Flight recording: record continuously into fixed-size segments, keeping
+	// only the current and the previous one, so the last bad frame can be
+	// saved after it has been seen. Costs nothing while not armed.
+	void StartFlightRecording();
+	void StopFlightRecording();
+	bool IsFlightRecording() const { return m_IsFlightRecording; }
+	// Writes the retained segments (between one and two segments worth of
+	// frames) as a regular .dff. Recording continues afterwards.
+	bool SaveFlightRecording(const std::string& filename);
+
 	FifoDataFile* GetRecordedFile() const { return m_File; }
 	// Called from video thread
 
@@ -54,7 +64,11 @@ private:
 	volatile s32 m_RecordFramesRemaining = 0;
 	volatile CallbackFunc m_FinishedCb = nullptr;
 
+	volatile bool m_IsFlightRecording = false;
+
 	FifoDataFile* volatile m_File = nullptr;
+	// Completed previous flight recording segment, if any.
+	FifoDataFile* m_FlightPrevFile = nullptr;
 
 	// Accessed only from video thread
 
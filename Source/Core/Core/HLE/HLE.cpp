@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <cinttypes>
 #include <map>
 
 #include "Common/CommonTypes.h"
@@ -16,6 +17,7 @@
 #include "Core/HLE/HLE_OS.h"
 #include "Core/HW/Memmap.h"
 #include "Core/IOS/ES/ES.h"
+#include "Core/PowerPC/FunctionMemo.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
 
@@ -23,8 +25,6 @@ namespace HLE
 {
 using namespace PowerPC;
 
-typedef void(*TPatchFunction)();
-
 static std::map<u32, u32> s_original_instructions;
 
 enum
@@ -67,10 +67,23 @@ static const SPatch OSPatches[] = {
 	{"___blank",                     HLE_OS::HLE_GeneralDebugPrint,         HLE_HOOK_REPLACE, HLE_TYPE_DEBUG}, // used for early init things (normally)
 	{"__write_console",              HLE_OS::HLE_write_console,             HLE_HOOK_REPLACE, HLE_TYPE_DEBUG}, // used by sysmenu (+more?)
 
+	// Accelerated string.h replacements. These only fire when a symbol map
+	// identifies the guest routines; the host implementations write straight
+	// through the emulated RAM mapping with SIMD-optimized libc code.
+	{"memset",                       HLE_Misc::HLEMemset,                   HLE_HOOK_REPLACE, HLE_TYPE_GENERIC},
+	{"memcpy",                       HLE_Misc::HLEMemcpy,                   HLE_HOOK_REPLACE, HLE_TYPE_GENERIC},
+	{"memmove",                      HLE_Misc::HLEMemmove,                  HLE_HOOK_REPLACE, HLE_TYPE_GENERIC},
+	{"bzero",                        HLE_Misc::HLEBzero,                    HLE_HOOK_REPLACE, HLE_TYPE_GENERIC},
+
+	// Installed by address on symbols FunctionMemo judges pure, not by name
+	{"HLEMemoizedFunction",          HLE_Misc::HLEMemoizedFunction,         HLE_HOOK_REPLACE, HLE_TYPE_GENERIC},
+
 	{"GeckoCodehandler",             HLE_Misc::GeckoCodeHandlerICacheFlush, HLE_HOOK_START,   HLE_TYPE_FIXED},
 	{"GeckoHandlerReturnTrampoline", HLE_Misc::GeckoReturnTrampoline,       HLE_HOOK_REPLACE, HLE_TYPE_FIXED},
 };
 
+static SHookStats s_hook_stats[ArraySize(OSPatches)];
+
 static const SPatch OSBreakPoints[] = {
 		{"FAKE_TO_SKIP_0", HLE_Misc::UnimplementedFunction, HLE_HOOK_START, HLE_TYPE_GENERIC},
 };
@@ -153,11 +166,23 @@ void PatchFunctions()
 	}
 
 	// CBreakPoints::AddBreakPoint(0x8000D3D0, false);
+
+	FunctionMemo::Install();
 }
 
 void Clear()
 {
+	for (u32 i = 1; i < ArraySize(OSPatches); ++i)
+	{
+		if (s_hook_stats[i].calls)
+		{
+			INFO_LOG(OSHLE, "HLE hook %s: %" PRIu64 " calls, ~%" PRIu64 " cycles saved",
+				OSPatches[i].m_szPatchName, s_hook_stats[i].calls, s_hook_stats[i].cycles_saved);
+		}
+		s_hook_stats[i] = {};
+	}
 	s_original_instructions.clear();
+	FunctionMemo::Clear();
 }
 
 void Reload()
@@ -172,6 +197,7 @@ void Execute(u32 _CurrentPC, u32 _Instruction)
 	unsigned int FunctionIndex = _Instruction & 0xFFFFF;
 	if (FunctionIndex > 0 && FunctionIndex < ArraySize(OSPatches))
 	{
+		s_hook_stats[FunctionIndex].calls++;
 		OSPatches[FunctionIndex].PatchFunction();
 	}
 	else
@@ -199,6 +225,36 @@ int GetFunctionFlagsByIndex(u32 index)
 	return OSPatches[index].flags;
 }
 
+TPatchFunction GetFunctionPointerByIndex(u32 index)
+{
+	if (index == 0 || index >= ArraySize(OSPatches))
+		return nullptr;
+	return OSPatches[index].PatchFunction;
+}
+
+SHookStats* GetHookStatsByIndex(u32 index)
+{
+	if (index == 0 || index >= ArraySize(OSPatches))
+		return nullptr;
+	return &s_hook_stats[index];
+}
+
+u32 GetHookIndexByName(const char* name)
+{
+	for (u32 i = 1; i < ArraySize(OSPatches); ++i)
+	{
+		if (!strcmp(OSPatches[i].m_szPatchName, name))
+			return i;
+	}
+	return 0;
+}
+
+void NoteCyclesSaved(u32 index, u64 cycles)
+{
+	if (index > 0 && index < ArraySize(OSPatches))
+		s_hook_stats[index].cycles_saved += cycles;
+}
+
 bool IsEnabled(int flags)
 {
 	return flags != HLE::HLE_TYPE_DEBUG || SConfig::GetInstance().bEnableDebugging ||
@@ -10,6 +10,16 @@
 
 namespace HLE
 {
+typedef void (*TPatchFunction)();
+
+// Per-hook runtime statistics. "cycles_saved" is a rough estimate credited
+// by hooks that replace whole guest loops (memset/memcpy and friends).
+struct SHookStats
+{
+	u64 calls;
+	u64 cycles_saved;
+};
+
 enum HookType
 {
 	HLE_HOOK_START = 0,    // Hook the beginning of the function and execute the function afterwards
@@ -38,5 +48,14 @@ u32 GetFunctionIndex(u32 em_address);
 int GetFunctionTypeByIndex(u32 index);
 int GetFunctionFlagsByIndex(u32 index);
 
+// Compile-time dispatch support: the JIT resolves a hook's function pointer
+// and stats block once when the block is compiled, so the emitted code can
+// bump the counter and call the hook directly instead of going through
+// Execute(). Both return nullptr/0 for an invalid index.
+TPatchFunction GetFunctionPointerByIndex(u32 index);
+SHookStats* GetHookStatsByIndex(u32 index);
+u32 GetHookIndexByName(const char* name);
+void NoteCyclesSaved(u32 index, u64 cycles);
+
 bool IsEnabled(int flags);
 }
@@ -2,13 +2,18 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <cstring>
+
 #include "Core/HLE/HLE_Misc.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Core/GeckoCode.h"
+#include "Core/HLE/HLE.h"
 #include "Core/HW/CPU.h"
+#include "Core/HW/Memmap.h"
 #include "Core/Host.h"
+#include "Core/PowerPC/FunctionMemo.h"
 #include "Core/PowerPC/PowerPC.h"
 
 namespace HLE_Misc
@@ -75,4 +80,128 @@ void GeckoReturnTrampoline()
 		riPS1(i) = PowerPC::HostRead_U64(SP + 24 + (2 * i + 1) * sizeof(u64));
 	}
 }
+
+// Returns a host pointer covering [address, address + size) if the whole
+// range lives in one flat emulated RAM mapping, nullptr otherwise. The
+// string.h hooks below use this to hand the range straight to the host's
+// SIMD-optimized libc routines instead of looping a byte at a time.
+static u8* HostRangePointer(u32 address, u32 size)
+{
+	if (size == 0 || !PowerPC::HostIsRAMAddress(address) ||
+		!PowerPC::HostIsRAMAddress(address + size - 1))
+		return nullptr;
+	u8* begin = Memory::GetPointer(address);
+	u8* end = Memory::GetPointer(address + size - 1);
+	if (!begin || !end || end - begin != static_cast<ptrdiff_t>(size - 1))
+		return nullptr;
+	return begin;
+}
+
+// Cycles-saved estimates below assume the guest loop managed roughly one
+// byte per cycle for stores and half that for copies. Deliberately
+// conservative; the counters are for profiling, not timing.
+
+void HLEMemset()
+{
+	u32 dest = GPR(3);
+	u32 value = GPR(4);
+	u32 size = GPR(5);
+
+	u8* ptr = HostRangePointer(dest, size);
+	if (ptr)
+	{
+		memset(ptr, value & 0xFF, size);
+	}
+	else
+	{
+		for (u32 i = 0; i < size; ++i)
+			PowerPC::HostWrite_U8(static_cast<u8>(value), dest + i);
+	}
+
+	static const u32 hook_index = HLE::GetHookIndexByName("memset");
+	HLE::NoteCyclesSaved(hook_index, size);
+
+	// memset returns its first argument, which is still in r3.
+	NPC = LR;
+}
+
+void HLEMemcpy()
+{
+	u32 dest = GPR(3);
+	u32 src = GPR(4);
+	u32 size = GPR(5);
+
+	u8* dest_ptr = HostRangePointer(dest, size);
+	u8* src_ptr = HostRangePointer(src, size);
+	if (dest_ptr && src_ptr)
+	{
+		memcpy(dest_ptr, src_ptr, size);
+	}
+	else
+	{
+		for (u32 i = 0; i < size; ++i)
+			PowerPC::HostWrite_U8(PowerPC::HostRead_U8(src + i), dest + i);
+	}
+
+	static const u32 hook_index = HLE::GetHookIndexByName("memcpy");
+	HLE::NoteCyclesSaved(hook_index, 2 * static_cast<u64>(size));
+
+	NPC = LR;
+}
+
+void HLEMemmove()
+{
+	u32 dest = GPR(3);
+	u32 src = GPR(4);
+	u32 size = GPR(5);
+
+	u8* dest_ptr = HostRangePointer(dest, size);
+	u8* src_ptr = HostRangePointer(src, size);
+	if (dest_ptr && src_ptr)
+	{
+		memmove(dest_ptr, src_ptr, size);
+	}
+	else if (dest <= src)
+	{
+		for (u32 i = 0; i < size; ++i)
+			PowerPC::HostWrite_U8(PowerPC::HostRead_U8(src + i), dest + i);
+	}
+	else
+	{
+		for (u32 i = size; i > 0; --i)
+			PowerPC::HostWrite_U8(PowerPC::HostRead_U8(src + i - 1), dest + i - 1);
+	}
+
+	static const u32 hook_index = HLE::GetHookIndexByName("memmove");
+	HLE::NoteCyclesSaved(hook_index, 2 * static_cast<u64>(size));
+
+	NPC = LR;
+}
+
+void HLEBzero()
+{
+	u32 dest = GPR(3);
+	u32 size = GPR(4);
+
+	u8* ptr = HostRangePointer(dest, size);
+	if (ptr)
+	{
+		memset(ptr, 0, size);
+	}
+	else
+	{
+		for (u32 i = 0; i < size; ++i)
+			PowerPC::HostWrite_U8(0, dest + i);
+	}
+
+	static const u32 hook_index = HLE::GetHookIndexByName("bzero");
+	HLE::NoteCyclesSaved(hook_index, size);
+
+	NPC = LR;
+}
+
+void HLEMemoizedFunction()
+{
+	FunctionMemo::HandleCall();
+}
 }
@@ -11,4 +11,9 @@ void UnimplementedFunction();
 void HBReload();
 void GeckoCodeHandlerICacheFlush();
 void GeckoReturnTrampoline();
+void HLEMemset();
+void HLEMemcpy();
+void HLEMemmove();
+void HLEBzero();
+void HLEMemoizedFunction();
 }
@@ -116,6 +116,10 @@ static u64 g_CPUCyclesPerSample = 0xFFFFFFFFFFFULL;
 static unsigned int g_AISSampleRate = 48000;
 static unsigned int g_AIDSampleRate = 32000;
 
+// Rolling hash of the scheduled audio event stream; compared across netplay
+// clients to catch audio timing divergence early.
+static u64 s_event_stream_hash = 0;
+
 void DoState(PointerWrap& p)
 {
 	p.DoPOD(m_Control);
@@ -126,6 +130,7 @@ void DoState(PointerWrap& p)
 	p.Do(g_AISSampleRate);
 	p.Do(g_AIDSampleRate);
 	p.Do(g_CPUCyclesPerSample);
+	p.Do(s_event_stream_hash);
 }
 
 static void GenerateAudioInterrupt();
@@ -135,6 +140,41 @@ static int GetAIPeriod();
 static CoreTiming::EventType* et_AI;
 static void Update(u64 userdata, s64 cyclesLate);
 
+s64 QuantizeAudioPeriod(s64 cycles)
+{
+	if (!SConfig::GetInstance().bDeterministicAudioTiming)
+		return cycles;
+	// The sample period is derived from emulated state only (AISFR), so every
+	// client computes the same boundaries. Rounding up never shortens a delay,
+	// which keeps minimum-latency requirements (e.g. the AID interrupt) intact.
+	const u64 quantum = g_CPUCyclesPerSample;
+	if (quantum == 0 || quantum > SystemTimers::GetTicksPerSecond())
+		return cycles;
+	const u64 target = CoreTiming::GetTicks() + std::max<s64>(cycles, 0);
+	const u64 aligned = target + (quantum - (target % quantum)) % quantum;
+	return static_cast<s64>(aligned - CoreTiming::GetTicks());
+}
+
+void NoteAudioEvent(u32 tag)
+{
+	if (!SConfig::GetInstance().bDeterministicAudioTiming)
+		return;
+	s_event_stream_hash ^= (static_cast<u64>(tag) << 32) ^ CoreTiming::GetTicks();
+	s_event_stream_hash *= 0x9E3779B97F4A7C15ULL;
+	s_event_stream_hash ^= s_event_stream_hash >> 29;
+}
+
+u64 GetEventStreamHash()
+{
+	return s_event_stream_hash;
+}
+
+static void ScheduleAIEvent(s64 cycles)
+{
+	CoreTiming::ScheduleEvent(QuantizeAudioPeriod(cycles), et_AI);
+	NoteAudioEvent(1);
+}
+
 void Init()
 {
 	m_Control.hex = 0;
@@ -149,6 +189,8 @@ void Init()
 	g_AISSampleRate = 48000;
 	g_AIDSampleRate = 32000;
 
+	s_event_stream_hash = 0;
+
 	et_AI = CoreTiming::RegisterEvent("AICallback", Update);
 }
 
@@ -210,7 +252,7 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 			g_LastCPUTime = CoreTiming::GetTicks();
 
 			CoreTiming::RemoveEvent(et_AI);
-			CoreTiming::ScheduleEvent(GetAIPeriod(), et_AI);
+			ScheduleAIEvent(GetAIPeriod());
 		}
 
 		// AI Interrupt
@@ -247,7 +289,7 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 		m_SampleCounter = val;
 		g_LastCPUTime = CoreTiming::GetTicks();
 		CoreTiming::RemoveEvent(et_AI);
-		CoreTiming::ScheduleEvent(GetAIPeriod(), et_AI);
+		ScheduleAIEvent(GetAIPeriod());
 	}));
 
 	mmio->Register(base | AI_INTERRUPT_TIMING, MMIO::DirectRead<u32>(&m_InterruptTiming),
@@ -256,7 +298,7 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 			PowerPC::ppcState.pc);
 		m_InterruptTiming = val;
 		CoreTiming::RemoveEvent(et_AI);
-		CoreTiming::ScheduleEvent(GetAIPeriod(), et_AI);
+		ScheduleAIEvent(GetAIPeriod());
 	}));
 }
 
@@ -314,7 +356,7 @@ static void Update(u64 userdata, s64 cyclesLate)
 			g_LastCPUTime += Samples * g_CPUCyclesPerSample;
 			IncreaseSampleCount(Samples);
 		}
-		CoreTiming::ScheduleEvent(GetAIPeriod() - cyclesLate, et_AI);
+		ScheduleAIEvent(GetAIPeriod() - cyclesLate);
 	}
 }
 
@@ -28,4 +28,17 @@ unsigned int GetAIDSampleRate();
 
 void GenerateAISInterrupt();
 
+// Deterministic audio timing (Core.DeterministicAudioTiming): rounds an audio
+// event delay up so the event lands on a cycle count that is a multiple of the
+// AI sample period, making its placement a pure function of emulated state.
+// Returns the delay unchanged when the option is off.
+s64 QuantizeAudioPeriod(s64 cycles);
+
+// Folds a scheduled audio event (tag + target cycle) into a rolling hash of
+// the audio event stream. Only call from the CPU thread.
+void NoteAudioEvent(u32 tag);
+
+// Current value of the event stream hash, compared across netplay clients.
+u64 GetEventStreamHash();
+
 }  // namespace
@@ -247,6 +247,26 @@ void EnableStepping(bool stepping)
 	}
 }
 
+void ResumeForFrameStep()
+{
+	std::lock_guard<std::mutex> stepping_lock(s_stepping_lock);
+	{
+		std::lock_guard<std::mutex> state_lock(s_state_change_lock);
+		if (!SetStateLocked(State::Running))
+			return;
+
+		// Wake the GPU thread only. Unlike RunAdjacentSystems(true) the audio
+		// stream stays muted: a TAS session steps thousands of frames an hour
+		// and toggling the sound backend for a 16ms burst each time costs more
+		// in stream restarts than it produces in audible output. The stream is
+		// unmuted again by the next real unpause through EnableStepping(false).
+		Fifo::EmulatorState(true);
+	}
+	// Notify with the state lock dropped so the CPU Thread doesn't wake up
+	// just to block on it.
+	s_state_cpu_cvar.notify_one();
+}
+
 void Break()
 {
 	std::lock_guard<std::mutex> state_lock(s_state_change_lock);
@@ -42,6 +42,14 @@ void StepOpcode(Common::Event* event = nullptr);
 // Enable or Disable Stepping. [Will deadlock if called from a system thread]
 void EnableStepping(bool stepping);
 
+// Resume the CPU Thread for a single-frame advance. [Host Thread]
+// Equivalent to EnableStepping(false) except that the audio stream stays
+// muted and the CPU Thread is woken after the locks are released, so rapid
+// frame advance does not toggle the sound backend every frame or wake the
+// CPU Thread straight into a held mutex. CPU::Break pairs with this to
+// re-enter State::Stepping at the end of the frame.
+void ResumeForFrameStep();
+
 // Breakpoint activation for system threads. Similar to EnableStepping(true).
 // NOTE: Unlike EnableStepping, this does NOT synchronize with the CPU Thread
 //   which enables it to avoid deadlocks but also makes it less safe so it
@@ -22,6 +22,8 @@
 // the just used buffer through the AXList (or whatever it might be called in
 // Nintendo games).
 
+#include <atomic>
+#include <cstring>
 #include <memory>
 
 #include "AudioCommon/AudioCommon.h"
@@ -31,6 +33,7 @@
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
 #include "Core/DSPEmulator.h"
+#include "Core/HW/AudioInterface.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/MMIO.h"
 #include "Core/HW/Memmap.h"
@@ -144,6 +147,11 @@ static bool s_dsp_is_lle = false;
 // time given to LLE DSP on every read of the high bits in a mailbox
 static const int DSP_MAIL_SLICE = 72;
 
+// Interrupt requests from the DSP emulator are delivered through zero-cycle
+// events; this mask tracks the types with an event already in flight so a
+// burst of mails schedules one event instead of one per mail.
+static std::atomic<u32> s_pending_dspemu_ints{0};
+
 void DoState(PointerWrap& p)
 {
 	if (!s_ARAM.wii_mode)
@@ -156,6 +164,12 @@ void DoState(PointerWrap& p)
 	p.Do(s_AR_REFRESH);
 	p.Do(s_dsp_slice);
 
+	// The pending-event mask must stay consistent with the CoreTiming queue
+	// serialized elsewhere in the state.
+	u32 pending_ints = s_pending_dspemu_ints.load();
+	p.Do(pending_ints);
+	s_pending_dspemu_ints.store(pending_ints);
+
 	s_dsp_emulator->DoState(p);
 }
 
@@ -188,6 +202,7 @@ void Reinit(bool hle)
 {
 	s_dsp_emulator = CreateDSPEmulator(hle);
 	s_dsp_is_lle = s_dsp_emulator->IsLLE();
+	s_pending_dspemu_ints = 0;
 
 	if (SConfig::GetInstance().bWii)
 	{
@@ -368,7 +383,9 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 			// TODO: need hardware tests for the timing of this interrupt.
 			// Sky Crawlers crashes at boot if this is scheduled less than 87 cycles in the future.
 			// Other Namco games crash too, see issue 9509. For now we will just push it to 200 cycles
-			CoreTiming::ScheduleEvent(200, s_et_GenerateDSPInterrupt, INT_AID);
+			CoreTiming::ScheduleEvent(AudioInterface::QuantizeAudioPeriod(200),
+				s_et_GenerateDSPInterrupt, INT_AID);
+			AudioInterface::NoteAudioEvent(2);
 		}
 	}));
 
@@ -404,6 +421,9 @@ static void UpdateInterrupts()
 
 static void GenerateDSPInterrupt(u64 DSPIntType, s64 cyclesLate)
 {
+	// Allow the DSP emulator to schedule a fresh event for these types again.
+	s_pending_dspemu_ints.fetch_and(~static_cast<u32>(DSPIntType));
+
 	// The INT_* enumeration members have values that reflect their bit positions in
 	// DSP_CONTROL - we mask by (INT_DSP | INT_ARAM | INT_AID) just to ensure people
 	// don't call this with bogus values.
@@ -415,6 +435,15 @@ static void GenerateDSPInterrupt(u64 DSPIntType, s64 cyclesLate)
 // CALLED FROM DSP EMULATOR, POSSIBLY THREADED
 void GenerateDSPInterruptFromDSPEmu(DSPInterruptType type)
 {
+	// The interrupt bits in DSP_CONTROL are level bits ORed in by the event,
+	// so several in-flight events for the same type are redundant. Mail
+	// bursts from the HLE ucodes (Zelda pushes an audio frame's worth of
+	// mails back to back) were queueing dozens of zero-cycle events per
+	// frame; only schedule when no event for this type is pending.
+	const u32 mask = static_cast<u32>(type);
+	if ((s_pending_dspemu_ints.fetch_or(mask) & mask) != 0)
+		return;
+
 	// TODO: Maybe rethink this? The timing is unpredictable.
 	CoreTiming::ScheduleEvent(0, s_et_GenerateDSPInterrupt, type, CoreTiming::FromThread::ANY);
 }
@@ -478,7 +507,9 @@ static void Do_ARAM_DMA()
 
 	// ARAM DMA transfer rate has been measured on real hw
 	int ticksToTransfer = (s_arDMA.Cnt.count / 32) * 246;
-	CoreTiming::ScheduleEvent(ticksToTransfer, s_et_CompleteARAM);
+	CoreTiming::ScheduleEvent(AudioInterface::QuantizeAudioPeriod(ticksToTransfer),
+		s_et_CompleteARAM);
+	AudioInterface::NoteAudioEvent(3);
 
 	// Real hardware DMAs in 32byte chunks, but we can get by with 8byte chunks
 	if (s_arDMA.Cnt.dir)
@@ -597,6 +628,20 @@ u8 ReadARAM(u32 address)
 	}
 }
 
+void ReadARAMBlock(u8* dst, u32 address, u32 size)
+{
+	// Fast path: the whole block lies in ARAM/EXRAM without wrapping the mask,
+	// so the bounds work is paid once instead of per byte.
+	if ((!s_ARAM.wii_mode || (address & 0x10000000)) && (address & s_ARAM.mask) + size <= s_ARAM.size)
+	{
+		memcpy(dst, &s_ARAM.ptr[address & s_ARAM.mask], size);
+		return;
+	}
+
+	for (u32 i = 0; i < size; i++)
+		dst[i] = ReadARAM(address + i);
+}
+
 void WriteARAM(u8 value, u32 address)
 {
 	// TODO: verify this on Wii
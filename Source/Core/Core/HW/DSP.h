@@ -73,6 +73,7 @@ void GenerateDSPInterruptFromDSPEmu(DSPInterruptType type);
 
 // Audio/DSP Helper
 u8 ReadARAM(u32 address);
+void ReadARAMBlock(u8* dst, u32 address, u32 size);
 void WriteARAM(u8 value, u32 address);
 
 // Debugger Helper
@@ -13,7 +13,7 @@ namespace DSP
 {
 namespace HLE
 {
-CMailHandler::CMailHandler()
+CMailHandler::CMailHandler() : m_read_index(0), m_write_index(0)
 {
 }
 
@@ -26,25 +26,33 @@ void CMailHandler::PushMail(u32 _Mail, bool interrupt)
 {
 	if (interrupt)
 	{
-		if (m_Mails.empty())
+		if (IsEmpty())
 		{
 			DSP::GenerateDSPInterruptFromDSPEmu(DSP::INT_DSP);
 		}
 		else
 		{
-			m_Mails.front().second = true;
+			Front().interrupt = true;
 		}
 	}
-	m_Mails.emplace(_Mail, false);
+	if (Size() == MAIL_QUEUE_SIZE)
+	{
+		// No ucode produces anywhere near a full ring of unread mails; losing
+		// one here means something upstream already went wrong.
+		ERROR_LOG(DSP_MAIL, "Mail queue overflow, dropping mail 0x%08x", _Mail);
+		return;
+	}
+	m_Mails[m_write_index & (MAIL_QUEUE_SIZE - 1)] = { _Mail, false };
+	m_write_index++;
 	DEBUG_LOG(DSP_MAIL, "DSP writes 0x%08x", _Mail);
 }
 
 u16 CMailHandler::ReadDSPMailboxHigh()
 {
 	// check if we have a mail for the core
-	if (!m_Mails.empty())
+	if (!IsEmpty())
 	{
-		u16 result = (m_Mails.front().first >> 16) & 0xFFFF;
+		u16 result = (Front().value >> 16) & 0xFFFF;
 		return result;
 	}
 	return 0x00;
@@ -53,11 +61,11 @@ u16 CMailHandler::ReadDSPMailboxHigh()
 u16 CMailHandler::ReadDSPMailboxLow()
 {
 	// check if we have a mail for the core
-	if (!m_Mails.empty())
+	if (!IsEmpty())
 	{
-		u16 result = m_Mails.front().first & 0xFFFF;
-		bool generate_interrupt = m_Mails.front().second;
-		m_Mails.pop();
+		u16 result = Front().value & 0xFFFF;
+		bool generate_interrupt = Front().interrupt;
+		m_read_index++;
 
 		if (generate_interrupt)
 		{
@@ -71,13 +79,13 @@ u16 CMailHandler::ReadDSPMailboxLow()
 
 void CMailHandler::Clear()
 {
-	while (!m_Mails.empty())
-		m_Mails.pop();
+	m_read_index = 0;
+	m_write_index = 0;
 }
 
 bool CMailHandler::IsEmpty() const
 {
-	return m_Mails.empty();
+	return m_read_index == m_write_index;
 }
 
 void CMailHandler::Halt(bool _Halt)
@@ -91,6 +99,8 @@ void CMailHandler::Halt(bool _Halt)
 
 void CMailHandler::DoState(PointerWrap& p)
 {
+	// Same wire format as the old std::queue implementation, so states stay
+	// compatible in both directions.
 	if (p.GetMode() == PointerWrap::MODE_READ)
 	{
 		Clear();
@@ -102,33 +112,22 @@ void CMailHandler::DoState(PointerWrap& p)
 			bool interrupt = false;
 			p.Do(mail);
 			p.Do(interrupt);
-			m_Mails.emplace(mail, interrupt);
+			if (Size() < MAIL_QUEUE_SIZE)
+			{
+				m_Mails[m_write_index & (MAIL_QUEUE_SIZE - 1)] = { mail, interrupt };
+				m_write_index++;
+			}
 		}
 	}
 	else  // WRITE and MEASURE
 	{
-		std::queue<std::pair<u32, bool>> temp;
-		int sz = (int)m_Mails.size();
+		int sz = (int)Size();
 		p.Do(sz);
-		for (int i = 0; i < sz; i++)
-		{
-			u32 value = m_Mails.front().first;
-			bool interrupt = m_Mails.front().second;
-			m_Mails.pop();
-			p.Do(value);
-			p.Do(interrupt);
-			temp.emplace(value, interrupt);
-		}
-		if (!m_Mails.empty())
-			PanicAlert("CMailHandler::DoState - WTF?");
-
-		// Restore queue.
-		for (int i = 0; i < sz; i++)
+		for (u32 i = m_read_index; i != m_write_index; i++)
 		{
-			u32 value = temp.front().first;
-			bool interrupt = temp.front().second;
-			temp.pop();
-			m_Mails.emplace(value, interrupt);
+			Mail& mail = m_Mails[i & (MAIL_QUEUE_SIZE - 1)];
+			p.Do(mail.value);
+			p.Do(mail.interrupt);
 		}
 	}
 }
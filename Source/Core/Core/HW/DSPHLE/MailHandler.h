@@ -4,9 +4,6 @@
 
 #pragma once
 
-#include <queue>
-#include <utility>
-
 #include "Common/CommonTypes.h"
 
 class PointerWrap;
@@ -31,8 +28,24 @@ public:
 	u16 ReadDSPMailboxLow();
 
 private:
-	// mail handler
-	std::queue<std::pair<u32, bool>> m_Mails;
+	struct Mail
+	{
+		u32 value;
+		bool interrupt;
+	};
+
+	// Mails live in a fixed ring with inline storage; the deepest the queue
+	// ever gets in practice is a ucode handshake burst of a few entries, so
+	// spilling is an error worth logging rather than a case worth heap
+	// allocation. The indices run free and are masked on access.
+	static const u32 MAIL_QUEUE_SIZE = 128;  // must be a power of two
+
+	Mail& Front() { return m_Mails[m_read_index & (MAIL_QUEUE_SIZE - 1)]; }
+	u32 Size() const { return m_write_index - m_read_index; }
+
+	Mail m_Mails[MAIL_QUEUE_SIZE];
+	u32 m_read_index;
+	u32 m_write_index;
 };
 }  // namespace HLE
 }  // namespace DSP
@@ -30,6 +30,11 @@ u8 ReadHostMemory(u32 addr)
 	return DSP::ReadARAM(addr);
 }
 
+void ReadHostMemoryBlock(u8* dst, u32 addr, u32 size)
+{
+	DSP::ReadARAMBlock(dst, addr, size);
+}
+
 void WriteHostMemory(u8 value, u32 addr)
 {
 	DSP::WriteARAM(value, addr);
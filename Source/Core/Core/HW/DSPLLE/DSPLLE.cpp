@@ -17,6 +17,7 @@
 #include "Common/Thread.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/DSP/DSPAccelerator.h"
 #include "Core/DSP/DSPCaptureLogger.h"
 #include "Core/DSP/DSPCore.h"
 #include "Core/DSP/DSPHWInterface.h"
@@ -82,6 +83,11 @@ void DSPLLE::DoState(PointerWrap& p)
 	p.Do(g_init_hax);
 	p.Do(m_cycle_count);
 
+	// ARAM contents may have changed; the accelerator prefetch window is a
+	// transient cache and just gets dropped.
+	if (p.GetMode() == PointerWrap::MODE_READ)
+		dsp_accelerator_invalidate_prefetch();
+
 	if (g_dsp_jit)
 		g_dsp_jit->DoState(p);
 }
@@ -16,6 +16,7 @@
 #include "Common/Flag.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/Swap.h"
 #include "Common/Thread.h"
 #include "Common/Timer.h"
 
@@ -25,6 +26,7 @@
 #include "Core/HW/DVD/DVDThread.h"
 #include "Core/HW/DVD/FileMonitor.h"
 #include "Core/HW/Memmap.h"
+#include "Core/HW/StreamADPCM.h"
 #include "Core/HW/SystemTimers.h"
 
 #include "DiscIO/Volume.h"
@@ -80,6 +82,26 @@ static Common::FifoQueue<ReadRequest, false> s_request_queue;
 static Common::FifoQueue<ReadResult, false> s_result_queue;
 static std::map<u64, ReadResult> s_result_map;
 
+// Speculative read-ahead. After servicing a request, the DVD thread uses its idle
+// time to read the data that follows into a small cache, so the bursts of small
+// mostly-sequential reads issued by streaming-audio titles are served warm even
+// when the host file cache is cold. All of this state belongs to the DVD thread;
+// the CPU thread only touches it while the DVD thread is stopped (WaitUntilIdle).
+struct PrefetchEntry
+{
+	u64 offset;
+	u32 length;
+	bool decrypt;
+	std::vector<u8> data;
+};
+static constexpr u32 PREFETCH_CHUNK_SIZE = 0x20000;  // 128 KiB per idle read
+static constexpr u32 PREFETCH_MAX_CHUNKS = 8;        // read up to 1 MiB past the last request
+static constexpr size_t PREFETCH_CACHE_ENTRIES = 16;
+static std::vector<PrefetchEntry> s_prefetch_cache;
+static u64 s_prefetch_offset;
+static u32 s_prefetch_chunks_left;
+static bool s_prefetch_decrypt;
+
 void Start()
 {
 	s_finish_read = CoreTiming::RegisterEvent("FinishReadDVDThread", FinishRead);
@@ -93,6 +115,9 @@ void Start()
 	// much, because this will never get exposed to the emulated game.
 	s_next_id = 0;
 
+	s_prefetch_cache.clear();
+	s_prefetch_chunks_left = 0;
+
 	StartDVDThread();
 }
 
@@ -160,6 +185,13 @@ void WaitUntilIdle()
 		s_result_queue_expanded.Wait();
 
 	StopDVDThread();
+
+	// The callers of WaitUntilIdle may be about to swap or eject the volume, which
+	// would leave the prefetched data pointing at the wrong disc. Dropping it here
+	// is conservative (savestates also lose the prefetch) but always correct.
+	s_prefetch_cache.clear();
+	s_prefetch_chunks_left = 0;
+
 	StartDVDThread();
 }
 
@@ -264,35 +296,116 @@ static void FinishRead(u64 id, s64 cycles_late)
 		buffer);
 }
 
+// Serves a read entirely from the prefetch cache if some entry fully covers it.
+static bool ReadFromPrefetchCache(const ReadRequest& request, std::vector<u8>* buffer)
+{
+	for (const PrefetchEntry& entry : s_prefetch_cache)
+	{
+		if (entry.decrypt == request.decrypt && request.dvd_offset >= entry.offset &&
+			request.dvd_offset + request.length <= entry.offset + entry.length)
+		{
+			const u8* src = entry.data.data() + (request.dvd_offset - entry.offset);
+			buffer->assign(src, src + request.length);
+			return true;
+		}
+	}
+	return false;
+}
+
+static void PrefetchNextChunk()
+{
+	PrefetchEntry entry;
+	entry.offset = s_prefetch_offset;
+	entry.length = PREFETCH_CHUNK_SIZE;
+	entry.decrypt = s_prefetch_decrypt;
+	entry.data.resize(PREFETCH_CHUNK_SIZE);
+
+	const DiscIO::IVolume& volume = DVDInterface::GetVolume();
+	if (!volume.Read(entry.offset, entry.length, entry.data.data(), entry.decrypt))
+	{
+		// Most likely we speculated past the end of the disc or partition;
+		// stop until the next real read gives us a new starting point.
+		s_prefetch_chunks_left = 0;
+		return;
+	}
+
+	if (s_prefetch_cache.size() >= PREFETCH_CACHE_ENTRIES)
+		s_prefetch_cache.erase(s_prefetch_cache.begin());
+	s_prefetch_cache.emplace_back(std::move(entry));
+
+	s_prefetch_offset += PREFETCH_CHUNK_SIZE;
+	s_prefetch_chunks_left--;
+}
+
+// Decodes a chunk of DTK ADPCM into byte-swapped PCM, replacing the buffer
+// contents. This runs on the DVD thread, so the CPU-thread reply handler only
+// has to hand finished samples to the mixer. The filter history in StreamADPCM
+// needs no locking: the DTK chain keeps at most one read in flight, and the
+// CPU thread only resets the filter between completed chunks (AdvanceDTK) or
+// while streaming is off (the stream-start command), never during a decode.
+static void DecodeDTK(std::vector<u8>* buffer)
+{
+	const size_t block_count = buffer->size() / StreamADPCM::ONE_BLOCK_SIZE;
+	std::vector<u8> pcm(block_count * StreamADPCM::SAMPLES_PER_BLOCK * 2 * sizeof(s16));
+	s16* out = reinterpret_cast<s16*>(pcm.data());
+	for (size_t i = 0; i < block_count; ++i)
+	{
+		StreamADPCM::DecodeBlock(out, buffer->data() + i * StreamADPCM::ONE_BLOCK_SIZE);
+		// TODO: Fix the mixer so it can accept non-byte-swapped samples.
+		for (size_t j = 0; j < StreamADPCM::SAMPLES_PER_BLOCK * 2; ++j)
+			out[j] = Common::swap16(out[j]);
+		out += StreamADPCM::SAMPLES_PER_BLOCK * 2;
+	}
+	*buffer = std::move(pcm);
+}
+
 static void DVDThread()
 {
 	Common::SetCurrentThreadName("DVD thread");
 
 	while (true)
 	{
-		s_request_queue_expanded.Wait();
-
 		if (s_dvd_thread_exiting.IsSet())
 			return;
 
 		ReadRequest request;
-		while (s_request_queue.Pop(request))
+		if (s_request_queue.Pop(request))
 		{
 			FileMonitor::Log(request.dvd_offset, request.decrypt);
 
 			std::vector<u8> buffer(request.length);
-			const DiscIO::IVolume& volume = DVDInterface::GetVolume();
-			if (!volume.Read(request.dvd_offset, request.length, buffer.data(), request.decrypt))
-				buffer.resize(0);
+			if (!ReadFromPrefetchCache(request, &buffer))
+			{
+				const DiscIO::IVolume& volume = DVDInterface::GetVolume();
+				if (!volume.Read(request.dvd_offset, request.length, buffer.data(), request.decrypt))
+					buffer.resize(0);
+			}
 
 			request.realtime_done_us = Common::Timer::GetTimeUs();
 
+			if (request.reply_type == DVDInterface::ReplyType::DTK && !buffer.empty())
+				DecodeDTK(&buffer);
+
+			// Predict that the game will keep reading forwards from here.
+			s_prefetch_offset = request.dvd_offset + request.length;
+			s_prefetch_chunks_left = PREFETCH_MAX_CHUNKS;
+			s_prefetch_decrypt = request.decrypt;
+
 			s_result_queue.Push(ReadResult(std::move(request), std::move(buffer)));
 			s_result_queue_expanded.Set();
 
-			if (s_dvd_thread_exiting.IsSet())
-				return;
+			continue;
 		}
+
+		// No request pending: spend the idle time reading ahead, one chunk at a
+		// time so a new request or an exit never waits for more than one chunk.
+		if (s_prefetch_chunks_left > 0)
+		{
+			PrefetchNextChunk();
+			continue;
+		}
+
+		s_request_queue_expanded.Wait();
 	}
 }
 }
@@ -4,6 +4,7 @@
 
 #include "Core/HW/EXI/EXI_Device.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "Common/CommonTypes.h"
@@ -46,22 +47,39 @@ void IEXIDevice::ImmReadWrite(u32& data, u32 size)
 {
 }
 
+// The generic DMA handlers copy the guest span in one go and feed the device's
+// byte-level state machine from a local buffer, instead of doing a full
+// Memory:: access (with address translation and MMIO checks) per byte.
+// Devices with true block semantics (memory card, ethernet) override these
+// entirely and memcpy straight to their backing store.
 void IEXIDevice::DMAWrite(u32 address, u32 size)
 {
-	while (size--)
+	u8 buffer[512];
+	while (size != 0)
 	{
-		u8 byte = Memory::Read_U8(address++);
-		TransferByte(byte);
+		const u32 chunk = std::min(size, static_cast<u32>(sizeof(buffer)));
+		Memory::CopyFromEmu(buffer, address, chunk);
+		for (u32 i = 0; i < chunk; ++i)
+			TransferByte(buffer[i]);
+		address += chunk;
+		size -= chunk;
 	}
 }
 
 void IEXIDevice::DMARead(u32 address, u32 size)
 {
-	while (size--)
+	u8 buffer[512];
+	while (size != 0)
 	{
-		u8 byte = 0;
-		TransferByte(byte);
-		Memory::Write_U8(byte, address++);
+		const u32 chunk = std::min(size, static_cast<u32>(sizeof(buffer)));
+		for (u32 i = 0; i < chunk; ++i)
+		{
+			buffer[i] = 0;
+			TransferByte(buffer[i]);
+		}
+		Memory::CopyToEmu(address, buffer, chunk);
+		address += chunk;
+		size -= chunk;
 	}
 }
 
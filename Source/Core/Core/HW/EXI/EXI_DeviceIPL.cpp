@@ -4,7 +4,9 @@
 
 #include "Core/HW/EXI/EXI_DeviceIPL.h"
 
+#include <algorithm>
 #include <cstring>
+#include <vector>
 
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
@@ -17,6 +19,7 @@
 #include "Common/Swap.h"
 #include "Common/Timer.h"
 
+#include "Core/Boot/BootAssetCache.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -159,6 +162,17 @@ void CEXIIPL::DoState(PointerWrap& p)
 
 void CEXIIPL::LoadFileToIPL(const std::string& filename, u32 offset)
 {
+	// Boot assets are usually staged in memory before the CPU thread needs
+	// them; only hit the disk if the preload missed.
+	std::vector<u8> preloaded;
+	if (BootAssetCache::GetFile(filename, &preloaded))
+	{
+		memcpy(m_pIPL + offset, preloaded.data(),
+			static_cast<size_t>(std::min<u64>(preloaded.size(), ROM_SIZE - offset)));
+		m_FontsLoaded = true;
+		return;
+	}
+
 	File::IOFile stream(filename, "rb");
 	if (!stream)
 		return;
@@ -200,11 +214,6 @@ void CEXIIPL::LoadFontFile(const std::string& filename, u32 offset)
 
 	if (File::Exists(ipl_rom_path))
 	{
-		// The user has an IPL dump, load the font from it
-		File::IOFile stream(ipl_rom_path, "rb");
-		if (!stream)
-			return;
-
 		// Official Windows-1252 and Shift JIS fonts present on the IPL dumps are 0x2575 and 0x4a24d
 		// bytes long respectively, so, determine the size of the font being loaded based on the offset
 		u64 fontsize = (offset == 0x1aff00) ? 0x4a24d : 0x2575;
@@ -212,6 +221,20 @@ void CEXIIPL::LoadFontFile(const std::string& filename, u32 offset)
 		INFO_LOG(BOOT, "Found IPL dump, loading %s font from %s",
 			((offset == 0x1aff00) ? "Shift JIS" : "Windows-1252"), (ipl_rom_path).c_str());
 
+		// The preloader stages the whole dump, which covers both fonts.
+		std::vector<u8> preloaded;
+		if (BootAssetCache::GetFile(ipl_rom_path, &preloaded) && preloaded.size() >= offset + fontsize)
+		{
+			memcpy(m_pIPL + offset, preloaded.data() + offset, static_cast<size_t>(fontsize));
+			m_FontsLoaded = true;
+			return;
+		}
+
+		// The user has an IPL dump, load the font from it
+		File::IOFile stream(ipl_rom_path, "rb");
+		if (!stream)
+			return;
+
 		stream.Seek(offset, 0);
 		stream.ReadBytes(m_pIPL + offset, fontsize);
 
@@ -33,6 +33,8 @@ public:
 
 	static void Descrambler(u8* data, u32 size);
 
+	static std::string FindIPLDump(const std::string& path_prefix);
+
 private:
 	enum
 	{
@@ -76,6 +78,5 @@ private:
 	u32 CommandRegion() const { return (m_uAddress & ~(1 << 31)) >> 8; }
 	void LoadFileToIPL(const std::string& filename, u32 offset);
 	void LoadFontFile(const std::string& filename, u32 offset);
-	std::string FindIPLDump(const std::string& path_prefix);
 };
 }  // namespace ExpansionInterface
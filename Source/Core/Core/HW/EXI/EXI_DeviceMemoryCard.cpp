@@ -507,7 +507,15 @@ IEXIDevice* CEXIMemoryCard::FindDevice(TEXIDevices device_type, int customIndex)
 // read all at once instead of single byte at a time as done by IEXIDevice::DMARead
 void CEXIMemoryCard::DMARead(u32 _uAddr, u32 _uSize)
 {
-	memorycard->Read(address, _uSize, Memory::GetPointer(_uAddr));
+	// Validate the destination range once instead of trusting the start pointer
+	// for the whole transfer.
+	u8* dest = Memory::GetPointerForRange(_uAddr, _uSize);
+	if (!dest)
+	{
+		PanicAlert("Invalid range in memory card DMA read. %x bytes to 0x%08x", _uSize, _uAddr);
+		return;
+	}
+	memorycard->Read(address, _uSize, dest);
 
 	if ((address + _uSize) % BLOCK_SIZE == 0)
 	{
@@ -523,7 +531,13 @@ void CEXIMemoryCard::DMARead(u32 _uAddr, u32 _uSize)
 // write all at once instead of single byte at a time as done by IEXIDevice::DMAWrite
 void CEXIMemoryCard::DMAWrite(u32 _uAddr, u32 _uSize)
 {
-	memorycard->Write(address, _uSize, Memory::GetPointer(_uAddr));
+	u8* src = Memory::GetPointerForRange(_uAddr, _uSize);
+	if (!src)
+	{
+		PanicAlert("Invalid range in memory card DMA write. %x bytes from 0x%08x", _uSize, _uAddr);
+		return;
+	}
+	memorycard->Write(address, _uSize, src);
 
 	if (((address + _uSize) % BLOCK_SIZE) == 0)
 	{
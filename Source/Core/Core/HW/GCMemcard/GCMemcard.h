@@ -291,7 +291,12 @@ public:
 	std::vector<GCMBlock> m_save_data;
 	std::vector<u16> m_used_blocks;
 	int UsesBlock(u16 blocknum);
+	void MarkBlockDirty(int block_num);
 	bool m_dirty;
+	// Which save blocks changed since the last flush, indexed like
+	// m_save_data. Lets the flush update just the touched parts of an
+	// existing .gci file instead of rewriting the whole thing.
+	std::vector<u8> m_dirty_blocks;
 	std::string m_filename;
 };
 
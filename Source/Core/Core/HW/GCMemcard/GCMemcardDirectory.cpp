@@ -423,6 +423,7 @@ inline void GCMemcardDirectory::SyncSaves()
 					INFO_LOG(EXPANSIONINTERFACE, "Save moved from 0x%x to 0x%x", old_start, new_start);
 					m_saves[i].m_used_blocks.clear();
 					m_saves[i].m_save_data.clear();
+					m_saves[i].m_dirty_blocks.clear();
 				}
 				if (m_saves[i].m_used_blocks.size() == 0)
 				{
@@ -437,6 +438,7 @@ inline void GCMemcardDirectory::SyncSaves()
 			*(u32*)&(m_saves[i].m_gci_header.Gamecode) = 0xFFFFFFFF;
 			m_saves[i].m_save_data.clear();
 			m_saves[i].m_used_blocks.clear();
+			m_saves[i].m_dirty_blocks.clear();
 			m_saves[i].m_dirty = true;
 		}
 	}
@@ -467,7 +469,7 @@ inline s32 GCMemcardDirectory::SaveAreaRW(u32 block, bool writing)
 
 				if (writing)
 				{
-					m_saves[i].m_dirty = true;
+					m_saves[i].MarkBlockDirty(idx);
 				}
 
 				m_last_block = block;
@@ -535,96 +537,154 @@ bool GCMemcardDirectory::SetUsedBlocks(int save_index)
 
 void GCMemcardDirectory::FlushToFile()
 {
-	std::unique_lock<std::mutex> l(m_write_mutex);
-	int errors = 0;
-	DEntry invalid;
-	for (u16 i = 0; i < m_saves.size(); ++i)
+	// Snapshot everything that needs to hit the disk while holding the write mutex,
+	// then perform the actual file I/O without it. Holding the mutex across the
+	// writes stalls the CPU thread's next Write() for as long as the host storage
+	// takes, which is very noticeable when the save directory lives on a network
+	// mount and a game autosaves.
+	struct FlushEntry
+	{
+		std::string filename;
+		DEntry header;
+		std::vector<GCMBlock> blocks;
+		// Empty with write_all unset means only the header changed.
+		std::vector<u8> dirty_blocks;
+		bool write_all;
+	};
+	std::vector<FlushEntry> pending_writes;
+	std::vector<std::string> pending_deletions;
+
 	{
-		if (m_saves[i].m_dirty)
+		std::unique_lock<std::mutex> l(m_write_mutex);
+		for (u16 i = 0; i < m_saves.size(); ++i)
 		{
-			if (BE32(m_saves[i].m_gci_header.Gamecode) != 0xFFFFFFFF)
+			if (m_saves[i].m_dirty)
 			{
-				m_saves[i].m_dirty = false;
-				if (m_saves[i].m_save_data.size() == 0)
-				{
-					// The save's header has been changed but the actual save blocks haven't been read/written
-					// to
-					// skip flushing this file until actual save data is modified
-					ERROR_LOG(EXPANSIONINTERFACE,
-						"GCI header modified without corresponding save data changes");
-					continue;
-				}
-				if (m_saves[i].m_filename.empty())
-				{
-					std::string default_save_name = m_save_directory + m_saves[i].m_gci_header.GCI_FileName();
-
-					// Check to see if another file is using the same name
-					// This seems unlikely except in the case of file corruption
-					// otherwise what user would name another file this way?
-					for (int j = 0; File::Exists(default_save_name) && j < 10; ++j)
-					{
-						default_save_name.insert(default_save_name.end() - 4, '0');
-					}
-					if (File::Exists(default_save_name))
-						PanicAlertT("Failed to find new filename.\n%s\n will be overwritten",
-							default_save_name.c_str());
-					m_saves[i].m_filename = default_save_name;
-				}
-				File::IOFile gci(m_saves[i].m_filename, "wb");
-				if (gci)
+				if (BE32(m_saves[i].m_gci_header.Gamecode) != 0xFFFFFFFF)
 				{
-					gci.WriteBytes(&m_saves[i].m_gci_header, DENTRY_SIZE);
-					gci.WriteBytes(m_saves[i].m_save_data.data(), BLOCK_SIZE * m_saves[i].m_save_data.size());
-
-					if (gci.IsGood())
+					m_saves[i].m_dirty = false;
+					if (m_saves[i].m_save_data.size() == 0)
 					{
-						Core::DisplayMessage(
-							StringFromFormat("Wrote save contents to %s", m_saves[i].m_filename.c_str()), 4000);
+						// The save's header has been changed but the actual save blocks haven't been
+						// read/written to
+						// skip flushing this file until actual save data is modified
+						ERROR_LOG(EXPANSIONINTERFACE,
+							"GCI header modified without corresponding save data changes");
+						continue;
 					}
-					else
+					bool write_all = false;
+					if (m_saves[i].m_filename.empty())
 					{
-						++errors;
-						Core::DisplayMessage(StringFromFormat("Failed to write save contents to %s",
-							m_saves[i].m_filename.c_str()),
-							4000);
-						ERROR_LOG(EXPANSIONINTERFACE, "Failed to save data to %s",
-							m_saves[i].m_filename.c_str());
+						std::string default_save_name = m_save_directory + m_saves[i].m_gci_header.GCI_FileName();
+
+						// Check to see if another file is using the same name
+						// This seems unlikely except in the case of file corruption
+						// otherwise what user would name another file this way?
+						// Naming a brand new save happens rarely enough that the probing can stay
+						// under the mutex.
+						for (int j = 0; File::Exists(default_save_name) && j < 10; ++j)
+						{
+							default_save_name.insert(default_save_name.end() - 4, '0');
+						}
+						if (File::Exists(default_save_name))
+							PanicAlertT("Failed to find new filename.\n%s\n will be overwritten",
+								default_save_name.c_str());
+						m_saves[i].m_filename = default_save_name;
+						write_all = true;
 					}
+					pending_writes.push_back(FlushEntry{ m_saves[i].m_filename, m_saves[i].m_gci_header,
+						m_saves[i].m_save_data, m_saves[i].m_dirty_blocks, write_all });
+					m_saves[i].m_dirty_blocks.clear();
+				}
+				else if (m_saves[i].m_filename.length() != 0)
+				{
+					m_saves[i].m_dirty = false;
+					pending_deletions.push_back(m_saves[i].m_filename);
+					m_saves[i].m_filename.clear();
+					m_saves[i].m_save_data.clear();
+					m_saves[i].m_used_blocks.clear();
 				}
 			}
-			else if (m_saves[i].m_filename.length() != 0)
+
+			// Unload the save data for any game that is not running
+			// we could use !m_dirty, but some games have multiple gci files and may not write to them
+			// simultaneously
+			// this ensures that the save data for all of the current games gci files are stored in the
+			// savestate
+			// Any dirty data was copied into pending_writes above, so clearing here is safe.
+			u32 gamecode = BE32(m_saves[i].m_gci_header.Gamecode);
+			if (gamecode != m_game_id && gamecode != 0xFFFFFFFF && m_saves[i].m_save_data.size())
 			{
-				m_saves[i].m_dirty = false;
-				std::string& old_name = m_saves[i].m_filename;
-				std::string deleted_name = old_name + ".deleted";
-				if (File::Exists(deleted_name))
-					File::Delete(deleted_name);
-				File::Rename(old_name, deleted_name);
-				m_saves[i].m_filename.clear();
+				INFO_LOG(EXPANSIONINTERFACE, "Flushing savedata to disk for %s",
+					m_saves[i].m_filename.c_str());
 				m_saves[i].m_save_data.clear();
-				m_saves[i].m_used_blocks.clear();
 			}
 		}
+#if _WRITE_MC_HEADER
+		u8 mc[BLOCK_SIZE * MC_FST_BLOCKS];
+		Read(0, BLOCK_SIZE * MC_FST_BLOCKS, mc);
+		File::IOFile hdrfile(m_save_directory + MC_HDR, "wb");
+		hdrfile.WriteBytes(mc, BLOCK_SIZE * MC_FST_BLOCKS);
+#endif
+	}
+
+	for (const std::string& old_name : pending_deletions)
+	{
+		std::string deleted_name = old_name + ".deleted";
+		if (File::Exists(deleted_name))
+			File::Delete(deleted_name);
+		File::Rename(old_name, deleted_name);
+	}
 
-		// Unload the save data for any game that is not running
-		// we could use !m_dirty, but some games have multiple gci files and may not write to them
-		// simultaneously
-		// this ensures that the save data for all of the current games gci files are stored in the
-		// savestate
-		u32 gamecode = BE32(m_saves[i].m_gci_header.Gamecode);
-		if (gamecode != m_game_id && gamecode != 0xFFFFFFFF && m_saves[i].m_save_data.size())
+	for (const FlushEntry& entry : pending_writes)
+	{
+		// When the .gci already exists with the right size, only the header and
+		// the blocks that actually changed are written; a full rewrite is kept
+		// for new files, resized saves and failed partial updates.
+		if (!entry.write_all)
 		{
-			INFO_LOG(EXPANSIONINTERFACE, "Flushing savedata to disk for %s",
-				m_saves[i].m_filename.c_str());
-			m_saves[i].m_save_data.clear();
+			File::IOFile gci(entry.filename, "r+b");
+			if (gci && gci.GetSize() == DENTRY_SIZE + BLOCK_SIZE * entry.blocks.size())
+			{
+				bool good = gci.WriteBytes(&entry.header, DENTRY_SIZE);
+				const size_t num_blocks = std::min(entry.dirty_blocks.size(), entry.blocks.size());
+				for (size_t i = 0; i < num_blocks && good; ++i)
+				{
+					if (!entry.dirty_blocks[i])
+						continue;
+					good = gci.Seek(DENTRY_SIZE + i * BLOCK_SIZE, SEEK_SET) &&
+						gci.WriteBytes(&entry.blocks[i], BLOCK_SIZE);
+				}
+				if (good && gci.IsGood())
+				{
+					Core::DisplayMessage(
+						StringFromFormat("Wrote save contents to %s", entry.filename.c_str()), 4000);
+					continue;
+				}
+				ERROR_LOG(EXPANSIONINTERFACE, "Partial update of %s failed, rewriting the whole file",
+					entry.filename.c_str());
+			}
+		}
+
+		File::IOFile gci(entry.filename, "wb");
+		if (gci)
+		{
+			gci.WriteBytes(&entry.header, DENTRY_SIZE);
+			gci.WriteBytes(entry.blocks.data(), BLOCK_SIZE * entry.blocks.size());
+
+			if (gci.IsGood())
+			{
+				Core::DisplayMessage(
+					StringFromFormat("Wrote save contents to %s", entry.filename.c_str()), 4000);
+			}
+			else
+			{
+				Core::DisplayMessage(
+					StringFromFormat("Failed to write save contents to %s", entry.filename.c_str()), 4000);
+				ERROR_LOG(EXPANSIONINTERFACE, "Failed to save data to %s", entry.filename.c_str());
+			}
 		}
 	}
-#if _WRITE_MC_HEADER
-	u8 mc[BLOCK_SIZE * MC_FST_BLOCKS];
-	Read(0, BLOCK_SIZE * MC_FST_BLOCKS, mc);
-	File::IOFile hdrfile(m_save_directory + MC_HDR, "wb");
-	hdrfile.WriteBytes(mc, BLOCK_SIZE * MC_FST_BLOCKS);
-#endif
 }
 
 void GCMemcardDirectory::DoState(PointerWrap& p)
@@ -682,10 +742,21 @@ int GCIFile::UsesBlock(u16 block_num)
 	return -1;
 }
 
+void GCIFile::MarkBlockDirty(int block_num)
+{
+	m_dirty = true;
+	if (block_num < 0)
+		return;
+	if (static_cast<size_t>(block_num) >= m_dirty_blocks.size())
+		m_dirty_blocks.resize(block_num + 1, 0);
+	m_dirty_blocks[block_num] = 1;
+}
+
 void GCIFile::DoState(PointerWrap& p)
 {
 	p.DoPOD<DEntry>(m_gci_header);
 	p.Do(m_dirty);
+	p.Do(m_dirty_blocks);
 	p.Do(m_filename);
 	int num_blocks = (int)m_save_data.size();
 	p.Do(num_blocks);
@@ -15,8 +15,8 @@ enum
 	GATHER_PIPE_SIZE = 32
 };
 
-// pipe pointer for JIT access
-extern u8* g_gather_pipe_ptr;
+// The write position lives in PowerPC::ppcState.gather_pipe_ptr so the JIT
+// can access it cheaply.
 
 // Init
 void Init();
@@ -2,10 +2,13 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <array>
+#include <cinttypes>
 #include <functional>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
 #include "Core/HW/MMIO.h"
 #include "Core/HW/MMIOHandlers.h"
 
@@ -376,6 +379,26 @@ void WriteHandler<T>::ResetMethod(WriteHandlingMethod<T>* method)
 	m_WriteFunc = v.ret;
 }
 
+static std::array<u64, NUM_MMIOS> s_generic_dispatch_counters;
+
+u64* GetGenericDispatchCounter(u32 address)
+{
+	return &s_generic_dispatch_counters[UniqueID(address)];
+}
+
+void LogGenericDispatchCounters()
+{
+	for (u32 id = 0; id < NUM_MMIOS; ++id)
+	{
+		if (!s_generic_dispatch_counters[id])
+			continue;
+		u32 address = ((id & 0x10000) ? 0x0D000000 : 0x0C000000) | (id & 0xFFFF);
+		INFO_LOG(MEMMAP, "MMIO %08x took the generic dispatch path %" PRIu64 " times", address,
+			s_generic_dispatch_counters[id]);
+	}
+	s_generic_dispatch_counters.fill(0);
+}
+
 // Define all the public specializations that are exported in MMIOHandlers.h.
 #define MaybeExtern
 MMIO_PUBLIC_SPECIALIZATIONS()
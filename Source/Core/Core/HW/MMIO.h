@@ -70,6 +70,13 @@ inline u32 UniqueID(u32 address)
 	return (((address >> 24) & 1) << 16) | (address & 0xFFFF);
 }
 
+// The JIT inlines Constant/Direct/Nop handlers for accesses at constant
+// folded addresses; accesses which still go through a Complex handler bump
+// the counter for their register at runtime. Dumping the counters shows
+// which registers still pay for generic dispatch in hot loops.
+u64* GetGenericDispatchCounter(u32 address);
+void LogGenericDispatchCounters();
+
 // Some utilities functions to define MMIO mappings.
 namespace Utils
 {
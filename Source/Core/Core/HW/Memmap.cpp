@@ -7,14 +7,20 @@
 // However, if a JITed instruction (for example lwz) wants to access a bad memory area that call
 // may be redirected here (for example to Read_U32()).
 
+#include <algorithm>
 #include <cstring>
+#include <map>
 #include <memory>
+#include <vector>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemArena.h"
+#include "Common/MemoryUtil.h"
 #include "Common/Swap.h"
+#include "Common/SwapCopy.h"
+#include "Common/ThreadPool.h"
 #include "Core/ConfigManager.h"
 #include "Core/HW/AudioInterface.h"
 #include "Core/HW/DSP.h"
@@ -162,6 +168,12 @@ static PhysicalMemoryRegion physical_regions[] = {
 
 static std::vector<LogicalMemoryView> logical_mapped_entries;
 
+// Page-table translations mirrored into the logical region, keyed by the
+// logical page address. Managed by the MMU: established when a page is
+// translated for a write, dropped again on tlbie and BAT changes.
+constexpr u32 LOGICAL_PAGE_SIZE = 0x1000;
+static std::map<u32, LogicalMemoryView> logical_page_entries;
+
 void Init()
 {
 	bool wii = SConfig::GetInstance().bWii;
@@ -227,6 +239,9 @@ void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 		g_arena.ReleaseView(entry.mapped_pointer, entry.mapped_size);
 	}
 	logical_mapped_entries.clear();
+	// The translation context changed, so the per-page mirrors are stale too.
+	// They re-establish themselves on the next translated write.
+	UnmapLogicalPages();
 	for (u32 i = 0; i < dbat_table.size(); ++i)
 	{
 		if (dbat_table[i] & PowerPC::BAT_PHYSICAL_BIT)
@@ -261,6 +276,109 @@ void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 	}
 }
 
+void PreTouchViews()
+{
+	if (!m_IsInitialized)
+		return;
+
+	// A savestate load rewrites guest RAM through the m_pXXX views, but fastmem
+	// accesses go through the physical_base/logical_base mirrors, and page-table
+	// entries are per mapping: the mirrors fault page by page once the core
+	// resumes. Collect every live view and fault them in here instead.
+	struct Range
+	{
+		u8* ptr;
+		size_t size;
+	};
+	std::vector<Range> ranges;
+	const bool fastmem = SConfig::GetInstance().bFastmem;
+	for (const PhysicalMemoryRegion& region : physical_regions)
+	{
+		if (!*region.out_pointer)
+			continue;
+		ranges.push_back({ *region.out_pointer, region.size });
+		if (fastmem && physical_base)
+			ranges.push_back({ physical_base + region.physical_address, region.size });
+	}
+	if (fastmem && logical_base)
+	{
+		for (const LogicalMemoryView& entry : logical_mapped_entries)
+			ranges.push_back({ static_cast<u8*>(entry.mapped_pointer), entry.mapped_size });
+	}
+
+	// Let the kernel start faulting the ranges in before we walk them.
+	for (const Range& range : ranges)
+		Common::AdviseWillNeed(range.ptr, range.size);
+
+	// The batch is only used as a fork/join across the worker pool here; the
+	// ordered commit halves stay empty.
+	Common::OrderedWorkBatch batch;
+	const size_t SLICE_SIZE = 4 * 1024 * 1024;
+	for (const Range& range : ranges)
+	{
+		for (size_t offset = 0; offset < range.size; offset += SLICE_SIZE)
+		{
+			const u8* slice_ptr = range.ptr + offset;
+			const size_t slice_size = std::min(SLICE_SIZE, range.size - offset);
+			batch.Add([slice_ptr, slice_size] { Common::PreTouchMemory(slice_ptr, slice_size); },
+				[] {});
+		}
+	}
+	batch.Run();
+}
+
+void MapLogicalPage(u32 logical_address, u32 translated_address)
+{
+#ifndef _ARCH_32
+	if (!logical_base || !SConfig::GetInstance().bFastmem)
+		return;
+
+	// Watched pages must keep faulting so the page-protection watchpoint
+	// engine sees accesses to them; never mirror them into the fast path.
+	if (PowerPC::memchecks.OverlapsMemcheck(logical_address, LOGICAL_PAGE_SIZE))
+		return;
+
+	for (const PhysicalMemoryRegion& physical_region : physical_regions)
+	{
+		u32 mapping_address = physical_region.physical_address;
+		if (!*physical_region.out_pointer || translated_address < mapping_address ||
+			translated_address + LOGICAL_PAGE_SIZE > mapping_address + physical_region.size)
+		{
+			continue;
+		}
+
+		UnmapLogicalPage(logical_address);
+
+		u32 position = physical_region.shm_position + translated_address - mapping_address;
+		u8* base = logical_base + logical_address;
+		void* mapped_pointer = g_arena.CreateView(position, LOGICAL_PAGE_SIZE, base);
+		// Failing to map is not fatal; the page simply keeps taking the slow
+		// path through the MMU.
+		if (mapped_pointer)
+			logical_page_entries[logical_address] = { mapped_pointer, LOGICAL_PAGE_SIZE };
+		return;
+	}
+#endif
+}
+
+void UnmapLogicalPage(u32 logical_address)
+{
+	auto it = logical_page_entries.find(logical_address);
+	if (it == logical_page_entries.end())
+		return;
+	g_arena.ReleaseView(it->second.mapped_pointer, it->second.mapped_size);
+	logical_page_entries.erase(it);
+}
+
+void UnmapLogicalPages()
+{
+	for (auto& entry : logical_page_entries)
+	{
+		g_arena.ReleaseView(entry.second.mapped_pointer, entry.second.mapped_size);
+	}
+	logical_page_entries.clear();
+}
+
 void DoState(PointerWrap& p)
 {
 	bool wii = SConfig::GetInstance().bWii;
@@ -278,6 +396,7 @@ void DoState(PointerWrap& p)
 void Shutdown()
 {
 	m_IsInitialized = false;
+	MMIO::LogGenericDispatchCounters();
 	u32 flags = 0;
 	if (SConfig::GetInstance().bWii)
 		flags |= PhysicalMemoryRegion::WII_ONLY;
@@ -295,6 +414,7 @@ void Shutdown()
 		g_arena.ReleaseView(entry.mapped_pointer, entry.mapped_size);
 	}
 	logical_mapped_entries.clear();
+	UnmapLogicalPages();
 	g_arena.ReleaseSHMSegment();
 	physical_base = nullptr;
 	logical_base = nullptr;
@@ -314,7 +434,7 @@ void Clear()
 		memset(m_pEXRAM, 0, EXRAM_SIZE);
 }
 
-static inline u8* GetPointerForRange(u32 address, size_t size)
+u8* GetPointerForRange(u32 address, size_t size)
 {
 	// Make sure we don't have a range spanning 2 separate banks
 	if (size >= EXRAM_SIZE)
@@ -356,6 +476,43 @@ void CopyToEmu(u32 address, const void* data, size_t size)
 	memcpy(pointer, data, size);
 }
 
+template <typename T>
+void CopyFromEmuSwapped(T* data, u32 address, size_t size)
+{
+	if (size == 0)
+		return;
+
+	const u8* src = GetPointerForRange(address, size);
+	if (!src)
+	{
+		PanicAlert("Invalid range in CopyFromEmuSwapped. %zx bytes from 0x%08x", size, address);
+		return;
+	}
+	Common::CopySwapped(data, reinterpret_cast<const T*>(src), size / sizeof(T));
+}
+
+template <typename T>
+void CopyToEmuSwapped(u32 address, const T* data, size_t size)
+{
+	if (size == 0)
+		return;
+
+	u8* dest = GetPointerForRange(address, size);
+	if (!dest)
+	{
+		PanicAlert("Invalid range in CopyToEmuSwapped. %zx bytes to 0x%08x", size, address);
+		return;
+	}
+	Common::CopySwapped(reinterpret_cast<T*>(dest), data, size / sizeof(T));
+}
+
+template void CopyFromEmuSwapped<u16>(u16*, u32, size_t);
+template void CopyFromEmuSwapped<u32>(u32*, u32, size_t);
+template void CopyFromEmuSwapped<u64>(u64*, u32, size_t);
+template void CopyToEmuSwapped<u16>(u32, const u16*, size_t);
+template void CopyToEmuSwapped<u32>(u32, const u32*, size_t);
+template void CopyToEmuSwapped<u64>(u32, const u64*, size_t);
+
 void Memset(u32 address, u8 value, size_t size)
 {
 	if (size == 0)
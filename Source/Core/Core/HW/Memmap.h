@@ -66,12 +66,29 @@ void DoState(PointerWrap& p);
 
 void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table);
 
+// Re-establishes the page-table entries of all memory views by touching them
+// across the worker pool. Called after a savestate load, with the core still
+// paused, so the soft faults don't stutter the first seconds of play.
+void PreTouchViews();
+
+// Mirror a single page-table translation into the logical region, so
+// page-translated MMU accesses get the same fastmem path BAT translations do.
+// The MMU drops these mappings again on tlbie and BAT changes.
+void MapLogicalPage(u32 logical_address, u32 translated_address);
+void UnmapLogicalPage(u32 logical_address);
+void UnmapLogicalPages();
+
 void Clear();
 
 // Routines to access physically addressed memory, designed for use by
 // emulated hardware outside the CPU. Use "Device_" prefix.
 std::string GetString(u32 em_address, size_t size = 0);
 u8* GetPointer(u32 address);
+// Validates the whole range once and returns a pointer to its start, or
+// nullptr if any part of it is unmapped (or it spans two banks). Bulk entry
+// point for DMA-style consumers that want to stream a transfer themselves
+// instead of paying a translation per access.
+u8* GetPointerForRange(u32 address, size_t size);
 void CopyFromEmu(void* data, u32 address, size_t size);
 void CopyToEmu(u32 address, const void* data, size_t size);
 void Memset(u32 address, u8 value, size_t size);
@@ -86,28 +103,12 @@ void Write_U64(u64 var, u32 address);
 void Write_U32_Swap(u32 var, u32 address);
 void Write_U64_Swap(u64 var, u32 address);
 
-// Templated functions for byteswapped copies.
+// Byteswapped bulk copies. The range is validated once up front, then the
+// data is streamed through the SIMD swapping copy in Common; instantiated in
+// Memmap.cpp for u16, u32 and u64 elements.
 template <typename T>
-void CopyFromEmuSwapped(T* data, u32 address, size_t size)
-{
-	const T* src = reinterpret_cast<T*>(GetPointer(address));
-
-	if (src == nullptr)
-		return;
-
-	for (size_t i = 0; i < size / sizeof(T); i++)
-		data[i] = Common::FromBigEndian(src[i]);
-}
+void CopyFromEmuSwapped(T* data, u32 address, size_t size);
 
 template <typename T>
-void CopyToEmuSwapped(u32 address, const T* data, size_t size)
-{
-	T* dest = reinterpret_cast<T*>(GetPointer(address));
-
-	if (dest == nullptr)
-		return;
-
-	for (size_t i = 0; i < size / sizeof(T); i++)
-		dest[i] = Common::FromBigEndian(data[i]);
-}
+void CopyToEmuSwapped(u32 address, const T* data, size_t size);
 }
@@ -21,6 +21,7 @@
 #include "Core/NetPlayProto.h"
 
 #include "InputCommon/ControllerInterface/ControllerInterface.h"
+#include "VideoCommon/LatencyTracker.h"
 
 namespace SerialInterface
 {
@@ -569,6 +570,7 @@ void UpdateDevices()
 	// Update inputs at the rate of SI
 	// Typically 120hz but is variable
 	g_controller_interface.UpdateInput();
+	LatencyTracker::OnInputPolled();
 
 	// Update channels and set the status bit if there's new data
 	s_status_reg.RDST0 =
@@ -6,12 +6,17 @@
 
 #include <cstring>
 
+#include <algorithm>
+
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/CoreTiming.h"
 #include "Core/HW/GCPad.h"
+#include "Core/HW/SI/SI.h"
+#include "Core/HW/SystemTimers.h"
 #include "Core/NetPlayProto.h"
 #include "InputCommon/GCAdapter.h"
 
@@ -35,6 +40,13 @@ GCPadStatus CSIDevice_GCAdapter::GetPadStatus()
 	if (!NetPlay::IsNetPlayRunning())
 	{
 		pad_status = GCAdapter::Input(m_device_number);
+
+		// Pads on the same adapter can have measurably different input latency
+		// (wired vs. WaveBird). Optionally hold the faster pads back so every
+		// port on the station sees the same effective latency. Disabled when
+		// determinism is wanted, so movies and netplay are unaffected.
+		if (SConfig::GetInstance().m_AdapterLatencyMatch && !Core::WantsDeterminism())
+			pad_status = MatchStationLatency(pad_status);
 	}
 
 	HandleMoviePadStatus(&pad_status);
@@ -42,6 +54,47 @@ GCPadStatus CSIDevice_GCAdapter::GetPadStatus()
 	return pad_status;
 }
 
+GCPadStatus CSIDevice_GCAdapter::MatchStationLatency(const GCPadStatus& pad_status)
+{
+	// Estimate the poll interval from our own cadence, so the latency gap can be
+	// expressed in whole polls. The game controls the SI poll rate, so this is
+	// measured rather than assumed.
+	const u64 now = CoreTiming::GetTicks();
+	if (m_last_poll_ticks != 0 && now > m_last_poll_ticks)
+	{
+		const u64 interval_us =
+			(now - m_last_poll_ticks) * 1000000 / SystemTimers::GetTicksPerSecond();
+		m_poll_interval_us += ((s64)interval_us - (s64)m_poll_interval_us) / 8;
+	}
+	m_last_poll_ticks = now;
+
+	// The slowest connected pad sets the station's effective latency.
+	u32 target_latency_us = 0;
+	for (int chan = 0; chan < MAX_SI_CHANNELS; chan++)
+	{
+		if (GCAdapter::DeviceConnected(chan))
+			target_latency_us = std::max(target_latency_us, GCAdapter::GetChannelLatencyUs(chan));
+	}
+
+	u32 delay_polls = 0;
+	const u32 latency_us = GCAdapter::GetChannelLatencyUs(m_device_number);
+	if (m_poll_interval_us != 0 && target_latency_us > latency_us)
+	{
+		delay_polls = static_cast<u32>(
+			(target_latency_us - latency_us + m_poll_interval_us / 2) / m_poll_interval_us);
+	}
+
+	m_status_ring[m_ring_pos] = pad_status;
+	if (m_ring_filled < m_status_ring.size())
+		m_ring_filled++;
+
+	delay_polls = std::min(delay_polls, m_ring_filled - 1);
+	const GCPadStatus delayed =
+		m_status_ring[(m_ring_pos + m_status_ring.size() - delay_polls) % m_status_ring.size()];
+	m_ring_pos = (m_ring_pos + 1) % m_status_ring.size();
+	return delayed;
+}
+
 int CSIDevice_GCAdapter::RunBuffer(u8* buffer, int length)
 {
 	if (!Core::WantsDeterminism())
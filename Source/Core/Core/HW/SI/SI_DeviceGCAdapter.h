@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <array>
+
+#include "Common/CommonTypes.h"
 #include "Core/HW/SI/SI_Device.h"
 #include "Core/HW/SI/SI_DeviceGCController.h"
 #include "InputCommon/GCPadStatus.h"
@@ -17,5 +20,16 @@ public:
 
 	GCPadStatus GetPadStatus() override;
 	int RunBuffer(u8* buffer, int length) override;
+
+private:
+	GCPadStatus MatchStationLatency(const GCPadStatus& pad_status);
+
+	// Ring of recent pad states used to hold back pads whose estimated latency
+	// is below the station's slowest pad. Quantized to whole SI polls.
+	std::array<GCPadStatus, 8> m_status_ring{};
+	u32 m_ring_pos = 0;
+	u32 m_ring_filled = 0;
+	u64 m_last_poll_ticks = 0;
+	u64 m_poll_interval_us = 0;
 };
 }  // namespace SerialInterface
@@ -4,11 +4,15 @@
 
 #include "Core/HW/Sram.h"
 
+#include <cstring>
+#include <vector>
+
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
 
+#include "Core/Boot/BootAssetCache.h"
 #include "Core/ConfigManager.h"
 
 // english
@@ -48,6 +52,22 @@ const SRAM sram_dump_german = { {
 
 void InitSRAM()
 {
+	// The boot preloader usually has the SRAM image staged already.
+	std::vector<u8> preloaded;
+	if (BootAssetCache::GetFile(SConfig::GetInstance().m_strSRAM, &preloaded))
+	{
+		if (preloaded.size() >= sizeof(SRAM))
+		{
+			memcpy(&g_SRAM, preloaded.data(), sizeof(SRAM));
+		}
+		else
+		{
+			ERROR_LOG(EXPANSIONINTERFACE, "EXI IPL-DEV: Could not read all of SRAM");
+			g_SRAM = sram_dump;
+		}
+		return;
+	}
+
 	File::IOFile file(SConfig::GetInstance().m_strSRAM, "rb");
 	if (file)
 	{
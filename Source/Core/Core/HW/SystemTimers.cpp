@@ -47,6 +47,7 @@ IPC_HLE_PERIOD: For the Wii Remote this is the call schedule:
 #include "Common/Atomic.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
+#include "Common/PerformanceHud.h"
 #include "Common/Thread.h"
 #include "Common/Timer.h"
 #include "Core/ConfigManager.h"
@@ -214,7 +215,12 @@ static void ThrottleCallback(u64 last_time, s64 cyclesLate)
 			last_time = time - max_fallback;
 		}
 		else if (diff > 0)
+		{
 			Common::SleepCurrentThread(diff);
+			// The HUD reports CPU thread load as frame time minus throttle sleep.
+			if (PerfHud::IsEnabled())
+				PerfHud::AddTime(PerfHud::SLOT_CPU_IDLE, (u64)diff * 1000);
+		}
 	}
 	CoreTiming::ScheduleEvent(next_event - cyclesLate, et_Throttle, last_time + 1);
 }
@@ -84,7 +84,7 @@ void Nunchuk::GetState(u8* const data)
 	AccelData accel;
 
 	// tilt
-	EmulateTilt(&accel, m_tilt);
+	EmulateTilt(&accel, m_tilt, &m_tilt_cache);
 
 	// swing
 	EmulateSwing(&accel, m_swing);
@@ -6,6 +6,7 @@
 
 #include <array>
 #include "Core/HW/WiimoteEmu/Attachment/Attachment.h"
+#include "Core/HW/WiimoteEmu/WiimoteEmu.h"
 
 namespace ControllerEmu
 {
@@ -54,6 +55,7 @@ public:
 
 private:
 	ControllerEmu::Tilt* m_tilt;
+	TiltCache m_tilt_cache;
 	ControllerEmu::Force* m_swing;
 
 	ControllerEmu::Buttons* m_shake;
@@ -6,6 +6,8 @@
 
 #include <cmath>
 
+#include "Common/Intrinsics.h"
+
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
@@ -110,6 +112,24 @@ inline void MatrixScale(Matrix& m, double xfact, double yfact, double zfact)
 
 inline void MatrixMultiply(Matrix& r, const Matrix& a, const Matrix& b)
 {
+#if defined(_M_X86)
+	// Two doubles per SSE2 register, so accumulate the column pairs of b.
+	// r must not alias a or b (the scalar version below has the same
+	// restriction, it zeroes r before accumulating).
+	for (int i = 0; i < 4; i++)
+	{
+		__m128d lo = _mm_setzero_pd();
+		__m128d hi = _mm_setzero_pd();
+		for (int k = 0; k < 4; k++)
+		{
+			const __m128d aik = _mm_set1_pd(a[i][k]);
+			lo = _mm_add_pd(lo, _mm_mul_pd(aik, _mm_loadu_pd(&b[k][0])));
+			hi = _mm_add_pd(hi, _mm_mul_pd(aik, _mm_loadu_pd(&b[k][2])));
+		}
+		_mm_storeu_pd(&r[i][0], lo);
+		_mm_storeu_pd(&r[i][2], hi);
+	}
+#else
 	for (int i = 0; i < 16; i++)
 		r[i >> 2][i & 3] = 0.0f;
 
@@ -117,12 +137,34 @@ inline void MatrixMultiply(Matrix& r, const Matrix& a, const Matrix& b)
 		for (int j = 0; j < 4; j++)
 			for (int k = 0; k < 4; k++)
 				r[i][j] += a[i][k] * b[k][j];
+#endif
+}
+
+#if defined(_M_X86)
+// Dot product of one matrix row with (x, y, z, 1), split across two registers.
+inline double MatrixRowDot(const double* row, __m128d xy, __m128d z1)
+{
+	const __m128d t =
+		_mm_add_pd(_mm_mul_pd(_mm_loadu_pd(&row[0]), xy), _mm_mul_pd(_mm_loadu_pd(&row[2]), z1));
+	return _mm_cvtsd_f64(_mm_add_sd(t, _mm_unpackhi_pd(t, t)));
 }
+#endif
 
 inline void MatrixTransformVertex(Matrix const& m, Vertex& v)
 {
-	Vertex ov;
 	double w;
+#if defined(_M_X86)
+	const __m128d xy = _mm_loadu_pd(&v.x);
+	const __m128d z1 = _mm_set_pd(1.0, v.z);
+	const double x = MatrixRowDot(m[0], xy, z1);
+	const double y = MatrixRowDot(m[1], xy, z1);
+	const double z = MatrixRowDot(m[2], xy, z1);
+	w = MatrixRowDot(m[3], xy, z1);
+	v.x = x;
+	v.y = y;
+	v.z = z;
+#else
+	Vertex ov;
 	ov.x = v.x;
 	ov.y = v.y;
 	ov.z = v.z;
@@ -130,6 +172,7 @@ inline void MatrixTransformVertex(Matrix const& m, Vertex& v)
 	v.y = m[1][0] * ov.x + m[1][1] * ov.y + m[1][2] * ov.z + m[1][3];
 	v.z = m[2][0] * ov.x + m[2][1] * ov.y + m[2][2] * ov.z + m[2][3];
 	w = m[3][0] * ov.x + m[3][1] * ov.y + m[3][2] * ov.z + m[3][3];
+#endif
 	if (w != 0)
 	{
 		v.x /= w;
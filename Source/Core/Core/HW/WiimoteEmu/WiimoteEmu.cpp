@@ -118,13 +118,26 @@ void EmulateShake(AccelData* const accel, ControllerEmu::Buttons* const buttons_
 	}
 }
 
-void EmulateTilt(AccelData* const accel, ControllerEmu::Tilt* const tilt_group, const bool sideways,
-	const bool upright)
+void EmulateTilt(AccelData* const accel, ControllerEmu::Tilt* const tilt_group,
+	TiltCache* const cache, const bool sideways, const bool upright)
 {
 	ControlState roll, pitch;
 	// 180 degrees
 	tilt_group->GetState(&roll, &pitch);
 
+	// replay the last result while the inputs sit still
+	if (cache->valid && roll == cache->roll && pitch == cache->pitch &&
+		sideways == cache->sideways && upright == cache->upright)
+	{
+		*accel = cache->accel;
+		return;
+	}
+
+	cache->roll = roll;
+	cache->pitch = pitch;
+	cache->sideways = sideways;
+	cache->upright = upright;
+
 	roll *= PI;
 	pitch *= PI;
 
@@ -151,6 +164,10 @@ void EmulateTilt(AccelData* const accel, ControllerEmu::Tilt* const tilt_group,
 	(&accel->x)[ud] = (sin((PI / 2) - std::max(fabs(roll), fabs(pitch)))) * sgn[ud];
 	(&accel->x)[lr] = -sin(roll) * sgn[lr];
 	(&accel->x)[fb] = sin(pitch) * sgn[fb];
+
+	// ud/lr/fb cover all three axes, so the whole triple can be replayed
+	cache->accel = *accel;
+	cache->valid = true;
 }
 
 #define SWING_INTENSITY 2.5  //-uncalibrated(aprox) 0x40-calibrated
@@ -248,7 +265,8 @@ void Wiimote::Reset()
 }
 
 Wiimote::Wiimote(const unsigned int index)
-	: m_index(index), ir_sin(0), ir_cos(1), m_last_connect_request_counter(0)
+	: m_index(index), ir_sin(0), ir_cos(1), m_ir_matrix_sin(0), m_ir_matrix_cos(1),
+	m_ir_matrix_valid(false), m_last_connect_request_counter(0)
 {
 	// ---- set up all the controls ----
 
@@ -473,7 +491,7 @@ void Wiimote::GetAccelData(u8* const data, const ReportFeatures& rptf)
 	const bool is_upright =
 		m_upright_setting->GetValue() ^ upright_modifier_toggle ^ upright_modifier_switch;
 
-	EmulateTilt(&m_accel, m_tilt, is_sideways, is_upright);
+	EmulateTilt(&m_accel, m_tilt, &m_tilt_cache, is_sideways, is_upright);
 	EmulateSwing(&m_accel, m_swing, is_sideways, is_upright);
 	EmulateShake(&m_accel, m_shake, m_shake_step);
 
@@ -549,6 +567,13 @@ void Wiimote::GetIRData(u8* const data, bool use_accel)
 
 	m_ir->GetState(&xx, &yy, &zz, true);
 
+	// The report only carries IR data once the game has finished the camera
+	// handshake, so skip the whole projection until then. The low pass filter
+	// and cursor state above still ran, keeping them converged for the moment
+	// reporting starts.
+	if (!m_reg_ir.data[0x30])
+		return;
+
 	Vertex v[4];
 
 	static const int camWidth = 1024;
@@ -579,17 +604,26 @@ void Wiimote::GetIRData(u8* const data, bool use_accel)
   PanicAlert("%f %f %f %f\n%f %f %f %f\n%f %f %f %f\n%f %f %f %f\n", m[0][0], m[0][1], m[0][2],    \
              m[0][3], m[1][0], m[1][1], m[1][2], m[1][3], m[2][0], m[2][1], m[2][2], m[2][3],      \
              m[3][0], m[3][1], m[3][2], m[3][3])
-	Matrix rot, tot;
-	static Matrix scale;
-	MatrixScale(scale, 1, camWidth / camHeight, 1);
-	// MatrixIdentity(scale);
-	MatrixRotationByZ(rot, ir_sin, ir_cos);
-	// MatrixIdentity(rot);
-	MatrixMultiply(tot, scale, rot);
+	// The scale factor is constant and the rotation tracks the low pass
+	// filtered accelerometer, which settles to a fixed point while the remote
+	// is at rest, so only rebuild the composed transform when it actually
+	// moved since the last report.
+	if (!m_ir_matrix_valid || ir_sin != m_ir_matrix_sin || ir_cos != m_ir_matrix_cos)
+	{
+		Matrix rot, scale;
+		MatrixScale(scale, 1, camWidth / camHeight, 1);
+		// MatrixIdentity(scale);
+		MatrixRotationByZ(rot, ir_sin, ir_cos);
+		// MatrixIdentity(rot);
+		MatrixMultiply(m_ir_matrix, scale, rot);
+		m_ir_matrix_sin = ir_sin;
+		m_ir_matrix_cos = ir_cos;
+		m_ir_matrix_valid = true;
+	}
 
 	for (int i = 0; i < 4; i++)
 	{
-		MatrixTransformVertex(tot, v[i]);
+		MatrixTransformVertex(m_ir_matrix, v[i]);
 		if ((v[i].x < -1) || (v[i].x > 1) || (v[i].y < -1) || (v[i].y > 1))
 			continue;
 		x[i] = (u16)lround((v[i].x + 1) / 2 * (camWidth - 1));
@@ -599,61 +633,59 @@ void Wiimote::GetIRData(u8* const data, bool use_accel)
 	//      v[0].x,v[0].y,v[1].x,v[1].y,v[2].x,v[2].y,v[3].x,v[3].y,
 	//      x[0],y[0],x[1],y[1],x[2],y[2],x[3],y[38]);
 
-	// Fill report with valid data when full handshake was done
-	if (m_reg_ir.data[0x30])
-		// ir mode
-		switch (m_reg_ir.mode)
-		{
-			// basic
-		case 1:
+	// ir mode
+	switch (m_reg_ir.mode)
+	{
+		// basic
+	case 1:
+	{
+		memset(data, 0xFF, 10);
+		wm_ir_basic* const irdata = (wm_ir_basic*)data;
+		for (unsigned int i = 0; i < 2; ++i)
 		{
-			memset(data, 0xFF, 10);
-			wm_ir_basic* const irdata = (wm_ir_basic*)data;
-			for (unsigned int i = 0; i < 2; ++i)
+			if (x[i * 2] < 1024 && y[i * 2] < 768)
 			{
-				if (x[i * 2] < 1024 && y[i * 2] < 768)
-				{
-					irdata[i].x1 = static_cast<u8>(x[i * 2]);
-					irdata[i].x1hi = x[i * 2] >> 8;
+				irdata[i].x1 = static_cast<u8>(x[i * 2]);
+				irdata[i].x1hi = x[i * 2] >> 8;
 
-					irdata[i].y1 = static_cast<u8>(y[i * 2]);
-					irdata[i].y1hi = y[i * 2] >> 8;
-				}
-				if (x[i * 2 + 1] < 1024 && y[i * 2 + 1] < 768)
-				{
-					irdata[i].x2 = static_cast<u8>(x[i * 2 + 1]);
-					irdata[i].x2hi = x[i * 2 + 1] >> 8;
+				irdata[i].y1 = static_cast<u8>(y[i * 2]);
+				irdata[i].y1hi = y[i * 2] >> 8;
+			}
+			if (x[i * 2 + 1] < 1024 && y[i * 2 + 1] < 768)
+			{
+				irdata[i].x2 = static_cast<u8>(x[i * 2 + 1]);
+				irdata[i].x2hi = x[i * 2 + 1] >> 8;
 
-					irdata[i].y2 = static_cast<u8>(y[i * 2 + 1]);
-					irdata[i].y2hi = y[i * 2 + 1] >> 8;
-				}
+				irdata[i].y2 = static_cast<u8>(y[i * 2 + 1]);
+				irdata[i].y2hi = y[i * 2 + 1] >> 8;
 			}
 		}
-		break;
-		// extended
-		case 3:
-		{
-			memset(data, 0xFF, 12);
-			wm_ir_extended* const irdata = (wm_ir_extended*)data;
-			for (unsigned int i = 0; i < 4; ++i)
-				if (x[i] < 1024 && y[i] < 768)
-				{
-					irdata[i].x = static_cast<u8>(x[i]);
-					irdata[i].xhi = x[i] >> 8;
+	}
+	break;
+	// extended
+	case 3:
+	{
+		memset(data, 0xFF, 12);
+		wm_ir_extended* const irdata = (wm_ir_extended*)data;
+		for (unsigned int i = 0; i < 4; ++i)
+			if (x[i] < 1024 && y[i] < 768)
+			{
+				irdata[i].x = static_cast<u8>(x[i]);
+				irdata[i].xhi = x[i] >> 8;
 
-					irdata[i].y = static_cast<u8>(y[i]);
-					irdata[i].yhi = y[i] >> 8;
+				irdata[i].y = static_cast<u8>(y[i]);
+				irdata[i].yhi = y[i] >> 8;
 
-					irdata[i].size = 10;
-				}
-		}
+				irdata[i].size = 10;
+			}
+	}
+	break;
+	// full
+	case 5:
+		PanicAlert("Full IR report");
+		// UNSUPPORTED
 		break;
-		// full
-		case 5:
-			PanicAlert("Full IR report");
-			// UNSUPPORTED
-			break;
-		}
+	}
 }
 
 void Wiimote::GetExtData(u8* const data)
@@ -8,6 +8,7 @@
 #include <string>
 
 #include "Core/HW/WiimoteEmu/Encryption.h"
+#include "Core/HW/WiimoteEmu/MatrixMath.h"
 #include "Core/HW/WiimoteEmu/WiimoteHid.h"
 #include "InputCommon/ControllerEmu/ControllerEmu.h"
 
@@ -126,6 +127,17 @@ struct ADPCMState
 	s32 predictor, step;
 };
 
+// Caches the last tilt result so EmulateTilt() can skip its three sin() calls
+// when nothing moved. With reports at 200Hz the tilt inputs are unchanged for
+// the vast majority of reports.
+struct TiltCache
+{
+	ControlState roll = 0, pitch = 0;
+	bool sideways = false, upright = false;
+	bool valid = false;
+	AccelData accel{};
+};
+
 struct ExtensionReg
 {
 	u8 unknown1[0x08];
@@ -154,7 +166,7 @@ void EmulateShake(AccelData* const accel_data, ControllerEmu::Buttons* const but
 	u8* const shake_step);
 
 void EmulateTilt(AccelData* const accel, ControllerEmu::Tilt* const tilt_group,
-	const bool sideways = false, const bool upright = false);
+	TiltCache* const cache, const bool sideways = false, const bool upright = false);
 
 void EmulateSwing(AccelData* const accel, ControllerEmu::Force* const tilt_group,
 	const bool sideways = false, const bool upright = false);
@@ -265,6 +277,14 @@ private:
 
 	double ir_sin, ir_cos;  // for the low pass filter
 
+	// composed IR camera transform, rebuilt only when the filtered rotation
+	// moved since the last report
+	Matrix m_ir_matrix;
+	double m_ir_matrix_sin, m_ir_matrix_cos;
+	bool m_ir_matrix_valid;
+
+	TiltCache m_tilt_cache;
+
 	bool m_rumble_on;
 	bool m_speaker_mute;
 	bool m_motion_plus_present;
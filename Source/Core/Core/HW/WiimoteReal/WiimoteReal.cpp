@@ -11,10 +11,12 @@
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/EventTrace.h"
 #include "Common/IniFile.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
 #include "Common/Thread.h"
+#include "Common/Timer.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/HW/WiimoteEmu/WiimoteEmu.h"
@@ -60,6 +62,7 @@ void Wiimote::Shutdown()
 	StopThread();
 	ClearReadQueue();
 	m_write_reports.Clear();
+	LogReadLatency();
 }
 
 // to be called from CPU thread
@@ -123,7 +126,7 @@ void Wiimote::SetChannel(u16 channel)
 
 void Wiimote::ClearReadQueue()
 {
-	Report rpt;
+	TimedReport rpt;
 
 	// The "Clear" function isn't thread-safe :/
 	while (m_read_reports.Pop(rpt))
@@ -131,6 +134,36 @@ void Wiimote::ClearReadQueue()
 	}
 }
 
+void Wiimote::RecordReadLatency(u64 arrival_time)
+{
+	const u64 latency_us = Common::Timer::GetTimeUs() - arrival_time;
+
+	int bucket = 0;
+	while (bucket < LATENCY_BUCKETS - 1 && latency_us >= (1000u << bucket))
+		bucket++;
+	m_latency_histogram[bucket]++;
+
+	TRACE_COUNTER("wiimote read latency us", (s64) latency_us);
+}
+
+void Wiimote::LogReadLatency() const
+{
+	u64 total = 0;
+	for (u32 count : m_latency_histogram)
+		total += count;
+	if (total == 0)
+		return;
+
+	std::string histogram;
+	for (int bucket = 0; bucket < LATENCY_BUCKETS; ++bucket)
+	{
+		histogram += StringFromFormat("%s<%dms: %u", bucket ? ", " : "", 1 << bucket,
+			m_latency_histogram[bucket]);
+	}
+	NOTICE_LOG(WIIMOTE, "Wii Remote %d read latency over %llu reports: %s", m_index + 1,
+		(unsigned long long) total, histogram.c_str());
+}
+
 void Wiimote::ControlChannel(const u16 channel, const void* const data, const u32 size)
 {
 	// Check for custom communication
@@ -214,9 +247,10 @@ void Wiimote::Read()
 				SConfig::GetInstance().iBBDumpPort);
 		}
 
-		// Add it to queue
+		// Add it to queue, stamped with the arrival time so the poll side can
+		// tell how long it sat there.
 		rpt.resize(result);
-		m_read_reports.Push(std::move(rpt));
+		m_read_reports.Push(TimedReport{ std::move(rpt), Common::Timer::GetTimeUs() });
 	}
 	else if (0 == result)
 	{
@@ -322,9 +356,13 @@ static bool IsDataReport(const Report& rpt)
 // Returns the next report that should be sent
 const Report& Wiimote::ProcessReadQueue()
 {
-	// Pop through the queued reports
-	while (m_read_reports.Pop(m_last_input_report))
+	// Pop through the queued reports, keeping only the freshest data report
+	TimedReport timed_rpt;
+	while (m_read_reports.Pop(timed_rpt))
 	{
+		m_last_input_report = std::move(timed_rpt.report);
+		RecordReadLatency(timed_rpt.arrival_time);
+
 		if (!IsDataReport(m_last_input_report))
 		{
 			// A non-data report, use it.
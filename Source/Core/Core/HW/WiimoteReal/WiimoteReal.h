@@ -24,6 +24,14 @@ typedef std::vector<u8> Report;
 
 namespace WiimoteReal
 {
+// A report paired with the time the device thread received it, so the poll
+// side can measure how stale the data it hands to the emulated Wiimote is.
+struct TimedReport
+{
+	Report report;
+	u64 arrival_time;
+};
+
 class Wiimote : NonCopyable
 {
 public:
@@ -92,6 +100,8 @@ protected:
 private:
 	void ClearReadQueue();
 	void WriteReport(Report rpt);
+	void RecordReadLatency(u64 arrival_time);
+	void LogReadLatency() const;
 
 	virtual int IORead(u8* buf) = 0;
 	virtual int IOWrite(u8 const* buf, size_t len) = 0;
@@ -109,8 +119,13 @@ private:
 	// Triggered when the thread has finished ConnectInternal.
 	Common::Event m_thread_ready_event;
 
-	Common::FifoQueue<Report> m_read_reports;
+	Common::FifoQueue<TimedReport> m_read_reports;
 	Common::FifoQueue<Report> m_write_reports;
+
+	// Device-thread-to-poll latency histogram; bucket i counts reports that
+	// took less than 2^i milliseconds to reach ProcessReadQueue.
+	static constexpr int LATENCY_BUCKETS = 8;
+	u32 m_latency_histogram[LATENCY_BUCKETS] = {};
 };
 
 class WiimoteScannerBackend
@@ -73,6 +73,9 @@ enum Hotkey
 	HK_TOGGLE_DUMPTEXTURES,
 	HK_TOGGLE_TEXTURES,
 	HK_TOGGLE_MATERIAL_TEXTURES,
+	HK_TOGGLE_PERF_HUD,
+	HK_TOGGLE_FIFO_FLIGHT_RECORDING,
+	HK_SAVE_FIFO_FLIGHT_RECORDING,
 
 	HK_INCREASE_IR,
 	HK_DECREASE_IR,
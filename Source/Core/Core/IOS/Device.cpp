@@ -22,25 +22,40 @@ Request::Request(const u32 address_) : address(address_)
 	fd = Memory::Read_U32(address + 8);
 }
 
-OpenRequest::OpenRequest(const u32 address_) : Request(address_)
+// The dispatch path in IPC.cpp parses the request header once; the base-copy
+// constructors let it build a typed request from that parse instead of
+// re-reading the command and fd words from guest memory for every request.
+OpenRequest::OpenRequest(const Request& base) : Request(base)
 {
 	path = Memory::GetString(Memory::Read_U32(address + 0xc));
 	flags = static_cast<OpenMode>(Memory::Read_U32(address + 0x10));
 }
 
-ReadWriteRequest::ReadWriteRequest(const u32 address_) : Request(address_)
+OpenRequest::OpenRequest(const u32 address_) : OpenRequest(Request(address_))
+{
+}
+
+ReadWriteRequest::ReadWriteRequest(const Request& base) : Request(base)
 {
 	buffer = Memory::Read_U32(address + 0xc);
 	size = Memory::Read_U32(address + 0x10);
 }
 
-SeekRequest::SeekRequest(const u32 address_) : Request(address_)
+ReadWriteRequest::ReadWriteRequest(const u32 address_) : ReadWriteRequest(Request(address_))
+{
+}
+
+SeekRequest::SeekRequest(const Request& base) : Request(base)
 {
 	offset = Memory::Read_U32(address + 0xc);
 	mode = static_cast<SeekMode>(Memory::Read_U32(address + 0x10));
 }
 
-IOCtlRequest::IOCtlRequest(const u32 address_) : Request(address_)
+SeekRequest::SeekRequest(const u32 address_) : SeekRequest(Request(address_))
+{
+}
+
+IOCtlRequest::IOCtlRequest(const Request& base) : Request(base)
 {
 	request = Memory::Read_U32(address + 0x0c);
 	buffer_in = Memory::Read_U32(address + 0x10);
@@ -49,13 +64,20 @@ IOCtlRequest::IOCtlRequest(const u32 address_) : Request(address_)
 	buffer_out_size = Memory::Read_U32(address + 0x1c);
 }
 
-IOCtlVRequest::IOCtlVRequest(const u32 address_) : Request(address_)
+IOCtlRequest::IOCtlRequest(const u32 address_) : IOCtlRequest(Request(address_))
+{
+}
+
+IOCtlVRequest::IOCtlVRequest(const Request& base) : Request(base)
 {
 	request = Memory::Read_U32(address + 0x0c);
 	const u32 in_number = Memory::Read_U32(address + 0x10);
 	const u32 out_number = Memory::Read_U32(address + 0x14);
 	const u32 vectors_base = Memory::Read_U32(address + 0x18);  // address to vectors
 
+	in_vectors.reserve(in_number);
+	io_vectors.reserve(out_number);
+
 	u32 offset = 0;
 	for (size_t i = 0; i < (in_number + out_number); ++i)
 	{
@@ -70,6 +92,10 @@ IOCtlVRequest::IOCtlVRequest(const u32 address_) : Request(address_)
 	}
 }
 
+IOCtlVRequest::IOCtlVRequest(const u32 address_) : IOCtlVRequest(Request(address_))
+{
+}
+
 bool IOCtlVRequest::HasInputVectorWithAddress(const u32 vector_address) const
 {
 	return std::any_of(in_vectors.begin(), in_vectors.end(),
@@ -93,6 +93,7 @@ struct OpenRequest final : Request
 	std::string path;
 	OpenMode flags = IOS_OPEN_READ;
 	explicit OpenRequest(u32 address);
+	explicit OpenRequest(const Request& base);
 };
 
 struct ReadWriteRequest final : Request
@@ -100,6 +101,7 @@ struct ReadWriteRequest final : Request
 	u32 buffer = 0;
 	u32 size = 0;
 	explicit ReadWriteRequest(u32 address);
+	explicit ReadWriteRequest(const Request& base);
 };
 
 struct SeekRequest final : Request
@@ -113,6 +115,7 @@ struct SeekRequest final : Request
 	u32 offset = 0;
 	SeekMode mode = IOS_SEEK_SET;
 	explicit SeekRequest(u32 address);
+	explicit SeekRequest(const Request& base);
 };
 
 struct IOCtlRequest final : Request
@@ -124,6 +127,7 @@ struct IOCtlRequest final : Request
 	u32 buffer_out = 0;
 	u32 buffer_out_size = 0;
 	explicit IOCtlRequest(u32 address);
+	explicit IOCtlRequest(const Request& base);
 	void Log(const std::string& description, LogTypes::LOG_TYPE type = LogTypes::IOS,
 		LogTypes::LOG_LEVELS level = LogTypes::LINFO) const;
 	void Dump(const std::string& description, LogTypes::LOG_TYPE type = LogTypes::IOS,
@@ -149,6 +153,7 @@ struct IOCtlVRequest final : Request
 	std::vector<IOVector> in_vectors;
 	std::vector<IOVector> io_vectors;
 	explicit IOCtlVRequest(u32 address);
+	explicit IOCtlVRequest(const Request& base);
 	bool HasInputVectorWithAddress(u32 vector_address) const;
 	bool HasNumberOfValidVectors(size_t in_count, size_t io_count) const;
 	void Dump(const std::string& description, LogTypes::LOG_TYPE type = LogTypes::IOS,
@@ -948,7 +948,7 @@ static IPCCommandResult HandleCommand(const Request& request)
 {
 	if (request.command == IPC_CMD_OPEN)
 	{
-		OpenRequest open_request{ request.address };
+		OpenRequest open_request{ request };
 		const s32 new_fd = OpenDevice(open_request);
 		return Device::Device::GetDefaultReply(new_fd);
 	}
@@ -964,15 +964,15 @@ static IPCCommandResult HandleCommand(const Request& request)
 		device->Close();
 		return Device::Device::GetDefaultReply(IPC_SUCCESS);
 	case IPC_CMD_READ:
-		return device->Read(ReadWriteRequest{ request.address });
+		return device->Read(ReadWriteRequest{ request });
 	case IPC_CMD_WRITE:
-		return device->Write(ReadWriteRequest{ request.address });
+		return device->Write(ReadWriteRequest{ request });
 	case IPC_CMD_SEEK:
-		return device->Seek(SeekRequest{ request.address });
+		return device->Seek(SeekRequest{ request });
 	case IPC_CMD_IOCTL:
-		return device->IOCtl(IOCtlRequest{ request.address });
+		return device->IOCtl(IOCtlRequest{ request });
 	case IPC_CMD_IOCTLV:
-		return device->IOCtlV(IOCtlVRequest{ request.address });
+		return device->IOCtlV(IOCtlVRequest{ request });
 	default:
 		_assert_msg_(IOS, false, "Unexpected command: %x", request.command);
 		return Device::Device::GetDefaultReply(IPC_EINVAL);
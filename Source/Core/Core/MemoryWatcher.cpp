@@ -2,13 +2,18 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <cstring>
+#include <fcntl.h>
 #include <fstream>
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <sys/mman.h>
 #include <unistd.h>
 
+#include "Common/CommonPaths.h"
 #include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
@@ -40,10 +45,15 @@ void MemoryWatcher::Shutdown()
 MemoryWatcher::MemoryWatcher()
 {
 	m_running = false;
+	m_shm_header = nullptr;
+	m_shm_entries = nullptr;
+	m_shm_size = 0;
 	if (!LoadAddresses(File::GetUserPath(F_MEMORYWATCHERLOCATIONS_IDX)))
 		return;
 	if (!OpenSocket(File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX)))
 		return;
+	// Best effort: the socket keeps working if the mapping fails.
+	OpenSHM(File::GetUserPath(F_MEMORYWATCHERSHM_IDX));
 	m_running = true;
 }
 
@@ -54,19 +64,36 @@ MemoryWatcher::~MemoryWatcher()
 
 	m_running = false;
 	close(m_fd);
+	if (m_shm_header)
+		munmap(m_shm_header, m_shm_size);
 }
 
 bool MemoryWatcher::LoadAddresses(const std::string& path)
+{
+	LoadAddressFile(path);
+
+	// Any other .txt file in the directory is a watch list too, so tools can
+	// each register their batch of watches as one file.
+	const File::FSTEntry dir = File::ScanDirectoryTree(File::GetUserPath(D_MEMORYWATCHER_IDX), false);
+	for (const auto& child : dir.children)
+	{
+		if (!child.isDirectory && StringEndsWith(child.virtualName, ".txt") &&
+			child.virtualName != MEMORYWATCHER_LOCATIONS)
+			LoadAddressFile(child.physicalName);
+	}
+
+	return m_values.size() > 0;
+}
+
+void MemoryWatcher::LoadAddressFile(const std::string& path)
 {
 	std::ifstream locations(path);
 	if (!locations)
-		return false;
+		return;
 
 	std::string line;
 	while (std::getline(locations, line))
 		ParseLine(line);
-
-	return m_values.size() > 0;
 }
 
 void MemoryWatcher::ParseLine(const std::string& line)
@@ -91,6 +118,40 @@ bool MemoryWatcher::OpenSocket(const std::string& path)
 	return m_fd >= 0;
 }
 
+bool MemoryWatcher::OpenSHM(const std::string& path)
+{
+	int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return false;
+
+	m_shm_size = sizeof(SHMHeader) + m_values.size() * sizeof(SHMEntry);
+	if (ftruncate(fd, m_shm_size) != 0)
+	{
+		close(fd);
+		return false;
+	}
+
+	void* mapping = mmap(nullptr, m_shm_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	// The mapping holds its own reference to the file.
+	close(fd);
+	if (mapping == MAP_FAILED)
+		return false;
+
+	m_shm_header = static_cast<SHMHeader*>(mapping);
+	m_shm_entries = reinterpret_cast<SHMEntry*>(m_shm_header + 1);
+
+	memset(mapping, 0, m_shm_size);
+	size_t index = 0;
+	for (auto& entry : m_values)
+		strncpy(m_shm_entries[index++].spec, entry.first.c_str(), sizeof(SHMEntry::spec) - 1);
+	m_shm_header->version = 1;
+	m_shm_header->num_entries = u32(m_values.size());
+	m_shm_header->entry_size = sizeof(SHMEntry);
+	// 'DMW1', written last so a reader that sees it also sees the layout.
+	m_shm_header->magic = 0x444D5731;
+	return true;
+}
+
 u32 MemoryWatcher::ChasePointer(const std::string& line)
 {
 	u32 value = 0;
@@ -111,12 +172,21 @@ void MemoryWatcher::Step()
 	if (!m_running)
 		return;
 
+	// Open the seqlock: an odd counter tells readers a publication is in
+	// flight and anything they copied meanwhile must be retried.
+	if (m_shm_header)
+		m_shm_header->seq.fetch_add(1, std::memory_order_acquire);
+
+	size_t index = 0;
 	for (auto& entry : m_values)
 	{
 		std::string address = entry.first;
 		u32& current_value = entry.second;
 
 		u32 new_value = ChasePointer(address);
+		if (m_shm_entries)
+			m_shm_entries[index].value = new_value;
+		index++;
 		if (new_value != current_value)
 		{
 			// Update the value
@@ -126,4 +196,8 @@ void MemoryWatcher::Step()
 				sizeof(m_addr));
 		}
 	}
+
+	// Close the seqlock; the counter is even again and the snapshot is valid.
+	if (m_shm_header)
+		m_shm_header->seq.fetch_add(1, std::memory_order_release);
 }
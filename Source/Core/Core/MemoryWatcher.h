@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <sys/socket.h>
 #include <sys/un.h>
@@ -14,9 +15,18 @@
 //
 // The input file is a newline-separated list of hex memory addresses, without
 // the "0x". To follow pointers, separate addresses with a space. For example,
-// "ABCD EF" will watch the address at (*0xABCD) + 0xEF.
+// "ABCD EF" will watch the address at (*0xABCD) + 0xEF. Additional .txt
+// files next to Locations.txt are loaded too, so each tool can register its
+// watch list as one file.
 // The output to the socket is two lines. The first is the address from the
 // input file, and the second is the new value in hex.
+//
+// All watched values are also published each step into a shared-memory file
+// (Values.shm) that readers can mmap and poll without any syscalls. The
+// region is a header followed by fixed-size entries carrying the watch spec
+// and its current value; the header's seqlock counter is incremented before
+// and after every publication, so a reader retries whenever it observes an
+// odd or changed counter.
 class MemoryWatcher final
 {
 public:
@@ -28,8 +38,26 @@ public:
 	static void Shutdown();
 
 private:
+	struct SHMHeader
+	{
+		u32 magic;  // written last, so readers never see a half-set-up region
+		u32 version;
+		u32 num_entries;
+		u32 entry_size;
+		std::atomic<u32> seq;  // seqlock counter, odd while a publication is in flight
+		u32 reserved[3];
+	};
+	struct SHMEntry
+	{
+		char spec[120];  // the watch list line, NUL-terminated
+		u32 value;
+		u32 reserved;
+	};
+
 	bool LoadAddresses(const std::string& path);
+	void LoadAddressFile(const std::string& path);
 	bool OpenSocket(const std::string& path);
+	bool OpenSHM(const std::string& path);
 
 	void ParseLine(const std::string& line);
 	u32 ChasePointer(const std::string& line);
@@ -40,6 +68,10 @@ private:
 	int m_fd;
 	sockaddr_un m_addr;
 
+	SHMHeader* m_shm_header;
+	SHMEntry* m_shm_entries;
+	size_t m_shm_size;
+
 	// Address as stored in the file -> list of offsets to follow
 	std::map<std::string, std::vector<u32>> m_addresses;
 	// Address as stored in the file -> current value
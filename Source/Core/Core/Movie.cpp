@@ -53,6 +53,7 @@ namespace Movie
 {
 static bool s_bFrameStep = false;
 static bool s_bReadOnly = true;
+static bool s_bTurboPlayback = false;
 static u32 s_rerecords = 0;
 static PlayMode s_playMode = MODE_NONE;
 
@@ -96,6 +97,12 @@ static std::string s_InputDisplay[8];
 static GCManipFunction s_gc_manip_func;
 static WiiManipFunction s_wii_manip_func;
 
+// Append-only crash journal for the active recording; see ResetJournal below.
+static File::IOFile s_journal;
+static u32 s_journal_inputs_since_flush = 0;
+
+static DTMHeader CreateDTMHeader();
+
 // NOTE: Host / CPU Thread
 static void EnsureTmpInputSize(size_t bound)
 {
@@ -123,6 +130,57 @@ static bool IsMovieHeader(u8 magic[4])
 	return magic[0] == 'D' && magic[1] == 'T' && magic[2] == 'M' && magic[3] == 0x1A;
 }
 
+// The journal keeps the recording crash-safe without ever rewriting the input
+// stream: it is itself a valid .dtm whose fixed-size header is refreshed in
+// place every so often while every polled input is appended behind it. Losing
+// the process costs at most the few inputs still in the stdio buffer, and a
+// multi-hour session never has to be rewritten wholesale until it is saved.
+static std::string GetJournalPath()
+{
+	return File::GetUserPath(D_STATESAVES_IDX) + "dtm.journal";
+}
+
+// NOTE: CPU Thread
+static void RefreshJournalHeader()
+{
+	if (!s_journal.IsOpen())
+		return;
+	DTMHeader header = CreateDTMHeader();
+	s_journal.Seek(0, SEEK_SET);
+	s_journal.WriteArray(&header, 1);
+	s_journal.Seek(0, SEEK_END);
+	s_journal.Flush();
+	s_journal_inputs_since_flush = 0;
+}
+
+// (Re)writes the whole journal. Used when recording starts and after a
+// rerecord rolls the input stream back - the only events that invalidate
+// already-journaled bytes.
+static void ResetJournal()
+{
+	s_journal.Close();
+	if (!s_journal.Open(GetJournalPath(), "wb"))
+		return;
+	DTMHeader header = CreateDTMHeader();
+	s_journal.WriteArray(&header, 1);
+	if (s_totalBytes > 0)
+		s_journal.WriteBytes(tmpInput, (size_t)s_totalBytes);
+	s_journal.Flush();
+	s_journal_inputs_since_flush = 0;
+}
+
+// NOTE: CPU Thread
+static void JournalAppend(const u8* data, size_t size)
+{
+	if (!s_journal.IsOpen())
+		return;
+	s_journal.WriteBytes(data, size);
+	// Push the header counters through every so often; appends in between
+	// ride the stdio buffer and still land on a crash-consistent prefix.
+	if (++s_journal_inputs_since_flush >= 128)
+		RefreshJournalHeader();
+}
+
 static std::array<u8, 20> ConvertGitRevisionToBytes(const std::string& revision)
 {
 	std::array<u8, 20> revision_bytes{};
@@ -286,9 +344,12 @@ void DoFrameStep()
 	if (Core::GetState() == Core::State::Paused)
 	{
 		// if already paused, frame advance for 1 frame
+		// Resume through the CPU directly instead of Core::SetState so a
+		// single-frame advance doesn't pay for Wiimote::Resume and the sound
+		// stream unmute/remute round trip on every step.
 		s_bFrameStep = true;
 		Core::RequestRefreshInfo();
-		Core::SetState(Core::State::Running);
+		CPU::ResumeForFrameStep();
 	}
 	else if (!s_bFrameStep)
 	{
@@ -341,6 +402,11 @@ bool IsReadOnly()
 	return s_bReadOnly;
 }
 
+bool IsTurboPlayback()
+{
+	return s_bTurboPlayback && s_playMode == MODE_PLAYING;
+}
+
 u64 GetRecordingStartTime()
 {
 	return s_recordingStartTime;
@@ -605,6 +671,8 @@ bool BeginRecordingInput(int controllers)
 
 	s_currentByte = s_totalBytes = 0;
 
+	ResetJournal();
+
 	Core::UpdateWantDeterminism();
 
 	Core::PauseAndLock(false, was_unpaused);
@@ -870,6 +938,7 @@ void RecordInput(GCPadStatus* PadStatus, int controllerID)
 	memcpy(&tmpInput[s_currentByte], &s_padState, sizeof(ControllerState));
 	s_currentByte += sizeof(ControllerState);
 	s_totalBytes = s_currentByte;
+	JournalAppend((u8*)&s_padState, sizeof(ControllerState));
 }
 
 // NOTE: CPU Thread
@@ -893,6 +962,7 @@ void RecordWiimote(int wiimote, u8* data, u8 size)
 	memcpy(&(tmpInput[s_currentByte]), data, size);
 	s_currentByte += size;
 	s_totalBytes = s_currentByte;
+	JournalAppend(&tmpInput[s_currentByte - size - 1], (size_t)size + 1);
 }
 
 // NOTE: EmuThread / Host Thread
@@ -967,6 +1037,13 @@ bool PlayInput(const std::string& filename)
 
 	s_playMode = MODE_PLAYING;
 
+	// Verification turbo: run as fast as the host allows. Presentation and
+	// audio mixing are skipped while this is set (see Renderer::Swap and
+	// AudioCommon::SendAIBuffer); only the emulated state matters.
+	s_bTurboPlayback = SConfig::GetInstance().m_MovieTurboPlayback;
+	if (s_bTurboPlayback)
+		Core::SetIsThrottlerTempDisabled(true);
+
 	// Wiimotes cause desync issues if they're not reset before launching the game
 	Wiimote::ResetAllWiimotes();
 
@@ -1161,6 +1238,9 @@ void LoadInput(const std::string& filename)
 				Core::UpdateWantDeterminism();
 				Core::DisplayMessage("Switched to recording", 2000);
 			}
+			// The rerecord rolled the input stream back, so the journaled
+			// bytes past this point are no longer part of the movie.
+			ResetJournal();
 		}
 	}
 	else
@@ -1334,6 +1414,16 @@ bool PlayWiimote(int wiimote, u8* data, const WiimoteEmu::ReportFeatures& rptf,
 // NOTE: Host / EmuThread / CPU Thread
 void EndPlayInput(bool cont)
 {
+	if (s_bTurboPlayback)
+	{
+		// The replay is over (or switched to recording): drop the turbo
+		// overrides and re-run the game hash check so the verification run
+		// finishes with an explicit verdict on screen and in the log.
+		s_bTurboPlayback = false;
+		Core::SetIsThrottlerTempDisabled(false);
+		std::thread md5thread(CheckMD5);
+		md5thread.detach();
+	}
 	if (cont)
 	{
 		// If !IsMovieActive(), changing s_playMode requires calling UpdateWantDeterminism
@@ -1351,6 +1441,9 @@ void EndPlayInput(bool cont)
 		s_rerecords = 0;
 		s_currentByte = 0;
 		s_playMode = MODE_NONE;
+		// Leave the journal file behind as a recovery copy, but stop writing.
+		RefreshJournalHeader();
+		s_journal.Close();
 		Core::DisplayMessage("Movie End.", 2000);
 		s_bRecordingFromSaveState = false;
 		// we don't clear these things because otherwise we can't resume playback if we load a movie
@@ -1368,10 +1461,9 @@ void EndPlayInput(bool cont)
 }
 
 // NOTE: Save State + Host Thread
-void SaveRecording(const std::string& filename)
+// NOTE: CPU Thread / Host Thread
+static DTMHeader CreateDTMHeader()
 {
-	File::IOFile save_record(filename, "wb");
-	// Create the real header now and write it
 	DTMHeader header;
 	memset(&header, 0, sizeof(DTMHeader));
 
@@ -1424,6 +1516,14 @@ void SaveRecording(const std::string& filename)
 	header.uniqueID = 0;
 	// header.audioEmulator;
 
+	return header;
+}
+
+void SaveRecording(const std::string& filename)
+{
+	File::IOFile save_record(filename, "wb");
+	// Create the real header now and write it
+	DTMHeader header = CreateDTMHeader();
 	save_record.WriteArray(&header, 1);
 
 	bool success = save_record.WriteArray(tmpInput, (size_t)s_totalBytes);
@@ -1578,6 +1678,15 @@ void GetMD5()
 // NOTE: EmuThread
 void Shutdown()
 {
+	// If emulation stopped mid-replay, drop the turbo overrides here since
+	// EndPlayInput never ran.
+	if (s_bTurboPlayback)
+	{
+		s_bTurboPlayback = false;
+		Core::SetIsThrottlerTempDisabled(false);
+	}
+	RefreshJournalHeader();
+	s_journal.Close();
 	s_currentInputCount = s_totalInputCount = s_totalFrames = s_totalBytes = s_tickCountAtLastInput =
 		0;
 	delete[] tmpInput;
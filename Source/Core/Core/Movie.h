@@ -121,6 +121,9 @@ bool IsJustStartingPlayingInputFromSaveState();
 bool IsPlayingInput();
 bool IsMovieActive();
 bool IsReadOnly();
+// True while a movie is replayed for verification only: throttling, frame
+// presentation and audio mixing are all skipped.
+bool IsTurboPlayback();
 u64 GetRecordingStartTime();
 
 u64 GetCurrentFrame();
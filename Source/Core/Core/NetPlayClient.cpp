@@ -11,13 +11,19 @@
 #include "Common/Common.h"
 #include "Common/CommonPaths.h"
 #include "Common/CommonTypes.h"
+#include "Common/CPUDetect.h"
 #include "Common/ENetUtil.h"
+#include "Common/Hash.h"
 #include "Common/MD5.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
+#include "Common/ThreadPool.h"
 #include "Common/Timer.h"
 #include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/HW/AudioInterface.h"
 #include "Core/HW/EXI/EXI_DeviceIPL.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/SI/SI.h"
 #include "Core/HW/SI/SI_DeviceGCController.h"
 #include "Core/HW/Sram.h"
@@ -25,6 +31,7 @@
 #include "Core/HW/WiimoteReal/WiimoteReal.h"
 #include "Core/IOS/USB/Bluetooth/BTEmu.h"
 #include "Core/Movie.h"
+#include "Core/State.h"
 #include "InputCommon/GCAdapter.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/VideoConfig.h"
@@ -51,6 +58,13 @@ NetPlayClient::~NetPlayClient()
 		Disconnect();
 	}
 
+	// destroy pooled packets that never made it onto the wire
+	while (!m_direct_queue.Empty())
+	{
+		enet_packet_destroy(m_direct_queue.Front());
+		m_direct_queue.Pop();
+	}
+
 	if (g_MainNetHost.get() == m_client)
 	{
 		g_MainNetHost.release();
@@ -78,7 +92,7 @@ NetPlayClient::NetPlayClient(const std::string& address, const u16 port, NetPlay
 	if (!traversal)
 	{
 		// Direct Connection
-		m_client = enet_host_create(nullptr, 1, 3, 0, 0);
+		m_client = enet_host_create(nullptr, 1, CHANNEL_COUNT, 0, 0);
 
 		if (m_client == nullptr)
 		{
@@ -89,7 +103,7 @@ NetPlayClient::NetPlayClient(const std::string& address, const u16 port, NetPlay
 		enet_address_set_host(&addr, address.c_str());
 		addr.port = port;
 
-		m_server = enet_host_connect(m_client, &addr, 3, 0);
+		m_server = enet_host_connect(m_client, &addr, CHANNEL_COUNT, 0);
 
 		if (m_server == nullptr)
 		{
@@ -323,9 +337,16 @@ unsigned int NetPlayClient::OnData(sf::Packet& packet)
 			pad.substickX >> pad.substickY >> pad.triggerLeft >> pad.triggerRight;
 
 		// Trusting server for good map value (>=0 && <4)
-		// add to pad buffer
-		m_pad_buffer.at(map).Push(pad);
-		m_gc_pad_event.Set();
+		if (m_input_prediction)
+		{
+			ReconcilePadData(map, pad);
+		}
+		else
+		{
+			// add to pad buffer
+			m_pad_buffer.at(map).Push(pad);
+			m_gc_pad_event.Set();
+		}
 	}
 	break;
 
@@ -415,6 +436,7 @@ unsigned int NetPlayClient::OnData(sf::Packet& packet)
 			packet >> g_NetPlaySettings.m_CopyWiiSave;
 			packet >> g_NetPlaySettings.m_OCEnable;
 			packet >> g_NetPlaySettings.m_OCFactor;
+			packet >> g_NetPlaySettings.m_DeterministicAudioTiming;
 
 			int tmp;
 			packet >> tmp;
@@ -552,6 +574,34 @@ unsigned int NetPlayClient::OnData(sf::Packet& packet)
 	}
 	break;
 
+	case NP_MSG_HOST_STATE:
+	{
+		// Receiving this means the server designated us the warm-standby
+		// backup; keep the mirror current so a host drop can be re-homed from
+		// it instead of setting the session up again from scratch.
+		std::lock_guard<std::recursive_mutex> lkg(m_crit.game);
+		const bool was_backup = m_host_state_mirror.valid;
+
+		packet >> m_host_state_mirror.buffer_size;
+		for (PadMapping& mapping : m_host_state_mirror.pad_map)
+			packet >> mapping;
+		for (PadMapping& mapping : m_host_state_mirror.wiimote_map)
+			packet >> mapping;
+		packet >> m_host_state_mirror.game;
+		packet >> m_host_state_mirror.current_game;
+		packet >> m_host_state_mirror.running;
+
+		u32 time_low, time_high;
+		packet >> time_low;
+		packet >> time_high;
+		m_host_state_mirror.initial_rtc = time_low | ((u64)time_high << 32);
+		m_host_state_mirror.valid = true;
+
+		if (!was_backup)
+			INFO_LOG(NETPLAY, "Designated as backup host; mirroring session state");
+	}
+	break;
+
 	default:
 		PanicAlertT("Unknown message received with id : %d", mid);
 		break;
@@ -564,7 +614,7 @@ void NetPlayClient::Send(const sf::Packet& packet)
 {
 	ENetPacket* epac =
 		enet_packet_create(packet.getData(), packet.getDataSize(), ENET_PACKET_FLAG_RELIABLE);
-	enet_peer_send(m_server, 0, epac);
+	enet_peer_send(m_server, CHANNEL_CONTROL, epac);
 }
 
 void NetPlayClient::DisplayPlayersPing()
@@ -623,6 +673,41 @@ void NetPlayClient::SendAsync(sf::Packet&& packet)
 	ENetUtil::WakeupThread(m_client);
 }
 
+// ENet is done with a pooled packet (sent or dropped), hand its buffer back.
+static void ENET_CALLBACK ReleaseDirectBuffer(ENetPacket* packet)
+{
+	static_cast<std::atomic<bool>*>(packet->userData)->store(false, std::memory_order_release);
+}
+
+// called from ---CPU--- thread
+NetPlayClient::DirectBuffer* NetPlayClient::AcquireDirectBuffer()
+{
+	for (size_t i = 0; i < DIRECT_BUFFER_COUNT; i++)
+	{
+		DirectBuffer& buffer = m_direct_buffers[m_direct_buffer_next];
+		m_direct_buffer_next = (m_direct_buffer_next + 1) % DIRECT_BUFFER_COUNT;
+		if (!buffer.in_use.load(std::memory_order_acquire))
+		{
+			buffer.in_use.store(true, std::memory_order_relaxed);
+			return &buffer;
+		}
+	}
+	// pool exhausted (the connection is stalled anyway), caller falls back to
+	// the allocating path
+	return nullptr;
+}
+
+// called from ---CPU--- thread
+void NetPlayClient::SendAsyncDirect(DirectBuffer* buffer, size_t data_size)
+{
+	ENetPacket* packet = enet_packet_create(
+		buffer->data, data_size, ENET_PACKET_FLAG_RELIABLE | ENET_PACKET_FLAG_NO_ALLOCATE);
+	packet->userData = &buffer->in_use;
+	packet->freeCallback = ReleaseDirectBuffer;
+	m_direct_queue.Push(packet);
+	ENetUtil::WakeupThread(m_client);
+}
+
 // called from ---NETPLAY--- thread
 void NetPlayClient::ThreadFunc()
 {
@@ -633,6 +718,17 @@ void NetPlayClient::ThreadFunc()
 		if (m_traversal_client)
 			m_traversal_client->HandleResends();
 		net = enet_host_service(m_client, &netEvent, 250);
+		if (!m_direct_queue.Empty())
+		{
+			// Input goes out on its own channel and is flushed to the socket
+			// before any queued control traffic is even handed to ENet.
+			do
+			{
+				enet_peer_send(m_server, CHANNEL_INPUT, m_direct_queue.Front());
+				m_direct_queue.Pop();
+			} while (!m_direct_queue.Empty());
+			enet_host_flush(m_client);
+		}
 		while (!m_async_queue.Empty())
 		{
 			Send(m_async_queue.Front());
@@ -650,6 +746,18 @@ void NetPlayClient::ThreadFunc()
 				enet_packet_destroy(netEvent.packet);
 				break;
 			case ENET_EVENT_TYPE_DISCONNECT:
+			{
+				std::lock_guard<std::recursive_mutex> lkg(m_crit.game);
+				if (m_host_state_mirror.valid)
+				{
+					// We were the warm standby, so the session state survived
+					// the host. Everything a replacement host needs - game,
+					// buffer depth, mappings, RTC seed - is in the mirror.
+					NOTICE_LOG(NETPLAY,
+						"Host lost; mirrored session state retained (game '%s', pad buffer %u)",
+						m_host_state_mirror.game.c_str(), m_host_state_mirror.buffer_size);
+				}
+			}
 				m_dialog->OnConnectionLost();
 
 				if (m_is_running.IsSet())
@@ -743,6 +851,29 @@ void NetPlayClient::SendChatMessage(const std::string& msg)
 // called from ---CPU--- thread
 void NetPlayClient::SendPadState(const int in_game_pad, const GCPadStatus& pad)
 {
+	// Serialized by hand into a pooled buffer, matching sf::Packet's wire
+	// format (scalars in network byte order) so the receiving side is
+	// unaffected.
+	DirectBuffer* buffer = AcquireDirectBuffer();
+	if (buffer)
+	{
+		u8* ptr = buffer->data;
+		*ptr++ = static_cast<MessageId>(NP_MSG_PAD_DATA);
+		*ptr++ = static_cast<u8>(static_cast<PadMapping>(in_game_pad));
+		*ptr++ = static_cast<u8>(pad.button >> 8);
+		*ptr++ = static_cast<u8>(pad.button);
+		*ptr++ = pad.analogA;
+		*ptr++ = pad.analogB;
+		*ptr++ = pad.stickX;
+		*ptr++ = pad.stickY;
+		*ptr++ = pad.substickX;
+		*ptr++ = pad.substickY;
+		*ptr++ = pad.triggerLeft;
+		*ptr++ = pad.triggerRight;
+		SendAsyncDirect(buffer, ptr - buffer->data);
+		return;
+	}
+
 	sf::Packet packet;
 	packet << static_cast<MessageId>(NP_MSG_PAD_DATA);
 	packet << static_cast<PadMapping>(in_game_pad);
@@ -755,6 +886,18 @@ void NetPlayClient::SendPadState(const int in_game_pad, const GCPadStatus& pad)
 // called from ---CPU--- thread
 void NetPlayClient::SendWiimoteState(const int in_game_pad, const NetWiimote& nw)
 {
+	DirectBuffer* buffer = nw.size() + 3 <= DIRECT_BUFFER_SIZE ? AcquireDirectBuffer() : nullptr;
+	if (buffer)
+	{
+		u8* ptr = buffer->data;
+		*ptr++ = static_cast<MessageId>(NP_MSG_WIIMOTE_DATA);
+		*ptr++ = static_cast<u8>(static_cast<PadMapping>(in_game_pad));
+		*ptr++ = static_cast<u8>(nw.size());
+		memcpy(ptr, nw.data(), nw.size());
+		SendAsyncDirect(buffer, 3 + nw.size());
+		return;
+	}
+
 	sf::Packet packet;
 	packet << static_cast<MessageId>(NP_MSG_WIIMOTE_DATA);
 	packet << static_cast<PadMapping>(in_game_pad);
@@ -800,6 +943,8 @@ bool NetPlayClient::StartGame(const std::string& path)
 
 	m_timebase_frame = 0;
 
+	ResetPrediction();
+
 	m_is_running.Set();
 	NetPlay_Enable(this);
 
@@ -910,7 +1055,7 @@ void NetPlayClient::OnConnectReady(ENetAddress addr)
 	if (m_connection_state == ConnectionState::WaitingForTraversalClientConnectReady)
 	{
 		m_connection_state = ConnectionState::Connecting;
-		enet_host_connect(m_client, &addr, 0, 0);
+		enet_host_connect(m_client, &addr, CHANNEL_COUNT, 0);
 	}
 }
 
@@ -956,6 +1101,9 @@ bool NetPlayClient::GetNetPads(const int pad_nb, GCPadStatus* pad_status)
 	// The slot number is the "local" pad number, and what player
 	// it actually means is the "in-game" pad number.
 
+	if (m_input_prediction)
+		return GetPredictedPads(pad_nb, pad_status);
+
 	// When the 1st in-game pad is polled, we assume the others will
 	// will be polled as well. To reduce latency, we poll all local
 	// controllers at once and then send the status to the other
@@ -1018,6 +1166,306 @@ bool NetPlayClient::GetNetPads(const int pad_nb, GCPadStatus* pad_status)
 	return true;
 }
 
+// called from ---CPU--- thread
+bool NetPlayClient::GetPredictedPads(const int pad_nb, GCPadStatus* pad_status)
+{
+	if (!m_is_running.IsSet())
+		return false;
+
+	std::lock_guard<std::mutex> lk(m_prediction_mutex);
+
+	const bool first = IsFirstInGamePad(pad_nb);
+
+	if (m_rollback_pending)
+	{
+		// A rollback host job is queued; everything emulated until it runs is
+		// discarded by the state load, so serve a held input and leave the
+		// journal and the round counters untouched.
+		const auto& history = m_input_history[pad_nb];
+		*pad_status = history.empty() ? m_last_remote_input[pad_nb] : history.back();
+		return true;
+	}
+
+	if (m_replaying)
+	{
+		if (first)
+		{
+			CaptureRollbackSnapshotLocked(m_replay_round);
+			m_replay_round++;
+		}
+		const u32 round = m_replay_round - 1;
+		const u32 index = round - m_history_base_round;
+		const auto& history = m_input_history[pad_nb];
+		*pad_status = index < history.size() ? history[index] : m_last_remote_input[pad_nb];
+
+		// Caught back up to the round where the rollback was requested; resume
+		// live serving (and real-time pacing) from the next round on.
+		if (m_replay_round >= m_round_count)
+		{
+			m_replaying = false;
+			Core::SetIsThrottlerTempDisabled(false);
+		}
+		return true;
+	}
+
+	if (first)
+	{
+		CaptureRollbackSnapshotLocked(m_round_count);
+
+		// Poll and send all local pads once per round; prediction does not
+		// pre-fill the delay buffer, remote clients predict us instead.
+		const int num_local_pads = NumLocalPads();
+		for (int local_pad = 0; local_pad < num_local_pads; local_pad++)
+		{
+			switch (SConfig::GetInstance().m_SIDevice[local_pad])
+			{
+			case SerialInterface::SIDEVICE_WIIU_ADAPTER:
+				m_current_local_status[local_pad] = GCAdapter::Input(local_pad);
+				break;
+			case SerialInterface::SIDEVICE_GC_CONTROLLER:
+			default:
+				m_current_local_status[local_pad] = Pad::GetStatus(local_pad);
+				break;
+			}
+			SendPadState(LocalPadToInGamePad(local_pad), m_current_local_status[local_pad]);
+		}
+
+		m_round_count++;
+		TrimRollbackWindowLocked();
+
+		if ((m_round_count % 3600) == 0 && m_stat_predicted != 0)
+		{
+			INFO_LOG(NETPLAY,
+				"Input prediction: %u predicted, %u mispredicted (%.2f%%), %u rollbacks "
+				"(max depth %u, %u beyond window)",
+				m_stat_predicted, m_stat_mispredicted,
+				100.0 * m_stat_mispredicted / m_stat_predicted, m_stat_rollbacks, m_stat_max_depth,
+				m_stat_beyond_window);
+		}
+	}
+
+	const u32 round = m_round_count - 1;
+
+	const int local_pad = InGamePadToLocalPad(pad_nb);
+	if (local_pad < 4)
+	{
+		// Local pads are served immediately - hiding the delay-buffer latency
+		// is the point of this mode.
+		*pad_status = m_current_local_status[local_pad];
+	}
+	else if (m_pad_buffer[pad_nb].Size() > 0)
+	{
+		m_pad_buffer[pad_nb].Pop(*pad_status);
+	}
+	else
+	{
+		// No authoritative input yet: predict. The default model holds the
+		// last input received from this pad.
+		*pad_status = m_last_remote_input[pad_nb];
+		m_prediction_ledger[pad_nb].push_back({ round, *pad_status });
+		m_stat_predicted++;
+	}
+
+	m_input_history[pad_nb].push_back(*pad_status);
+	return true;
+}
+
+// called from ---NETPLAY--- thread
+void NetPlayClient::ReconcilePadData(const int map, const GCPadStatus& pad)
+{
+	std::lock_guard<std::mutex> lk(m_prediction_mutex);
+
+	m_last_remote_input[map] = pad;
+
+	auto& ledger = m_prediction_ledger[map];
+	if (ledger.empty())
+	{
+		// Nothing outstanding for this pad; serve it through the buffer.
+		m_pad_buffer.at(map).Push(pad);
+		return;
+	}
+
+	// Arrival order matches poll order, so this input is the authoritative
+	// version of the oldest outstanding prediction.
+	const PredictionRecord record = ledger.front();
+	ledger.pop_front();
+
+	if (memcmp(&record.predicted, &pad, sizeof(GCPadStatus)) == 0)
+		return;  // the prediction held; the journal already has this input
+
+	m_stat_mispredicted++;
+
+	const u32 index = record.round - m_history_base_round;
+	if (record.round < m_history_base_round || index >= m_input_history[map].size())
+	{
+		// The snapshot window has moved past the damaged round; nothing left
+		// to roll back to. The session may desync - widen the window if this
+		// count is ever nonzero on a healthy link.
+		m_stat_beyond_window++;
+		ERROR_LOG(NETPLAY, "Misprediction at round %u is outside the rollback window", record.round);
+		return;
+	}
+	m_input_history[map][index] = pad;
+
+	if (m_rollback_pending)
+	{
+		m_rollback_target = std::min(m_rollback_target, record.round);
+	}
+	else
+	{
+		m_rollback_pending = true;
+		m_rollback_target = record.round;
+		Core::QueueHostJob([this] { RollbackJob(); });
+	}
+}
+
+// called from ---HOST--- thread (Core::QueueHostJob)
+void NetPlayClient::RollbackJob()
+{
+	if (!m_is_running.IsSet())
+		return;
+
+	// Keep the CPU paused across both the bookkeeping and the state load so no
+	// round is served against half-switched timelines. PauseAndLock nests.
+	const bool was_unpaused = Core::PauseAndLock(true);
+
+	std::vector<u8> base;
+	std::vector<u8> delta;
+	bool have_snapshot = false;
+
+	{
+		std::lock_guard<std::mutex> lk(m_prediction_mutex);
+
+		// Newest snapshot at or before the mispredicted round.
+		const RollbackSnapshot* snapshot = nullptr;
+		for (const RollbackSnapshot& s : m_rollback_snapshots)
+		{
+			if (s.round > m_rollback_target)
+				break;
+			snapshot = &s;
+		}
+
+		if (snapshot)
+		{
+			const u32 depth = m_round_count - snapshot->round;
+			m_stat_rollbacks++;
+			m_stat_max_depth = std::max(m_stat_max_depth, depth);
+
+			base = m_rollback_base;
+			delta = snapshot->delta;
+			have_snapshot = true;
+
+			m_replaying = true;
+			m_replay_round = snapshot->round;
+
+			// Snapshots past the rollback point describe the abandoned
+			// timeline; the replay recaptures them against the corrected one.
+			while (!m_rollback_snapshots.empty() &&
+				m_rollback_snapshots.back().round > snapshot->round)
+				m_rollback_snapshots.pop_back();
+			m_rollback_snapshots.pop_back();  // recaptured as the first replay round
+
+			INFO_LOG(NETPLAY, "Rolling back %u rounds to reconcile mispredicted input", depth);
+		}
+		else
+		{
+			m_stat_beyond_window++;
+		}
+
+		m_rollback_pending = false;
+	}
+
+	if (have_snapshot)
+	{
+		// Replay runs unthrottled so remote peers see as small a send gap as
+		// possible; GetPredictedPads re-enables pacing once caught up.
+		Core::SetIsThrottlerTempDisabled(true);
+		State::LoadRollbackSnapshot(base, delta);
+	}
+
+	Core::PauseAndLock(false, was_unpaused);
+}
+
+// called from ---CPU--- thread, m_prediction_mutex held
+void NetPlayClient::CaptureRollbackSnapshotLocked(u32 round)
+{
+	const size_t prev_base_size = m_rollback_base.size();
+
+	RollbackSnapshot snapshot;
+	snapshot.round = round;
+	State::SaveRollbackSnapshot(m_rollback_base, snapshot.delta);
+
+	// SaveRollbackSnapshot refreshed the base (first capture or size change);
+	// deltas against the old base no longer apply.
+	if (m_rollback_base.size() != prev_base_size)
+		m_rollback_snapshots.clear();
+
+	m_rollback_snapshots.emplace_back(std::move(snapshot));
+}
+
+// called from ---CPU--- thread, m_prediction_mutex held
+void NetPlayClient::TrimRollbackWindowLocked()
+{
+	// How many rounds of history and snapshots to keep. The window bounds both
+	// the worst-case rollback depth and the per-round snapshot memory; with
+	// 60Hz polling, 30 rounds tolerates a 500ms correction round trip.
+	static const size_t ROLLBACK_WINDOW = 30;
+
+	while (m_rollback_snapshots.size() > ROLLBACK_WINDOW)
+		m_rollback_snapshots.pop_front();
+
+	if (m_rollback_snapshots.empty())
+		return;
+
+	const u32 new_base = m_rollback_snapshots.front().round;
+	while (m_history_base_round < new_base)
+	{
+		for (auto& history : m_input_history)
+		{
+			if (!history.empty())
+				history.pop_front();
+		}
+		m_history_base_round++;
+	}
+}
+
+// called from the ---GUI--- thread before the game boots
+void NetPlayClient::ResetPrediction()
+{
+	std::lock_guard<std::mutex> lk(m_prediction_mutex);
+
+	m_input_prediction = SConfig::GetInstance().m_NetPlayInputPrediction;
+
+	GCPadStatus neutral = {};
+	neutral.stickX = GCPadStatus::MAIN_STICK_CENTER_X;
+	neutral.stickY = GCPadStatus::MAIN_STICK_CENTER_Y;
+	neutral.substickX = GCPadStatus::C_STICK_CENTER_X;
+	neutral.substickY = GCPadStatus::C_STICK_CENTER_Y;
+	m_last_remote_input.fill(neutral);
+	m_current_local_status.fill(neutral);
+
+	for (auto& ledger : m_prediction_ledger)
+		ledger.clear();
+	for (auto& history : m_input_history)
+		history.clear();
+	m_history_base_round = 0;
+	m_round_count = 0;
+	m_rollback_base.clear();
+	m_rollback_snapshots.clear();
+	m_rollback_pending = false;
+	m_replaying = false;
+	m_replay_round = 0;
+	m_rollback_target = 0;
+	m_stat_predicted = 0;
+	m_stat_mispredicted = 0;
+	m_stat_rollbacks = 0;
+	m_stat_max_depth = 0;
+	m_stat_beyond_window = 0;
+
+	if (m_input_prediction)
+		INFO_LOG(NETPLAY, "Input prediction enabled (last-input-held predictor)");
+}
+
 // called from ---CPU--- thread
 bool NetPlayClient::WiimoteUpdate(int _number, u8* data, const u8 size, u8 reporting_mode)
 {
@@ -1187,19 +1635,106 @@ int NetPlayClient::LocalPadToInGamePad(int local_pad) const
 	return ingame_pad;
 }
 
+// How often (in frames) the emulated RAM digest is exchanged. The timebase
+// only diverges long after actual state does, so this catches desyncs within
+// a couple of seconds.
+static const u32 RAM_HASH_INTERVAL = 120;
+
+// called from ---CPU--- thread
+// Hashes emulated RAM in 4MB slices spread across the thread pool. The CPU
+// thread claims slices alongside the workers, so completion never depends on
+// pool scheduling.
+static u64 ComputeRamHash()
+{
+	struct HashJob
+	{
+		struct Slice
+		{
+			const u8* ptr;
+			u32 len;
+		};
+		std::vector<Slice> slices;
+		std::vector<u64> results;
+		std::atomic<u32> next{ 0 };
+		std::atomic<u32> done{ 0 };
+	};
+	static const u32 SLICE_SIZE = 4 * 1024 * 1024;
+
+	std::shared_ptr<HashJob> job = std::make_shared<HashJob>();
+	auto add_region = [&job](const u8* base, u32 size) {
+		for (u32 offset = 0; offset < size; offset += SLICE_SIZE)
+			job->slices.push_back({ base + offset, std::min(SLICE_SIZE, size - offset) });
+	};
+	add_region(Memory::m_pRAM, Memory::REALRAM_SIZE);
+	if (SConfig::GetInstance().bWii)
+		add_region(Memory::m_pEXRAM, Memory::EXRAM_SIZE);
+
+	const u32 num_slices = static_cast<u32>(job->slices.size());
+	job->results.resize(num_slices);
+	auto hash_slices = [job, num_slices]() {
+		u32 i;
+		while ((i = job->next.fetch_add(1)) < num_slices)
+		{
+			job->results[i] = GetCRC32(job->slices[i].ptr, job->slices[i].len, 0);
+			job->done.fetch_add(1);
+		}
+	};
+	const u32 num_helpers = std::min(num_slices, static_cast<u32>(std::max(cpu_info.num_cores, 2)) - 1);
+	for (u32 i = 0; i < num_helpers; i++)
+		Common::AsyncWorker::ExecuteAsync(std::function<void()>(hash_slices));
+	hash_slices();
+	u32 loopcount = 0;
+	while (job->done.load() < num_slices)
+		Common::cYield(loopcount++);
+
+	return GetCRC32(reinterpret_cast<const u8*>(job->results.data()),
+		num_slices * sizeof(u64), 0);
+}
+
 void NetPlayClient::SendTimeBase()
 {
 	std::lock_guard<std::mutex> lk(crit_netplay_client);
 
 	u64 timebase = SystemTimers::GetFakeTimeBase();
 
+	const u32 frame = netplay_client->m_timebase_frame++;
+
 	sf::Packet packet;
 	packet << static_cast<MessageId>(NP_MSG_TIMEBASE);
 	packet << static_cast<u32>(timebase);
 	packet << static_cast<u32>(timebase << 32);
-	packet << netplay_client->m_timebase_frame++;
+	packet << frame;
 
 	netplay_client->SendAsync(std::move(packet));
+
+	if ((frame % RAM_HASH_INTERVAL) == 0)
+	{
+		const u64 hash = ComputeRamHash();
+
+		sf::Packet hash_packet;
+		hash_packet << static_cast<MessageId>(NP_MSG_RAM_HASH);
+		hash_packet << static_cast<u32>(hash);
+		hash_packet << static_cast<u32>(hash >> 32);
+		hash_packet << frame;
+
+		netplay_client->SendAsync(std::move(hash_packet));
+	}
+
+	// With deterministic audio timing every client schedules the same audio
+	// event stream, so its hash doubles as a focused desync probe that fires
+	// well before a timing divergence reaches RAM.
+	if (SConfig::GetInstance().bDeterministicAudioTiming && (frame % RAM_HASH_INTERVAL) == 0)
+	{
+		const u64 hash = AudioInterface::GetEventStreamHash();
+
+		sf::Packet hash_packet;
+		hash_packet << static_cast<MessageId>(NP_MSG_AUDIO_HASH);
+		hash_packet << static_cast<u32>(hash);
+		hash_packet << static_cast<u32>(hash >> 32);
+		hash_packet << frame;
+
+		netplay_client->SendAsync(std::move(hash_packet));
+	}
 }
 
 bool NetPlayClient::DoAllPlayersHaveGame()
@@ -6,6 +6,8 @@
 
 #include <SFML/Network/Packet.hpp>
 #include <array>
+#include <atomic>
+#include <deque>
 #include <map>
 #include <mutex>
 #include <string>
@@ -112,6 +114,22 @@ protected:
 
 	Common::FifoQueue<sf::Packet, false> m_async_queue;
 
+	// Preallocated buffers backing the per-frame data messages. Pad and
+	// wiimote state is serialized straight into one of these and handed to
+	// ENet with ENET_PACKET_FLAG_NO_ALLOCATE, so the 60Hz send path does not
+	// allocate. Only the CPU thread acquires buffers; ENet releases them from
+	// the netplay thread once the packet is sent.
+	static const size_t DIRECT_BUFFER_SIZE = 64;
+	static const size_t DIRECT_BUFFER_COUNT = 64;
+	struct DirectBuffer
+	{
+		u8 data[DIRECT_BUFFER_SIZE];
+		std::atomic<bool> in_use{ false };
+	};
+	std::array<DirectBuffer, DIRECT_BUFFER_COUNT> m_direct_buffers;
+	size_t m_direct_buffer_next = 0;
+	Common::FifoQueue<ENetPacket*, false> m_direct_queue;
+
 	std::array<Common::FifoQueue<GCPadStatus>, 4> m_pad_buffer;
 	std::array<Common::FifoQueue<NetWiimote>, 4> m_wiimote_buffer;
 
@@ -149,10 +167,62 @@ private:
 
 	bool LocalPlayerHasControllerMapped() const;
 
+	// ---- Input prediction / rollback (optional, m_input_prediction) ----
+	//
+	// Instead of stalling on an empty remote pad buffer, GetNetPads serves a
+	// locally predicted input (last-input-held) and keeps going. Every served
+	// input - local or remote, predicted or authoritative - is journalled per
+	// pad, and a delta savestate is captured at each poll round. When an
+	// authoritative input contradicts a prediction, a host job reloads the
+	// snapshot from the mispredicted round and the journal replays the
+	// corrected inputs back to the present, unthrottled. All clients of a
+	// session should run with the same setting; a predicting client sends one
+	// input per round instead of pre-filling the delay buffer.
+	struct PredictionRecord
+	{
+		u32 round;
+		GCPadStatus predicted;
+	};
+	struct RollbackSnapshot
+	{
+		u32 round;
+		std::vector<u8> delta;
+	};
+
+	bool GetPredictedPads(int pad_nb, GCPadStatus* pad_status);
+	void ReconcilePadData(int map, const GCPadStatus& pad);
+	void RollbackJob();
+	void ResetPrediction();
+	void CaptureRollbackSnapshotLocked(u32 round);
+	void TrimRollbackWindowLocked();
+
+	bool m_input_prediction = false;
+	std::mutex m_prediction_mutex;
+	std::array<GCPadStatus, 4> m_last_remote_input{};
+	std::array<GCPadStatus, 4> m_current_local_status{};
+	std::array<std::deque<PredictionRecord>, 4> m_prediction_ledger;
+	std::array<std::deque<GCPadStatus>, 4> m_input_history;
+	u32 m_history_base_round = 0;
+	u32 m_round_count = 0;  // rounds served on the live timeline
+	std::vector<u8> m_rollback_base;
+	std::deque<RollbackSnapshot> m_rollback_snapshots;
+	bool m_rollback_pending = false;  // host job queued; serves are frozen
+	bool m_replaying = false;
+	u32 m_replay_round = 0;  // next round served from the journal
+	u32 m_rollback_target = 0;
+	// Instrumentation, reported through the NETPLAY log.
+	u32 m_stat_predicted = 0;
+	u32 m_stat_mispredicted = 0;
+	u32 m_stat_rollbacks = 0;
+	u32 m_stat_max_depth = 0;
+	u32 m_stat_beyond_window = 0;
+
 	void SendStartGamePacket();
 	void SendStopGamePacket();
 
 	void UpdateDevices();
+	DirectBuffer* AcquireDirectBuffer();
+	void SendAsyncDirect(DirectBuffer* buffer, size_t data_size);
 	void SendPadState(int in_game_pad, const GCPadStatus& np);
 	void SendWiimoteState(int in_game_pad, const NetWiimote& nw);
 	unsigned int OnData(sf::Packet& packet);
@@ -166,6 +236,25 @@ private:
 	bool m_is_connected = false;
 	ConnectionState m_connection_state = ConnectionState::Failure;
 
+	// Warm-standby mirror of the server's session state (see
+	// NP_MSG_HOST_STATE). Only the designated backup client ever receives the
+	// message, so a valid mirror doubles as the "we are the backup" flag. If
+	// the host drops, the mirror holds what a replacement host needs to
+	// re-open the session with the same buffers, mappings and RTC seed.
+	// Guarded by m_crit.game.
+	struct HostStateMirror
+	{
+		bool valid = false;
+		u32 buffer_size = 0;
+		PadMappingArray pad_map{};
+		PadMappingArray wiimote_map{};
+		std::string game;
+		u32 current_game = 0;
+		bool running = false;
+		u64 initial_rtc = 0;
+	};
+	HostStateMirror m_host_state_mirror;
+
 	PlayerId m_pid = 0;
 	std::map<PlayerId, Player> m_players;
 	std::string m_host_spec;
@@ -24,6 +24,7 @@ struct NetSettings
 	bool m_CopyWiiSave;
 	bool m_OCEnable;
 	float m_OCFactor;
+	bool m_DeterministicAudioTiming;
 	ExpansionInterface::TEXIDevices m_EXIDevice[2];
 };
 
@@ -58,6 +59,8 @@ enum
 
 	NP_MSG_TIMEBASE = 0xB0,
 	NP_MSG_DESYNC_DETECTED = 0xB1,
+	NP_MSG_RAM_HASH = 0xB2,
+	NP_MSG_AUDIO_HASH = 0xB3,
 
 	NP_MSG_COMPUTE_MD5 = 0xC0,
 	NP_MSG_MD5_PROGRESS = 0xC1,
@@ -73,6 +76,25 @@ enum
 	NP_MSG_PLAYER_PING_DATA = 0xE2,
 
 	NP_MSG_SYNC_GC_SRAM = 0xF0,
+
+	// Warm-standby replication: the server periodically mirrors its session
+	// state (pad buffer depth, mappings, selected game, RTC seed) to one
+	// designated backup client, so a host drop leaves a peer holding what a
+	// replacement host needs. Sent on CHANNEL_BULK, never on the input path.
+	NP_MSG_HOST_STATE = 0xF1,
+};
+
+// ENet channel assignment. Per-frame input gets a dedicated channel so a
+// bursty control message (chat, an MD5 result, a game change) can never
+// head-of-line block a pad packet - ENet orders and retransmits per channel.
+// Input stays reliable: every pad message fills exactly one slot of the
+// receiver's buffer, so an unsequenced (lossy) channel would stall it.
+enum
+{
+	CHANNEL_CONTROL = 0,  // session control, chat, desync hashes
+	CHANNEL_INPUT = 1,    // per-frame pad and wiimote data
+	CHANNEL_BULK = 2,     // reserved for paced bulk transfers
+	CHANNEL_COUNT = 3
 };
 
 enum
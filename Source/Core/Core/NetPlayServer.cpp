@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include "Core/NetPlayServer.h"
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -13,6 +14,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 #include "Core/ConfigManager.h"
 #include "Core/HW/EXI/EXI_DeviceIPL.h"
 #include "Core/HW/Sram.h"
@@ -32,8 +34,28 @@
 
 u64 g_netplay_initial_rtc = 1272737767;
 
+// Spectator tap tuning. Subscribers register (and keep themselves alive) by
+// sending the string "SPEC" to the session port + 1 and are dropped again
+// after 30 seconds of silence, so overlay tooling just pings periodically.
+static const u16 SPECTATOR_PORT_OFFSET = 1;
+static const u32 SPECTATOR_SUBSCRIBER_TIMEOUT_MS = 30 * 1000;
+static const u32 SPECTATOR_KEYFRAME_INTERVAL_MS = 1000;
+static const u8 SPECTATOR_PKT_KEYFRAME = 'K';
+static const u8 SPECTATOR_PKT_DELTA = 'D';
+
 NetPlayServer::~NetPlayServer()
 {
+	if (m_spectator_running.load())
+	{
+		m_spectator_running.store(false);
+		m_spectator_thread.join();
+	}
+	if (m_spectator_socket != ENET_SOCKET_NULL)
+	{
+		enet_socket_destroy(m_spectator_socket);
+		m_spectator_socket = ENET_SOCKET_NULL;
+	}
+
 	if (is_connected)
 	{
 		m_do_loop = false;
@@ -91,7 +113,7 @@ NetPlayServer::NetPlayServer(const u16 port, bool traversal, const std::string&
 		ENetAddress serverAddr;
 		serverAddr.host = ENET_HOST_ANY;
 		serverAddr.port = port;
-		m_server = enet_host_create(&serverAddr, 10, 3, 0, 0);
+		m_server = enet_host_create(&serverAddr, 10, CHANNEL_COUNT, 0, 0);
 		if (m_server != nullptr)
 			m_server->intercept = ENetUtil::InterceptCallback;
 	}
@@ -99,8 +121,33 @@ NetPlayServer::NetPlayServer(const u16 port, bool traversal, const std::string&
 	{
 		is_connected = true;
 		m_do_loop = true;
+		m_stats_timer.Start();
+		m_replication_timer.Start();
 		m_thread = std::thread(&NetPlayServer::ThreadFunc, this);
 		m_target_buffer_size = 8;
+
+		// Spectator tap (see SpectatorThreadFunc). Losing the port is not
+		// fatal; the session just runs without spectators.
+		ENetAddress spectator_addr;
+		spectator_addr.host = ENET_HOST_ANY;
+		spectator_addr.port = GetPort() + SPECTATOR_PORT_OFFSET;
+		m_spectator_socket = enet_socket_create(ENET_SOCKET_TYPE_DATAGRAM);
+		if (m_spectator_socket != ENET_SOCKET_NULL &&
+			enet_socket_bind(m_spectator_socket, &spectator_addr) == 0)
+		{
+			enet_socket_set_option(m_spectator_socket, ENET_SOCKOPT_NONBLOCK, 1);
+			m_spectator_running.store(true);
+			m_spectator_thread = std::thread(&NetPlayServer::SpectatorThreadFunc, this);
+		}
+		else
+		{
+			WARN_LOG(NETPLAY, "failed to bind spectator port %u", spectator_addr.port);
+			if (m_spectator_socket != ENET_SOCKET_NULL)
+			{
+				enet_socket_destroy(m_spectator_socket);
+				m_spectator_socket = ENET_SOCKET_NULL;
+			}
+		}
 	}
 }
 
@@ -123,6 +170,23 @@ void NetPlayServer::ThreadFunc()
 			m_update_pings = false;
 		}
 
+		// Log per-player link quality and session bandwidth every so often,
+		// so relay operators can watch sessions without attaching a debugger.
+		if (m_stats_timer.GetTimeElapsed() > 5000)
+		{
+			ReportTrafficStats();
+			m_stats_timer.Start();
+		}
+
+		// Mirror session state to the designated backup client every so often,
+		// so a host drop leaves a peer holding everything needed to re-home
+		// the session. This runs on the control loop, off the pad relay path.
+		if (m_replication_timer.GetTimeElapsed() > 1000)
+		{
+			ReplicateHostState();
+			m_replication_timer.Start();
+		}
+
 		ENetEvent netEvent;
 		int net;
 		if (m_traversal_client)
@@ -220,6 +284,217 @@ void NetPlayServer::ThreadFunc()
 	}
 }
 
+// called from ---NETPLAY--- thread
+void NetPlayServer::ReportTrafficStats()
+{
+	// ENet already keeps the counters; the host totals are ours to reset,
+	// which turns them into per-interval bandwidth.
+	const u64 interval_ms = m_stats_timer.GetTimeElapsed();
+	const u32 sent = m_server->totalSentData;
+	const u32 received = m_server->totalReceivedData;
+	m_server->totalSentData = 0;
+	m_server->totalReceivedData = 0;
+
+	std::lock_guard<std::recursive_mutex> lkp(m_crit.players);
+	if (m_players.empty() || interval_ms == 0)
+		return;
+
+	INFO_LOG(NETPLAY, "session traffic: up %u B/s, down %u B/s",
+		u32(u64(sent) * 1000 / interval_ms), u32(u64(received) * 1000 / interval_ms));
+
+	for (const auto& player_entry : m_players)
+	{
+		const Client& client = player_entry.second;
+		INFO_LOG(NETPLAY, "player %u (%s): rtt %u ms (var %u), loss %.2f%%", client.pid,
+			client.name.c_str(), client.socket->roundTripTime,
+			client.socket->roundTripTimeVariance,
+			100.0 * client.socket->packetLoss / ENET_PEER_PACKET_LOSS_SCALE);
+	}
+}
+
+// Appends the fields of pad that differ from prev to out, preceded by a
+// bitmask saying which ones follow. Returns the datagram length.
+static u32 SpectatorEncodeDelta(const GCPadStatus& prev, const GCPadStatus& pad, PadMapping map,
+	u8 sequence, u8* out)
+{
+	u16 mask = 0;
+	u8 fields[10];
+	u32 field_len = 0;
+
+	if (pad.button != prev.button)
+	{
+		mask |= 1 << 0;
+		fields[field_len++] = pad.button >> 8;
+		fields[field_len++] = pad.button & 0xff;
+	}
+
+	const u8 bytes[8] = { pad.analogA, pad.analogB, pad.stickX, pad.stickY,
+												pad.substickX, pad.substickY, pad.triggerLeft, pad.triggerRight };
+	const u8 prev_bytes[8] = { prev.analogA, prev.analogB, prev.stickX, prev.stickY,
+														 prev.substickX, prev.substickY, prev.triggerLeft, prev.triggerRight };
+	for (u32 i = 0; i < 8; i++)
+	{
+		if (bytes[i] != prev_bytes[i])
+		{
+			mask |= 1 << (i + 1);
+			fields[field_len++] = bytes[i];
+		}
+	}
+
+	u32 len = 0;
+	out[len++] = SPECTATOR_PKT_DELTA;
+	out[len++] = sequence;
+	out[len++] = (u8)map;
+	out[len++] = mask >> 8;
+	out[len++] = mask & 0xff;
+	memcpy(out + len, fields, field_len);
+	return len + field_len;
+}
+
+static u32 SpectatorEncodePad(const GCPadStatus& pad, u8* out)
+{
+	u32 len = 0;
+	out[len++] = pad.button >> 8;
+	out[len++] = pad.button & 0xff;
+	out[len++] = pad.analogA;
+	out[len++] = pad.analogB;
+	out[len++] = pad.stickX;
+	out[len++] = pad.stickY;
+	out[len++] = pad.substickX;
+	out[len++] = pad.substickY;
+	out[len++] = pad.triggerLeft;
+	out[len++] = pad.triggerRight;
+	return len;
+}
+
+// called from ---NETPLAY--- thread
+void NetPlayServer::SpectatorTapPadData(PadMapping map, const GCPadStatus& pad)
+{
+	if (!m_spectator_running.load(std::memory_order_relaxed))
+		return;
+
+	SpectatorPadEvent event;
+	event.map = map;
+	event.pad = pad;
+	m_spectator_queue.Push(event);
+}
+
+// called from ---SPECTATOR--- thread
+//
+// Read-only fan-out of the relayed input stream (not video). Each relayed
+// pad status becomes a delta datagram carrying only the fields that changed
+// since the previous one for that pad; once a second a keyframe datagram
+// carries the absolute state of all four pads plus the pad mapping and game
+// id, so late joiners and lost datagrams recover at the next keyframe. Both
+// kinds carry a rolling sequence number for loss detection. Datagrams are a
+// few dozen bytes, so unicasting to hundreds of subscribers is still far
+// cheaper than one more player - and since everything here runs on this
+// thread, the player path never waits on a spectator.
+void NetPlayServer::SpectatorThreadFunc()
+{
+	Common::SetCurrentThreadName("Spectator fan-out");
+
+	struct Subscriber
+	{
+		ENetAddress address;
+		u32 last_seen_ms;
+	};
+	std::vector<Subscriber> subscribers;
+
+	GCPadStatus last_pad[4];
+	memset(last_pad, 0, sizeof(last_pad));
+	u8 sequence = 0;
+	Common::Timer keyframe_timer;
+	keyframe_timer.Start();
+
+	const auto send_to_subscribers = [&](const u8* data, u32 size) {
+		ENetBuffer buf;
+		buf.data = (void*)data;
+		buf.dataLength = size;
+		for (const Subscriber& subscriber : subscribers)
+			enet_socket_send(m_spectator_socket, &subscriber.address, &buf, 1);
+	};
+
+	while (m_spectator_running.load())
+	{
+		// Doubles as the pacing sleep when there is nothing to read.
+		enet_uint32 condition = ENET_SOCKET_WAIT_RECEIVE;
+		enet_socket_wait(m_spectator_socket, &condition, 10);
+
+		// Subscribe/keepalive datagrams.
+		for (;;)
+		{
+			u8 bfr[32];
+			ENetAddress from;
+			ENetBuffer buf;
+			buf.data = bfr;
+			buf.dataLength = sizeof(bfr);
+			const int rcvd = enet_socket_receive(m_spectator_socket, &from, &buf, 1);
+			if (rcvd <= 0)
+				break;
+			if (rcvd < 4 || memcmp(bfr, "SPEC", 4) != 0)
+				continue;
+
+			const u32 now = Common::Timer::GetTimeMs();
+			auto it = std::find_if(subscribers.begin(), subscribers.end(), [&](const Subscriber& s) {
+				return s.address.host == from.host && s.address.port == from.port;
+			});
+			if (it == subscribers.end())
+			{
+				subscribers.push_back({ from, now });
+				INFO_LOG(NETPLAY, "spectator subscribed (%u total)", (u32)subscribers.size());
+			}
+			else
+			{
+				it->last_seen_ms = now;
+			}
+		}
+
+		const u32 now = Common::Timer::GetTimeMs();
+		subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(),
+												 [&](const Subscriber& s) {
+													 return now - s.last_seen_ms > SPECTATOR_SUBSCRIBER_TIMEOUT_MS;
+												 }),
+			subscribers.end());
+
+		if (keyframe_timer.GetTimeElapsed() > SPECTATOR_KEYFRAME_INTERVAL_MS)
+		{
+			u8 bfr[64];
+			u32 len = 0;
+			bfr[len++] = SPECTATOR_PKT_KEYFRAME;
+			bfr[len++] = sequence++;
+			bfr[len++] = m_current_game >> 24;
+			bfr[len++] = m_current_game >> 16;
+			bfr[len++] = m_current_game >> 8;
+			bfr[len++] = m_current_game & 0xff;
+			for (PadMapping mapping : m_pad_map)
+				bfr[len++] = (u8)mapping;
+			for (const GCPadStatus& pad : last_pad)
+				len += SpectatorEncodePad(pad, bfr + len);
+
+			if (!subscribers.empty())
+				send_to_subscribers(bfr, len);
+			keyframe_timer.Start();
+		}
+
+		// Drain the tap into delta datagrams. The delta state advances even
+		// with no subscribers so a keyframe is always consistent.
+		SpectatorPadEvent event;
+		while (m_spectator_queue.Pop(event))
+		{
+			if (event.map < 0 || event.map >= (PadMapping)m_pad_map.size())
+				continue;
+
+			u8 bfr[32];
+			const u32 len = SpectatorEncodeDelta(last_pad[event.map], event.pad, event.map, sequence++, bfr);
+			last_pad[event.map] = event.pad;
+
+			if (!subscribers.empty())
+				send_to_subscribers(bfr, len);
+		}
+	}
+}
+
 // called from ---NETPLAY--- thread
 unsigned int NetPlayServer::OnConnect(ENetPeer* socket)
 {
@@ -339,6 +614,7 @@ unsigned int NetPlayServer::OnConnect(ENetPeer* socket)
 		m_players.emplace(*(PlayerId*)player.socket->data, player);
 		UpdatePadMapping();  // sync pad mappings with everyone
 		UpdateWiimoteMapping();
+		UpdateBackupClient();
 	}
 
 	return 0;
@@ -399,6 +675,8 @@ unsigned int NetPlayServer::OnDisconnect(const Client& player)
 	}
 	UpdateWiimoteMapping();
 
+	UpdateBackupClient();
+
 	return 0;
 }
 
@@ -451,6 +729,69 @@ void NetPlayServer::UpdateWiimoteMapping()
 	SendToClients(spac);
 }
 
+// called from ---NETPLAY--- thread
+void NetPlayServer::UpdateBackupClient()
+{
+	std::lock_guard<std::recursive_mutex> lkp(m_crit.players);
+
+	// The host's own client is always player 1; the lowest remaining pid
+	// becomes the warm standby. A change of backup drops the cached snapshot
+	// so the new one receives a full mirror on the next replication tick.
+	PlayerId backup = 0;
+	for (const auto& entry : m_players)
+	{
+		if (entry.second.pid != 1)
+		{
+			backup = entry.second.pid;
+			break;
+		}
+	}
+
+	if (backup != m_backup_pid)
+	{
+		m_backup_pid = backup;
+		m_last_replicated_state.clear();
+	}
+}
+
+// called from ---NETPLAY--- thread
+void NetPlayServer::ReplicateHostState()
+{
+	std::lock_guard<std::recursive_mutex> lkp(m_crit.players);
+
+	if (m_backup_pid == 0)
+		return;
+
+	auto it = m_players.find(m_backup_pid);
+	if (it == m_players.end())
+		return;
+
+	sf::Packet spac;
+	spac << (MessageId)NP_MSG_HOST_STATE;
+	spac << (u32)m_target_buffer_size;
+	for (PadMapping mapping : m_pad_map)
+		spac << mapping;
+	for (PadMapping mapping : m_wiimote_map)
+		spac << mapping;
+	spac << m_selected_game;
+	spac << m_current_game;
+	spac << m_is_running;
+	spac << (u32)g_netplay_initial_rtc;
+	spac << (u32)(g_netplay_initial_rtc >> 32);
+
+	// Only push a packet when something changed; the steady-state cost of the
+	// replication channel is this compare.
+	const u8* data = (const u8*)spac.getData();
+	if (m_last_replicated_state.size() == spac.getDataSize() &&
+		std::equal(m_last_replicated_state.begin(), m_last_replicated_state.end(), data))
+	{
+		return;
+	}
+	m_last_replicated_state.assign(data, data + spac.getDataSize());
+
+	Send(it->second.socket, spac, CHANNEL_BULK);
+}
+
 // called from ---GUI--- thread and ---NETPLAY--- thread
 void NetPlayServer::AdjustPadBufferSize(unsigned int size)
 {
@@ -525,7 +866,14 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
 		spac << map << pad.button << pad.analogA << pad.analogB << pad.stickX << pad.stickY
 			<< pad.substickX << pad.substickY << pad.triggerLeft << pad.triggerRight;
 
-		SendToClients(spac, player.pid);
+		// Relayed input skips the control channel's queue and hits the wire
+		// immediately instead of waiting for the next host service.
+		SendToClients(spac, player.pid, CHANNEL_INPUT);
+		enet_host_flush(m_server);
+
+		// Feed the spectator tap; this only queues a copy, the fan-out runs
+		// on its own thread.
+		SpectatorTapPadData(map, pad);
 	}
 	break;
 
@@ -557,7 +905,8 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
 		for (const u8& byte : data)
 			spac << byte;
 
-		SendToClients(spac, player.pid);
+		SendToClients(spac, player.pid, CHANNEL_INPUT);
+		enet_host_flush(m_server);
 	}
 	break;
 
@@ -664,6 +1013,98 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
 	}
 	break;
 
+	case NP_MSG_RAM_HASH:
+	{
+		u32 x, y, frame;
+		packet >> x;
+		packet >> y;
+		packet >> frame;
+
+		if (m_desync_detected)
+			break;
+
+		u64 hash = x | ((u64)y << 32);
+		std::vector<std::pair<PlayerId, u64>>& hashes = m_ramhash_by_frame[frame];
+		hashes.emplace_back(player.pid, hash);
+		if (hashes.size() >= m_players.size())
+		{
+			// we have all records for this frame
+			if (!std::all_of(hashes.begin(), hashes.end(), [&](std::pair<PlayerId, u64> pair) {
+				return pair.second == hashes[0].second;
+			}))
+			{
+				int pid_to_blame = -1;
+				for (auto pair : hashes)
+				{
+					if (std::all_of(hashes.begin(), hashes.end(), [&](std::pair<PlayerId, u64> other) {
+						return other.first == pair.first || other.second != pair.second;
+					}))
+					{
+						// we are the only outlier
+						pid_to_blame = pair.first;
+						break;
+					}
+				}
+
+				sf::Packet spac;
+				spac << (MessageId)NP_MSG_DESYNC_DETECTED;
+				spac << pid_to_blame;
+				spac << frame;
+				SendToClients(spac);
+
+				m_desync_detected = true;
+			}
+			m_ramhash_by_frame.erase(frame);
+		}
+	}
+	break;
+
+	case NP_MSG_AUDIO_HASH:
+	{
+		u32 x, y, frame;
+		packet >> x;
+		packet >> y;
+		packet >> frame;
+
+		if (m_desync_detected)
+			break;
+
+		u64 hash = x | ((u64)y << 32);
+		std::vector<std::pair<PlayerId, u64>>& hashes = m_audiohash_by_frame[frame];
+		hashes.emplace_back(player.pid, hash);
+		if (hashes.size() >= m_players.size())
+		{
+			// we have all records for this frame
+			if (!std::all_of(hashes.begin(), hashes.end(), [&](std::pair<PlayerId, u64> pair) {
+				return pair.second == hashes[0].second;
+			}))
+			{
+				int pid_to_blame = -1;
+				for (auto pair : hashes)
+				{
+					if (std::all_of(hashes.begin(), hashes.end(), [&](std::pair<PlayerId, u64> other) {
+						return other.first == pair.first || other.second != pair.second;
+					}))
+					{
+						// we are the only outlier
+						pid_to_blame = pair.first;
+						break;
+					}
+				}
+
+				sf::Packet spac;
+				spac << (MessageId)NP_MSG_DESYNC_DETECTED;
+				spac << pid_to_blame;
+				spac << frame;
+				SendToClients(spac);
+
+				m_desync_detected = true;
+			}
+			m_audiohash_by_frame.erase(frame);
+		}
+	}
+	break;
+
 	case NP_MSG_MD5_PROGRESS:
 	{
 		int progress;
@@ -784,6 +1225,7 @@ void NetPlayServer::SetNetSettings(const NetSettings& settings)
 bool NetPlayServer::StartGame()
 {
 	m_timebase_by_frame.clear();
+	m_audiohash_by_frame.clear();
 	m_desync_detected = false;
 	std::lock_guard<std::recursive_mutex> lkg(m_crit.game);
 	m_current_game = Common::Timer::GetTimeMs();
@@ -813,6 +1255,7 @@ bool NetPlayServer::StartGame()
 	spac << m_settings.m_CopyWiiSave;
 	spac << m_settings.m_OCEnable;
 	spac << m_settings.m_OCFactor;
+	spac << m_settings.m_DeterministicAudioTiming;
 	spac << m_settings.m_EXIDevice[0];
 	spac << m_settings.m_EXIDevice[1];
 	spac << (u32)g_netplay_initial_rtc;
@@ -826,22 +1269,23 @@ bool NetPlayServer::StartGame()
 }
 
 // called from multiple threads
-void NetPlayServer::SendToClients(const sf::Packet& packet, const PlayerId skip_pid)
+void NetPlayServer::SendToClients(const sf::Packet& packet, const PlayerId skip_pid,
+	const u8 channel)
 {
 	for (auto& p : m_players)
 	{
 		if (p.second.pid && p.second.pid != skip_pid)
 		{
-			Send(p.second.socket, packet);
+			Send(p.second.socket, packet, channel);
 		}
 	}
 }
 
-void NetPlayServer::Send(ENetPeer* socket, const sf::Packet& packet)
+void NetPlayServer::Send(ENetPeer* socket, const sf::Packet& packet, const u8 channel)
 {
 	ENetPacket* epac =
 		enet_packet_create(packet.getData(), packet.getDataSize(), ENET_PACKET_FLAG_RELIABLE);
-	enet_peer_send(socket, 0, epac);
+	enet_peer_send(socket, channel, epac);
 }
 
 void NetPlayServer::KickPlayer(PlayerId player)
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <SFML/Network/Packet.hpp>
+#include <atomic>
 #include <map>
 #include <mutex>
 #include <queue>
@@ -16,6 +17,7 @@
 #include "Common/Timer.h"
 #include "Common/TraversalClient.h"
 #include "Core/NetPlayProto.h"
+#include "InputCommon/GCPadStatus.h"
 
 enum class PlayerGameStatus;
 
@@ -78,8 +80,10 @@ private:
 		bool operator==(const Client& other) const { return this == &other; }
 	};
 
-	void SendToClients(const sf::Packet& packet, const PlayerId skip_pid = 0);
-	void Send(ENetPeer* socket, const sf::Packet& packet);
+	void SendToClients(const sf::Packet& packet, const PlayerId skip_pid = 0,
+		u8 channel = CHANNEL_CONTROL);
+	void Send(ENetPeer* socket, const sf::Packet& packet, u8 channel = CHANNEL_CONTROL);
+	void ReportTrafficStats();
 	unsigned int OnConnect(ENetPeer* socket);
 	unsigned int OnDisconnect(const Client& player);
 	unsigned int OnData(sf::Packet& packet, Client& player);
@@ -87,8 +91,23 @@ private:
 	void OnTraversalStateChanged() override;
 	void OnConnectReady(ENetAddress) override {}
 	void OnConnectFailed(u8) override {}
+
+	// Spectator tap: read-only subscribers receive the relayed input stream
+	// over UDP from a dedicated thread. The player path only ever pushes a
+	// copy of the pad status into a lockless queue, so spectator fan-out can
+	// never add latency to it. See SpectatorThreadFunc for the wire format.
+	struct SpectatorPadEvent
+	{
+		PadMapping map;
+		GCPadStatus pad;
+	};
+	void SpectatorThreadFunc();
+	void SpectatorTapPadData(PadMapping map, const GCPadStatus& pad);
+
 	void UpdatePadMapping();
 	void UpdateWiimoteMapping();
+	void UpdateBackupClient();
+	void ReplicateHostState();
 	std::vector<std::pair<std::string, std::string>> GetInterfaceListInternal() const;
 
 	NetSettings m_settings;
@@ -96,6 +115,7 @@ private:
 	bool m_is_running = false;
 	bool m_do_loop = false;
 	Common::Timer m_ping_timer;
+	Common::Timer m_stats_timer;
 	u32 m_ping_key = 0;
 	bool m_update_pings = false;
 	u32 m_current_game = 0;
@@ -105,7 +125,16 @@ private:
 
 	std::map<PlayerId, Client> m_players;
 
+	// Warm-standby host state replication (see NP_MSG_HOST_STATE). The lowest
+	// non-host pid is the designated backup; the last snapshot sent to it is
+	// kept so unchanged state costs a memcmp per tick instead of a packet.
+	PlayerId m_backup_pid = 0;
+	Common::Timer m_replication_timer;
+	std::vector<u8> m_last_replicated_state;
+
 	std::unordered_map<u32, std::vector<std::pair<PlayerId, u64>>> m_timebase_by_frame;
+	std::unordered_map<u32, std::vector<std::pair<PlayerId, u64>>> m_ramhash_by_frame;
+	std::unordered_map<u32, std::vector<std::pair<PlayerId, u64>>> m_audiohash_by_frame;
 	bool m_desync_detected;
 
 	struct
@@ -124,6 +153,11 @@ private:
 	TraversalClient* m_traversal_client = nullptr;
 	NetPlayUI* m_dialog = nullptr;
 
+	std::thread m_spectator_thread;
+	std::atomic<bool> m_spectator_running{ false };
+	ENetSocket m_spectator_socket = ENET_SOCKET_NULL;
+	Common::FifoQueue<SpectatorPadEvent, false> m_spectator_queue;
+
 #ifdef USE_UPNP
 	static void mapPortThread(const u16 port);
 	static void unmapPortThread();
@@ -22,6 +22,7 @@
 #include "Core/GeckoCode.h"
 #include "Core/GeckoCodeConfig.h"
 #include "Core/PatchEngine.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PowerPC.h"
 
 namespace PatchEngine
@@ -170,21 +171,35 @@ static void ApplyPatches(const std::vector<Patch>& patches)
 			{
 				u32 addr = entry.address;
 				u32 value = entry.value;
+				// Only write when memory disagrees. Most entries are constant
+				// patches the game never overwrites, so after the first
+				// application a frame costs one read per entry instead of a
+				// write plus a JIT flush.
 				switch (entry.type)
 				{
 				case PATCH_8BIT:
+					if (PowerPC::HostRead_U8(addr) == (u8)value)
+						continue;
 					PowerPC::HostWrite_U8((u8)value, addr);
 					break;
 				case PATCH_16BIT:
+					if (PowerPC::HostRead_U16(addr) == (u16)value)
+						continue;
 					PowerPC::HostWrite_U16((u16)value, addr);
 					break;
 				case PATCH_32BIT:
+					if (PowerPC::HostRead_U32(addr) == value)
+						continue;
 					PowerPC::HostWrite_U32(value, addr);
 					break;
 				default:
 					// unknown patchtype
-					break;
+					continue;
 				}
+				// Host-side writes bypass the icbi path the JIT relies on, so
+				// flush any blocks built from the old instructions; code
+				// patches then take effect the moment they are written.
+				JitInterface::InvalidateICache(addr & ~3u, 8, true);
 			}
 		}
 	}
@@ -0,0 +1,238 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Common/FileUtil.h"
+#include "Common/IniFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+#include "Core/PerfProfile.h"
+
+namespace PerfProfile
+{
+static std::string s_profile_override;
+
+std::vector<Profile> LoadProfiles(const IniFile& ini)
+{
+	std::vector<Profile> profiles;
+
+	std::vector<std::string> lines;
+	ini.GetLines("Performance_Profiles", &lines, false);
+
+	Profile profile;
+
+	for (const std::string& line : lines)
+	{
+		if (line.empty() || line[0] == '#')
+			continue;
+
+		switch (line[0])
+		{
+			// start of a new profile
+		case '$':
+			if (profile.name.size())
+				profiles.push_back(profile);
+			profile = Profile();
+			profile.name = StripSpaces(line.substr(1));
+			break;
+
+			// notes (measured-impact metadata)
+		case '*':
+			profile.notes.push_back(line.substr(1));
+			break;
+
+			// "Section.Key = Value" override
+		default:
+		{
+			const size_t equals = line.find('=');
+			if (equals == std::string::npos)
+				break;
+
+			const std::string location = StripSpaces(line.substr(0, equals));
+			const size_t dot = location.find('.');
+			if (dot == std::string::npos || dot == 0 || dot + 1 == location.size())
+			{
+				WARN_LOG(CORE, "Malformed performance profile override: %s", line.c_str());
+				break;
+			}
+
+			Override override_entry;
+			override_entry.section = location.substr(0, dot);
+			override_entry.key = location.substr(dot + 1);
+			override_entry.value = StripSpaces(line.substr(equals + 1));
+			profile.overrides.push_back(override_entry);
+		}
+		break;
+		}
+	}
+
+	// add the last profile
+	if (profile.name.size())
+		profiles.push_back(profile);
+
+	return profiles;
+}
+
+std::string GetActiveProfileName(IniFile& ini)
+{
+	if (!s_profile_override.empty())
+		return s_profile_override;
+
+	std::string name;
+	ini.GetIfExists("Performance", "Profile", &name);
+	return name;
+}
+
+void SetProfileOverride(const std::string& name)
+{
+	s_profile_override = name;
+}
+
+void ApplyActiveProfile(IniFile* ini)
+{
+	const std::string name = GetActiveProfileName(*ini);
+	if (name.empty())
+		return;
+
+	for (const Profile& profile : LoadProfiles(*ini))
+	{
+		if (profile.name != name)
+			continue;
+
+		INFO_LOG(CORE, "Applying performance profile: %s", profile.name.c_str());
+		for (const std::string& note : profile.notes)
+			INFO_LOG(CORE, "  %s", StripSpaces(note).c_str());
+
+		for (const Override& override_entry : profile.overrides)
+		{
+			INFO_LOG(CORE, "  %s.%s = %s", override_entry.section.c_str(),
+				override_entry.key.c_str(), override_entry.value.c_str());
+			ini->GetOrCreateSection(override_entry.section)
+				->Set(override_entry.key, override_entry.value);
+		}
+		return;
+	}
+
+	WARN_LOG(CORE, "Performance profile \"%s\" not found in game ini", name.c_str());
+}
+
+static bool ReadReportValue(const std::string& report, const char* key, double* value)
+{
+	const std::string needle = StringFromFormat("\"%s\":", key);
+	const size_t pos = report.find(needle);
+	if (pos == std::string::npos)
+		return false;
+
+	*value = std::strtod(report.c_str() + pos + needle.size(), nullptr);
+	return true;
+}
+
+bool WriteBenchmarkDelta(const std::string& base_report_path,
+	const std::string& variant_report_path, const std::string& out_path)
+{
+	std::string base_report, variant_report;
+	if (!File::ReadFileToString(base_report_path, base_report) ||
+		!File::ReadFileToString(variant_report_path, variant_report))
+	{
+		ERROR_LOG(CORE, "Failed to read benchmark reports for delta computation");
+		return false;
+	}
+
+	static const char* const metrics[] = { "average_ms", "p50_ms", "p95_ms", "p99_ms" };
+
+	std::string delta_report = "{\n";
+	delta_report += StringFromFormat("  \"base\": \"%s\",\n", base_report_path.c_str());
+	delta_report += StringFromFormat("  \"variant\": \"%s\"", variant_report_path.c_str());
+
+	for (const char* metric : metrics)
+	{
+		double base_value, variant_value;
+		if (!ReadReportValue(base_report, metric, &base_value) ||
+			!ReadReportValue(variant_report, metric, &variant_value))
+		{
+			continue;
+		}
+
+		const double delta = variant_value - base_value;
+		const double percent = base_value != 0.0 ? delta / base_value * 100.0 : 0.0;
+		delta_report += StringFromFormat(
+			",\n  \"%s\": { \"base\": %.3f, \"variant\": %.3f, \"delta\": %.3f, "
+			"\"delta_percent\": %.1f }",
+			metric, base_value, variant_value, delta, percent);
+	}
+	delta_report += "\n}\n";
+
+	if (!File::WriteStringToFile(delta_report, out_path))
+	{
+		ERROR_LOG(CORE, "Failed to write benchmark delta report to %s", out_path.c_str());
+		return false;
+	}
+
+	NOTICE_LOG(CORE, "Benchmark delta report written to %s", out_path.c_str());
+	return true;
+}
+
+bool WriteBackendComparison(const std::vector<std::pair<std::string, std::string>>& backend_reports,
+	const std::string& out_path, std::string* best_backend)
+{
+	std::string comparison = "{\n  \"backends\": [";
+	std::string best;
+	double best_average = 0.0;
+	bool first = true;
+
+	for (const auto& entry : backend_reports)
+	{
+		std::string report;
+		if (!File::ReadFileToString(entry.second, report))
+		{
+			WARN_LOG(CORE, "Missing benchmark report for backend %s", entry.first.c_str());
+			continue;
+		}
+
+		double average;
+		if (!ReadReportValue(report, "average_ms", &average))
+			continue;
+		double p95;
+		if (!ReadReportValue(report, "p95_ms", &p95))
+			p95 = 0.0;
+
+		comparison += StringFromFormat(
+			"%s\n    { \"backend\": \"%s\", \"average_ms\": %.3f, \"p95_ms\": %.3f }",
+			first ? "" : ",", entry.first.c_str(), average, p95);
+		first = false;
+
+		if (best.empty() || average < best_average)
+		{
+			best = entry.first;
+			best_average = average;
+		}
+	}
+
+	if (best.empty())
+	{
+		ERROR_LOG(CORE, "No backend benchmark reports could be read");
+		return false;
+	}
+
+	comparison += "\n  ],\n";
+	comparison += StringFromFormat("  \"fastest\": \"%s\",\n", best.c_str());
+	comparison += StringFromFormat("  \"fastest_average_ms\": %.3f\n", best_average);
+	comparison += "}\n";
+
+	if (!File::WriteStringToFile(comparison, out_path))
+	{
+		ERROR_LOG(CORE, "Failed to write backend comparison report to %s", out_path.c_str());
+		return false;
+	}
+
+	NOTICE_LOG(CORE, "Backend comparison written to %s (fastest: %s)", out_path.c_str(),
+		best.c_str());
+	*best_backend = best;
+	return true;
+}
+}
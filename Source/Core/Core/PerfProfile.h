@@ -0,0 +1,61 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+class IniFile;
+
+namespace PerfProfile
+{
+// A single "Section.Key = Value" game ini override carried by a profile.
+struct Override
+{
+	std::string section;
+	std::string key;
+	std::string value;
+};
+
+// A named per-title performance profile parsed from the [Performance_Profiles]
+// game ini section. Uses the same line format as Gecko codes: '$' starts a
+// profile, '*' lines are notes. The notes carry the measured-impact metadata
+// (which capture was benchmarked, frame time delta, date).
+struct Profile
+{
+	std::string name;
+	std::vector<std::string> notes;
+	std::vector<Override> overrides;
+};
+
+std::vector<Profile> LoadProfiles(const IniFile& ini);
+
+// Name of the profile selected by "Profile" in [Performance], or the command
+// line override when one is set. Empty when no profile is active.
+std::string GetActiveProfileName(IniFile& ini);
+
+// Frontend override used by benchmark scripts to iterate profile variants
+// without editing the game ini between runs.
+void SetProfileOverride(const std::string& name);
+
+// Folds the active profile's overrides into the regular game ini sections so
+// that every existing consumer (BootManager, VideoConfig, ...) picks them up
+// without knowing profiles exist.
+void ApplyActiveProfile(IniFile* ini);
+
+// Computes frame time deltas between two JSON reports written by the
+// FifoPlayer benchmark mode and writes them to out_path. Returns false when
+// either report cannot be read.
+bool WriteBenchmarkDelta(const std::string& base_report_path,
+	const std::string& variant_report_path, const std::string& out_path);
+
+// Reads the per-backend reports of a --benchmark_all_backends run (pairs of
+// backend name and report path), writes a combined comparison report and
+// returns the backend with the lowest average frame time through
+// best_backend. Returns false when no report could be read.
+bool WriteBackendComparison(const std::vector<std::pair<std::string, std::string>>& backend_reports,
+	const std::string& out_path, std::string* best_backend);
+}
@@ -173,12 +173,12 @@ void MemChecks::Add(const TMemCheck& memory_check)
 {
 	if (GetMemCheck(memory_check.start_address) == nullptr)
 	{
-		bool had_any = HasAny();
 		bool lock = Core::PauseAndLock(true);
 		m_mem_checks.push_back(memory_check);
-		// If this is the first one, clear the JIT cache so it can switch to
-		// watchpoint-compatible code.
-		if (!had_any && g_jit)
+		// Compiled code embeds per-page decisions (whether an access was
+		// optimizable), so the cache must be flushed on every change, not
+		// just the first one.
+		if (g_jit)
 			g_jit->ClearCache();
 		PowerPC::DBATUpdated();
 		Core::PauseAndLock(false, lock);
@@ -193,7 +193,7 @@ void MemChecks::Remove(u32 address)
 		{
 			bool lock = Core::PauseAndLock(true);
 			m_mem_checks.erase(i);
-			if (!HasAny() && g_jit)
+			if (g_jit)
 				g_jit->ClearCache();
 			PowerPC::DBATUpdated();
 			Core::PauseAndLock(false, lock);
@@ -202,6 +202,19 @@ void MemChecks::Remove(u32 address)
 	}
 }
 
+void MemChecks::Clear()
+{
+	if (!HasAny())
+		return;
+
+	bool lock = Core::PauseAndLock(true);
+	m_mem_checks.clear();
+	if (g_jit)
+		g_jit->ClearCache();
+	PowerPC::DBATUpdated();
+	Core::PauseAndLock(false, lock);
+}
+
 TMemCheck* MemChecks::GetMemCheck(u32 address, size_t size)
 {
 	for (TMemCheck& mc : m_mem_checks)
@@ -30,17 +30,33 @@ struct CachedInterpreter::Instruction
 	{
 	}
 
+	// Fused variants: the dispatch loop writes PC/NPC itself before invoking
+	// the callback, replacing the separate WritePC entry that used to precede
+	// it and cost an extra loop iteration and indirect call.
+	Instruction(const CommonCallback c, UGeckoInstruction i, u32 address)
+		: common_callback(c), data(i.hex), pc(address), type(INSTRUCTION_TYPE_COMMON_AT_PC)
+	{
+	}
+
+	Instruction(const ConditionalCallback c, u32 d, u32 address)
+		: conditional_callback(c), data(d), pc(address), type(INSTRUCTION_TYPE_CONDITIONAL_AT_PC)
+	{
+	}
+
 	union
 	{
 		const CommonCallback common_callback;
 		const ConditionalCallback conditional_callback;
 	};
 	u32 data;
+	u32 pc;
 	enum
 	{
 		INSTRUCTION_ABORT,
 		INSTRUCTION_TYPE_COMMON,
 		INSTRUCTION_TYPE_CONDITIONAL,
+		INSTRUCTION_TYPE_COMMON_AT_PC,
+		INSTRUCTION_TYPE_CONDITIONAL_AT_PC,
 	} type;
 };
 
@@ -98,6 +114,19 @@ void CachedInterpreter::ExecuteOneBlock()
 				return;
 			break;
 
+		case Instruction::INSTRUCTION_TYPE_COMMON_AT_PC:
+			PC = code->pc;
+			NPC = code->pc + 4;
+			code->common_callback(UGeckoInstruction(code->data));
+			break;
+
+		case Instruction::INSTRUCTION_TYPE_CONDITIONAL_AT_PC:
+			PC = code->pc;
+			NPC = code->pc + 4;
+			if (code->conditional_callback(code->data))
+				return;
+			break;
+
 		default:
 			ERROR_LOG(POWERPC, "Unknown CachedInterpreter Instruction: %d", code->type);
 			break;
@@ -133,12 +162,6 @@ static void EndBlock(UGeckoInstruction data)
 	PowerPC::ppcState.downcount -= data.hex;
 }
 
-static void WritePC(UGeckoInstruction data)
-{
-	PC = data.hex;
-	NPC = data.hex + 4;
-}
-
 static void WriteBrokenBlockNPC(UGeckoInstruction data)
 {
 	NPC = data.hex;
@@ -214,8 +237,7 @@ void CachedInterpreter::Jit(u32 address)
 				int flags = HLE::GetFunctionFlagsByIndex(function);
 				if (HLE::IsEnabled(flags))
 				{
-					m_code.emplace_back(WritePC, ops[i].address);
-					m_code.emplace_back(Interpreter::HLEFunction, function);
+					m_code.emplace_back(Interpreter::HLEFunction, function, ops[i].address);
 					if (type == HLE::HLE_HOOK_REPLACE)
 					{
 						m_code.emplace_back(EndBlock, js.downcountAmount);
@@ -234,14 +256,14 @@ void CachedInterpreter::Jit(u32 address)
 
 			if (check_fpu)
 			{
-				m_code.emplace_back(WritePC, ops[i].address);
-				m_code.emplace_back(CheckFPU, js.downcountAmount);
+				m_code.emplace_back(CheckFPU, js.downcountAmount, ops[i].address);
 				js.firstFPInstructionFound = true;
 			}
 
 			if (endblock || memcheck)
-				m_code.emplace_back(WritePC, ops[i].address);
-			m_code.emplace_back(GetInterpreterOp(ops[i].inst), ops[i].inst);
+				m_code.emplace_back(GetInterpreterOp(ops[i].inst), ops[i].inst, ops[i].address);
+			else
+				m_code.emplace_back(GetInterpreterOp(ops[i].inst), ops[i].inst);
 			if (memcheck)
 				m_code.emplace_back(CheckDSI, js.downcountAmount);
 			if (endblock)
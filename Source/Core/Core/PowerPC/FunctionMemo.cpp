@@ -0,0 +1,395 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <array>
+#include <cinttypes>
+#include <cstring>
+#include <map>
+#include <vector>
+
+#include "Common/BitHelpers.h"
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+#include "Common/SymbolDB.h"
+#include "Core/ConfigManager.h"
+#include "Core/HLE/HLE.h"
+#include "Core/PowerPC/FunctionMemo.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/PPCSymbolDB.h"
+#include "Core/PowerPC/PPCTables.h"
+#include "Core/PowerPC/PowerPC.h"
+
+namespace FunctionMemo
+{
+// Candidate functions are at most this many instructions; anything bigger is
+// unlikely to be a math/table wrapper and the inline execution on a cache
+// miss would get expensive.
+static const u32 MAX_INSTRUCTIONS = 64;
+
+// Caps on key and captured-output width, so lookups stay a short memcmp.
+static const u32 MAX_KEY_REGS = 4;
+static const u32 MAX_OUT_REGS = 8;
+
+// Per-function cache size; direct mapped, must be a power of two.
+static const u32 CACHE_ENTRIES = 64;
+
+// After this many calls a function that answered fewer than a quarter of
+// them from the cache is un-hooked: the probing costs more than it saves.
+static const u64 PROBE_CALLS = 1024;
+
+// EABI volatile sets: r0/r3-r12 and f0-f13. Only these may be written by a
+// candidate, which makes both a cache-hit replay and a half-finished inline
+// run invisible to the caller.
+static const u32 VOLATILE_GPRS = 0x00001FF9;
+static const u32 VOLATILE_FPRS = 0x00003FFF;
+
+struct CacheEntry
+{
+	bool valid;
+	u64 key[MAX_KEY_REGS];
+	u32 gpr_out[MAX_OUT_REGS];
+	u64 fpr_out[MAX_OUT_REGS];      // PS0 of every output FPR
+	u64 fpr_ps1_out[MAX_OUT_REGS];  // PS1, replayed only for out_ps1_fprs
+	u64 cr_out[8];
+};
+
+struct BodyOp
+{
+	Interpreter::Instruction handler;
+	UGeckoInstruction inst;
+};
+
+struct Function
+{
+	u32 address = 0;
+	u32 key_gprs = 0;  // registers read before written: the cache key
+	u32 key_fprs = 0;
+	u32 out_gprs = 0;  // registers the body writes: captured and replayed
+	u32 out_fprs = 0;
+	u32 out_ps1_fprs = 0;  // output FPRs whose PS1 the body defines (see WritesPS1)
+	u8 cr_mask = 0;    // CR fields the body writes
+	u32 cycles = 0;    // interpreter cycle estimate for a whole call
+	u64 calls = 0;
+	u64 hits = 0;
+	bool dead = false;
+	std::vector<BodyOp> body;  // without the final blr
+	std::array<CacheEntry, CACHE_ENTRIES> cache{};
+};
+
+static std::map<u32, Function> s_functions;
+static u32 s_hook_index;
+
+// Whether an instruction writes PS1 of its output FPR as well as PS0. The
+// single-precision arithmetic handlers all do rPS0 = rPS1 = result, and the
+// lfs family loads into both halves, so for those registers PS1 must be
+// captured and replayed or a cache hit leaves it stale. Double-precision
+// writes (including lfd, hence its FL_INOUT_FLOAT_D) leave PS1 untouched,
+// which replaying only PS0 preserves by construction. frspx is typed
+// OPTYPE_DOUBLEFP but its handler writes both halves too.
+static bool WritesPS1(const GekkoOPInfo* info, UGeckoInstruction inst)
+{
+	if (info->type == OPTYPE_SINGLEFP)
+		return true;
+	if (inst.OPCD == 63 && inst.SUBOP10 == 12)  // frspx
+		return true;
+	if (inst.OPCD == 48 || inst.OPCD == 49)  // lfs, lfsu
+		return true;
+	return inst.OPCD == 31 && (inst.SUBOP10 == 535 || inst.SUBOP10 == 567);  // lfsx, lfsux
+}
+
+static bool ScanSymbol(const Symbol& sym, Function* func)
+{
+	const u32 required = FFLAG_LEAF | FFLAG_STRAIGHT;
+	const u32 rejected = FFLAG_EVIL | FFLAG_RFI | FFLAG_TIMERINSTRUCTIONS;
+	if ((sym.flags & required) != required || (sym.flags & rejected))
+		return false;
+	if (sym.size < 8 || sym.size > (int)(MAX_INSTRUCTIONS * 4))
+		return false;
+
+	const u32 end = sym.address + sym.size - 4;
+	if (PowerPC::HostRead_Instruction(end) != 0x4e800020)  // blr
+		return false;
+
+	u32 written_gprs = 0;
+	u32 written_fprs = 0;
+
+	for (u32 addr = sym.address; addr < end; addr += 4)
+	{
+		const UGeckoInstruction inst = PowerPC::HostRead_Instruction(addr);
+		const GekkoOPInfo* info = GetOpInfo(inst);
+		if (!info)
+			return false;
+
+		switch (info->type)
+		{
+		case OPTYPE_INTEGER:
+		case OPTYPE_LOAD:
+		case OPTYPE_LOADFP:
+		case OPTYPE_SINGLEFP:
+		case OPTYPE_DOUBLEFP:
+			break;
+		default:
+			// Stores, branches, CR/SPR/system, cache and paired single ops
+			// either have side effects or touch state we don't capture.
+			return false;
+		}
+
+		if (info->flags & (FL_TIMER | FL_CHECKEXCEPTIONS | FL_EVIL | FL_SET_CA | FL_READ_CA |
+			FL_READ_FPRF | FL_ENDBLOCK))
+		{
+			return false;
+		}
+		if ((info->flags & FL_SET_OE) && inst.OE)
+			return false;
+
+		// Reads of registers the body hasn't produced yet are inputs and
+		// become part of the cache key.
+		u32 in_gprs = 0;
+		u32 in_fprs = 0;
+		if (info->flags & FL_IN_A)
+			in_gprs |= 1u << inst.RA;
+		if ((info->flags & FL_IN_A0) && inst.RA)
+			in_gprs |= 1u << inst.RA;
+		if (info->flags & FL_IN_B)
+			in_gprs |= 1u << inst.RB;
+		if (info->flags & FL_IN_C)
+			in_gprs |= 1u << inst.RC;
+		if (info->flags & FL_IN_S)
+			in_gprs |= 1u << inst.RS;
+		if (info->flags & FL_IN_FLOAT_A)
+			in_fprs |= 1u << inst.FA;
+		if (info->flags & FL_IN_FLOAT_B)
+			in_fprs |= 1u << inst.FB;
+		if (info->flags & FL_IN_FLOAT_C)
+			in_fprs |= 1u << inst.FC;
+		if (info->flags & FL_IN_FLOAT_S)
+			in_fprs |= 1u << inst.FS;
+		if (info->flags & FL_IN_FLOAT_D)
+			in_fprs |= 1u << inst.FD;
+		func->key_gprs |= in_gprs & ~written_gprs;
+		func->key_fprs |= in_fprs & ~written_fprs;
+
+		u32 out_gprs = 0;
+		u32 out_fprs = 0;
+		if (info->flags & FL_OUT_D)
+			out_gprs |= 1u << inst.RD;
+		if (info->flags & FL_OUT_A)
+			out_gprs |= 1u << inst.RA;
+		if (info->flags & FL_OUT_FLOAT_D)
+			out_fprs |= 1u << inst.FD;
+		if ((out_gprs & ~VOLATILE_GPRS) || (out_fprs & ~VOLATILE_FPRS))
+			return false;
+		written_gprs |= out_gprs;
+		written_fprs |= out_fprs;
+		func->out_gprs |= out_gprs;
+		func->out_fprs |= out_fprs;
+		// Once any write has defined PS1 of a register, its final PS1 is a
+		// function of the inputs (later double-precision writes leave it in
+		// place), so it is safe and necessary to replay.
+		if (out_fprs && WritesPS1(info, inst))
+			func->out_ps1_fprs |= out_fprs;
+
+		// cr2-cr4 are callee saved, so a body writing them can't be replayed
+		// blindly; the volatile fields are recorded and replayed.
+		if ((info->flags & FL_SET_CR0) || ((info->flags & FL_RC_BIT) && inst.Rc))
+			func->cr_mask |= 1 << 0;
+		if ((info->flags & FL_SET_CR1) || ((info->flags & FL_RC_BIT_F) && inst.Rc))
+			func->cr_mask |= 1 << 1;
+		if (info->flags & FL_SET_CRn)
+		{
+			if (inst.CRFD >= 2 && inst.CRFD <= 4)
+				return false;
+			func->cr_mask |= 1 << inst.CRFD;
+		}
+
+		BodyOp op;
+		op.inst = inst;
+		op.handler = GetInterpreterOp(inst);
+		if (!op.handler)
+			return false;
+		func->body.push_back(op);
+		func->cycles += info->numCycles;
+	}
+
+	if (func->body.empty())
+		return false;
+	if (CountSetBits(func->key_gprs) + CountSetBits(func->key_fprs) >
+		(int)MAX_KEY_REGS)
+	{
+		return false;
+	}
+	if (CountSetBits(func->out_gprs) > (int)MAX_OUT_REGS ||
+		CountSetBits(func->out_fprs) > (int)MAX_OUT_REGS)
+	{
+		return false;
+	}
+
+	func->address = sym.address;
+	return true;
+}
+
+// Runs the real instructions host-side. Returns false if one of them raised
+// an exception; PC/NPC then point at the faulting instruction, and since only
+// volatile registers were touched so far, resuming there through the normal
+// dispatcher is indistinguishable from the call having run natively.
+static bool RunBody(const Function& func)
+{
+	for (size_t i = 0; i < func.body.size(); ++i)
+	{
+		PC = func.address + (u32)(i * 4);
+		NPC = PC + 4;
+		func.body[i].handler(func.body[i].inst);
+		if (PowerPC::ppcState.Exceptions)
+		{
+			NPC = PC;
+			return false;
+		}
+	}
+	PC = func.address;
+	NPC = LR;
+	return true;
+}
+
+void HandleCall()
+{
+	auto iter = s_functions.find(PC);
+	if (iter == s_functions.end())
+	{
+		// Stale hook from a reload; put the real instruction back in play.
+		HLE::UnPatch(PC);
+		NPC = PC;
+		return;
+	}
+	Function& func = iter->second;
+
+	if (func.dead)
+	{
+		// Un-hooked after probation, but an already compiled block still
+		// dispatched here. Just run the call.
+		RunBody(func);
+		return;
+	}
+
+	func.calls++;
+
+	u64 key[MAX_KEY_REGS] = {};
+	u32 num_keys = 0;
+	u64 hash = 0;
+	for (u32 i = 0; i < 32; ++i)
+	{
+		if (func.key_gprs & (1u << i))
+			key[num_keys++] = GPR(i);
+		if (func.key_fprs & (1u << i))
+			key[num_keys++] = riPS0(i);
+	}
+	for (u32 i = 0; i < num_keys; ++i)
+		hash = hash * 6364136223846793005ULL + key[i] + 1;
+
+	CacheEntry& entry = func.cache[(u32)(hash >> 32) & (CACHE_ENTRIES - 1)];
+	if (entry.valid && !memcmp(entry.key, key, sizeof(key)))
+	{
+		u32 num_gprs = 0;
+		u32 num_fprs = 0;
+		for (u32 i = 0; i < 32; ++i)
+		{
+			if (func.out_gprs & (1u << i))
+				GPR(i) = entry.gpr_out[num_gprs++];
+			if (func.out_fprs & (1u << i))
+			{
+				riPS0(i) = entry.fpr_out[num_fprs];
+				// PS1 the body never defines is preserved across the call by
+				// real execution, so it is left alone here too.
+				if (func.out_ps1_fprs & (1u << i))
+					riPS1(i) = entry.fpr_ps1_out[num_fprs];
+				num_fprs++;
+			}
+		}
+		for (u32 i = 0; i < 8; ++i)
+		{
+			if (func.cr_mask & (1 << i))
+				PowerPC::ppcState.cr_val[i] = entry.cr_out[i];
+		}
+		func.hits++;
+		HLE::NoteCyclesSaved(s_hook_index, func.cycles);
+		NPC = LR;
+		return;
+	}
+
+	if (!RunBody(func))
+		return;
+
+	entry.valid = true;
+	memcpy(entry.key, key, sizeof(entry.key));
+	u32 num_gprs = 0;
+	u32 num_fprs = 0;
+	for (u32 i = 0; i < 32; ++i)
+	{
+		if (func.out_gprs & (1u << i))
+			entry.gpr_out[num_gprs++] = GPR(i);
+		if (func.out_fprs & (1u << i))
+		{
+			entry.fpr_out[num_fprs] = riPS0(i);
+			entry.fpr_ps1_out[num_fprs] = riPS1(i);
+			num_fprs++;
+		}
+	}
+	for (u32 i = 0; i < 8; ++i)
+	{
+		if (func.cr_mask & (1 << i))
+			entry.cr_out[i] = PowerPC::ppcState.cr_val[i];
+	}
+
+	if (func.calls == PROBE_CALLS && func.hits * 4 < func.calls)
+	{
+		INFO_LOG(OSHLE, "Memoization of %08x not paying off (%" PRIu64 "/%" PRIu64 " hits), removing",
+			func.address, func.hits, func.calls);
+		HLE::UnPatch(func.address);
+		func.dead = true;
+	}
+}
+
+void Install()
+{
+	Clear();
+	if (!SConfig::GetInstance().bMemoizePureFunctions)
+		return;
+
+	for (const auto& it : g_symbolDB.Symbols())
+	{
+		const Symbol& sym = it.second;
+		if (sym.type != Symbol::Type::Function)
+			continue;
+		// Leave functions another hook already claimed (memset and friends) alone
+		if (HLE::GetFunctionIndex(sym.address))
+			continue;
+
+		Function func;
+		if (!ScanSymbol(sym, &func))
+			continue;
+
+		HLE::Patch(sym.address, "HLEMemoizedFunction");
+		INFO_LOG(OSHLE, "Memoizing %s at %08x (%zu instructions, %d key regs)", sym.name.c_str(),
+			sym.address, func.body.size(),
+			CountSetBits(func.key_gprs) + CountSetBits(func.key_fprs));
+		s_functions.emplace(sym.address, std::move(func));
+	}
+
+	s_hook_index = HLE::GetHookIndexByName("HLEMemoizedFunction");
+}
+
+void Clear()
+{
+	for (const auto& it : s_functions)
+	{
+		const Function& func = it.second;
+		if (func.calls)
+		{
+			INFO_LOG(OSHLE, "Memoized function %08x: %" PRIu64 " calls, %" PRIu64 " hits%s",
+				func.address, func.calls, func.hits, func.dead ? " (removed)" : "");
+		}
+	}
+	s_functions.clear();
+}
+
+}  // namespace FunctionMemo
@@ -0,0 +1,28 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+namespace FunctionMemo
+{
+// Memoization of pure guest functions. The symbol database is scanned for
+// small straight-line leaf functions whose instructions provably have no side
+// effects beyond writing ABI-volatile registers (trig table lookups, sqrt
+// wrappers and similar). Their entry points get an HLE hook that answers
+// repeated calls from a host-side cache keyed by the argument registers;
+// misses run the real instructions. Per-function hit rates are tracked and
+// functions that don't pay for the probing are un-hooked again.
+//
+// Opt-in via Core/MemoizePureFunctions: constant data feeding table lookups
+// cannot be proven constant, and FPSCR status bits are not replayed on a hit.
+
+// Scans g_symbolDB and installs hooks. Called from HLE::PatchFunctions().
+void Install();
+
+// Logs per-function statistics and drops all state. Called from HLE::Clear().
+void Clear();
+
+// Hook body, dispatched through HLE_Misc::HLEMemoizedFunction.
+void HandleCall();
+}
@@ -5,13 +5,13 @@
 // Originally written by Sven Peter <sven@fail0verflow.com> for anergistic.
 
 #include <fcntl.h>
+#include <signal.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
 #ifdef _WIN32
 #include <iphlpapi.h>
-#include <iphlpapi.h>
 #include <ws2tcpip.h>
 #else
 #include <netinet/in.h>
@@ -20,11 +20,27 @@
 #include <sys/un.h>
 #endif
 
+#include <atomic>
+#include <thread>
+
+#include "Common/Event.h"
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+#include "Core/HW/CPU.h"
+#include "Core/HW/Memmap.h"
 #include "Core/Host.h"
+#include "Core/PowerPC/BreakPoints.h"
 #include "Core/PowerPC/GDBStub.h"
+#include "Core/PowerPC/JitCommon/JitBase.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/PowerPC.h"
+
+#ifdef _WIN32
+#define SIGTRAP 5
+#define MSG_WAITALL 8
+#endif
 
 #define GDB_BFR_MAX 10000
-#define GDB_MAX_BP 10
 
 #define GDB_STUB_START '$'
 #define GDB_STUB_END '#'
@@ -38,20 +54,16 @@ static u8 cmd_bfr[GDB_BFR_MAX];
 static u32 cmd_len;
 
 static u32 sig = 0;
-static u32 send_signal = 0;
-static u32 step_break = 0;
 
-typedef struct
-{
-	u32 active;
-	u32 addr;
-	u32 len;
-} gdb_bp_t;
+// All packet servicing happens on this thread. The emulated CPU never runs
+// stub code; it only sees the shared PowerPC breakpoint and memcheck lists,
+// so it keeps executing compiled JIT blocks at full speed until one fires.
+static std::thread s_stub_thread;
+static std::atomic<bool> s_shutdown{ false };
 
-static gdb_bp_t bp_x[GDB_MAX_BP];
-static gdb_bp_t bp_r[GDB_MAX_BP];
-static gdb_bp_t bp_w[GDB_MAX_BP];
-static gdb_bp_t bp_a[GDB_MAX_BP];
+// Set after a resume packet ('c'/'s') or an interrupt request; the stub
+// thread turns the next CPU halt into a stop reply. Stub thread only.
+static bool s_waiting_for_stop = false;
 
 // private helpers
 static u8 hex2char(u8 hex)
@@ -97,6 +109,23 @@ static void hex2mem(u8* dst, u8* src, u32 len)
 	}
 }
 
+static void gdb_drop_client()
+{
+	if (sock == -1)
+		return;
+
+	shutdown(sock, SHUT_RDWR);
+	sock = -1;
+	s_waiting_for_stop = false;
+
+	INFO_LOG(GDB_STUB, "Client disconnected.");
+
+	// Never leave the game frozen because the debugger went away. The listen
+	// socket stays up so a new session can attach later.
+	if (!s_shutdown.load() && CPU::IsStepping())
+		CPU::EnableStepping(false);
+}
+
 static u8 gdb_read_byte()
 {
 	ssize_t res;
@@ -106,7 +135,7 @@ static u8 gdb_read_byte()
 	if (res != 1)
 	{
 		ERROR_LOG(GDB_STUB, "recv failed : %ld", res);
-		gdb_deinit();
+		gdb_drop_client();
 	}
 
 	return c;
@@ -124,93 +153,6 @@ static u8 gdb_calc_chksum()
 	return c;
 }
 
-static gdb_bp_t* gdb_bp_ptr(u32 type)
-{
-	switch (type)
-	{
-	case GDB_BP_TYPE_X:
-		return bp_x;
-	case GDB_BP_TYPE_R:
-		return bp_x;
-	case GDB_BP_TYPE_W:
-		return bp_x;
-	case GDB_BP_TYPE_A:
-		return bp_x;
-	default:
-		return nullptr;
-	}
-}
-
-static gdb_bp_t* gdb_bp_empty_slot(u32 type)
-{
-	gdb_bp_t* p;
-	u32 i;
-
-	p = gdb_bp_ptr(type);
-	if (p == nullptr)
-		return nullptr;
-
-	for (i = 0; i < GDB_MAX_BP; i++)
-	{
-		if (p[i].active == 0)
-			return &p[i];
-	}
-
-	return nullptr;
-}
-
-static gdb_bp_t* gdb_bp_find(u32 type, u32 addr, u32 len)
-{
-	gdb_bp_t* p;
-	u32 i;
-
-	p = gdb_bp_ptr(type);
-	if (p == nullptr)
-		return nullptr;
-
-	for (i = 0; i < GDB_MAX_BP; i++)
-	{
-		if (p[i].active == 1 && p[i].addr == addr && p[i].len == len)
-			return &p[i];
-	}
-
-	return nullptr;
-}
-
-static void gdb_bp_remove(u32 type, u32 addr, u32 len)
-{
-	gdb_bp_t* p;
-
-	do
-	{
-		p = gdb_bp_find(type, addr, len);
-		if (p != nullptr)
-		{
-			DEBUG_LOG(GDB_STUB, "gdb: removed a breakpoint: %08x bytes at %08x", len, addr);
-			p->active = 0;
-			memset(p, 0, sizeof(gdb_bp_t));
-		}
-	} while (p != nullptr);
-}
-
-static int gdb_bp_check(u32 addr, u32 type)
-{
-	gdb_bp_t* p;
-	u32 i;
-
-	p = gdb_bp_ptr(type);
-	if (p == nullptr)
-		return 0;
-
-	for (i = 0; i < GDB_MAX_BP; i++)
-	{
-		if (p[i].active == 1 && (addr >= p[i].addr && addr < p[i].addr + p[i].len))
-			return 1;
-	}
-
-	return 0;
-}
-
 static void gdb_nak()
 {
 	const char nak = GDB_STUB_NAK;
@@ -247,8 +189,11 @@ static void gdb_read_command()
 	}
 	else if (c == 0x03)
 	{
+		// Asynchronous break request. Halt the core; the stop reply goes out
+		// once the CPU thread has actually parked.
+		sig = SIGTRAP;
+		s_waiting_for_stop = true;
 		CPU::Break();
-		gdb_signal(SIGTRAP);
 		return;
 	}
 	else if (c != GDB_STUB_START)
@@ -257,7 +202,7 @@ static void gdb_read_command()
 		return;
 	}
 
-	while ((c = gdb_read_byte()) != GDB_STUB_END)
+	while (sock != -1 && (c = gdb_read_byte()) != GDB_STUB_END)
 	{
 		cmd_bfr[cmd_len++] = c;
 		if (cmd_len == sizeof cmd_bfr)
@@ -268,6 +213,13 @@ static void gdb_read_command()
 		}
 	}
 
+	if (sock == -1)
+	{
+		// Lost the client mid-packet.
+		cmd_len = 0;
+		return;
+	}
+
 	chk_read = hex2char(gdb_read_byte()) << 4;
 	chk_read |= hex2char(gdb_read_byte());
 
@@ -296,8 +248,10 @@ static int gdb_data_available()
 	FD_ZERO(fds);
 	FD_SET(sock, fds);
 
+	// The stub runs on its own thread now; a 1ms poll keeps it cheap while
+	// idle and still services ^C promptly.
 	t.tv_sec = 0;
-	t.tv_usec = 20;
+	t.tv_usec = 1000;
 
 	if (select(sock + 1, fds, nullptr, nullptr, &t) < 0)
 	{
@@ -317,7 +271,7 @@ static void gdb_reply(const char* reply)
 	u8* ptr;
 	int n;
 
-	if (!gdb_active())
+	if (sock == -1)
 		return;
 
 	memset(cmd_bfr, 0, sizeof cmd_bfr);
@@ -346,7 +300,7 @@ static void gdb_reply(const char* reply)
 		if (n < 0)
 		{
 			ERROR_LOG(GDB_STUB, "gdb: send failed");
-			return gdb_deinit();
+			return gdb_drop_client();
 		}
 		left -= n;
 		ptr += n;
@@ -620,39 +574,37 @@ static void gdb_write_mem()
 	if (!dst)
 		return gdb_reply("E00");
 	hex2mem(dst, cmd_bfr + i + 1, len);
-	gdb_reply("OK");
-}
 
-// forces a break on next instruction check
-void gdb_break()
-{
-	step_break = 1;
-	send_signal = 1;
-}
+	// The patched range may already have been compiled; knock out the
+	// affected blocks so the JIT picks up the new code.
+	if (g_jit)
+		g_jit->GetBlockCache()->InvalidateICache(addr, len, true);
 
-static void gdb_step()
-{
-	gdb_break();
+	gdb_reply("OK");
 }
 
 static void gdb_continue()
 {
-	send_signal = 1;
+	// Resume at full speed. The next stop - breakpoint, watchpoint or an
+	// interrupt request - is reported once the CPU thread parks again.
+	sig = SIGTRAP;
+	s_waiting_for_stop = true;
+	CPU::EnableStepping(false);
 }
 
-bool gdb_add_bp(u32 type, u32 addr, u32 len)
+static void gdb_step()
 {
-	gdb_bp_t* bp;
-	bp = gdb_bp_empty_slot(type);
-	if (bp == nullptr)
-		return false;
+	Common::Event stepped;
 
-	bp->active = 1;
-	bp->addr = addr;
-	bp->len = len;
+	// CPU::StepOpcode drives whichever core is active (the JIT compiles
+	// single-instruction blocks while stepping) and signals the event once
+	// the opcode has retired.
+	sig = SIGTRAP;
+	CPU::StepOpcode(&stepped);
+	stepped.Wait();
 
-	DEBUG_LOG(GDB_STUB, "gdb: added %d breakpoint: %08x bytes at %08x", type, bp->len, bp->addr);
-	return true;
+	gdb_handle_signal();
+	Host_UpdateDisasmDialog();
 }
 
 static void _gdb_add_bp()
@@ -661,24 +613,6 @@ static void _gdb_add_bp()
 	u32 i, addr = 0, len = 0;
 
 	type = hex2char(cmd_bfr[1]);
-	switch (type)
-	{
-	case 0:
-	case 1:
-		type = GDB_BP_TYPE_X;
-		break;
-	case 2:
-		type = GDB_BP_TYPE_W;
-		break;
-	case 3:
-		type = GDB_BP_TYPE_R;
-		break;
-	case 4:
-		type = GDB_BP_TYPE_A;
-		break;
-	default:
-		return gdb_reply("E01");
-	}
 
 	i = 3;
 	while (cmd_bfr[i] != ',')
@@ -688,8 +622,35 @@ static void _gdb_add_bp()
 	while (i < cmd_len)
 		len = len << 4 | hex2char(cmd_bfr[i++]);
 
-	if (!gdb_add_bp(type, addr, len))
-		return gdb_reply("E02");
+	switch (type)
+	{
+	case 0:  // software breakpoint
+	case 1:  // hardware breakpoint
+		// Execution breakpoints go on the shared PowerPC list; adding one
+		// invalidates just the block containing the address, so the recompile
+		// traps through PowerPC::CheckBreakPoints while every other block
+		// keeps running from compiled code.
+		PowerPC::breakpoints.Add(addr);
+		break;
+	case 2:  // write watchpoint
+	case 3:  // read watchpoint
+	case 4:  // access watchpoint
+	{
+		TMemCheck mc;
+		mc.start_address = addr;
+		mc.end_address = len > 1 ? addr + len - 1 : addr;
+		mc.is_ranged = len > 1;
+		mc.is_break_on_write = type == 2 || type == 4;
+		mc.is_break_on_read = type == 3 || type == 4;
+		mc.break_on_hit = true;
+		PowerPC::memchecks.Add(mc);
+		break;
+	}
+	default:
+		return gdb_reply("E01");
+	}
+
+	DEBUG_LOG(GDB_STUB, "gdb: added %d breakpoint: %08x bytes at %08x", type, len, addr);
 	gdb_reply("OK");
 }
 
@@ -698,102 +659,158 @@ static void gdb_remove_bp()
 	u32 type, addr, len, i;
 
 	type = hex2char(cmd_bfr[1]);
+
+	addr = 0;
+	len = 0;
+
+	i = 3;
+	while (cmd_bfr[i] != ',')
+		addr = (addr << 4) | hex2char(cmd_bfr[i++]);
+	i++;
+
+	while (i < cmd_len)
+		len = (len << 4) | hex2char(cmd_bfr[i++]);
+
 	switch (type)
 	{
 	case 0:
 	case 1:
-		type = GDB_BP_TYPE_X;
+		PowerPC::breakpoints.Remove(addr);
 		break;
 	case 2:
-		type = GDB_BP_TYPE_W;
-		break;
 	case 3:
-		type = GDB_BP_TYPE_R;
-		break;
 	case 4:
-		type = GDB_BP_TYPE_A;
+		PowerPC::memchecks.Remove(addr);
 		break;
 	default:
 		return gdb_reply("E01");
 	}
 
-	addr = 0;
-	len = 0;
+	DEBUG_LOG(GDB_STUB, "gdb: removed %d breakpoint: %08x bytes at %08x", type, len, addr);
+	gdb_reply("OK");
+}
 
-	i = 3;
-	while (cmd_bfr[i] != ',')
-		addr = (addr << 4) | hex2char(cmd_bfr[i++]);
-	i++;
+static void gdb_process_command()
+{
+	switch (cmd_bfr[0])
+	{
+	case 'q':
+		gdb_handle_query();
+		break;
+	case 'H':
+		gdb_handle_set_thread();
+		break;
+	case '?':
+		gdb_handle_signal();
+		break;
+	case 'D':
+		// Detach: the game keeps running and the stub goes back to waiting
+		// for a new connection.
+		gdb_reply("OK");
+		gdb_drop_client();
+		break;
+	case 'k':
+		INFO_LOG(GDB_STUB, "killed by gdb");
+		gdb_drop_client();
+		break;
+	case 'g':
+		gdb_read_registers();
+		break;
+	case 'G':
+		gdb_write_registers();
+		break;
+	case 'p':
+		gdb_read_register();
+		break;
+	case 'P':
+		gdb_write_register();
+		break;
+	case 'm':
+		gdb_read_mem();
+		break;
+	case 'M':
+		gdb_write_mem();
+		PowerPC::ppcState.iCache.Reset();
+		Host_UpdateDisasmDialog();
+		break;
+	case 's':
+		gdb_step();
+		break;
+	case 'C':
+	case 'c':
+		gdb_continue();
+		break;
+	case 'z':
+		gdb_remove_bp();
+		break;
+	case 'Z':
+		_gdb_add_bp();
+		break;
+	default:
+		gdb_reply("");
+		break;
+	}
+}
 
-	while (i < cmd_len)
-		len = (len << 4) | hex2char(cmd_bfr[i++]);
+static void gdb_accept_client()
+{
+	sockaddr_storage saddr_client;
+	socklen_t client_addrlen = sizeof(saddr_client);
+	struct timeval t;
+	fd_set _fds, *fds = &_fds;
 
-	gdb_bp_remove(type, addr, len);
-	gdb_reply("OK");
+	if (tmpsock == -1)
+		return;
+
+	// Poll so gdb_deinit can take the thread down while nobody is attached.
+	FD_ZERO(fds);
+	FD_SET(tmpsock, fds);
+	t.tv_sec = 0;
+	t.tv_usec = 100000;
+	if (select(tmpsock + 1, fds, nullptr, nullptr, &t) < 1 || !FD_ISSET(tmpsock, fds))
+		return;
+
+	sock = accept(tmpsock, (sockaddr*)&saddr_client, &client_addrlen);
+	if (sock < 0)
+		return;
+	INFO_LOG(GDB_STUB, "Client connected.");
+
+	// gdb's all-stop protocol expects a halted target on attach; a single
+	// 'continue' from the client puts the game back at full speed.
+	sig = SIGTRAP;
+	s_waiting_for_stop = false;
+	CPU::Break();
 }
 
-void gdb_handle_exception()
+static void gdb_stub_thread()
 {
-	while (gdb_active())
+	Common::SetCurrentThreadName("GDB stub");
+
+	while (!s_shutdown.load())
 	{
-		if (!gdb_data_available())
-			continue;
-		gdb_read_command();
-		if (cmd_len == 0)
+		if (sock == -1)
+		{
+			gdb_accept_client();
 			continue;
+		}
 
-		switch (cmd_bfr[0])
+		// Breakpoints, watchpoints and interrupt requests all funnel through
+		// CPU::Break(); once the CPU thread has parked, tell the client why.
+		if (s_waiting_for_stop && CPU::IsStepping())
 		{
-		case 'q':
-			gdb_handle_query();
-			break;
-		case 'H':
-			gdb_handle_set_thread();
-			break;
-		case '?':
+			s_waiting_for_stop = false;
 			gdb_handle_signal();
-			break;
-		case 'k':
-			gdb_deinit();
-			INFO_LOG(GDB_STUB, "killed by gdb");
-			return;
-		case 'g':
-			gdb_read_registers();
-			break;
-		case 'G':
-			gdb_write_registers();
-			break;
-		case 'p':
-			gdb_read_register();
-			break;
-		case 'P':
-			gdb_write_register();
-			break;
-		case 'm':
-			gdb_read_mem();
-			break;
-		case 'M':
-			gdb_write_mem();
-			PowerPC::ppcState.iCache.Reset();
 			Host_UpdateDisasmDialog();
-			break;
-		case 's':
-			gdb_step();
-			return;
-		case 'C':
-		case 'c':
-			gdb_continue();
-			return;
-		case 'z':
-			gdb_remove_bp();
-			break;
-		case 'Z':
-			_gdb_add_bp();
-			break;
-		default:
-			gdb_reply("");
-			break;
 		}
+
+		if (!gdb_data_available())
+			continue;
+
+		gdb_read_command();
+		if (cmd_len == 0)
+			continue;
+
+		gdb_process_command();
 	}
 }
 
@@ -803,8 +820,7 @@ WSADATA InitData;
 
 // exported functions
 
-static void gdb_init_generic(int domain, const sockaddr* server_addr, socklen_t server_addrlen,
-	sockaddr* client_addr, socklen_t* client_addrlen);
+static void gdb_init_generic(int domain, const sockaddr* server_addr, socklen_t server_addrlen);
 
 #ifndef _WIN32
 void gdb_init_local(const char* socket)
@@ -815,46 +831,28 @@ void gdb_init_local(const char* socket)
 	addr.sun_family = AF_UNIX;
 	strcpy(addr.sun_path, socket);
 
-	gdb_init_generic(PF_LOCAL, (const sockaddr*)&addr, sizeof(addr), NULL, NULL);
+	gdb_init_generic(PF_LOCAL, (const sockaddr*)&addr, sizeof(addr));
 }
 #endif
 
 void gdb_init(u32 port)
 {
 	sockaddr_in saddr_server = {};
-	sockaddr_in saddr_client;
 
 	saddr_server.sin_family = AF_INET;
 	saddr_server.sin_port = htons(port);
 	saddr_server.sin_addr.s_addr = INADDR_ANY;
 
-	socklen_t client_addrlen = sizeof(saddr_client);
-
-	gdb_init_generic(PF_INET, (const sockaddr*)&saddr_server, sizeof(saddr_server),
-		(sockaddr*)&saddr_client, &client_addrlen);
-
-	saddr_client.sin_addr.s_addr = ntohl(saddr_client.sin_addr.s_addr);
-	/*if (((saddr_client.sin_addr.s_addr >> 24) & 0xff) != 127 ||
-	*      ((saddr_client.sin_addr.s_addr >> 16) & 0xff) !=   0 ||
-	*      ((saddr_client.sin_addr.s_addr >>  8) & 0xff) !=   0 ||
-	*      ((saddr_client.sin_addr.s_addr >>  0) & 0xff) !=   1)
-	*      ERROR_LOG(GDB_STUB, "gdb: incoming connection not from localhost");
-	*/
+	gdb_init_generic(PF_INET, (const sockaddr*)&saddr_server, sizeof(saddr_server));
 }
 
-static void gdb_init_generic(int domain, const sockaddr* server_addr, socklen_t server_addrlen,
-	sockaddr* client_addr, socklen_t* client_addrlen)
+static void gdb_init_generic(int domain, const sockaddr* server_addr, socklen_t server_addrlen)
 {
 	int on;
 #ifdef _WIN32
 	WSAStartup(MAKEWORD(2, 2), &InitData);
 #endif
 
-	memset(bp_x, 0, sizeof bp_x);
-	memset(bp_r, 0, sizeof bp_r);
-	memset(bp_w, 0, sizeof bp_w);
-	memset(bp_a, 0, sizeof bp_a);
-
 	tmpsock = socket(domain, SOCK_STREAM, 0);
 	if (tmpsock == -1)
 		ERROR_LOG(GDB_STUB, "Failed to create gdb socket");
@@ -871,17 +869,17 @@ static void gdb_init_generic(int domain, const sockaddr* server_addr, socklen_t
 
 	INFO_LOG(GDB_STUB, "Waiting for gdb to connect...");
 
-	sock = accept(tmpsock, client_addr, client_addrlen);
-	if (sock < 0)
-		ERROR_LOG(GDB_STUB, "Failed to accept gdb client");
-	INFO_LOG(GDB_STUB, "Client connected.");
-
-	close(tmpsock);
-	tmpsock = -1;
+	// The stub thread owns the connection from here on: it accepts clients,
+	// services packets and reports stops. The emulated core starts running
+	// without waiting for a debugger.
+	s_shutdown.store(false);
+	s_stub_thread = std::thread(gdb_stub_thread);
 }
 
 void gdb_deinit()
 {
+	s_shutdown.store(true);
+
 	if (tmpsock != -1)
 	{
 		shutdown(tmpsock, SHUT_RDWR);
@@ -893,6 +891,9 @@ void gdb_deinit()
 		sock = -1;
 	}
 
+	if (s_stub_thread.joinable())
+		s_stub_thread.join();
+
 #ifdef _WIN32
 	WSACleanup();
 #endif
@@ -902,59 +903,3 @@ bool gdb_active()
 {
 	return tmpsock != -1 || sock != -1;
 }
-
-int gdb_signal(u32 s)
-{
-	if (sock == -1)
-		return 1;
-
-	sig = s;
-
-	if (send_signal)
-	{
-		gdb_handle_signal();
-		send_signal = 0;
-	}
-
-	return 0;
-}
-
-int gdb_bp_x(u32 addr)
-{
-	if (sock == -1)
-		return 0;
-
-	if (step_break)
-	{
-		step_break = 0;
-
-		DEBUG_LOG(GDB_STUB, "Step was successful.");
-		return 1;
-	}
-
-	return gdb_bp_check(addr, GDB_BP_TYPE_X);
-}
-
-int gdb_bp_r(u32 addr)
-{
-	if (sock == -1)
-		return 0;
-
-	return gdb_bp_check(addr, GDB_BP_TYPE_R);
-}
-
-int gdb_bp_w(u32 addr)
-{
-	if (sock == -1)
-		return 0;
-
-	return gdb_bp_check(addr, GDB_BP_TYPE_W);
-}
-
-int gdb_bp_a(u32 addr)
-{
-	if (sock == -1)
-		return 0;
-
-	return gdb_bp_check(addr, GDB_BP_TYPE_A);
-}
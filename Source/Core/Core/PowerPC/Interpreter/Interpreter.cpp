@@ -99,7 +99,11 @@ static void Trace(UGeckoInstruction& inst)
 
 int Interpreter::SingleStepInner()
 {
-	static UGeckoInstruction instCode;
+	// Preserved across calls so the exception paths (HLE hooks, fetch
+	// failures) charge the same cycle count as the last decoded instruction,
+	// matching the old behaviour of re-looking up a stale opcode.
+	static int last_cycles = 0;
+	UGeckoInstruction instCode;
 	u32 function = HLE::GetFunctionIndex(PC);
 	if (function != 0)
 	{
@@ -125,16 +129,6 @@ int Interpreter::SingleStepInner()
 
 	if (function == 0)
 	{
-#ifdef USE_GDBSTUB
-		if (gdb_active() && gdb_bp_x(PC))
-		{
-			Host_UpdateDisasmDialog();
-
-			gdb_signal(SIGTRAP);
-			gdb_handle_exception();
-		}
-#endif
-
 		NPC = PC + sizeof(UGeckoInstruction);
 		instCode.hex = PowerPC::Read_Opcode(PC);
 
@@ -151,10 +145,17 @@ int Interpreter::SingleStepInner()
 
 		if (instCode.hex != 0)
 		{
+			// One table walk gets us the handler, the cycle count and the FPU
+			// flag; the old path dispatched through the subtable trampolines
+			// and then re-walked the info tables up to twice more.
+			const DecodedInstruction decoded = DecodeInstruction(instCode);
+			last_cycles = decoded.info->numCycles;
+
 			UReg_MSR& msr = (UReg_MSR&)MSR;
-			if (msr.FP)  // If FPU is enabled, just execute
+			// If the FPU is enabled, or the instruction doesn't use it, just execute
+			if (msr.FP || !(decoded.info->flags & FL_USE_FPU))
 			{
-				m_op_table[instCode.OPCD](instCode);
+				decoded.handler(instCode);
 				if (PowerPC::ppcState.Exceptions & EXCEPTION_DSI)
 				{
 					PowerPC::CheckExceptions();
@@ -163,22 +164,10 @@ int Interpreter::SingleStepInner()
 			}
 			else
 			{
-				// check if we have to generate a FPU unavailable exception
-				if (!PPCTables::UsesFPU(instCode))
-				{
-					m_op_table[instCode.OPCD](instCode);
-					if (PowerPC::ppcState.Exceptions & EXCEPTION_DSI)
-					{
-						PowerPC::CheckExceptions();
-						m_end_block = true;
-					}
-				}
-				else
-				{
-					PowerPC::ppcState.Exceptions |= EXCEPTION_FPU_UNAVAILABLE;
-					PowerPC::CheckExceptions();
-					m_end_block = true;
-				}
+				// generate a FPU unavailable exception
+				PowerPC::ppcState.Exceptions |= EXCEPTION_FPU_UNAVAILABLE;
+				PowerPC::CheckExceptions();
+				m_end_block = true;
 			}
 		}
 		else
@@ -191,8 +180,7 @@ int Interpreter::SingleStepInner()
 	last_pc = PC;
 	PC = NPC;
 
-	GekkoOPInfo* opinfo = GetOpInfo(instCode);
-	return opinfo->numCycles;
+	return last_cycles;
 }
 
 void Interpreter::SingleStep()
@@ -231,8 +219,16 @@ void Interpreter::Run()
 		// advance into slice 0 to get a correct slice length before executing any cycles.
 		CoreTiming::Advance();
 
+		bool enable_debugging = SConfig::GetInstance().bEnableDebugging;
+#ifdef USE_GDBSTUB
+		// The gdb stub maps its breakpoints onto PowerPC::breakpoints, so the
+		// breakpoint-aware loop has to be taken whenever a stub session is
+		// enabled, even without the debugger UI.
+		enable_debugging = enable_debugging || gdb_active();
+#endif
+
 		// we have to check exceptions at branches apparently (or maybe just rfi?)
-		if (SConfig::GetInstance().bEnableDebugging)
+		if (enable_debugging)
 		{
 #ifdef SHOW_HISTORY
 			PCBlockVec.push_back(PC);
@@ -5,6 +5,7 @@
 #include <cmath>
 
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/MathUtil.h"
 #include "Core/PowerPC/Interpreter/Interpreter.h"
 #include "Core/PowerPC/Interpreter/Interpreter_FPUtils.h"
@@ -12,6 +13,47 @@
 
 using namespace MathUtil;
 
+#if defined(_M_X86)
+// Vectorized fast paths for the paired-single mul/add family, which dominates
+// interpreter FP time. FPSCRtoFPUSettings() already re-arms the host MXCSR
+// (rounding mode and flush-to-zero) whenever the guest writes FPSCR, so the
+// rounding environment is paid for once per FPSCR write and packed SSE2
+// arithmetic below rounds exactly like the scalar helpers do. Only the NaN
+// bookkeeping differs, and IEEE propagation guarantees a NaN input always
+// surfaces as a NaN result: if neither result lane is NaN, the NI_* helpers
+// would have taken their trivial path and both lanes are bit-identical, so the
+// ops only fall back to the scalar code when a NaN actually shows up.
+
+static inline __m128d LoadPS(u32 reg)
+{
+	// ps0/ps1 are adjacent doubles, ps0 in the low lane.
+	return _mm_loadu_pd(&rPS0(reg));
+}
+
+static inline __m128d LoadPSForce25Bit(u32 reg)
+{
+	// Same rounding of the multiplier to 25 significant bits as Force25Bit().
+	__m128i x = _mm_castpd_si128(LoadPS(reg));
+	x = _mm_add_epi64(_mm_and_si128(x, _mm_set1_epi64x(0xFFFFFFFFF8000000ULL)),
+		_mm_and_si128(x, _mm_set1_epi64x(0x8000000ULL)));
+	return _mm_castsi128_pd(x);
+}
+
+// Rounds both lanes to single precision and writes them to FD. Returns false
+// without touching any state when either lane is NaN, so the caller can redo
+// the op through the scalar helpers for PPC NaN selection and exceptions.
+static inline bool StorePSIfOrdered(u32 fd, __m128d result, bool negate = false)
+{
+	if (_mm_movemask_pd(_mm_cmpunord_pd(result, result)))
+		return false;
+	result = _mm_cvtps_pd(_mm_cvtpd_ps(result));
+	if (negate)
+		result = _mm_xor_pd(result, _mm_castsi128_pd(_mm_set1_epi64x(1ULL << 63)));
+	_mm_storeu_pd(&rPS0(fd), result);
+	return true;
+}
+#endif
+
 // These "binary instructions" do not alter FPSCR.
 void Interpreter::ps_sel(UGeckoInstruction inst)
 {
@@ -156,6 +198,16 @@ void Interpreter::ps_rsqrte(UGeckoInstruction inst)
 
 void Interpreter::ps_sub(UGeckoInstruction inst)
 {
+#if defined(_M_X86)
+	if (StorePSIfOrdered(inst.FD, _mm_sub_pd(LoadPS(inst.FA), LoadPS(inst.FB))))
+	{
+		UpdateFPRF(rPS0(inst.FD));
+
+		if (inst.Rc)
+			Helper_UpdateCR1();
+		return;
+	}
+#endif
 	rPS0(inst.FD) = ForceSingle(NI_sub(rPS0(inst.FA), rPS0(inst.FB)));
 	rPS1(inst.FD) = ForceSingle(NI_sub(rPS1(inst.FA), rPS1(inst.FB)));
 	UpdateFPRF(rPS0(inst.FD));
@@ -166,6 +218,16 @@ void Interpreter::ps_sub(UGeckoInstruction inst)
 
 void Interpreter::ps_add(UGeckoInstruction inst)
 {
+#if defined(_M_X86)
+	if (StorePSIfOrdered(inst.FD, _mm_add_pd(LoadPS(inst.FA), LoadPS(inst.FB))))
+	{
+		UpdateFPRF(rPS0(inst.FD));
+
+		if (inst.Rc)
+			Helper_UpdateCR1();
+		return;
+	}
+#endif
 	rPS0(inst.FD) = ForceSingle(NI_add(rPS0(inst.FA), rPS0(inst.FB)));
 	rPS1(inst.FD) = ForceSingle(NI_add(rPS1(inst.FA), rPS1(inst.FB)));
 	UpdateFPRF(rPS0(inst.FD));
@@ -176,6 +238,16 @@ void Interpreter::ps_add(UGeckoInstruction inst)
 
 void Interpreter::ps_mul(UGeckoInstruction inst)
 {
+#if defined(_M_X86)
+	if (StorePSIfOrdered(inst.FD, _mm_mul_pd(LoadPS(inst.FA), LoadPSForce25Bit(inst.FC))))
+	{
+		UpdateFPRF(rPS0(inst.FD));
+
+		if (inst.Rc)
+			Helper_UpdateCR1();
+		return;
+	}
+#endif
 	double c0 = Force25Bit(rPS0(inst.FC));
 	double c1 = Force25Bit(rPS1(inst.FC));
 	rPS0(inst.FD) = ForceSingle(NI_mul(rPS0(inst.FA), c0));
@@ -188,6 +260,17 @@ void Interpreter::ps_mul(UGeckoInstruction inst)
 
 void Interpreter::ps_msub(UGeckoInstruction inst)
 {
+#if defined(_M_X86)
+	const __m128d product = _mm_mul_pd(LoadPS(inst.FA), LoadPSForce25Bit(inst.FC));
+	if (StorePSIfOrdered(inst.FD, _mm_sub_pd(product, LoadPS(inst.FB))))
+	{
+		UpdateFPRF(rPS0(inst.FD));
+
+		if (inst.Rc)
+			Helper_UpdateCR1();
+		return;
+	}
+#endif
 	double c0 = Force25Bit(rPS0(inst.FC));
 	double c1 = Force25Bit(rPS1(inst.FC));
 	rPS0(inst.FD) = ForceSingle(NI_msub(rPS0(inst.FA), c0, rPS0(inst.FB)));
@@ -200,6 +283,17 @@ void Interpreter::ps_msub(UGeckoInstruction inst)
 
 void Interpreter::ps_madd(UGeckoInstruction inst)
 {
+#if defined(_M_X86)
+	const __m128d product = _mm_mul_pd(LoadPS(inst.FA), LoadPSForce25Bit(inst.FC));
+	if (StorePSIfOrdered(inst.FD, _mm_add_pd(product, LoadPS(inst.FB))))
+	{
+		UpdateFPRF(rPS0(inst.FD));
+
+		if (inst.Rc)
+			Helper_UpdateCR1();
+		return;
+	}
+#endif
 	double c0 = Force25Bit(rPS0(inst.FC));
 	double c1 = Force25Bit(rPS1(inst.FC));
 	rPS0(inst.FD) = ForceSingle(NI_madd(rPS0(inst.FA), c0, rPS0(inst.FB)));
@@ -212,6 +306,17 @@ void Interpreter::ps_madd(UGeckoInstruction inst)
 
 void Interpreter::ps_nmsub(UGeckoInstruction inst)
 {
+#if defined(_M_X86)
+	const __m128d product = _mm_mul_pd(LoadPS(inst.FA), LoadPSForce25Bit(inst.FC));
+	if (StorePSIfOrdered(inst.FD, _mm_sub_pd(product, LoadPS(inst.FB)), true))
+	{
+		UpdateFPRF(rPS0(inst.FD));
+
+		if (inst.Rc)
+			Helper_UpdateCR1();
+		return;
+	}
+#endif
 	double c0 = Force25Bit(rPS0(inst.FC));
 	double c1 = Force25Bit(rPS1(inst.FC));
 	double result0 = ForceSingle(NI_msub(rPS0(inst.FA), c0, rPS0(inst.FB)));
@@ -226,6 +331,17 @@ void Interpreter::ps_nmsub(UGeckoInstruction inst)
 
 void Interpreter::ps_nmadd(UGeckoInstruction inst)
 {
+#if defined(_M_X86)
+	const __m128d product = _mm_mul_pd(LoadPS(inst.FA), LoadPSForce25Bit(inst.FC));
+	if (StorePSIfOrdered(inst.FD, _mm_add_pd(product, LoadPS(inst.FB)), true))
+	{
+		UpdateFPRF(rPS0(inst.FD));
+
+		if (inst.Rc)
+			Helper_UpdateCR1();
+		return;
+	}
+#endif
 	double c0 = Force25Bit(rPS0(inst.FC));
 	double c1 = Force25Bit(rPS1(inst.FC));
 	double result0 = ForceSingle(NI_madd(rPS0(inst.FA), c0, rPS0(inst.FB)));
@@ -264,6 +380,17 @@ void Interpreter::ps_sum1(UGeckoInstruction inst)
 
 void Interpreter::ps_muls0(UGeckoInstruction inst)
 {
+#if defined(_M_X86)
+	const __m128d c = LoadPSForce25Bit(inst.FC);
+	if (StorePSIfOrdered(inst.FD, _mm_mul_pd(LoadPS(inst.FA), _mm_shuffle_pd(c, c, 0))))
+	{
+		UpdateFPRF(rPS0(inst.FD));
+
+		if (inst.Rc)
+			Helper_UpdateCR1();
+		return;
+	}
+#endif
 	double c0 = Force25Bit(rPS0(inst.FC));
 	double p0 = ForceSingle(NI_mul(rPS0(inst.FA), c0));
 	double p1 = ForceSingle(NI_mul(rPS1(inst.FA), c0));
@@ -277,6 +404,17 @@ void Interpreter::ps_muls0(UGeckoInstruction inst)
 
 void Interpreter::ps_muls1(UGeckoInstruction inst)
 {
+#if defined(_M_X86)
+	const __m128d c = LoadPSForce25Bit(inst.FC);
+	if (StorePSIfOrdered(inst.FD, _mm_mul_pd(LoadPS(inst.FA), _mm_shuffle_pd(c, c, 3))))
+	{
+		UpdateFPRF(rPS0(inst.FD));
+
+		if (inst.Rc)
+			Helper_UpdateCR1();
+		return;
+	}
+#endif
 	double c1 = Force25Bit(rPS1(inst.FC));
 	double p0 = ForceSingle(NI_mul(rPS0(inst.FA), c1));
 	double p1 = ForceSingle(NI_mul(rPS1(inst.FA), c1));
@@ -290,6 +428,18 @@ void Interpreter::ps_muls1(UGeckoInstruction inst)
 
 void Interpreter::ps_madds0(UGeckoInstruction inst)
 {
+#if defined(_M_X86)
+	const __m128d c = LoadPSForce25Bit(inst.FC);
+	const __m128d product = _mm_mul_pd(LoadPS(inst.FA), _mm_shuffle_pd(c, c, 0));
+	if (StorePSIfOrdered(inst.FD, _mm_add_pd(product, LoadPS(inst.FB))))
+	{
+		UpdateFPRF(rPS0(inst.FD));
+
+		if (inst.Rc)
+			Helper_UpdateCR1();
+		return;
+	}
+#endif
 	double c0 = Force25Bit(rPS0(inst.FC));
 	double p0 = ForceSingle(NI_madd(rPS0(inst.FA), c0, rPS0(inst.FB)));
 	double p1 = ForceSingle(NI_madd(rPS1(inst.FA), c0, rPS1(inst.FB)));
@@ -303,6 +453,18 @@ void Interpreter::ps_madds0(UGeckoInstruction inst)
 
 void Interpreter::ps_madds1(UGeckoInstruction inst)
 {
+#if defined(_M_X86)
+	const __m128d c = LoadPSForce25Bit(inst.FC);
+	const __m128d product = _mm_mul_pd(LoadPS(inst.FA), _mm_shuffle_pd(c, c, 3));
+	if (StorePSIfOrdered(inst.FD, _mm_add_pd(product, LoadPS(inst.FB))))
+	{
+		UpdateFPRF(rPS0(inst.FD));
+
+		if (inst.Rc)
+			Helper_UpdateCR1();
+		return;
+	}
+#endif
 	double c1 = Force25Bit(rPS1(inst.FC));
 	double p0 = ForceSingle(NI_madd(rPS0(inst.FA), c1, rPS0(inst.FB)));
 	double p1 = ForceSingle(NI_madd(rPS1(inst.FA), c1, rPS1(inst.FB)));
@@ -10,7 +10,11 @@
 
 using namespace Gen;
 
-FPURegCache::FPURegCache(Jit64& jit) : RegCache{ jit }
+static constexpr X64Reg FPR_ALLOCATION_ORDER[] = { XMM6,  XMM7,  XMM8,  XMM9, XMM10, XMM11, XMM12,
+																									XMM13, XMM14, XMM15, XMM2, XMM3,  XMM4,  XMM5 };
+
+FPURegCache::FPURegCache(Jit64& jit)
+	: RegCache{ jit, FPR_ALLOCATION_ORDER, sizeof(FPR_ALLOCATION_ORDER) / sizeof(X64Reg) }
 {
 }
 
@@ -24,14 +28,6 @@ void FPURegCache::LoadRegister(size_t preg, X64Reg new_loc)
 	m_emitter->MOVAPD(new_loc, m_regs[preg].location);
 }
 
-const X64Reg* FPURegCache::GetAllocationOrder(size_t* count)
-{
-	static const X64Reg allocation_order[] = { XMM6,  XMM7,  XMM8,  XMM9, XMM10, XMM11, XMM12,
-																						XMM13, XMM14, XMM15, XMM2, XMM3,  XMM4,  XMM5 };
-	*count = sizeof(allocation_order) / sizeof(X64Reg);
-	return allocation_order;
-}
-
 OpArg FPURegCache::GetDefaultLocation(size_t reg) const
 {
 	return PPCSTATE(ps[reg][0]);
@@ -39,7 +35,7 @@ OpArg FPURegCache::GetDefaultLocation(size_t reg) const
 
 BitSet32 FPURegCache::GetRegUtilization()
 {
-	return m_jit.js.op->gprInReg;
+	return m_jit.js.op->fprInXmm;
 }
 
 BitSet32 FPURegCache::CountRegsIn(size_t preg, u32 lookahead)
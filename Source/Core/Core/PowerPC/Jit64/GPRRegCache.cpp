@@ -10,7 +10,20 @@
 
 using namespace Gen;
 
-GPRRegCache::GPRRegCache(Jit64& jit) : RegCache{ jit }
+static constexpr X64Reg GPR_ALLOCATION_ORDER[] = {
+	// R12, when used as base register, for example in a LEA, can generate bad code! Need to look into
+	// this.
+	#ifdef _WIN32
+				RSI, RDI, R13, R14, R15, R8,
+				R9,  R10, R11, R12, RCX
+	#else
+				R12, R13, R14, R15, RSI, RDI,
+				R8,  R9,  R10, R11, RCX
+	#endif
+};
+
+GPRRegCache::GPRRegCache(Jit64& jit)
+	: RegCache{ jit, GPR_ALLOCATION_ORDER, sizeof(GPR_ALLOCATION_ORDER) / sizeof(X64Reg) }
 {
 }
 
@@ -29,29 +42,13 @@ OpArg GPRRegCache::GetDefaultLocation(size_t reg) const
 	return PPCSTATE(gpr[reg]);
 }
 
-const X64Reg* GPRRegCache::GetAllocationOrder(size_t* count)
-{
-	static const X64Reg allocation_order[] = {
-		// R12, when used as base register, for example in a LEA, can generate bad code! Need to look into
-		// this.
-		#ifdef _WIN32
-					RSI, RDI, R13, R14, R15, R8,
-					R9,  R10, R11, R12, RCX
-		#else
-					R12, R13, R14, R15, RSI, RDI,
-					R8,  R9,  R10, R11, RCX
-		#endif
-	};
-	*count = sizeof(allocation_order) / sizeof(X64Reg);
-	return allocation_order;
-}
-
 void GPRRegCache::SetImmediate32(size_t preg, u32 imm_value, bool dirty)
 {
 	// "dirty" can be false to avoid redundantly flushing an immediate when
 	// processing speculative constants.
 	DiscardRegContentsIfCached(preg);
-	m_regs[preg].away |= dirty;
+	if (dirty)
+		m_regs_away[preg] = true;
 	m_regs[preg].location = Imm32(imm_value);
 }
 
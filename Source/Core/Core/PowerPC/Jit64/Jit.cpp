@@ -16,6 +16,7 @@
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
+#include "Common/PerformanceHud.h"
 #include "Common/StringUtil.h"
 #include "Common/x64ABI.h"
 #include "Core/Core.h"
@@ -33,6 +34,9 @@
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/PowerPC/Profiler.h"
+#ifdef USE_GDBSTUB
+#include "Core/PowerPC/GDBStub.h"
+#endif
 #if defined(_DEBUG) || defined(DEBUGFAST)
 #include "Common/GekkoDisassembler.h"
 #endif
@@ -40,6 +44,21 @@
 using namespace Gen;
 using namespace PowerPC;
 
+// Whether blocks have to be compiled with breakpoint checks and stepping
+// support. The gdb stub maps its breakpoints onto PowerPC::breakpoints, so
+// they are honored whenever a stub session is enabled, even without the
+// debugger UI.
+static bool IsDebuggingActive()
+{
+	if (SConfig::GetInstance().bEnableDebugging)
+		return true;
+#ifdef USE_GDBSTUB
+	if (gdb_active())
+		return true;
+#endif
+	return false;
+}
+
 // Dolphin's PowerPC->x86_64 JIT dynamic recompiler
 // Written mostly by ector (hrydgard)
 // Features:
@@ -322,9 +341,27 @@ void Jit64::HLEFunction(UGeckoInstruction _inst)
 {
 	gpr.Flush();
 	fpr.Flush();
-	ABI_PushRegistersAndAdjustStack({}, 0);
-	ABI_CallFunctionCC(HLE::Execute, js.compilerPC, _inst.hex);
-	ABI_PopRegistersAndAdjustStack({}, 0);
+
+	// The hook index is known at compile time, so resolve the patch function
+	// here and emit a direct call with an inlined invocation counter instead
+	// of going through HLE::Execute's bounds check and table dispatch.
+	const u32 function_index = _inst.hex & 0xFFFFF;
+	HLE::TPatchFunction patch_function = HLE::GetFunctionPointerByIndex(function_index);
+	HLE::SHookStats* stats = HLE::GetHookStatsByIndex(function_index);
+	if (patch_function && stats)
+	{
+		MOV(64, R(RSCRATCH), ImmPtr(&stats->calls));
+		ADD(64, MatR(RSCRATCH), Imm32(1));
+		ABI_PushRegistersAndAdjustStack({}, 0);
+		ABI_CallFunction(patch_function);
+		ABI_PopRegistersAndAdjustStack({}, 0);
+	}
+	else
+	{
+		ABI_PushRegistersAndAdjustStack({}, 0);
+		ABI_CallFunctionCC(HLE::Execute, js.compilerPC, _inst.hex);
+		ABI_PopRegistersAndAdjustStack({}, 0);
+	}
 }
 
 void Jit64::DoNothing(UGeckoInstruction _inst)
@@ -332,6 +369,10 @@ void Jit64::DoNothing(UGeckoInstruction _inst)
 	// Yup, just don't do anything.
 }
 
+// Number of times a baseline-tier block has to run before it is promoted to a
+// fully optimized recompile (see bJITTieredCompile).
+static const int HOT_BLOCK_THRESHOLD = 512;
+
 static const bool ImHereDebug = false;
 static const bool ImHereLog = false;
 static std::map<u32, int> been_here;
@@ -556,6 +597,7 @@ void Jit64::Trace()
 
 void Jit64::Jit(u32 em_address)
 {
+	PerfHud::ScopedTimer hud_timer(PerfHud::SLOT_JIT);
 	if (m_cleanup_after_stackfault)
 	{
 		ClearCache();
@@ -574,7 +616,7 @@ void Jit64::Jit(u32 em_address)
 
 	int blockSize = code_buffer.GetSize();
 
-	if (SConfig::GetInstance().bEnableDebugging)
+	if (IsDebuggingActive())
 	{
 		// We can link blocks as long as we are not single stepping and there are no breakpoints here
 		EnableBlockLink();
@@ -599,6 +641,32 @@ void Jit64::Jit(u32 em_address)
 		}
 	}
 
+	// Tiered compilation: give new blocks a cheap baseline compile and only spend
+	// the expensive analysis passes on blocks which have proven themselves hot.
+	// Promotion happens through the same invalidate-and-recompile path as the
+	// other block respecializations, so the dispatcher never has to wait.
+	m_compiling_tier0 = false;
+	if (SConfig::GetInstance().bJITTieredCompile && !SConfig::GetInstance().bEnableDebugging)
+	{
+		if (js.hotBlockAddresses.find(em_address) == js.hotBlockAddresses.end())
+		{
+			m_compiling_tier0 = true;
+			analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_MERGE);
+			analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
+			analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
+			analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+			analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_AGGRESSIVE_BRANCH_FOLLOW);
+		}
+		else
+		{
+			EnableOptimization();
+			// The block has earned a recompile through its execution count, so
+			// spend code size on superblock formation: following more branches
+			// here is what cuts the dispatch count on hot paths.
+			analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_AGGRESSIVE_BRANCH_FOLLOW);
+		}
+	}
+
 	// Analyze the block, collect all instructions it is made of (including inlining,
 	// if that is enabled), reorder instructions for optimal performance, and join joinable
 	// instructions.
@@ -666,6 +734,26 @@ const u8* Jit64::DoJit(u32 em_address, PPCAnalyst::CodeBuffer* code_buf, JitBloc
 		// get start tic
 		PROFILER_QUERY_PERFORMANCE_COUNTER(&b->ticStart);
 	}
+
+	// Count executions of baseline-tier blocks. Once one crosses the threshold,
+	// request a recompile with the full optimization passes; the comparison uses
+	// CC_E so the request only fires once.
+	if (m_compiling_tier0)
+	{
+		MOV(64, R(RSCRATCH), ImmPtr(&b->runCount));
+		ADD(32, MatR(RSCRATCH), Imm8(1));
+		CMP(32, MatR(RSCRATCH), Imm32(HOT_BLOCK_THRESHOLD));
+		FixupBranch hot = J_CC(CC_E, true);
+		SwitchToFarCode();
+		SetJumpTarget(hot);
+		MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
+		ABI_PushRegistersAndAdjustStack({}, 0);
+		ABI_CallFunctionC(JitInterface::CompileExceptionCheck,
+			static_cast<u32>(JitInterface::ExceptionType::HotBlock));
+		ABI_PopRegistersAndAdjustStack({}, 0);
+		JMP(asm_routines.dispatcherNoCheck, true);
+		SwitchToNearCode();
+	}
 #if defined(_DEBUG) || defined(DEBUGFAST) || defined(NAN_CHECK)
 	// should help logged stack-traces become more accurate
 	MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
@@ -841,8 +929,8 @@ const u8* Jit64::DoJit(u32 em_address, PPCAnalyst::CodeBuffer* code_buf, JitBloc
 				js.firstFPInstructionFound = true;
 			}
 
-			if (SConfig::GetInstance().bEnableDebugging &&
-				breakpoints.IsAddressBreakPoint(ops[i].address) && !CPU::IsStepping())
+			if (IsDebuggingActive() && breakpoints.IsAddressBreakPoint(ops[i].address) &&
+				!CPU::IsStepping())
 			{
 				// Turn off block linking if there are breakpoints so that the Step Over command does not
 				// link this block.
@@ -1001,6 +1089,12 @@ void Jit64::EnableOptimization()
 	analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
 	analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
 	analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+	// Hoisting loads across stores reorders guest memory accesses, which is
+	// only safe while no access can take a guest exception path mid-block:
+	// with the MMU enabled a reordered fault would resume with the skipped
+	// store lost.
+	if (!SConfig::GetInstance().bMMU)
+		analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_LOADSTORE_REORDER);
 }
 
 void Jit64::IntializeSpeculativeConstants()
@@ -247,5 +247,8 @@ private:
 
 	bool m_enable_blr_optimization;
 	bool m_cleanup_after_stackfault;
+	// Whether the block currently being compiled is a cheap first-tier compile
+	// which still needs its hotness counter (see bJITTieredCompile).
+	bool m_compiling_tier0 = false;
 	u8* m_stack;
 };
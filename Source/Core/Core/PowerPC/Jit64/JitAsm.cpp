@@ -104,7 +104,35 @@ void Jit64AsmRoutineManager::Generate()
 	const bool assembly_dispatcher = true;
 	if (assembly_dispatcher)
 	{
-		// Fast block number lookup.
+		// First level: probe the small hot block map. It is 4KiB and stays
+		// resident in the host L1 cache, so the common case never touches the
+		// half-megabyte fast block map below. An aliased or stale entry fails
+		// the effectiveAddress/msrBits check and falls through harmlessly.
+		// ((PC >> 2) & mask) * sizeof(JitBlock*) = (PC & (mask << 2)) * 2
+		MOV(32, R(RSCRATCH), PPCSTATE(pc));
+		u64 hot_map = reinterpret_cast<u64>(g_jit->GetBlockCache()->GetHotBlockMap());
+		AND(32, R(RSCRATCH), Imm32(JitBaseBlockCache::HOT_BLOCK_MAP_MASK << 2));
+		if (hot_map <= INT_MAX)
+		{
+			MOV(64, R(RSCRATCH), MScaled(RSCRATCH, SCALE_2, static_cast<s32>(hot_map)));
+		}
+		else
+		{
+			MOV(64, R(RSCRATCH2), Imm64(hot_map));
+			MOV(64, R(RSCRATCH), MComplex(RSCRATCH2, RSCRATCH, SCALE_2, 0));
+		}
+		TEST(64, R(RSCRATCH), R(RSCRATCH));
+		FixupBranch hot_empty = J_CC(CC_Z);
+		MOV(32, R(RSCRATCH2), PPCSTATE(msr));
+		AND(32, R(RSCRATCH2), Imm32(JitBaseBlockCache::JIT_CACHE_MSR_MASK));
+		SHL(64, R(RSCRATCH2), Imm8(32));
+		MOV(32, R(RSCRATCH_EXTRA), PPCSTATE(pc));
+		OR(64, R(RSCRATCH2), R(RSCRATCH_EXTRA));
+		CMP(64, R(RSCRATCH2), MDisp(RSCRATCH, static_cast<s32>(offsetof(JitBlock, effectiveAddress))));
+		FixupBranch hot_found = J_CC(CC_E);
+		SetJumpTarget(hot_empty);
+
+		// Second level: fast block number lookup.
 		// ((PC >> 2) & mask) * sizeof(JitBlock*) = (PC & (mask << 2)) * 2
 		MOV(32, R(RSCRATCH), PPCSTATE(pc));
 		u64 icache = reinterpret_cast<u64>(g_jit->GetBlockCache()->GetFastBlockMap());
@@ -132,6 +160,19 @@ void Jit64AsmRoutineManager::Generate()
 		CMP(64, R(RSCRATCH2), MDisp(RSCRATCH, static_cast<s32>(offsetof(JitBlock, effectiveAddress))));
 		FixupBranch state_mismatch = J_CC(CC_NE);
 
+		// Promote the block into the hot map so the next dispatch to this PC
+		// takes the first-level hit. The back-index is stored alongside the
+		// slot; DestroyBlock relies on it to clear the entry again.
+		MOV(32, R(RSCRATCH2), R(RSCRATCH_EXTRA));
+		AND(32, R(RSCRATCH2), Imm32(JitBaseBlockCache::HOT_BLOCK_MAP_MASK << 2));
+		MOV(64, R(RSCRATCH_EXTRA), Imm64(hot_map));
+		MOV(64, MComplex(RSCRATCH_EXTRA, RSCRATCH2, SCALE_2, 0), R(RSCRATCH));
+		SHR(32, R(RSCRATCH2), Imm8(2));
+		MOV(64, MDisp(RSCRATCH, static_cast<s32>(offsetof(JitBlock, hot_block_map_index))),
+			R(RSCRATCH2));
+
+		SetJumpTarget(hot_found);
+
 		// Success; branch to the block we found.
 		// Switch to the correct memory base, in case MSR.DR has changed.
 		TEST(32, PPCSTATE(msr), Imm32(1 << (31 - 27)));
@@ -221,14 +262,6 @@ void Jit64AsmRoutineManager::ResetStack(X64CodeBlock& emitter)
 
 void Jit64AsmRoutineManager::GenerateCommon()
 {
-	fifoDirectWrite8 = AlignCode4();
-	GenFifoWrite(8);
-	fifoDirectWrite16 = AlignCode4();
-	GenFifoWrite(16);
-	fifoDirectWrite32 = AlignCode4();
-	GenFifoWrite(32);
-	fifoDirectWrite64 = AlignCode4();
-	GenFifoWrite(64);
 	frsqrte = AlignCode4();
 	GenFrsqrte();
 	fres = AlignCode4();
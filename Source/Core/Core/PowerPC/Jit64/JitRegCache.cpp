@@ -19,24 +19,28 @@
 using namespace Gen;
 using namespace PowerPC;
 
-RegCache::RegCache(Jit64& jit) : m_jit{ jit }
+RegCache::RegCache(Jit64& jit, const X64Reg* allocation_order, size_t allocation_order_count)
+	: m_jit{ jit }, m_allocation_order{ allocation_order },
+	m_allocation_order_count{ allocation_order_count }
 {
+	for (size_t i = 0; i < allocation_order_count; i++)
+		m_allocation_order_mask[allocation_order[i]] = true;
 }
 
 void RegCache::Start()
 {
+	m_xregs_free = BitSet32::AllTrue(NUM_XREGS);
+	m_xregs_locked = BitSet32();
 	for (auto& xreg : m_xregs)
 	{
-		xreg.free = true;
 		xreg.dirty = false;
-		xreg.locked = false;
 		xreg.ppcReg = INVALID_REG;
 	}
+	m_regs_away = BitSet32();
+	m_regs_locked = BitSet32();
 	for (size_t i = 0; i < m_regs.size(); i++)
 	{
 		m_regs[i].location = GetDefaultLocation(i);
-		m_regs[i].away = false;
-		m_regs[i].locked = false;
 	}
 
 	// todo: sort to find the most popular regs
@@ -61,10 +65,10 @@ void RegCache::DiscardRegContentsIfCached(size_t preg)
 	if (IsBound(preg))
 	{
 		X64Reg xr = m_regs[preg].location.GetSimpleReg();
-		m_xregs[xr].free = true;
+		m_xregs_free[xr] = true;
 		m_xregs[xr].dirty = false;
 		m_xregs[xr].ppcReg = INVALID_REG;
-		m_regs[preg].away = false;
+		m_regs_away[preg] = false;
 		m_regs[preg].location = GetDefaultLocation(preg);
 	}
 }
@@ -76,29 +80,22 @@ void RegCache::SetEmitter(XEmitter* emitter)
 
 void RegCache::Flush(FlushMode mode, BitSet32 regsToFlush)
 {
-	for (size_t i = 0; i < m_xregs.size(); i++)
-	{
-		if (m_xregs[i].locked)
-			PanicAlert("Someone forgot to unlock X64 reg %zu", i);
-	}
+	for (int i : m_xregs_locked)
+		PanicAlert("Someone forgot to unlock X64 reg %d", i);
+
+	for (int i : regsToFlush & m_regs_locked)
+		PanicAlert("Someone forgot to unlock PPC reg %d (X64 reg %i).", i, RX(i));
 
-	for (unsigned int i : regsToFlush)
+	// Only registers that actually left the register file need a look.
+	for (int i : regsToFlush & m_regs_away)
 	{
-		if (m_regs[i].locked)
+		if (m_regs[i].location.IsSimpleReg() || m_regs[i].location.IsImm())
 		{
-			PanicAlert("Someone forgot to unlock PPC reg %u (X64 reg %i).", i, RX(i));
+			StoreFromRegister(i, mode);
 		}
-
-		if (m_regs[i].away)
+		else
 		{
-			if (m_regs[i].location.IsSimpleReg() || m_regs[i].location.IsImm())
-			{
-				StoreFromRegister(i, mode);
-			}
-			else
-			{
-				_assert_msg_(DYNA_REC, 0, "Jit64 - Flush unhandled case, reg %u PC: %08x", i, PC);
-			}
+			_assert_msg_(DYNA_REC, 0, "Jit64 - Flush unhandled case, reg %d PC: %08x", i, PC);
 		}
 	}
 }
@@ -107,7 +104,7 @@ void RegCache::FlushR(X64Reg reg)
 {
 	if (reg >= m_xregs.size())
 		PanicAlert("Flushing non existent reg");
-	if (!m_xregs[reg].free)
+	if (!m_xregs_free[reg])
 	{
 		StoreFromRegister(m_xregs[reg].ppcReg);
 	}
@@ -135,22 +132,19 @@ void RegCache::FlushLockX(X64Reg reg1, X64Reg reg2)
 
 int RegCache::SanityCheck() const
 {
-	for (size_t i = 0; i < m_regs.size(); i++)
+	for (int i : m_regs_away)
 	{
-		if (m_regs[i].away)
+		if (m_regs[i].location.IsSimpleReg())
 		{
-			if (m_regs[i].location.IsSimpleReg())
-			{
-				Gen::X64Reg simple = m_regs[i].location.GetSimpleReg();
-				if (m_xregs[simple].locked)
-					return 1;
-				if (m_xregs[simple].ppcReg != i)
-					return 2;
-			}
-			else if (m_regs[i].location.IsImm())
-			{
-				return 3;
-			}
+			Gen::X64Reg simple = m_regs[i].location.GetSimpleReg();
+			if (m_xregs_locked[simple])
+				return 1;
+			if (m_xregs[simple].ppcReg != static_cast<size_t>(i))
+				return 2;
+		}
+		else if (m_regs[i].location.IsImm())
+		{
+			return 3;
 		}
 	}
 	return 0;
@@ -158,7 +152,7 @@ int RegCache::SanityCheck() const
 
 void RegCache::KillImmediate(size_t preg, bool doLoad, bool makeDirty)
 {
-	if (m_regs[preg].away)
+	if (m_regs_away[preg])
 	{
 		if (m_regs[preg].location.IsImm())
 			BindToRegister(preg, doLoad, makeDirty);
@@ -169,16 +163,16 @@ void RegCache::KillImmediate(size_t preg, bool doLoad, bool makeDirty)
 
 void RegCache::BindToRegister(size_t i, bool doLoad, bool makeDirty)
 {
-	if (!m_regs[i].away || m_regs[i].location.IsImm())
+	if (!m_regs_away[i] || m_regs[i].location.IsImm())
 	{
 		X64Reg xr = GetFreeXReg();
 		if (m_xregs[xr].dirty)
 			PanicAlert("Xreg already dirty");
-		if (m_xregs[xr].locked)
+		if (m_xregs_locked[xr])
 			PanicAlert("GetFreeXReg returned locked register");
-		m_xregs[xr].free = false;
+		m_xregs_free[xr] = false;
 		m_xregs[xr].ppcReg = i;
-		m_xregs[xr].dirty = makeDirty || m_regs[i].away;
+		m_xregs[xr].dirty = makeDirty || m_regs_away[i];
 		if (doLoad)
 			LoadRegister(i, xr);
 		for (size_t j = 0; j < m_regs.size(); j++)
@@ -188,7 +182,7 @@ void RegCache::BindToRegister(size_t i, bool doLoad, bool makeDirty)
 				Crash();
 			}
 		}
-		m_regs[i].away = true;
+		m_regs_away[i] = true;
 		m_regs[i].location = ::Gen::R(xr);
 	}
 	else
@@ -198,7 +192,7 @@ void RegCache::BindToRegister(size_t i, bool doLoad, bool makeDirty)
 		m_xregs[RX(i)].dirty |= makeDirty;
 	}
 
-	if (m_xregs[RX(i)].locked)
+	if (m_xregs_locked[RX(i)])
 	{
 		PanicAlert("Seriously WTF, this reg should have been flushed");
 	}
@@ -206,7 +200,7 @@ void RegCache::BindToRegister(size_t i, bool doLoad, bool makeDirty)
 
 void RegCache::StoreFromRegister(size_t i, FlushMode mode)
 {
-	if (m_regs[i].away)
+	if (m_regs_away[i])
 	{
 		bool doStore;
 		if (m_regs[i].location.IsSimpleReg())
@@ -215,7 +209,7 @@ void RegCache::StoreFromRegister(size_t i, FlushMode mode)
 			doStore = m_xregs[xr].dirty;
 			if (mode == FlushMode::All)
 			{
-				m_xregs[xr].free = true;
+				m_xregs_free[xr] = true;
 				m_xregs[xr].ppcReg = INVALID_REG;
 				m_xregs[xr].dirty = false;
 			}
@@ -231,7 +225,7 @@ void RegCache::StoreFromRegister(size_t i, FlushMode mode)
 		if (mode == FlushMode::All)
 		{
 			m_regs[i].location = newLoc;
-			m_regs[i].away = false;
+			m_regs_away[i] = false;
 		}
 	}
 }
@@ -250,38 +244,40 @@ X64Reg RegCache::RX(size_t preg) const
 	return Gen::INVALID_REG;
 }
 
+// These run after every compiled instruction, so they are single stores now
+// instead of walks over the register arrays.
 void RegCache::UnlockAll()
 {
-	for (auto& reg : m_regs)
-		reg.locked = false;
+	m_regs_locked = BitSet32();
 }
 
 void RegCache::UnlockAllX()
 {
-	for (auto& xreg : m_xregs)
-		xreg.locked = false;
+	m_xregs_locked = BitSet32();
 }
 
 bool RegCache::IsFreeX(size_t xreg) const
 {
-	return m_xregs[xreg].free && !m_xregs[xreg].locked;
+	return m_xregs_free[xreg] && !m_xregs_locked[xreg];
 }
 
 bool RegCache::IsBound(size_t preg) const
 {
-	return m_regs[preg].away && m_regs[preg].location.IsSimpleReg();
+	return m_regs_away[preg] && m_regs[preg].location.IsSimpleReg();
 }
 
 X64Reg RegCache::GetFreeXReg()
 {
-	size_t aCount;
-	const X64Reg* aOrder = GetAllocationOrder(&aCount);
-	for (size_t i = 0; i < aCount; i++)
+	// All allocatable candidates in one mask; the common case picks the first
+	// one in allocation order without touching m_xregs at all.
+	BitSet32 candidates = m_xregs_free & ~m_xregs_locked & m_allocation_order_mask;
+	if (candidates)
 	{
-		X64Reg xr = aOrder[i];
-		if (!m_xregs[xr].locked && m_xregs[xr].free)
+		for (size_t i = 0; i < m_allocation_order_count; i++)
 		{
-			return xr;
+			X64Reg xr = m_allocation_order[i];
+			if (candidates[xr])
+				return xr;
 		}
 	}
 
@@ -290,11 +286,13 @@ X64Reg RegCache::GetFreeXReg()
 	float min_score = std::numeric_limits<float>::max();
 	X64Reg best_xreg = INVALID_REG;
 	size_t best_preg = 0;
-	for (size_t i = 0; i < aCount; i++)
+	for (size_t i = 0; i < m_allocation_order_count; i++)
 	{
-		X64Reg xreg = (X64Reg)aOrder[i];
+		X64Reg xreg = m_allocation_order[i];
+		if (m_xregs_locked[xreg])
+			continue;
 		size_t preg = m_xregs[xreg].ppcReg;
-		if (m_xregs[xreg].locked || m_regs[preg].locked)
+		if (m_regs_locked[preg])
 			continue;
 		float score = ScoreRegister(xreg);
 		if (score < min_score)
@@ -318,13 +316,7 @@ X64Reg RegCache::GetFreeXReg()
 
 int RegCache::NumFreeRegisters()
 {
-	int count = 0;
-	size_t aCount;
-	const X64Reg* aOrder = GetAllocationOrder(&aCount);
-	for (size_t i = 0; i < aCount; i++)
-		if (!m_xregs[aOrder[i]].locked && m_xregs[aOrder[i]].free)
-			count++;
-	return count;
+	return static_cast<int>((m_xregs_free & ~m_xregs_locked & m_allocation_order_mask).Count());
 }
 
 // Estimate roughly how bad it would be to de-allocate this register. Higher score
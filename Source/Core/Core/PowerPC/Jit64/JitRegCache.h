@@ -7,24 +7,23 @@
 #include <array>
 #include <cinttypes>
 
+#include "Common/BitSet.h"
 #include "Common/x64Emitter.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 
 class Jit64;
 
+// The away/locked/free flags live in the RegCache bitmasks below, so the
+// allocator's per-block scans are bit operations rather than array walks.
 struct PPCCachedReg
 {
 	Gen::OpArg location;
-	bool away;  // value not in source register
-	bool locked;
 };
 
 struct X64CachedReg
 {
 	size_t ppcReg;
 	bool dirty;
-	bool free;
-	bool locked;
 };
 
 class RegCache
@@ -38,7 +37,7 @@ public:
 
 	static constexpr size_t NUM_XREGS = 16;
 
-	explicit RegCache(Jit64& jit);
+	RegCache(Jit64& jit, const Gen::X64Reg* allocation_order, size_t allocation_order_count);
 	virtual ~RegCache() = default;
 
 	virtual void StoreRegister(size_t preg, const Gen::OpArg& new_loc) = 0;
@@ -75,7 +74,7 @@ public:
 	template <typename T>
 	void Lock(T p)
 	{
-		m_regs[p].locked = true;
+		m_regs_locked[p] = true;
 	}
 	template <typename T, typename... Args>
 	void Lock(T first, Args... args)
@@ -88,9 +87,9 @@ public:
 	template <typename T>
 	void LockX(T x)
 	{
-		if (m_xregs[x].locked)
+		if (m_xregs_locked[x])
 			PanicAlert("RegCache: x %i already locked!", x);
-		m_xregs[x].locked = true;
+		m_xregs_locked[x] = true;
 	}
 	template <typename T, typename... Args>
 	void LockX(T first, Args... args)
@@ -102,9 +101,9 @@ public:
 	template <typename T>
 	void UnlockX(T x)
 	{
-		if (!m_xregs[x].locked)
+		if (!m_xregs_locked[x])
 			PanicAlert("RegCache: x %i already unlocked!", x);
-		m_xregs[x].locked = false;
+		m_xregs_locked[x] = false;
 	}
 	template <typename T, typename... Args>
 	void UnlockX(T first, Args... args)
@@ -123,8 +122,6 @@ public:
 	int NumFreeRegisters();
 
 protected:
-	virtual const Gen::X64Reg* GetAllocationOrder(size_t* count) = 0;
-
 	virtual BitSet32 GetRegUtilization() = 0;
 	virtual BitSet32 CountRegsIn(size_t preg, u32 lookahead) = 0;
 
@@ -133,5 +130,21 @@ protected:
 	Jit64& m_jit;
 	std::array<PPCCachedReg, 32> m_regs;
 	std::array<X64CachedReg, NUM_XREGS> m_xregs;
+
+	// Allocator scan state as bitmasks: one bit per PPC/x64 register. The hot
+	// scans (GetFreeXReg, Flush, the per-instruction UnlockAll*) operate on
+	// these instead of walking the arrays above.
+	BitSet32 m_regs_away;
+	BitSet32 m_regs_locked;
+	BitSet32 m_xregs_free;
+	BitSet32 m_xregs_locked;
+
+	// Allocation order is a per-cache constant handed to the constructor, so
+	// the scans don't pay a virtual call to fetch it; the mask form is
+	// precomputed for the bitset paths.
+	const Gen::X64Reg* m_allocation_order;
+	size_t m_allocation_order_count;
+	BitSet32 m_allocation_order_mask;
+
 	Gen::XEmitter* m_emitter = nullptr;
 };
@@ -119,20 +119,29 @@ void Jit64::lXXx(UGeckoInstruction inst)
 		signExtend = true;
 	}
 
-	if (!CPU::IsStepping() && inst.OPCD == 32 && CanMergeNextInstructions(2) &&
-		(inst.hex & 0xFFFF0000) == 0x800D0000 &&
-		(js.op[1].inst.hex == 0x28000000 ||
-		(SConfig::GetInstance().bWii && js.op[1].inst.hex == 0x2C000000)) &&
-		js.op[2].inst.hex == 0x4182fff8)
+	// Idle loop detection: lwz rD, imm(rA) / cmp[l]wi cr0, rD, imm / b[eq|ne] cr0, -8.
+	// The guest is spinning on a memory word that only an interrupt handler (or
+	// the GPU, covered by the FlushGpu in CoreTiming::Idle) will change, so once
+	// the loop condition holds we can hand the rest of the slice back to
+	// CoreTiming instead of iterating. This used to match only the r13-relative
+	// compare-against-zero form; any register pair and immediate works the same.
+	if (!CPU::IsStepping() && inst.OPCD == 32 && a != 0 && a != d && CanMergeNextInstructions(2) &&
+		(js.op[1].inst.OPCD == 10 || js.op[1].inst.OPCD == 11) && js.op[1].inst.CRFD == 0 &&
+		js.op[1].inst.L == 0 && js.op[1].inst.RA == d &&
+		(js.op[2].inst.hex == 0x4182fff8 || js.op[2].inst.hex == 0x4082fff8))
 	{
+		const UGeckoInstruction cmp = js.op[1].inst;
+		const u32 compare_value = cmp.OPCD == 10 ? (u32)cmp.UIMM : (u32)(s32)(s16)cmp.UIMM;
+		const bool loop_on_equal = js.op[2].inst.hex == 0x4182fff8;
+
 		s32 offset = (s32)(s16)inst.SIMM_16;
 		gpr.BindToRegister(a, true, false);
 		gpr.BindToRegister(d, false, true);
 		SafeLoadToReg(gpr.RX(d), gpr.R(a), accessSize, offset, CallerSavedRegistersInUse(), signExtend);
 
-		// if it's still 0, we can wait until the next event
-		TEST(32, gpr.R(d), gpr.R(d));
-		FixupBranch noIdle = J_CC(CC_NZ);
+		// if the loop would take another lap, we can wait until the next event
+		CMP(32, gpr.R(d), Imm32(compare_value));
+		FixupBranch noIdle = J_CC(loop_on_equal ? CC_NE : CC_E);
 
 		BitSet32 registersInUse = CallerSavedRegistersInUse();
 		ABI_PushRegistersAndAdjustStack(registersInUse, 0);
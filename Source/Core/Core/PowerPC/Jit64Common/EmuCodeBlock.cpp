@@ -202,23 +202,13 @@ bool EmuCodeBlock::UnsafeLoadToReg(X64Reg reg_value, OpArg opAddress, int access
 
 void EmuCodeBlock::UnsafeWriteGatherPipe(int accessSize)
 {
-	// No need to protect these, they don't touch any state
-	// question - should we inline them instead? Pro: Lose a CALL   Con: Code bloat
-	switch (accessSize)
-	{
-	case 8:
-		CALL(g_jit->GetAsmRoutines()->fifoDirectWrite8);
-		break;
-	case 16:
-		CALL(g_jit->GetAsmRoutines()->fifoDirectWrite16);
-		break;
-	case 32:
-		CALL(g_jit->GetAsmRoutines()->fifoDirectWrite32);
-		break;
-	case 64:
-		CALL(g_jit->GetAsmRoutines()->fifoDirectWrite64);
-		break;
-	}
+	// Value is expected in RSCRATCH.  With the write position in ppcState this
+	// is short enough to inline, so runs of FIFO writes become plain stores
+	// with the single gather pipe check deferred to the end of the run.
+	MOV(64, R(RSCRATCH2), PPCSTATE(gather_pipe_ptr));
+	SwapAndStore(accessSize, MatR(RSCRATCH2), RSCRATCH);
+	ADD(64, R(RSCRATCH2), Imm8(accessSize >> 3));
+	MOV(64, PPCSTATE(gather_pipe_ptr), R(RSCRATCH2));
 	g_jit->js.fifoBytesSinceCheck += accessSize >> 3;
 }
 
@@ -291,6 +281,10 @@ private:
 	void CallLambda(int sbits, const std::function<T(u32)>* lambda)
 	{
 		m_code->ABI_PushRegistersAndAdjustStack(m_registers_in_use, 0);
+		// Count reads which could not be inlined, so it stays visible which
+		// registers keep taking the generic dispatch path.
+		m_code->MOV(64, R(RSCRATCH), ImmPtr(MMIO::GetGenericDispatchCounter(m_address)));
+		m_code->ADD(64, MatR(RSCRATCH), Gen::Imm8(1));
 		m_code->ABI_CallLambdaC(lambda, m_address);
 		m_code->ABI_PopRegistersAndAdjustStack(m_registers_in_use, 0);
 		MoveOpArgToReg(sbits, R(ABI_RETURN));
@@ -303,6 +297,84 @@ private:
 	bool m_sign_extend;
 };
 
+template <typename T>
+class MMIOWriteCodeGenerator : public MMIO::WriteHandlingMethodVisitor<T>
+{
+public:
+	MMIOWriteCodeGenerator(Gen::X64CodeBlock* code, BitSet32 registers_in_use, Gen::OpArg src,
+		u32 address)
+		: m_code(code), m_registers_in_use(registers_in_use), m_src(src), m_address(address)
+	{
+	}
+
+	void VisitNop() override
+	{
+		// Nothing to do: the write is dropped on the floor.
+	}
+
+	void VisitDirect(T* addr, u32 mask) override { WriteRegToAddr(8 * sizeof(T), addr, mask); }
+	void VisitComplex(const std::function<void(u32, T)>* lambda) override
+	{
+		CallLambda(8 * sizeof(T), lambda);
+	}
+
+private:
+	void WriteRegToAddr(int sbits, T* addr, u32 mask)
+	{
+		u32 all_ones = (1ULL << sbits) - 1;
+		if (m_src.IsImm())
+		{
+			// The mask can be folded into the immediate directly.
+			Gen::OpArg src = m_src;
+			if ((all_ones & mask) != all_ones)
+			{
+				switch (sbits)
+				{
+				case 8:
+					src = Gen::Imm8(m_src.Imm8() & mask);
+					break;
+				case 16:
+					src = Gen::Imm16(m_src.Imm16() & mask);
+					break;
+				default:
+					src = Gen::Imm32(m_src.Imm32() & mask);
+					break;
+				}
+			}
+			m_code->MOV(64, R(RSCRATCH2), ImmPtr(addr));
+			m_code->MOV(sbits, MatR(RSCRATCH2), src);
+		}
+		else
+		{
+			// Grab the value before loading the pointer, in case the source
+			// register is one of our scratch registers.
+			m_code->MOV(32, R(RSCRATCH), m_src);
+			if ((all_ones & mask) != all_ones)
+				m_code->AND(32, R(RSCRATCH), Gen::Imm32(mask));
+			m_code->MOV(64, R(RSCRATCH2), ImmPtr(addr));
+			m_code->MOV(sbits, MatR(RSCRATCH2), R(RSCRATCH));
+		}
+	}
+
+	void CallLambda(int sbits, const std::function<void(u32, T)>* lambda)
+	{
+		m_code->ABI_PushRegistersAndAdjustStack(m_registers_in_use, 0);
+		// Count writes which could not be inlined, so it stays visible which
+		// registers keep taking the generic dispatch path. Careful not to
+		// clobber the register holding the value to write.
+		Gen::X64Reg scratch = m_src.IsSimpleReg(RSCRATCH) ? RSCRATCH2 : RSCRATCH;
+		m_code->MOV(64, R(scratch), ImmPtr(MMIO::GetGenericDispatchCounter(m_address)));
+		m_code->ADD(64, MatR(scratch), Gen::Imm8(1));
+		m_code->ABI_CallLambdaCA(sbits, lambda, m_address, m_src);
+		m_code->ABI_PopRegistersAndAdjustStack(m_registers_in_use, 0);
+	}
+
+	Gen::X64CodeBlock* m_code;
+	BitSet32 m_registers_in_use;
+	Gen::OpArg m_src;
+	u32 m_address;
+};
+
 void EmuCodeBlock::MMIOLoadToReg(MMIO::Mapping* mmio, Gen::X64Reg reg_value,
 	BitSet32 registers_in_use, u32 address, int access_size,
 	bool sign_extend)
@@ -330,6 +402,32 @@ void EmuCodeBlock::MMIOLoadToReg(MMIO::Mapping* mmio, Gen::X64Reg reg_value,
 	}
 }
 
+void EmuCodeBlock::MMIOWriteRegToAddr(MMIO::Mapping* mmio, Gen::OpArg arg,
+	BitSet32 registers_in_use, u32 address, int access_size)
+{
+	switch (access_size)
+	{
+	case 8:
+	{
+		MMIOWriteCodeGenerator<u8> gen(this, registers_in_use, arg, address);
+		mmio->GetHandlerForWrite<u8>(address).Visit(gen);
+		break;
+	}
+	case 16:
+	{
+		MMIOWriteCodeGenerator<u16> gen(this, registers_in_use, arg, address);
+		mmio->GetHandlerForWrite<u16>(address).Visit(gen);
+		break;
+	}
+	case 32:
+	{
+		MMIOWriteCodeGenerator<u32> gen(this, registers_in_use, arg, address);
+		mmio->GetHandlerForWrite<u32>(address).Visit(gen);
+		break;
+	}
+	}
+}
+
 void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress, int accessSize,
 	s32 offset, BitSet32 registersInUse, bool signExtend, int flags)
 {
@@ -632,6 +730,16 @@ bool EmuCodeBlock::WriteToConstAddress(int accessSize, OpArg arg, u32 address,
 	}
 	else
 	{
+		// If the address maps to an MMIO register, inline the MMIO write code
+		// instead of calling through the dispatcher.
+		u32 mmioAddress = PowerPC::IsOptimizableMMIOAccess(address, accessSize);
+		if (accessSize != 64 && mmioAddress)
+		{
+			MMIOWriteRegToAddr(Memory::mmio_mapping.get(), arg, registersInUse, mmioAddress,
+				accessSize);
+			return false;
+		}
+
 		// Helps external systems know which instruction triggered the write
 		MOV(32, PPCSTATE(pc), Imm32(g_jit->js.compilerPC));
 
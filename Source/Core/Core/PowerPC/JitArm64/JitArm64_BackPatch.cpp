@@ -91,6 +91,11 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, bool fastmem, bool do_farcode, AR
 				m_float_emit.LDR(32, EncodeRegToDouble(RS), MEM_REG, addr);
 				m_float_emit.REV32(8, EncodeRegToDouble(RS), EncodeRegToDouble(RS));
 			}
+			else if (flags & BackPatchInfo::FLAG_SIZE_F32X2)
+			{
+				m_float_emit.LDR(64, EncodeRegToDouble(RS), MEM_REG, addr);
+				m_float_emit.REV32(8, EncodeRegToDouble(RS), EncodeRegToDouble(RS));
+			}
 			else
 			{
 				m_float_emit.LDR(64, EncodeRegToDouble(RS), MEM_REG, addr);
@@ -222,6 +227,15 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, bool fastmem, bool do_farcode, AR
 				BLR(X30);
 				m_float_emit.INS(32, RS, 0, X0);
 			}
+			else if (flags & BackPatchInfo::FLAG_SIZE_F32X2)
+			{
+				MOVP2R(X30, &PowerPC::Read_U64);
+				BLR(X30);
+				// Read_U64 returns the first word in the upper half; rotate it
+				// down so the lanes come out in guest order.
+				ORR(X0, SP, X0, ArithOption(X0, ST_ROR, 32));
+				m_float_emit.INS(64, RS, 0, X0);
+			}
 			else
 			{
 				MOVP2R(X30, &PowerPC::Read_F64);
@@ -64,16 +64,23 @@ void JitArm64::psq_l(UGeckoInstruction inst)
 	if (js.assumeNoPairedQuantize)
 	{
 		VS = fpr.RW(inst.RS, REG_REG_SINGLE);
-		if (!inst.W)
-		{
-			ADD(EncodeRegTo64(addr_reg), EncodeRegTo64(addr_reg), MEM_REG);
-			m_float_emit.LD1(32, 1, EncodeRegToDouble(VS), EncodeRegTo64(addr_reg));
-		}
-		else
-		{
-			m_float_emit.LDR(32, VS, EncodeRegTo64(addr_reg), MEM_REG);
-		}
-		m_float_emit.REV32(8, EncodeRegToDouble(VS), EncodeRegToDouble(VS));
+
+		BitSet32 gprs_in_use = gpr.GetCallerSavedUsed();
+		BitSet32 fprs_in_use = fpr.GetCallerSavedUsed();
+
+		// Wipe the registers we are using as temporaries
+		gprs_in_use &= BitSet32(~7);
+		fprs_in_use &= BitSet32(~3);
+		fprs_in_use[VS - Q0] = 0;
+
+		u32 flags = BackPatchInfo::FLAG_LOAD |
+			(inst.W ? BackPatchInfo::FLAG_SIZE_F32 : BackPatchInfo::FLAG_SIZE_F32X2);
+
+		// Going through the backpatch routine registers the access as a fastmem
+		// area, so a fault here gets rewritten to the slowmem handler instead of
+		// taking the whole emulator down.
+		EmitBackpatchRoutine(flags, jo.fastmem, jo.fastmem, VS, EncodeRegTo64(addr_reg), gprs_in_use,
+			fprs_in_use);
 	}
 	else
 	{
@@ -47,5 +47,13 @@ void JitBase::UpdateMemoryOptions()
 {
 	bool any_watchpoints = PowerPC::memchecks.HasAny();
 	jo.fastmem = SConfig::GetInstance().bFastmem && (UReg_MSR(MSR).DR || !any_watchpoints);
-	jo.memcheck = SConfig::GetInstance().bMMU || any_watchpoints;
+	// With fastmem, watchpoints are enforced through page protection instead
+	// of per-access checks: pages overlapping a memcheck lose their
+	// BAT_PHYSICAL_BIT (see UpdateBATs), so they are never mapped into the
+	// logical region and every fastmem access to them faults. The fault
+	// handler backpatches that one access site to the slow path, which
+	// evaluates the memchecks; all other pages keep the single-instruction
+	// fastmem path. Only fall back to compiling every access with memcheck
+	// support when there is no fastmem to take the fault.
+	jo.memcheck = SConfig::GetInstance().bMMU || (any_watchpoints && !jo.fastmem);
 }
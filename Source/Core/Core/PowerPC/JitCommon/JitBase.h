@@ -99,6 +99,11 @@ protected:
 		std::unordered_set<u32> fifoWriteAddresses;
 		std::unordered_set<u32> pairedQuantizeAddresses;
 		std::unordered_set<u32> noSpeculativeConstantsAddresses;
+		// Blocks which ran often enough in their baseline form to deserve a
+		// recompile with the full set of optimization passes. Like the
+		// speculative constants set, this survives cache clears so re-learned
+		// hotness isn't thrown away.
+		std::unordered_set<u32> hotBlockAddresses;
 	};
 
 	PPCAnalyst::CodeBlock code_block;
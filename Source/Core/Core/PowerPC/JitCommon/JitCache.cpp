@@ -15,10 +15,13 @@
 #include <utility>
 
 #include "Common/CommonTypes.h"
+#include "Common/EventTrace.h"
 #include "Common/JitRegister.h"
+#include "Common/Logging/Log.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
+#include "Core/PowerPC/JitCommon/JitDiskCache.h"
 #include "Core/PowerPC/PowerPC.h"
 
 #ifdef _WIN32
@@ -27,6 +30,14 @@
 
 using namespace Gen;
 
+// Tunables for the one-time hot-block relayout (see RelayoutBlocks).
+// Settling is polled from the slow dispatch path; a poll window in which
+// fewer than RELAYOUT_SETTLE_DELTA new blocks were compiled means the title
+// has warmed up.
+static constexpr u32 RELAYOUT_POLL_INTERVAL = 0x4000;
+static constexpr u32 RELAYOUT_MIN_BLOCKS = 512;
+static constexpr u32 RELAYOUT_SETTLE_DELTA = 32;
+
 bool JitBlock::OverlapsPhysicalRange(u32 address, u32 length) const
 {
   return physical_addresses.lower_bound(address) !=
@@ -43,11 +54,21 @@ void JitBaseBlockCache::Init()
 {
   JitRegister::Init(SConfig::GetInstance().m_perfDir);
 
+  m_relayout_done = false;
+  m_in_relayout = false;
+  m_compile_count = 0;
+  m_settled_compile_count = 0;
+  m_dispatch_poll = 0;
+
   Clear();
+
+  JitDiskCache::Load(m_jit);
 }
 
 void JitBaseBlockCache::Shutdown()
 {
+  JitDiskCache::Save(m_jit);
+
   JitRegister::Shutdown();
 }
 
@@ -58,6 +79,7 @@ void JitBaseBlockCache::Clear()
 #if defined(_DEBUG) || defined(DEBUGFAST)
   Core::DisplayMessage("Clearing code cache.", 3000);
 #endif
+  m_pending_invalidations.clear();
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
   for (auto& e : block_map)
@@ -71,6 +93,7 @@ void JitBaseBlockCache::Clear()
   valid_block.ClearAll();
 
   fast_block_map.fill(nullptr);
+  hot_block_map.fill(nullptr);
 }
 
 void JitBaseBlockCache::Reset()
@@ -84,6 +107,11 @@ JitBlock** JitBaseBlockCache::GetFastBlockMap()
   return fast_block_map.data();
 }
 
+JitBlock** JitBaseBlockCache::GetHotBlockMap()
+{
+  return hot_block_map.data();
+}
+
 void JitBaseBlockCache::RunOnBlocks(std::function<void(const JitBlock&)> f)
 {
   for (const auto& e : block_map)
@@ -92,6 +120,9 @@ void JitBaseBlockCache::RunOnBlocks(std::function<void(const JitBlock&)> f)
 
 JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
 {
+  // Never compile over a range with destruction still queued.
+  FlushPendingInvalidations();
+
   u32 physicalAddress = PowerPC::JitCache_TranslateAddress(em_address).address;
   JitBlock& b = block_map.emplace(physicalAddress, JitBlock())->second;
   b.effectiveAddress = em_address;
@@ -99,6 +130,7 @@ JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
   b.msrBits = MSR & JIT_CACHE_MSR_MASK;
   b.linkData.clear();
   b.fast_block_map_index = 0;
+  b.hot_block_map_index = 0;
   return &b;
 }
 
@@ -109,6 +141,10 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   fast_block_map[index] = &block;
   block.fast_block_map_index = index;
 
+  // A block is compiled because the dispatcher is about to run it, so it is
+  // by definition a hot target right now.
+  MoveBlockIntoHotCache(&block);
+
   block.physical_addresses = physical_addresses;
 
   u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
@@ -129,10 +165,16 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   }
 
   JitRegister::Register(block.checkedEntry, block.codeSize, "JIT_PPC_%08x", block.physicalAddress);
+
+  m_compile_count++;
 }
 
 JitBlock* JitBaseBlockCache::GetBlockFromStartAddress(u32 addr, u32 msr)
 {
+  // Host-side lookups (debugger, profiler) must not see blocks with
+  // destruction still queued.
+  FlushPendingInvalidations();
+
   u32 translated_addr = addr;
   if (UReg_MSR(msr).IR)
   {
@@ -157,6 +199,14 @@ JitBlock* JitBaseBlockCache::GetBlockFromStartAddress(u32 addr, u32 msr)
 
 const u8* JitBaseBlockCache::Dispatch()
 {
+  FlushPendingInvalidations();
+
+  if (!m_relayout_done && !m_in_relayout && ++m_dispatch_poll >= RELAYOUT_POLL_INTERVAL)
+  {
+    m_dispatch_poll = 0;
+    CheckRelayout();
+  }
+
   JitBlock* block = fast_block_map[FastLookupIndexForAddress(PC)];
 
   if (!block || block->effectiveAddress != PC || block->msrBits != (MSR & JIT_CACHE_MSR_MASK))
@@ -165,44 +215,111 @@ const u8* JitBaseBlockCache::Dispatch()
   if (!block)
     return nullptr;
 
+  // The assembly dispatcher only reads the hot table, so a block reached
+  // through this slow path would keep missing the first-level probe until
+  // it is promoted here.
+  MoveBlockIntoHotCache(block);
+
   return block->normalEntry;
 }
 
 void JitBaseBlockCache::InvalidateICache(u32 address, u32 length, bool forced)
 {
+  // Running total; a climbing graph in the trace viewer points at games
+  // thrashing the JIT cache.
+  static u64 s_invalidation_count = 0;
+  TRACE_COUNTER("jit icache invalidations", ++s_invalidation_count);
+
   auto translated = PowerPC::JitCache_TranslateAddress(address);
   if (!translated.valid)
     return;
   u32 pAddr = translated.address;
 
-  // Optimize the common case of length == 32 which is used by Interpreter::dcb*
-  bool destroy_block = true;
-  if (length == 32)
+  // Check the valid-block bitmap before walking any block map: games which
+  // stream code invalidate far more ranges than ever held compiled blocks,
+  // and the 32-byte-granular bits cover arbitrary lengths, not just the
+  // dcb* case. Bits inside the range can be cleared eagerly because every
+  // block overlapping the range is destroyed below.
+  bool destroy_block = false;
+  if (length > 0)
   {
-    if (!valid_block.Test(pAddr / 32))
-      destroy_block = false;
-    else
-      valid_block.Clear(pAddr / 32);
+    const u32 end_chunk = (pAddr + length - 1) / 32;
+    for (u32 chunk = pAddr / 32; chunk <= end_chunk; chunk++)
+    {
+      if (valid_block.Test(chunk))
+      {
+        destroy_block = true;
+        valid_block.Clear(chunk);
+      }
+    }
+  }
+
+  if (!destroy_block)
+    return;
+
+  // Invalidations which actually hit compiled code are the expensive ones;
+  // comparing this counter against the one above shows how often the
+  // bitmap check short-circuits the map walk.
+  static u64 s_destroy_count = 0;
+  TRACE_COUNTER("jit icache block destructions", ++s_destroy_count);
+
+  // Queue the block destruction instead of walking the maps per call. Games
+  // that stream code invalidate bursts of adjacent cachelines; merging a
+  // burst into one range and unlinking at the next dispatcher boundary turns
+  // thousands of map walks into one. Deferring is safe because modified code
+  // cannot run again without crossing the dispatcher first: the dispatch
+  // tables are dropped below, so every lookup takes the slow path (which
+  // flushes the queue), and making new code reachable through an existing
+  // block link requires an icbi, which ends the block (FL_ENDBLOCK) and
+  // re-enters the dispatcher.
+  if (m_pending_invalidations.empty())
+  {
+    // Drop the dispatch tables so no stale block is reachable through them
+    // while the queue is pending. Wholesale is cheaper than precise here:
+    // finding the affected slots is exactly the map walk being deferred.
+    fast_block_map.fill(nullptr);
+    hot_block_map.fill(nullptr);
   }
+  for (PendingInvalidation& p : m_pending_invalidations)
+  {
+    if (p.forced == forced && pAddr <= p.physical_end && p.physical_start <= pAddr + length)
+    {
+      p.physical_start = std::min(p.physical_start, pAddr);
+      p.physical_end = std::max(p.physical_end, pAddr + length);
+      p.effective_start = std::min(p.effective_start, address);
+      p.effective_end = std::max(p.effective_end, address + length);
+      return;
+    }
+  }
+  if (m_pending_invalidations.size() >= MAX_PENDING_INVALIDATIONS)
+    FlushPendingInvalidations();
+  m_pending_invalidations.push_back({pAddr, pAddr + length, address, address + length, forced});
+}
+
+void JitBaseBlockCache::FlushPendingInvalidations()
+{
+  if (m_pending_invalidations.empty())
+    return;
 
-  if (destroy_block)
+  for (const PendingInvalidation& p : m_pending_invalidations)
   {
     // destroy JIT blocks
-    ErasePhysicalRange(pAddr, length);
+    ErasePhysicalRange(p.physical_start, p.physical_end - p.physical_start);
 
     // If the code was actually modified, we need to clear the relevant entries from the
     // FIFO write address cache, so we don't end up with FIFO checks in places they shouldn't
     // be (this can clobber flags, and thus break any optimization that relies on flags
     // being in the right place between instructions).
-    if (!forced)
+    if (!p.forced)
     {
-      for (u32 i = address; i < address + length; i += 4)
+      for (u32 i = p.effective_start; i < p.effective_end; i += 4)
       {
         m_jit.js.fifoWriteAddresses.erase(i);
         m_jit.js.pairedQuantizeAddresses.erase(i);
       }
     }
   }
+  m_pending_invalidations.clear();
 }
 
 void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
@@ -329,6 +446,8 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
 {
   if (fast_block_map[block.fast_block_map_index] == &block)
     fast_block_map[block.fast_block_map_index] = nullptr;
+  if (hot_block_map[block.hot_block_map_index] == &block)
+    hot_block_map[block.hot_block_map_index] = nullptr;
 
   UnlinkBlock(block);
 
@@ -349,6 +468,93 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
   WriteDestroyBlock(block);
 }
 
+// Decide whether the title has warmed up: enough blocks compiled overall,
+// and the compile rate dropped to a trickle since the previous poll window.
+void JitBaseBlockCache::CheckRelayout()
+{
+  if (SConfig::GetInstance().bJITNoBlockCache || SConfig::GetInstance().bEnableDebugging)
+  {
+    m_relayout_done = true;
+    return;
+  }
+
+  const u32 newly_compiled = m_compile_count - m_settled_compile_count;
+  m_settled_compile_count = m_compile_count;
+  if (m_compile_count < RELAYOUT_MIN_BLOCKS || newly_compiled > RELAYOUT_SETTLE_DELTA)
+    return;
+
+  RelayoutBlocks();
+}
+
+// Blocks land in the code region in compile order, so after minutes of play
+// the hot set is scattered across it and thrashes the host icache. This
+// clears the cache once and recompiles the hot blocks back to back, each
+// followed depth-first by the exits it usually jumps to, packing the steady
+// state into a few contiguous pages. Blocks are recompiled rather than
+// relocated because emitted code holds RIP-relative references (far code,
+// trampolines, constants) which cannot be moved safely.
+void JitBaseBlockCache::RelayoutBlocks()
+{
+  const u32 msr_bits = MSR & JIT_CACHE_MSR_MASK;
+
+  // The hot set: with tiered compilation the promoted addresses, otherwise
+  // every block which still owns its dispatcher slot (i.e. ran recently).
+  std::map<u32, std::vector<u32>> hot_blocks;  // address -> exit addresses
+  for (const JitBlock* b : fast_block_map)
+  {
+    if (!b || b->msrBits != msr_bits)
+      continue;
+    if (!m_jit.js.hotBlockAddresses.empty() &&
+        m_jit.js.hotBlockAddresses.find(b->effectiveAddress) == m_jit.js.hotBlockAddresses.end())
+      continue;
+    std::vector<u32>& exits = hot_blocks[b->effectiveAddress];
+    for (const JitBlock::LinkData& e : b->linkData)
+      exits.push_back(e.exitAddress);
+  }
+
+  // Chain blocks depth-first along the link graph so each block is laid out
+  // next to the successor it exits to.
+  std::vector<u32> order;
+  order.reserve(hot_blocks.size());
+  std::set<u32> visited;
+  std::vector<u32> stack;
+  for (const auto& seed : hot_blocks)
+  {
+    stack.push_back(seed.first);
+    while (!stack.empty())
+    {
+      const u32 address = stack.back();
+      stack.pop_back();
+      const auto it = hot_blocks.find(address);
+      if (it == hot_blocks.end() || !visited.insert(address).second)
+        continue;
+      order.push_back(address);
+      // Push exits in reverse so the first exit (the common fallthrough)
+      // is compiled immediately after its predecessor.
+      for (auto e = it->second.rbegin(); e != it->second.rend(); ++e)
+        stack.push_back(*e);
+    }
+  }
+
+  m_in_relayout = true;
+  m_jit.ClearCache();
+  for (u32 address : order)
+  {
+    // The address must still translate (Jit would raise a guest ISI for a
+    // PC we are not actually at), and branch following may already have
+    // covered it through an earlier block in this loop.
+    if (!PowerPC::JitCache_TranslateAddress(address).valid)
+      continue;
+    if (!GetBlockFromStartAddress(address, MSR))
+      m_jit.Jit(address);
+  }
+  m_in_relayout = false;
+  m_relayout_done = true;
+
+  INFO_LOG(DYNA_REC, "Relaid out %u hot blocks contiguously by link affinity",
+           static_cast<u32>(order.size()));
+}
+
 JitBlock* JitBaseBlockCache::MoveBlockIntoFastCache(u32 addr, u32 msr)
 {
   JitBlock* block = GetBlockFromStartAddress(addr, msr);
@@ -368,7 +574,24 @@ JitBlock* JitBaseBlockCache::MoveBlockIntoFastCache(u32 addr, u32 msr)
   return block;
 }
 
+void JitBaseBlockCache::MoveBlockIntoHotCache(JitBlock* block)
+{
+  // Drop old hot block map entry
+  if (hot_block_map[block->hot_block_map_index] == block)
+    hot_block_map[block->hot_block_map_index] = nullptr;
+
+  // And create a new one
+  size_t index = HotLookupIndexForAddress(block->effectiveAddress);
+  hot_block_map[index] = block;
+  block->hot_block_map_index = index;
+}
+
 size_t JitBaseBlockCache::FastLookupIndexForAddress(u32 address)
 {
   return (address >> 2) & FAST_BLOCK_MAP_MASK;
 }
+
+size_t JitBaseBlockCache::HotLookupIndexForAddress(u32 address)
+{
+  return (address >> 2) & HOT_BLOCK_MAP_MASK;
+}
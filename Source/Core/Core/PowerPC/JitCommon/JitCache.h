@@ -74,6 +74,9 @@ struct JitBlock
   // This tracks the position if this block within the fast block cache.
   // We allow each block to have only one map entry.
   size_t fast_block_map_index;
+
+  // Likewise for the small hot block map probed first by the dispatcher.
+  size_t hot_block_map_index;
 };
 
 typedef void (*CompiledCode)();
@@ -118,6 +121,14 @@ public:
   static constexpr u32 FAST_BLOCK_MAP_ELEMENTS = 0x10000;
   static constexpr u32 FAST_BLOCK_MAP_MASK = FAST_BLOCK_MAP_ELEMENTS - 1;
 
+  // The first level of the dispatcher lookup. fast_block_map is half a
+  // megabyte of pointers, so probing it misses L2 regularly once the guest
+  // working set grows; this table is small enough to stay resident in L1
+  // and catches the few hundred targets the dispatcher actually cycles
+  // through. 0x200 entries * 8 bytes = 4KiB.
+  static constexpr u32 HOT_BLOCK_MAP_ELEMENTS = 0x200;
+  static constexpr u32 HOT_BLOCK_MAP_MASK = HOT_BLOCK_MAP_ELEMENTS - 1;
+
   explicit JitBaseBlockCache(JitBase& jit);
   virtual ~JitBaseBlockCache();
 
@@ -128,6 +139,7 @@ public:
 
   // Code Cache
   JitBlock** GetFastBlockMap();
+  JitBlock** GetHotBlockMap();
   void RunOnBlocks(std::function<void(const JitBlock&)> f);
 
   JitBlock* AllocateBlock(u32 em_address);
@@ -145,6 +157,10 @@ public:
   const u8* Dispatch();
 
   void InvalidateICache(u32 address, u32 length, bool forced);
+  // Applies invalidations queued by InvalidateICache. Runs on every slow
+  // dispatch and before block allocation or lookup; see the comment in
+  // InvalidateICache for why deferring to these points is safe.
+  void FlushPendingInvalidations();
   void ErasePhysicalRange(u32 address, u32 length);
 
   u32* GetBlockBitSet() const;
@@ -156,15 +172,23 @@ private:
   virtual void WriteLinkBlock(const JitBlock::LinkData& source, const JitBlock* dest) = 0;
   virtual void WriteDestroyBlock(const JitBlock& block);
 
+  // Profile-guided block layout: once compilation has settled after warm-up,
+  // the hot blocks are recompiled back to back in link-graph order so the
+  // host icache working set shrinks. Runs once per Init; see RelayoutBlocks.
+  void CheckRelayout();
+  void RelayoutBlocks();
+
   void LinkBlockExits(JitBlock& block);
   void LinkBlock(JitBlock& block);
   void UnlinkBlock(const JitBlock& block);
   void DestroyBlock(JitBlock& block);
 
   JitBlock* MoveBlockIntoFastCache(u32 em_address, u32 msr);
+  void MoveBlockIntoHotCache(JitBlock* block);
 
   // Fast but risky block lookup based on fast_block_map.
   size_t FastLookupIndexForAddress(u32 address);
+  size_t HotLookupIndexForAddress(u32 address);
 
   // links_to hold all exit points of all valid blocks in a reverse way.
   // It is used to query all blocks which links to an address.
@@ -187,4 +211,30 @@ private:
   // This array is indexed with the masked PC and likely holds the correct block id.
   // This is used as a fast cache of block_map used in the assembly dispatcher.
   std::array<JitBlock*, FAST_BLOCK_MAP_ELEMENTS> fast_block_map;  // start_addr & mask -> number
+
+  // The L1-resident first level of the above, probed first by the assembly
+  // dispatcher. Aliasing is heavy at this size, but every hit is verified
+  // against the block's effective address and MSR bits just like the big
+  // table, so a stale or aliased entry only costs the second probe.
+  std::array<JitBlock*, HOT_BLOCK_MAP_ELEMENTS> hot_block_map;
+
+  // Deferred invalidation queue; entries are merged ranges of pending block
+  // destruction, applied by FlushPendingInvalidations. See InvalidateICache.
+  struct PendingInvalidation
+  {
+    u32 physical_start;
+    u32 physical_end;  // exclusive
+    u32 effective_start;
+    u32 effective_end;  // exclusive
+    bool forced;
+  };
+  static constexpr size_t MAX_PENDING_INVALIDATIONS = 8;
+  std::vector<PendingInvalidation> m_pending_invalidations;
+
+  // State for the one-time hot-block relayout.
+  bool m_relayout_done = false;
+  bool m_in_relayout = false;
+  u32 m_compile_count = 0;
+  u32 m_settled_compile_count = 0;
+  u32 m_dispatch_poll = 0;
 };
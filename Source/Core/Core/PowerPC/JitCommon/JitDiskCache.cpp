@@ -0,0 +1,131 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/PowerPC/JitCommon/JitDiskCache.h"
+
+#include <string>
+#include <unordered_set>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/LinearDiskCache.h"
+#include "Common/StringUtil.h"
+#include "Core/ConfigManager.h"
+#include "Core/PowerPC/JitCommon/JitBase.h"
+
+namespace JitDiskCache
+{
+namespace
+{
+enum class SetId : u32
+{
+	FIFOWrite,
+	PairedQuantize,
+	NoSpeculativeConstants,
+	HotBlock
+};
+
+struct CacheKey
+{
+	u32 address;
+	u32 set;
+};
+
+LinearDiskCache<CacheKey, u8> s_disk_cache;
+// Entries already present on disk, so Save() doesn't append them again.
+std::unordered_set<u64> s_entries_on_disk;
+bool s_cache_open = false;
+
+u64 EntryId(const CacheKey& key)
+{
+	return static_cast<u64>(key.set) << 32 | key.address;
+}
+
+std::unordered_set<u32>* SetForId(JitBase& jit, u32 set)
+{
+	switch (static_cast<SetId>(set))
+	{
+	case SetId::FIFOWrite:
+		return &jit.js.fifoWriteAddresses;
+	case SetId::PairedQuantize:
+		return &jit.js.pairedQuantizeAddresses;
+	case SetId::NoSpeculativeConstants:
+		return &jit.js.noSpeculativeConstantsAddresses;
+	case SetId::HotBlock:
+		return &jit.js.hotBlockAddresses;
+	}
+	return nullptr;
+}
+
+class CacheReader : public LinearDiskCacheReader<CacheKey, u8>
+{
+public:
+	explicit CacheReader(JitBase& jit) : m_jit(jit) {}
+	void Read(const CacheKey& key, const u8* value, u32 value_size) override
+	{
+		std::unordered_set<u32>* set = SetForId(m_jit, key.set);
+		if (set)
+		{
+			set->insert(key.address);
+			s_entries_on_disk.insert(EntryId(key));
+		}
+	}
+
+private:
+	JitBase& m_jit;
+};
+
+void AppendSet(JitBase& jit, SetId id)
+{
+	for (u32 address : *SetForId(jit, static_cast<u32>(id)))
+	{
+		CacheKey key;
+		key.address = address;
+		key.set = static_cast<u32>(id);
+		if (s_entries_on_disk.insert(EntryId(key)).second)
+		{
+			u8 dummy = 0;
+			s_disk_cache.Append(key, &dummy, 0);
+		}
+	}
+}
+}
+
+void Load(JitBase& jit)
+{
+	if (s_cache_open)
+		return;
+
+	const std::string& game_id = SConfig::GetInstance().GetGameID();
+	if (game_id.empty())
+		return;
+
+	if (!File::Exists(File::GetUserPath(D_CACHE_IDX)))
+		File::CreateDir(File::GetUserPath(D_CACHE_IDX));
+
+	std::string filename =
+		StringFromFormat("%s%s-jit.cache", File::GetUserPath(D_CACHE_IDX).c_str(), game_id.c_str());
+
+	s_entries_on_disk.clear();
+	CacheReader reader(jit);
+	s_disk_cache.OpenAndRead(filename, reader);
+	s_cache_open = true;
+}
+
+void Save(JitBase& jit)
+{
+	if (!s_cache_open)
+		return;
+
+	AppendSet(jit, SetId::FIFOWrite);
+	AppendSet(jit, SetId::PairedQuantize);
+	AppendSet(jit, SetId::NoSpeculativeConstants);
+	AppendSet(jit, SetId::HotBlock);
+
+	s_disk_cache.Sync();
+	s_disk_cache.Close();
+	s_entries_on_disk.clear();
+	s_cache_open = false;
+}
+}
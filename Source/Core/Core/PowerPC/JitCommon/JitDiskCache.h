@@ -0,0 +1,22 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+class JitBase;
+
+// Persists the JIT respecialization sets (FIFO write sites, paired-quantize
+// bailouts, failed speculative constants, hot blocks) to disk, keyed by game
+// ID. Each entry in these sets normally has to be rediscovered by compiling a
+// block, faulting and recompiling it, so reloading them at boot lets warm
+// starts skip most of the first-minutes compile storm.
+//
+// The generated machine code itself is not serialized: blocks embed host
+// pointers (far code, trampolines, constant pool), so stored code would not
+// be valid in a new address space.
+namespace JitDiskCache
+{
+void Load(JitBase& jit);
+void Save(JitBase& jit);
+}
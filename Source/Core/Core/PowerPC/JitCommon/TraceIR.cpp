@@ -0,0 +1,221 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <map>
+#include <tuple>
+
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/JitCommon/TraceIR.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+#include "Core/PowerPC/PPCTables.h"
+
+namespace JitTrace
+{
+namespace
+{
+// Expression kinds for value numbering. The IR never materializes nodes; an
+// expression is just its kind plus the value numbers of its operands, and two
+// computations with equal keys produce equal guest values.
+enum ExprKind : u32
+{
+	EXPR_ADDI,  // a + signed imm; also the effective address of d-form memory ops
+	EXPR_ADDIS,
+	EXPR_ADD,
+	EXPR_ORI,
+	EXPR_ORIS,
+	EXPR_RLWINM,
+	EXPR_LOAD32,  // the 32-bit memory value at (addr_vn, mem_generation)
+};
+
+// Sentinel operand for the hardwired zero of rA == 0 forms (li/lis and
+// r0-less effective addresses).
+constexpr u32 VN_ZERO_OPERAND = 0xFFFFFFFF;
+
+struct TraceState
+{
+	u32 next_vn = 0;
+	u32 gpr_vn[32];
+	// Bumped by anything that may write guest memory; invalidates all EXPR_LOAD32
+	// expressions since we make no attempt to disambiguate stores.
+	u32 mem_generation = 0;
+	std::map<std::tuple<u32, u32, u32, u32>, u32> exprs;
+
+	TraceState()
+	{
+		for (u32& vn : gpr_vn)
+			vn = next_vn++;
+	}
+
+	u32 FreshVN() { return next_vn++; }
+	u32 ExprVN(u32 kind, u32 a, u32 b, u32 imm)
+	{
+		auto result = exprs.emplace(std::make_tuple(kind, a, b, imm), next_vn);
+		if (result.second)
+			next_vn++;
+		return result.first->second;
+	}
+
+	// Effective address of a d-form load/store (or equivalently the result of
+	// addi), so address recomputations and memory ops share value numbers.
+	u32 AddrVN(UGeckoInstruction inst)
+	{
+		const u32 base = inst.RA ? gpr_vn[inst.RA] : VN_ZERO_OPERAND;
+		return ExprVN(EXPR_ADDI, base, 0, (u32)(s32)inst.SIMM_16);
+	}
+};
+
+bool IsCR0OnlyCompare(UGeckoInstruction inst)
+{
+	if (inst.CRFD != 0)
+		return false;
+	if (inst.OPCD == 10 || inst.OPCD == 11)  // cmplwi, cmpwi
+		return true;
+	if (inst.OPCD == 31 && (inst.SUBOP10 == 0 || inst.SUBOP10 == 32))  // cmpw, cmplw
+		return true;
+	return false;
+}
+
+// Whether an op leaves guest memory untouched, so remembered load values stay
+// valid across it. Anything not provably read-only kills them.
+bool PreservesMemory(const GekkoOPInfo* opinfo)
+{
+	switch (opinfo->type)
+	{
+	case OPTYPE_INTEGER:
+	case OPTYPE_CR:
+	case OPTYPE_SPR:
+	case OPTYPE_LOAD:
+	case OPTYPE_LOADFP:
+	case OPTYPE_LOADPS:
+	case OPTYPE_DOUBLEFP:
+	case OPTYPE_SINGLEFP:
+	case OPTYPE_PS:
+	case OPTYPE_BRANCH:
+		return true;
+	default:
+		return false;
+	}
+}
+}  // Anonymous namespace
+
+u32 OptimizeTrace(PPCAnalyst::CodeOp* code, u32 num_ops)
+{
+	TraceState state;
+	u32 eliminated = 0;
+
+	for (u32 i = 0; i < num_ops; i++)
+	{
+		PPCAnalyst::CodeOp& op = code[i];
+		if (op.skip)
+			continue;
+		const UGeckoInstruction inst = op.inst;
+
+		// Dead compare elimination. wantsCR0 already treats every potential
+		// block exit as a CR0 reader, so this only fires when a later compare
+		// in the trace unconditionally overwrites the result.
+		if (IsCR0OnlyCompare(inst) && !op.wantsCR0)
+		{
+			op.skip = true;
+			eliminated++;
+			continue;
+		}
+
+		// Pure integer computations: value-number the result, and drop the op
+		// when the destination register provably already holds it. None of
+		// these touch carry; the only flag concern is Rc on add/rlwinm.
+		bool computed = false;
+		u32 result_vn = 0;
+		bool rc = false;
+		switch (inst.OPCD)
+		{
+		case 14:  // addi
+			result_vn = state.AddrVN(inst);
+			computed = true;
+			break;
+		case 15:  // addis
+			result_vn = state.ExprVN(EXPR_ADDIS, inst.RA ? state.gpr_vn[inst.RA] : VN_ZERO_OPERAND, 0,
+				inst.SIMM_16);
+			computed = true;
+			break;
+		case 24:  // ori
+			result_vn = inst.UIMM == 0 ? state.gpr_vn[inst.RS] :
+				state.ExprVN(EXPR_ORI, state.gpr_vn[inst.RS], 0, inst.UIMM);
+			computed = true;
+			break;
+		case 25:  // oris
+			result_vn = state.ExprVN(EXPR_ORIS, state.gpr_vn[inst.RS], 0, inst.UIMM);
+			computed = true;
+			break;
+		case 21:  // rlwinm(.) - SH|MB|ME live in the low hex bits above Rc
+			result_vn = state.ExprVN(EXPR_RLWINM, state.gpr_vn[inst.RS], 0, inst.hex & 0xFFFE);
+			computed = true;
+			rc = inst.Rc;
+			break;
+		case 31:
+			if (inst.SUBOP10 == 266)  // add(.)
+			{
+				const u32 a = state.gpr_vn[inst.RA];
+				const u32 b = state.gpr_vn[inst.RB];
+				result_vn = state.ExprVN(EXPR_ADD, std::min(a, b), std::max(a, b), 0);
+				computed = true;
+				rc = inst.Rc;
+			}
+			break;
+		}
+		if (computed)
+		{
+			const u32 dest = inst.OPCD == 31 || inst.OPCD == 14 || inst.OPCD == 15 ? inst.RD : inst.RA;
+			if (state.gpr_vn[dest] == result_vn && !(rc && op.wantsCR0))
+			{
+				op.skip = true;
+				eliminated++;
+			}
+			else
+			{
+				state.gpr_vn[dest] = result_vn;
+			}
+			continue;
+		}
+
+		// Load-store and load-load forwarding for plain word accesses. A store
+		// defines the memory value for the new generation, so a reload whose
+		// target register still holds that value number is a no-op. We only
+		// ever skip stack-relative (r1) reloads: those are the ABI spill
+		// refills we are after, and unlike arbitrary pointers they cannot be
+		// MMIO, where dropping the access would be observable.
+		if (inst.OPCD == 36)  // stw
+		{
+			const u32 addr_vn = state.AddrVN(inst);
+			state.mem_generation++;
+			state.exprs[std::make_tuple(EXPR_LOAD32, addr_vn, state.mem_generation, 0)] =
+				state.gpr_vn[inst.RS];
+			continue;
+		}
+		if (inst.OPCD == 32)  // lwz
+		{
+			const u32 addr_vn = state.AddrVN(inst);
+			result_vn = state.ExprVN(EXPR_LOAD32, addr_vn, state.mem_generation, 0);
+			if (state.gpr_vn[inst.RD] == result_vn && inst.RA == 1)
+			{
+				op.skip = true;
+				eliminated++;
+			}
+			else
+			{
+				state.gpr_vn[inst.RD] = result_vn;
+			}
+			continue;
+		}
+
+		// Everything else: forget what we knew about its outputs.
+		for (int reg : op.regsOut)
+			state.gpr_vn[reg] = state.FreshVN();
+		if (!PreservesMemory(op.opinfo))
+			state.mem_generation++;
+	}
+	return eliminated;
+}
+
+}  // namespace JitTrace
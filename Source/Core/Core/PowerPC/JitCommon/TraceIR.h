@@ -0,0 +1,35 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+namespace PPCAnalyst
+{
+struct CodeOp;
+}
+
+// Trace-level redundancy elimination for hot superblocks. The analyzed
+// instruction stream of a superblock is a single-entry trace (any mid-block
+// branch only exits, it never rejoins), so we can run a straight-line value
+// numbering over it and drop instructions whose entire effect is already
+// present in the guest state:
+//
+//  - Common subexpression elimination on integer computations, aimed at the
+//    address arithmetic (addi/add/rlwinm/ori) which branch following tends to
+//    duplicate across inlined call boundaries.
+//  - Dead compare elimination for CR0-only compares, reusing the wantsCR0
+//    liveness that PPCAnalyst already computes.
+//  - Load-store and load-load forwarding: reloads of a value that provably
+//    still sits in the target register (ABI spill/refill pairs) are dropped.
+//
+// Everything is expressed by setting CodeOp::skip, so no backend changes are
+// needed; an op is only skipped when the destination register would receive a
+// value it already holds and no live flag output is lost.
+namespace JitTrace
+{
+// Returns the number of instructions eliminated from the trace.
+u32 OptimizeTrace(PPCAnalyst::CodeOp* code, u32 num_ops);
+}
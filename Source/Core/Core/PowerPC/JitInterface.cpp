@@ -93,16 +93,17 @@ void WriteProfileResults(const std::string& filename)
 		return;
 	}
 	fprintf(f.GetHandle(), "origAddr\tblkName\trunCount\tcost\ttimeCost\tpercent\ttimePercent\tOvAlli"
-		"nBlkTime(ms)\tblkCodeSize\n");
+		"nBlkTime(ms)\tblkCodeSize\tlinkedExits\ttotalExits\n");
 	for (auto& stat : prof_stats.block_stats)
 	{
 		std::string name = g_symbolDB.GetDescription(stat.addr);
 		double percent = 100.0 * (double)stat.cost / (double)prof_stats.cost_sum;
 		double timePercent = 100.0 * (double)stat.tick_counter / (double)prof_stats.timecost_sum;
 		fprintf(f.GetHandle(),
-			"%08x\t%s\t%" PRIu64 "\t%" PRIu64 "\t%" PRIu64 "\t%.2f\t%.2f\t%.2f\t%i\n", stat.addr,
+			"%08x\t%s\t%" PRIu64 "\t%" PRIu64 "\t%" PRIu64 "\t%.2f\t%.2f\t%.2f\t%i\t%u\t%u\n", stat.addr,
 			name.c_str(), stat.run_count, stat.cost, stat.tick_counter, percent, timePercent,
-			(double)stat.tick_counter * 1000.0 / (double)prof_stats.countsPerSec, stat.block_size);
+			(double)stat.tick_counter * 1000.0 / (double)prof_stats.countsPerSec, stat.block_size,
+			stat.linked_exits, stat.total_exits);
 	}
 }
 
@@ -125,10 +126,18 @@ void GetProfileResults(ProfileStats* prof_stats)
 		// Rough heuristic.  Mem instructions should cost more.
 		u64 cost = block.originalSize * (block.runCount / 4);
 		u64 timecost = block.ticCounter;
+		// Exits that are already patched to branch straight into the
+		// destination block never take the dispatcher path.
+		u32 linked_exits = 0;
+		for (const auto& e : block.linkData)
+		{
+			if (e.linkStatus)
+				linked_exits++;
+		}
 		// Todo: tweak.
 		if (block.runCount >= 1)
 			prof_stats->block_stats.emplace_back(block.effectiveAddress, cost, timecost, block.runCount,
-				block.codeSize);
+				block.codeSize, linked_exits, static_cast<u32>(block.linkData.size()));
 		prof_stats->cost_sum += cost;
 		prof_stats->timecost_sum += timecost;
 	});
@@ -237,6 +246,9 @@ void CompileExceptionCheck(ExceptionType type)
 	case ExceptionType::SpeculativeConstants:
 		exception_addresses = &g_jit->js.noSpeculativeConstantsAddresses;
 		break;
+	case ExceptionType::HotBlock:
+		exception_addresses = &g_jit->js.hotBlockAddresses;
+		break;
 	}
 
 	if (PC != 0 && (exception_addresses->find(PC)) == (exception_addresses->end()))
@@ -19,7 +19,8 @@ enum class ExceptionType
 {
 	FIFOWrite,
 	PairedQuantize,
-	SpeculativeConstants
+	SpeculativeConstants,
+	HotBlock
 };
 
 void DoState(PointerWrap& p);
@@ -28,7 +28,11 @@ namespace PowerPC
 {
 constexpr size_t HW_PAGE_SIZE = 4096;
 constexpr u32 HW_PAGE_INDEX_SHIFT = 12;
-constexpr u32 HW_PAGE_INDEX_MASK = 0x3f;
+// Derived from the software TLB size so enlarging it in PowerPC.h is enough.
+constexpr u32 HW_PAGE_INDEX_MASK = static_cast<u32>(TLB_SIZE / TLB_WAYS - 1);
+// tlbie only names one of the 64 hardware congruence classes; our cache has
+// more sets than that, so all sets aliasing the named class must be dropped.
+constexpr u32 HW_TLB_CLASS_MASK = 0x3f;
 
 // EFB RE
 /*
@@ -619,9 +623,9 @@ std::string HostGetString(u32 address, size_t size)
 
 bool IsOptimizableRAMAddress(const u32 address)
 {
-	if (PowerPC::memchecks.HasAny())
-		return false;
-
+	// No blanket memcheck test here: pages overlapping a memcheck have their
+	// BAT_PHYSICAL_BIT cleared in UpdateBATs, so the table lookup below
+	// already rejects them and every other page stays optimizable.
 	if (!UReg_MSR(MSR).DR)
 		return false;
 
@@ -769,7 +773,8 @@ void ClearCacheLine(u32 address)
 
 u32 IsOptimizableMMIOAccess(u32 address, u32 accessSize)
 {
-	if (PowerPC::memchecks.HasAny())
+	// Only the watched addresses themselves must stay unoptimized.
+	if (PowerPC::memchecks.GetMemCheck(address, accessSize / 8))
 		return 0;
 
 	if (!UReg_MSR(MSR).DR)
@@ -791,7 +796,8 @@ u32 IsOptimizableMMIOAccess(u32 address, u32 accessSize)
 
 bool IsOptimizableGatherPipeWrite(u32 address)
 {
-	if (PowerPC::memchecks.HasAny())
+	// Gather pipe writes are up to 8 bytes wide.
+	if (PowerPC::memchecks.GetMemCheck(address, 8))
 		return false;
 
 	if (!UReg_MSR(MSR).DR)
@@ -1044,15 +1050,23 @@ static void UpdateTLBEntry(const XCheckTLBFlag flag, UPTE2 PTE2, const u32 addre
 
 void InvalidateTLBEntry(u32 address)
 {
-	const u32 entry_index = (address >> HW_PAGE_INDEX_SHIFT) & HW_PAGE_INDEX_MASK;
+	// tlbie invalidates the whole congruence class, which can cover pages other
+	// than the named one, so conservatively drop every mirrored page mapping.
+	Memory::UnmapLogicalPages();
 
-	TLBEntry& tlbe = ppcState.tlb[0][entry_index];
-	tlbe.tag[0] = TLBEntry::INVALID_TAG;
-	tlbe.tag[1] = TLBEntry::INVALID_TAG;
+	const u32 class_index = (address >> HW_PAGE_INDEX_SHIFT) & HW_TLB_CLASS_MASK;
 
-	TLBEntry& tlbe_i = ppcState.tlb[1][entry_index];
-	tlbe_i.tag[0] = TLBEntry::INVALID_TAG;
-	tlbe_i.tag[1] = TLBEntry::INVALID_TAG;
+	for (u32 entry_index = class_index; entry_index <= HW_PAGE_INDEX_MASK;
+		entry_index += HW_TLB_CLASS_MASK + 1)
+	{
+		TLBEntry& tlbe = ppcState.tlb[0][entry_index];
+		tlbe.tag[0] = TLBEntry::INVALID_TAG;
+		tlbe.tag[1] = TLBEntry::INVALID_TAG;
+
+		TLBEntry& tlbe_i = ppcState.tlb[1][entry_index];
+		tlbe_i.tag[0] = TLBEntry::INVALID_TAG;
+		tlbe_i.tag[1] = TLBEntry::INVALID_TAG;
+	}
 }
 
 // Page Address Translation
@@ -1137,6 +1151,15 @@ static TranslateAddressResult TranslatePageAddress(const u32 address, const XChe
 				if (res != TLB_UPDATE_C)
 					UpdateTLBEntry(flag, PTE2, address);
 
+				// Once a writable page has been written (R and C are both set
+				// above), no further PTE state transitions are needed, so the
+				// page can be mirrored into the host logical mapping and
+				// served by fastmem. Read-only pages keep taking this path so
+				// protection faults and R/C updates still happen.
+				if (flag == FLAG_WRITE && PTE2.PP == 2)
+					Memory::MapLogicalPage(address & ~(u32)(HW_PAGE_SIZE - 1),
+						PTE2.RPN << HW_PAGE_INDEX_SHIFT);
+
 				return TranslateAddressResult{ TranslateAddressResult::PAGE_TABLE_TRANSLATED,
 					(PTE2.RPN << 12) | offset };
 			}
@@ -5,12 +5,15 @@
 #include <algorithm>
 #include <queue>
 #include <string>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
+#include "Common/ThreadPool.h"
 #include "Core/ConfigManager.h"
 #include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/JitCommon/TraceIR.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PPCTables.h"
@@ -36,6 +39,11 @@ constexpr int CODEBUFFER_SIZE = 32000;
 // 0 does not perform block merging
 constexpr u32 BRANCH_FOLLOWING_THRESHOLD = 2;
 
+// Follow budget for superblock formation on blocks which have proven
+// themselves hot. Cold blocks keep the small default; the extra code size
+// is only worth it where dispatch overhead actually shows up.
+constexpr u32 SUPERBLOCK_FOLLOWING_THRESHOLD = 8;
+
 constexpr u32 INVALID_BRANCH_TARGET = 0xFFFFFFFF;
 
 CodeBuffer::CodeBuffer(int size)
@@ -267,35 +275,61 @@ static bool CanSwapAdjacentOps(const CodeOp& a, const CodeOp& b)
 // called by another function. Therefore, let's scan the
 // entire space for bl operations and find what functions
 // get called.
+//
+// The word-by-word scan only reads guest memory, so it is sliced across the
+// worker pool; each slice collects its call targets into private storage and
+// the ordered commit phase feeds them to the symbol database on this thread,
+// slice by slice, so the database sees the same insertion sequence as the
+// old serial walk regardless of how the slices were scheduled.
 static void FindFunctionsFromBranches(u32 startAddr, u32 endAddr, SymbolDB* func_db)
 {
-	for (u32 addr = startAddr; addr < endAddr; addr += 4)
-	{
-		const UGeckoInstruction instr = PowerPC::HostRead_Instruction(addr);
+	const u32 SLICE_SIZE = 0x40000;
 
-		if (PPCTables::IsValidInstruction(instr))
-		{
-			switch (instr.OPCD)
-			{
-			case 18:  // branch instruction
-			{
-				if (instr.LK)  // bl
+	Common::OrderedWorkBatch batch;
+	std::vector<std::vector<u32>> slice_targets((endAddr - startAddr + SLICE_SIZE - 1) / SLICE_SIZE);
+	for (size_t slice = 0; slice < slice_targets.size(); slice++)
+	{
+		const u32 sliceStart = startAddr + (u32)slice * SLICE_SIZE;
+		const u32 sliceEnd = std::min(endAddr, sliceStart + SLICE_SIZE);
+		std::vector<u32>* targets = &slice_targets[slice];
+		batch.Add(
+			[sliceStart, sliceEnd, targets] {
+				for (u32 addr = sliceStart; addr < sliceEnd; addr += 4)
 				{
-					u32 target = SignExt26(instr.LI << 2);
-					if (!instr.AA)
-						target += addr;
-					if (PowerPC::HostIsRAMAddress(target))
+					const UGeckoInstruction instr = PowerPC::HostRead_Instruction(addr);
+
+					if (PPCTables::IsValidInstruction(instr))
 					{
-						func_db->AddFunction(target);
+						switch (instr.OPCD)
+						{
+						case 18:  // branch instruction
+						{
+							if (instr.LK)  // bl
+							{
+								u32 target = SignExt26(instr.LI << 2);
+								if (!instr.AA)
+									target += addr;
+								if (PowerPC::HostIsRAMAddress(target))
+								{
+									targets->push_back(target);
+								}
+							}
+						}
+						break;
+						default:
+							break;
+						}
 					}
 				}
-			}
-			break;
-			default:
-				break;
-			}
-		}
+			},
+			[targets, func_db] {
+				// AddFunction runs the per-function analysis on first sight of
+				// a target and dedups repeats, so this is the single writer.
+				for (u32 target : *targets)
+					func_db->AddFunction(target);
+			});
 	}
+	batch.Run();
 }
 
 static void FindFunctionsAfterBLR(PPCSymbolDB* func_db)
@@ -417,6 +451,89 @@ static bool isCror(const CodeOp& a)
 	return a.inst.OPCD == 19 && a.inst.SUBOP10 == 449;
 }
 
+// Plain register+displacement integer loads and stores. The update and
+// indexed forms are excluded: updates modify the base register and indexed
+// offsets are unknown at analysis time, so neither can be reasoned about.
+static bool isSimpleLoad(const CodeOp& a)
+{
+	switch (a.inst.OPCD)
+	{
+	case 32:  // lwz
+	case 34:  // lbz
+	case 40:  // lhz
+	case 42:  // lha
+		return true;
+	}
+	return false;
+}
+
+static bool isSimpleStore(const CodeOp& a)
+{
+	switch (a.inst.OPCD)
+	{
+	case 36:  // stw
+	case 38:  // stb
+	case 44:  // sth
+		return true;
+	}
+	return false;
+}
+
+static s32 AccessWidth(const CodeOp& a)
+{
+	switch (a.inst.OPCD)
+	{
+	case 34:  // lbz
+	case 38:  // stb
+		return 1;
+	case 40:  // lhz
+	case 42:  // lha
+	case 44:  // sth
+		return 2;
+	}
+	return 4;
+}
+
+// Alias classification by base register provenance: when a load and a store
+// go through the same base register (and nothing in between modifies it -
+// guaranteed here because they are adjacent and stores write no GPR), their
+// effective addresses differ by exactly the difference of the displacements,
+// so disjoint displacement ranges prove the accesses independent for every
+// runtime value of the base. Two different base registers prove nothing -
+// they may point into the same buffer - so that case is never accepted.
+static bool MemOpsProvablyIndependent(const CodeOp& a, const CodeOp& b)
+{
+	if (a.inst.RA == 0 || a.inst.RA != b.inst.RA)
+		return false;
+
+	const s32 a_offset = a.inst.SIMM_16;
+	const s32 b_offset = b.inst.SIMM_16;
+	return a_offset + AccessWidth(a) <= b_offset || b_offset + AccessWidth(b) <= a_offset;
+}
+
+// Whether the load may be hoisted above the store immediately preceding it.
+static bool CanSwapLoadAcrossStore(const CodeOp& load, const CodeOp& store)
+{
+	// can't reorder around breakpoints
+	if (SConfig::GetInstance().bEnableDebugging &&
+		(PowerPC::breakpoints.IsAddressBreakPoint(load.address) ||
+			PowerPC::breakpoints.IsAddressBreakPoint(store.address)))
+		return false;
+
+	if (!isSimpleLoad(load) || !isSimpleStore(store))
+		return false;
+
+	if (!MemOpsProvablyIndependent(load, store))
+		return false;
+
+	// The usual register collision rules: the hoisted load must not clobber
+	// the store's source or base register.
+	if (load.regsOut & store.regsIn)
+		return false;
+
+	return true;
+}
+
 void PPCAnalyzer::ReorderInstructionsCore(u32 instructions, CodeOp* code, bool reverse,
 	ReorderType type)
 {
@@ -440,8 +557,20 @@ void PPCAnalyzer::ReorderInstructionsCore(u32 instructions, CodeOp* code, bool r
 			// Reorder integer compares, rlwinm., and carry-affecting ops
 			// (if we add more merged branch instructions, add them here!)
 			if ((type == REORDER_CROR && isCror(a)) || (type == REORDER_CARRY && isCarryOp(a)) ||
-				(type == REORDER_CMP && (isCmp(a) || a.outputCR0)))
+				(type == REORDER_CMP && (isCmp(a) || a.outputCR0)) ||
+				(type == REORDER_LOAD && isSimpleLoad(a)))
 			{
+				// Load pass: only bubble across an independent store. Moving
+				// loads across arbitrary ops would just stretch live ranges.
+				if (type == REORDER_LOAD)
+				{
+					if (CanSwapLoadAcrossStore(a, b))
+					{
+						std::swap(a, b);
+						swapped = true;
+					}
+					continue;
+				}
 				// once we're next to a carry instruction, don't move away!
 				if (type == REORDER_CARRY && i != start)
 				{
@@ -468,8 +597,63 @@ void PPCAnalyzer::ReorderInstructionsCore(u32 instructions, CodeOp* code, bool r
 	}
 }
 
+#if defined(_DEBUG) || defined(DEBUGFAST)
+// Reorder validation: re-derive independence for every pair of instructions
+// whose relative order the passes inverted. The passes only ever prove
+// adjacent swaps safe; this checks the transitive result, so a bad
+// interaction between passes shows up here instead of as a silent
+// miscompilation. Ops are matched up by address, which is unique within a
+// block.
+static void VerifyReorder(const std::vector<CodeOp>& original, const CodeOp* code,
+	u32 instructions)
+{
+	for (u32 i = 0; i < instructions; i++)
+	{
+		for (u32 j = i + 1; j < instructions; j++)
+		{
+			// Find the pair's original relative order.
+			size_t pos_i = 0, pos_j = 0;
+			for (size_t k = 0; k < original.size(); k++)
+			{
+				if (original[k].address == code[i].address)
+					pos_i = k;
+				if (original[k].address == code[j].address)
+					pos_j = k;
+			}
+			if (pos_j > pos_i)
+				continue;
+
+			// code[j] was moved above code[i]; the pair must be independent.
+			const CodeOp& early = code[i];
+			const CodeOp& late = code[j];
+			const bool reg_conflict = (early.regsOut & late.regsIn) || (late.regsOut & early.regsIn) ||
+				(early.regsOut & late.regsOut);
+			const bool mem_conflict =
+				(early.opinfo->flags & FL_LOADSTORE) && (late.opinfo->flags & FL_LOADSTORE) &&
+				(isSimpleStore(early) || isSimpleStore(late)) &&
+				!MemOpsProvablyIndependent(early, late);
+			if (reg_conflict || mem_conflict)
+			{
+				ERROR_LOG(POWERPC,
+					"Bad instruction reorder: %08x moved above %08x with a %s dependency",
+					code[i].address, code[j].address, reg_conflict ? "register" : "memory");
+			}
+		}
+	}
+}
+#endif
+
 void PPCAnalyzer::ReorderInstructions(u32 instructions, CodeOp* code)
 {
+#if defined(_DEBUG) || defined(DEBUGFAST)
+	std::vector<CodeOp> original(code, code + instructions);
+#endif
+
+	// Hoist loads above stores they provably cannot alias, so the loaded
+	// register is available earlier and back-to-back loads pair up. Runs
+	// before the merge passes so it cannot split up a pair they created.
+	if (HasOption(OPTION_LOADSTORE_REORDER))
+		ReorderInstructionsCore(instructions, code, true, REORDER_LOAD);
 	// Reorder cror instructions upwards (e.g. towards an fcmp). Technically we should be more
 	// picky about this, but cror seems to almost solely be used for this purpose in real code.
 	// Additionally, the other boolean ops seem to almost never be used.
@@ -484,6 +668,10 @@ void PPCAnalyzer::ReorderInstructions(u32 instructions, CodeOp* code)
 	}
 	if (HasOption(OPTION_BRANCH_MERGE))
 		ReorderInstructionsCore(instructions, code, false, REORDER_CMP);
+
+#if defined(_DEBUG) || defined(DEBUGFAST)
+	VerifyReorder(original, code, instructions);
+#endif
 }
 
 void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code, const GekkoOPInfo* opinfo,
@@ -692,15 +880,17 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32
 		//       If it is small, the performance will be down.
 		//       If it is big, the size of generated code will be big and
 		//       cache clearning will happen many times.
-		if (HasOption(OPTION_BRANCH_FOLLOW) && numFollows < BRANCH_FOLLOWING_THRESHOLD)
+		const u32 followThreshold = HasOption(OPTION_AGGRESSIVE_BRANCH_FOLLOW) ?
+			SUPERBLOCK_FOLLOWING_THRESHOLD : BRANCH_FOLLOWING_THRESHOLD;
+		if (HasOption(OPTION_BRANCH_FOLLOW) && numFollows < followThreshold)
 		{
 			if (inst.OPCD == 18 && blockSize > 1)
 			{
 				// Always follow BX instructions.
 				// TODO: Loop unrolling might bloat the code size too much.
 				//       Enable it carefully.
-				follow = destination != block->m_address;
 				destination = SignExt26(inst.LI << 2) + (inst.AA ? 0 : address);
+				follow = destination != block->m_address;
 				if (inst.LK)
 				{
 					found_call = true;
@@ -913,6 +1103,20 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32
 	block->m_gqr_used = gqrUsed;
 	block->m_gqr_modified = gqrModified;
 	block->m_gpr_inputs = gprBlockInputs;
+
+	// Superblocks get a trace-level redundancy pass on top: branch following
+	// duplicates address computations and spill refills across the inlined
+	// call boundaries, and the liveness results above are exactly what the
+	// pass needs to prove flag outputs dead.
+	if (HasOption(OPTION_AGGRESSIVE_BRANCH_FOLLOW) && block->m_num_instructions > 1)
+	{
+		const u32 eliminated = JitTrace::OptimizeTrace(code, block->m_num_instructions);
+		if (eliminated)
+		{
+			DEBUG_LOG(DYNA_REC, "Trace IR dropped %u/%u ops in superblock at %08x", eliminated,
+				block->m_num_instructions, block->m_address);
+		}
+	}
 	return address;
 }
 
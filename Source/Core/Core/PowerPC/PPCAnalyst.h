@@ -171,7 +171,8 @@ private:
 	{
 		REORDER_CARRY,
 		REORDER_CMP,
-		REORDER_CROR
+		REORDER_CROR,
+		REORDER_LOAD
 	};
 
 	void ReorderInstructionsCore(u32 instructions, CodeOp* code, bool reverse, ReorderType type);
@@ -218,6 +219,17 @@ public:
 
 		// Reorder cror instructions next to their associated fcmp.
 		OPTION_CROR_MERGE = (1 << 6),
+
+		// Superblock formation: keep following unconditional branches well
+		// past the default budget, so hot paths compile into fewer, larger
+		// blocks. Only worth the code bloat on blocks known to be hot.
+		OPTION_AGGRESSIVE_BRANCH_FOLLOW = (1 << 7),
+
+		// Hoist loads above stores they provably don't alias (same base
+		// register, disjoint displacement ranges). Reorders guest memory
+		// accesses, so the JIT must only enable it when a reordered access
+		// cannot take a guest exception path (no MMU, no memchecks).
+		OPTION_LOADSTORE_REORDER = (1 << 8),
 	};
 
 	PPCAnalyzer() : m_options(0) {}
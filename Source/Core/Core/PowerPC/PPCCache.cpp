@@ -71,6 +71,9 @@ void InstructionCache::Init()
 {
 	memset(data, 0, sizeof(data));
 	memset(tags, 0, sizeof(tags));
+	// Accuracy tiers survive Reset (an invalidate-all clears the cache, not
+	// the knowledge of where the program manages code), but not a reboot.
+	memset(accurate_region, 0, sizeof(accurate_region));
 
 	Reset();
 }
@@ -79,6 +82,10 @@ void InstructionCache::Invalidate(u32 addr)
 {
 	if (!HID0.ICE)
 		return;
+	// The program manages code around this address, so promote its region to
+	// the accurate model: later fetches there can observe stale lines the way
+	// hardware would instead of taking the constant-cost bypass.
+	accurate_region[(addr >> ICACHE_REGION_SHIFT) & ICACHE_REGION_MASK] = 1;
 	// invalidates the whole set
 	u32 set = (addr >> 5) & 0x7f;
 	for (int i = 0; i < 8; i++)
@@ -99,6 +106,14 @@ u32 InstructionCache::ReadInstruction(u32 addr)
 {
 	if (!HID0.ICE)  // instruction cache is disabled
 		return Memory::Read_U32(addr);
+	// Constant-cost tier: a region the program never invalidates in is served
+	// straight from memory, skipping the lookup tables and fill machinery.
+	// Only code rewritten in place can tell the difference, and rewriting
+	// comes with icbi, which promotes its region above. Both interpreter
+	// fetches and the JIT's compile-time reads come through here, so the
+	// bypass also takes the model cost out of block compilation.
+	if (!accurate_region[(addr >> ICACHE_REGION_SHIFT) & ICACHE_REGION_MASK])
+		return Memory::Read_U32(addr);
 	u32 set = (addr >> 5) & 0x7f;
 	u32 tag = addr >> 12;
 
@@ -163,5 +178,6 @@ void InstructionCache::DoState(PointerWrap& p)
 	p.DoArray(lookup_table);
 	p.DoArray(lookup_table_ex);
 	p.DoArray(lookup_table_vmem);
+	p.DoArray(accurate_region);
 }
 }  // namespace PowerPC
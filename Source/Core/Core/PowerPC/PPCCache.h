@@ -18,6 +18,12 @@ const u32 ICACHE_BLOCK_SIZE = 8;
 const u32 ICACHE_EXRAM_BIT = 0x10000000;
 const u32 ICACHE_VMEM_BIT = 0x20000000;
 
+// Granularity of the accuracy tiers: fetches bypass the cache model unless
+// their 256 KiB region has been promoted to the accurate model (see
+// ReadInstruction).
+const u32 ICACHE_REGION_SHIFT = 18;
+const u32 ICACHE_REGION_MASK = 0xfff;
+
 struct InstructionCache
 {
 	u32 data[ICACHE_SETS][ICACHE_WAYS][ICACHE_BLOCK_SIZE];
@@ -32,6 +38,11 @@ struct InstructionCache
 	u8 lookup_table_ex[1 << 21];
 	u8 lookup_table_vmem[1 << 20];
 
+	// Nonzero entries mark regions served by the accurate cache model; all
+	// other fetches take the constant-cost bypass. A region is promoted the
+	// first time the program invalidates inside it and stays promoted.
+	u8 accurate_region[ICACHE_REGION_MASK + 1];
+
 	InstructionCache();
 	u32 ReadInstruction(u32 addr);
 	void Invalidate(u32 addr);
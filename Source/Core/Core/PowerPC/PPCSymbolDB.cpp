@@ -2,8 +2,12 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <atomic>
 #include <map>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -11,6 +15,8 @@
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
+#include "Core/HLE/HLE.h"
+#include "Core/Host.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
@@ -58,6 +64,7 @@ Symbol* PPCSymbolDB::AddFunction(u32 startAddr)
 		functions[startAddr] = tempFunc;
 		tempFunc.type = Symbol::Type::Function;
 		checksumToFunction[tempFunc.hash].insert(&functions[startAddr]);
+		m_address_index_dirty = true;
 		return &functions[startAddr];
 	}
 }
@@ -92,28 +99,17 @@ void PPCSymbolDB::AddKnownSymbol(u32 startAddr, u32 size, const std::string& nam
 		tf.size = size;
 		functions[startAddr] = tf;
 	}
+	m_address_index_dirty = true;
 }
 
 Symbol* PPCSymbolDB::GetSymbolFromAddr(u32 addr)
 {
-	XFuncMap::iterator it = functions.find(addr);
-	if (it != functions.end())
-	{
-		return &it->second;
-	}
-	else
-	{
-		for (auto& p : functions)
-		{
-			if (addr >= p.second.address && addr < p.second.address + p.second.size)
-				return &p.second;
-		}
-	}
-	return nullptr;
+	return LookupAddressIndex(addr);
 }
 
 std::string PPCSymbolDB::GetDescription(u32 addr)
 {
+	EnsureMapLoaded();
 	Symbol* symbol = GetSymbolFromAddr(addr);
 	if (symbol)
 		return symbol->name;
@@ -225,6 +221,19 @@ void PPCSymbolDB::LogFunctionCall(u32 addr)
 // https://forums.oculus.com/viewtopic.php?f=42&t=11241&start=580
 // https://m2k2.taigaforum.com/post/metroid_prime_hacking_help_25.html#metroid_prime_hacking_help_25
 
+namespace
+{
+// One parsed .map line; analyzed in parallel before being merged serially.
+struct PendingSymbol
+{
+	u32 address = 0;
+	u32 size = 0;
+	std::string name;
+	bool good = false;
+	Symbol symbol;
+};
+}
+
 // This one can load both leftover map files on game discs (like Zelda), and mapfiles
 // produced by SaveSymbolMap below.
 // bad=true means carefully load map files that might not be from exactly the right version
@@ -237,6 +246,7 @@ bool PPCSymbolDB::LoadMap(const std::string& filename, bool bad)
 	// four columns are used in American Mensa Academy map files and perhaps other games
 	bool started = false, four_columns = false;
 	int good_count = 0, bad_count = 0;
+	std::vector<PendingSymbol> entries;
 
 	char line[512];
 	while (fgets(line, 512, f.GetHandle()))
@@ -362,31 +372,77 @@ bool PPCSymbolDB::LoadMap(const std::string& filename, bool bad)
 		// Check if this is a valid entry.
 		if (strcmp(name, ".text") != 0 && strcmp(name, ".init") != 0 && strlen(name) > 0)
 		{
-			vaddress |= 0x80000000;
-			bool good = !bad;
-			if (!good)
-			{
-				// check for BLR before function
-				u32 opcode = PowerPC::HostRead_Instruction(vaddress - 4);
-				if (opcode == 0x4e800020)
-				{
-					// check for BLR at end of function
-					opcode = PowerPC::HostRead_Instruction(vaddress + size - 4);
-					if (opcode == 0x4e800020)
-						good = true;
-				}
-			}
-			if (good)
-			{
-				++good_count;
-				AddKnownSymbol(vaddress | 0x80000000, size, name);  // ST_FUNCTION
-			}
-			else
+			PendingSymbol entry;
+			entry.address = vaddress | 0x80000000;
+			entry.size = size;
+			entry.name = name;
+			entry.good = !bad;
+			entries.push_back(std::move(entry));
+		}
+	}
+
+	// Function analysis (checksums, flow analysis) dominates loading a large
+	// map and only reads guest memory, so farm it out across threads. The
+	// shared maps are updated serially below.
+	std::atomic<size_t> next_entry{0};
+	const auto analyze_worker = [&entries, &next_entry]() {
+		size_t i;
+		while ((i = next_entry.fetch_add(1)) < entries.size())
+		{
+			PendingSymbol& entry = entries[i];
+			if (!entry.good)
 			{
-				++bad_count;
+				// check for BLR before the function and at its end
+				if (PowerPC::HostRead_Instruction(entry.address - 4) == 0x4e800020 &&
+					PowerPC::HostRead_Instruction(entry.address + entry.size - 4) == 0x4e800020)
+					entry.good = true;
+				else
+					continue;
 			}
+			entry.symbol.name = entry.name;
+			entry.symbol.function_name = GetStrippedFunctionName(entry.name);
+			entry.symbol.type = Symbol::Type::Function;
+			entry.symbol.address = entry.address;
+			PPCAnalyst::AnalyzeFunction(entry.address, entry.symbol, entry.size);
+			entry.symbol.size = entry.size;
+		}
+	};
+	const size_t worker_count = std::max<size_t>(
+		1, std::min<size_t>(std::thread::hardware_concurrency(), entries.size()));
+	std::vector<std::thread> workers;
+	for (size_t i = 1; i < worker_count; i++)
+		workers.emplace_back(analyze_worker);
+	analyze_worker();
+	for (auto& worker : workers)
+		worker.join();
+
+	for (PendingSymbol& entry : entries)
+	{
+		if (!entry.good)
+		{
+			++bad_count;
+			continue;
+		}
+		++good_count;
+		XFuncMap::iterator iter = functions.find(entry.address);
+		if (iter != functions.end())
+		{
+			// already got it, just update name, checksum & size to be sure.
+			Symbol* tempfunc = &iter->second;
+			tempfunc->name = entry.symbol.name;
+			tempfunc->function_name = entry.symbol.function_name;
+			tempfunc->hash = entry.symbol.hash;
+			tempfunc->type = entry.symbol.type;
+			tempfunc->size = entry.symbol.size;
+		}
+		else
+		{
+			functions[entry.address] = std::move(entry.symbol);
+			Symbol* inserted = &functions[entry.address];
+			checksumToFunction[inserted->hash].insert(inserted);
 		}
 	}
+	m_address_index_dirty = true;
 
 	Index();
 	if (bad)
@@ -394,6 +450,29 @@ bool PPCSymbolDB::LoadMap(const std::string& filename, bool bad)
 	return true;
 }
 
+void PPCSymbolDB::ScheduleLoadMap(const std::string& filename, bool bad)
+{
+	m_pending_map_filename = filename;
+	m_pending_map_bad = bad;
+}
+
+bool PPCSymbolDB::EnsureMapLoaded()
+{
+	if (m_pending_map_filename.empty())
+		return false;
+
+	// Clear the pending name first so a failed load is not retried per query.
+	const std::string filename = std::move(m_pending_map_filename);
+	m_pending_map_filename.clear();
+	if (!LoadMap(filename, m_pending_map_bad))
+		return false;
+
+	// The boot path skipped these because no symbols were loaded back then.
+	HLE::PatchFunctions();
+	Host_NotifyMapLoaded();
+	return true;
+}
+
 // ===================================================
 /* Save the map file and save a code file */
 // ----------------
@@ -19,6 +19,9 @@ class PPCSymbolDB : public SymbolDB
 private:
 	DebugInterface* debugger;
 
+	std::string m_pending_map_filename;
+	bool m_pending_map_bad = false;
+
 public:
 	typedef void(*functionGetterCallback)(Symbol* f);
 
@@ -36,6 +39,12 @@ public:
 	void FillInCallers();
 
 	bool LoadMap(const std::string& filename, bool bad = false);
+	// Records a map file to be parsed on first debugger/profiler use instead
+	// of stalling the boot path. Loading it re-runs the HLE patch pass, so
+	// name based patches still apply.
+	void ScheduleLoadMap(const std::string& filename, bool bad = false);
+	// Loads a scheduled map file, if any. Returns true if one was loaded now.
+	bool EnsureMapLoaded();
 	bool SaveMap(const std::string& filename, bool WithCodes = false) const;
 
 	void PrintCalls(u32 funcAddr) const;
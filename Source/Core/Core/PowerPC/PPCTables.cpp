@@ -103,6 +103,43 @@ Interpreter::Instruction GetInterpreterOp(UGeckoInstruction _inst)
 		return Interpreter::m_op_table[_inst.OPCD];
 	}
 }
+DecodedInstruction DecodeInstruction(UGeckoInstruction _inst)
+{
+	// The subtable opcodes always mark a subtable in the primary tables, so
+	// indexing directly on OPCD flattens the two-level dispatch into a single
+	// switch.  Invalid encodings resolve to the unknown_instruction handler
+	// and its opinfo, so every result is usable without further checks.
+	DecodedInstruction result;
+	switch (_inst.OPCD)
+	{
+	case 4:
+		result.handler = Interpreter::m_op_table4[_inst.SUBOP10];
+		result.info = m_infoTable4[_inst.SUBOP10];
+		break;
+	case 19:
+		result.handler = Interpreter::m_op_table19[_inst.SUBOP10];
+		result.info = m_infoTable19[_inst.SUBOP10];
+		break;
+	case 31:
+		result.handler = Interpreter::m_op_table31[_inst.SUBOP10];
+		result.info = m_infoTable31[_inst.SUBOP10];
+		break;
+	case 59:
+		result.handler = Interpreter::m_op_table59[_inst.SUBOP5];
+		result.info = m_infoTable59[_inst.SUBOP5];
+		break;
+	case 63:
+		result.handler = Interpreter::m_op_table63[_inst.SUBOP10];
+		result.info = m_infoTable63[_inst.SUBOP10];
+		break;
+	default:
+		result.handler = Interpreter::m_op_table[_inst.OPCD];
+		result.info = m_infoTable[_inst.OPCD];
+		break;
+	}
+	return result;
+}
+
 namespace PPCTables
 {
 bool UsesFPU(UGeckoInstruction inst)
@@ -108,6 +108,17 @@ extern size_t m_numInstructions;
 GekkoOPInfo* GetOpInfo(UGeckoInstruction _inst);
 Interpreter::Instruction GetInterpreterOp(UGeckoInstruction _inst);
 
+// Handler plus metadata for one instruction, resolved in a single table walk.
+// The interpreter's hot loop uses this so it doesn't have to dispatch through
+// the subtable trampolines and then re-walk the info tables for the cycle
+// count and FPU flag.
+struct DecodedInstruction
+{
+	Interpreter::Instruction handler;
+	const GekkoOPInfo* info;
+};
+DecodedInstruction DecodeInstruction(UGeckoInstruction _inst);
+
 namespace PPCTables
 {
 bool IsValidInstruction(UGeckoInstruction _instCode);
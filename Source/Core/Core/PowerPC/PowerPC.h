@@ -37,8 +37,12 @@ enum class CoreMode
 	JIT,
 };
 
-// TLB cache
-constexpr size_t TLB_SIZE = 128;
+// TLB cache. The real Gekko TLB only has 64 congruence classes, but this is a
+// software lookup cache, not a model of the hardware: making it considerably
+// larger keeps more translations hot in MMU titles at the cost of a little
+// extra state, and tlbie still invalidates every set aliasing the named
+// hardware class.
+constexpr size_t TLB_SIZE = 1024;
 constexpr size_t NUM_TLBS = 2;
 constexpr size_t TLB_WAYS = 2;
 
@@ -116,6 +120,11 @@ struct PowerPCState
 	// Storage for the stack pointer of the BLR optimization.
 	u8* stored_stack_pointer;
 
+	// Gather pipe write position. Lives here rather than in GPFifo so the JIT
+	// can address it relative to the ppcState register instead of
+	// materializing a 64-bit immediate for every FIFO write.
+	u8* gather_pipe_ptr;
+
 	std::array<std::array<TLBEntry, TLB_SIZE / TLB_WAYS>, NUM_TLBS> tlb;
 
 	u32 pagetable_base;
@@ -43,8 +43,9 @@
 
 struct BlockStat
 {
-	BlockStat(u32 _addr, u64 c, u64 ticks, u64 run, u32 size)
-		: addr(_addr), cost(c), tick_counter(ticks), run_count(run), block_size(size)
+	BlockStat(u32 _addr, u64 c, u64 ticks, u64 run, u32 size, u32 links, u32 exits)
+		: addr(_addr), cost(c), tick_counter(ticks), run_count(run), block_size(size),
+		linked_exits(links), total_exits(exits)
 	{
 	}
 	u32 addr;
@@ -52,6 +53,10 @@ struct BlockStat
 	u64 tick_counter;
 	u64 run_count;
 	u32 block_size;
+	// How many of this block's exits currently branch straight to another
+	// block, bypassing the dispatcher. Useful to verify link coverage.
+	u32 linked_exits;
+	u32 total_exits;
 
 	bool operator<(const BlockStat& other) const { return cost > other.cost; }
 };
@@ -68,4 +73,15 @@ namespace Profiler
 extern bool g_ProfileBlocks;
 
 void WriteProfileResults(const std::string& filename);
+
+// Sampling profiler: a timer thread periodically samples the guest PC and
+// attributes hits to guest functions through g_symbolDB. Unlike
+// g_ProfileBlocks it adds no instrumentation to generated code, so it is
+// cheap enough to leave running in production.
+void StartSampling();
+void StopSampling();
+bool IsSampling();
+// Writes the collected samples in collapsed-stack format ("frame count" per
+// line) for flamegraph tooling, then clears them.
+void WriteSampleResults(const std::string& filename);
 }
@@ -2,6 +2,9 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
 #include <lzo/lzo1x.h>
 #include <map>
 #include <mutex>
@@ -10,10 +13,12 @@
 #include <utility>
 #include <vector>
 
+#include "Common/CPUDetect.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/MsgHandler.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
@@ -23,8 +28,13 @@
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
+#include "Core/DSPEmulator.h"
 #include "Core/GeckoCode.h"
+#include "Core/HW/DSP.h"
+#include "Core/HW/EXI/EXI.h"
 #include "Core/HW/HW.h"
+#include "Core/HW/Memmap.h"
+#include "Core/HW/VideoInterface.h"
 #include "Core/HW/Wiimote.h"
 #include "Core/Host.h"
 #include "Core/Movie.h"
@@ -33,6 +43,7 @@
 #include "Core/State.h"
 
 #include "VideoCommon/AVIDump.h"
+#include "VideoCommon/Fifo.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/VideoBackendBase.h"
 
@@ -48,13 +59,9 @@ static const u32 IN_LEN = 128 * 1024u;
 
 static const u32 OUT_LEN = IN_LEN + (IN_LEN / 16) + 64 + 3;
 
-static unsigned char __LZO_MMODEL out[OUT_LEN];
-
 #define HEAP_ALLOC(var, size)                                                                      \
   lzo_align_t __LZO_MMODEL var[((size) + (sizeof(lzo_align_t) - 1)) / sizeof(lzo_align_t)]
 
-static HEAP_ALLOC(wrkmem, LZO1X_1_MEM_COMPRESS);
-
 static std::string g_last_filename;
 
 static AfterLoadCallbackFunc s_on_after_load_callback;
@@ -70,8 +77,25 @@ static Common::Event g_compressAndDumpStateSyncEvent;
 
 static std::thread g_save_thread;
 
+// Prefetch cache: decompressed slot data keyed by filename, so a load of a
+// prefetched slot is a memcpy into the apply buffer instead of file IO plus
+// decompression on the CPU thread. Entries are revalidated against the file
+// header before use, so a stale or torn prefetch only costs a cache miss.
+struct PrefetchedState
+{
+	std::vector<u8> data;
+	StateHeader header;
+	u64 file_size = 0;
+};
+static const size_t PREFETCH_SLOT_COUNT = 3;
+static const size_t PREFETCH_CACHE_MAX_ENTRIES = 4;
+static std::map<std::string, PrefetchedState> s_prefetch_cache;
+static std::vector<std::vector<u8>> s_prefetch_buffer_pool;
+static std::mutex s_prefetch_mutex;
+static std::thread s_prefetch_thread;
+
 // Don't forget to increase this after doing changes on the savestate system
-static const u32 STATE_VERSION = 80;  // Last changed in PR 5309
+static const u32 STATE_VERSION = 86;  // Last changed when the icache accuracy-tier map was added
 
 // Maps savestate versions to Dolphin versions.
 // Versions after 42 don't need to be added to this list,
@@ -233,6 +257,258 @@ void SaveToBuffer(std::vector<u8>& buffer)
 	Core::PauseAndLock(false, wasUnpaused);
 }
 
+// Page granularity of the delta snapshot path. Serialization is stable from
+// one frame to the next, so unchanged emulated RAM lands on the same offsets
+// and page-level comparison against the base snapshot finds the small set of
+// pages that actually changed.
+static const size_t DELTA_PAGE_SIZE = 4096;
+
+void SaveToBufferDelta(std::vector<u8>& base, std::vector<u8>& delta)
+{
+	// Serialized into a scratch buffer so the caller's base snapshot stays
+	// intact as the reference for subsequent deltas.
+	static std::vector<u8> s_delta_scratch;
+
+	delta.clear();
+
+	SaveToBuffer(s_delta_scratch);
+
+	if (base.size() != s_delta_scratch.size())
+	{
+		// No usable reference; refresh the base snapshot instead.
+		base = s_delta_scratch;
+		return;
+	}
+
+	const size_t page_count = (base.size() + DELTA_PAGE_SIZE - 1) / DELTA_PAGE_SIZE;
+	for (size_t page = 0; page < page_count; page++)
+	{
+		const size_t offset = page * DELTA_PAGE_SIZE;
+		const size_t len = std::min(DELTA_PAGE_SIZE, base.size() - offset);
+		if (memcmp(&base[offset], &s_delta_scratch[offset], len) != 0)
+		{
+			const u32 page_index = (u32)page;
+			const u8* index_bytes = reinterpret_cast<const u8*>(&page_index);
+			delta.insert(delta.end(), index_bytes, index_bytes + sizeof(page_index));
+			delta.insert(delta.end(), &s_delta_scratch[offset], &s_delta_scratch[offset] + len);
+		}
+	}
+}
+
+static void ApplyDeltaPages(std::vector<u8>& buffer, const std::vector<u8>& delta)
+{
+	size_t pos = 0;
+	while (pos + sizeof(u32) <= delta.size())
+	{
+		u32 page_index;
+		memcpy(&page_index, &delta[pos], sizeof(page_index));
+		pos += sizeof(page_index);
+
+		const size_t offset = (size_t)page_index * DELTA_PAGE_SIZE;
+		if (offset >= buffer.size())
+			break;
+		const size_t len = std::min(DELTA_PAGE_SIZE, buffer.size() - offset);
+		if (pos + len > delta.size())
+			break;
+		memcpy(&buffer[offset], &delta[pos], len);
+		pos += len;
+	}
+}
+
+void LoadFromBufferDelta(std::vector<u8>& base, std::vector<u8>& delta)
+{
+	if (base.empty())
+		return;
+
+	std::vector<u8> buffer = base;
+	ApplyDeltaPages(buffer, delta);
+	LoadFromBuffer(buffer);
+}
+
+void SaveRollbackSnapshot(std::vector<u8>& base, std::vector<u8>& delta)
+{
+	// Same quiesce pattern as CaptureReplaySnapshot below: called mid-frame on
+	// the CPU thread, so stop the threads running beside it but not the CPU.
+	ExpansionInterface::PauseAndLock(true, false);
+	DSP::GetDSPEmulator()->PauseAndLock(true, false);
+	Fifo::PauseAndLock(true, false);
+
+	SaveToBufferDelta(base, delta);
+
+	Fifo::PauseAndLock(false, true);
+	DSP::GetDSPEmulator()->PauseAndLock(false, true);
+	ExpansionInterface::PauseAndLock(false, true);
+}
+
+void LoadRollbackSnapshot(std::vector<u8>& base, std::vector<u8>& delta)
+{
+	if (base.empty())
+		return;
+
+	std::vector<u8> buffer = base;
+	ApplyDeltaPages(buffer, delta);
+
+	bool wasUnpaused = Core::PauseAndLock(true);
+
+	u8* ptr = &buffer[0];
+	PointerWrap p(&ptr, PointerWrap::MODE_READ);
+	DoState(p);
+
+	Core::PauseAndLock(false, wasUnpaused);
+}
+
+// ---- Instant replay ring ----
+//
+// One delta snapshot per emulated second, taken on the CPU thread. Every
+// snapshot in the ring is a delta against a full base snapshot; the base is
+// refreshed every ring length so delta size tracks recent change instead of
+// drift since the ring was enabled, and a base snapshot is kept alive for as
+// long as any ring entry still references it (at most two at a time).
+
+struct ReplayRingEntry
+{
+	u32 generation = 0;
+	std::vector<u8> delta;
+};
+
+static std::mutex s_replay_ring_mutex;
+static bool s_replay_ring_enabled = false;
+static u32 s_replay_ring_length = 0;         // snapshots to keep
+static u32 s_replay_ring_frame_count = 0;    // frames since the last capture
+static u32 s_replay_ring_generation = 0;     // current base snapshot
+static u32 s_replay_ring_capture_count = 0;  // captures against the current base
+static std::deque<ReplayRingEntry> s_replay_ring;
+static std::map<u32, std::vector<u8>> s_replay_ring_bases;
+// Frames left until a running replay has caught back up to the rewind point.
+static u32 s_replay_frames_to_dump = 0;
+
+// Must be called from the CPU thread. Quiesces the threads which run beside
+// the CPU the same way Core::PauseAndLock does, minus the CPU itself.
+static void CaptureReplaySnapshot()
+{
+	if (s_replay_ring_capture_count >= s_replay_ring_length)
+	{
+		s_replay_ring_generation++;
+		s_replay_ring_capture_count = 0;
+	}
+
+	ExpansionInterface::PauseAndLock(true, false);
+	DSP::GetDSPEmulator()->PauseAndLock(true, false);
+	Fifo::PauseAndLock(true, false);
+
+	std::vector<u8>& base = s_replay_ring_bases[s_replay_ring_generation];
+	const size_t prev_base_size = base.size();
+
+	ReplayRingEntry entry;
+	entry.generation = s_replay_ring_generation;
+	SaveToBufferDelta(base, entry.delta);
+
+	Fifo::PauseAndLock(false, true);
+	DSP::GetDSPEmulator()->PauseAndLock(false, true);
+	ExpansionInterface::PauseAndLock(false, true);
+
+	if (prev_base_size != 0 && base.size() != prev_base_size)
+	{
+		// The serialized size changed, so SaveToBufferDelta refreshed the base;
+		// deltas taken against the old base no longer apply to it.
+		s_replay_ring.erase(std::remove_if(s_replay_ring.begin(), s_replay_ring.end(),
+			[](const ReplayRingEntry& e) {
+			return e.generation == s_replay_ring_generation;
+		}),
+			s_replay_ring.end());
+	}
+
+	s_replay_ring_capture_count++;
+	s_replay_ring.emplace_back(std::move(entry));
+	while (s_replay_ring.size() > s_replay_ring_length)
+		s_replay_ring.pop_front();
+
+	for (auto it = s_replay_ring_bases.begin(); it != s_replay_ring_bases.end();)
+	{
+		const u32 generation = it->first;
+		const bool referenced = std::any_of(s_replay_ring.begin(), s_replay_ring.end(),
+			[&](const ReplayRingEntry& e) { return e.generation == generation; });
+		it = referenced ? std::next(it) : s_replay_ring_bases.erase(it);
+	}
+}
+
+void EnableReplayRing(u32 seconds)
+{
+	std::lock_guard<std::mutex> lk(s_replay_ring_mutex);
+	s_replay_ring_enabled = seconds > 0;
+	s_replay_ring_length = seconds;
+	s_replay_ring_frame_count = 0;
+	s_replay_ring_capture_count = 0;
+	s_replay_ring.clear();
+	s_replay_ring_bases.clear();
+}
+
+void DisableReplayRing()
+{
+	EnableReplayRing(0);
+}
+
+void ReplayRingFrameUpdate()
+{
+	std::lock_guard<std::mutex> lk(s_replay_ring_mutex);
+
+	if (s_replay_frames_to_dump > 0)
+	{
+		// A replay is being captured; the ring was cleared on rewind and starts
+		// reseeding once emulation has caught back up to the rewind point.
+		if (--s_replay_frames_to_dump == 0)
+		{
+			SConfig::GetInstance().m_DumpFrames = false;
+			Core::DisplayMessage("Instant replay finished", 2000);
+		}
+		return;
+	}
+
+	if (!s_replay_ring_enabled)
+		return;
+
+	if (++s_replay_ring_frame_count < VideoInterface::GetTargetRefreshRate())
+		return;
+	s_replay_ring_frame_count = 0;
+
+	CaptureReplaySnapshot();
+}
+
+void PlayInstantReplay()
+{
+	std::vector<u8> base;
+	std::vector<u8> delta;
+
+	{
+		std::lock_guard<std::mutex> lk(s_replay_ring_mutex);
+		if (s_replay_ring.empty())
+		{
+			Core::DisplayMessage("No instant replay snapshot available", 2000);
+			return;
+		}
+
+		ReplayRingEntry& oldest = s_replay_ring.front();
+		base = s_replay_ring_bases[oldest.generation];
+		delta = std::move(oldest.delta);
+
+		// Dump until emulation is back at the point the rewind was requested.
+		s_replay_frames_to_dump = (u32)(s_replay_ring.size() - 1) *
+			VideoInterface::GetTargetRefreshRate() +
+			std::max(s_replay_ring_frame_count, 1u);
+
+		// The states ahead of the rewind point are stale now; reseed the ring
+		// once the replay has finished.
+		s_replay_ring_frame_count = 0;
+		s_replay_ring_capture_count = 0;
+		s_replay_ring.clear();
+		s_replay_ring_bases.clear();
+
+		SConfig::GetInstance().m_DumpFrames = true;
+	}
+
+	LoadFromBufferDelta(base, delta);
+}
+
 void VerifyBuffer(std::vector<u8>& buffer)
 {
 	bool wasUnpaused = Core::PauseAndLock(true);
@@ -265,6 +541,12 @@ static int GetEmptySlot(std::map<double, int> m)
 }
 
 static std::string MakeStateFilename(int number);
+static bool ReadStateData(const std::string& filename, StateHeader* out_header,
+	std::vector<u8>& ret_data, bool silent);
+static std::vector<u8> AcquirePrefetchBuffer();
+static void ReleasePrefetchBuffer(std::vector<u8>&& buffer);
+static void StorePrefetchedState(const std::string& filename, std::vector<u8>&& data,
+	const StateHeader& header, u64 file_size);
 
 // read state timestamps
 static std::map<double, int> GetSavedStates()
@@ -359,32 +641,51 @@ static void CompressAndDumpState(CompressAndDumpState_args save_args)
 
 	if (header.size != 0)  // non-zero header size means the state is compressed
 	{
-		lzo_uint i = 0;
-		while (true)
-		{
-			lzo_uint32 cur_len = 0;
-			lzo_uint out_len = 0;
-
-			if ((i + IN_LEN) >= buffer_size)
-			{
-				cur_len = (lzo_uint32)(buffer_size - i);
-			}
-			else
+		// The chunks of the container format are fully independent, so they can
+		// be compressed in parallel and written out sequentially afterwards,
+		// which keeps the on-disk format unchanged. The trailing short (or, for
+		// sizes that are exact multiples of IN_LEN, empty) chunk acts as the
+		// end marker, exactly like the old serial loop emitted.
+		const size_t chunk_count = buffer_size / IN_LEN + 1;
+		std::vector<std::vector<u8>> chunks(chunk_count);
+		std::atomic<size_t> next_chunk{0};
+		std::atomic<bool> failed{false};
+
+		auto compress_worker = [&]() {
+			HEAP_ALLOC(local_wrkmem, LZO1X_1_MEM_COMPRESS);
+			std::vector<u8> local_out(OUT_LEN);
+			size_t chunk;
+			while ((chunk = next_chunk.fetch_add(1)) < chunk_count && !failed.load())
 			{
-				cur_len = IN_LEN;
+				const size_t offset = chunk * IN_LEN;
+				const lzo_uint32 cur_len = (lzo_uint32)std::min<size_t>(IN_LEN, buffer_size - offset);
+				lzo_uint out_len = 0;
+				if (lzo1x_1_compress(buffer_data + offset, cur_len, local_out.data(), &out_len,
+					local_wrkmem) != LZO_E_OK)
+				{
+					failed.store(true);
+					return;
+				}
+				chunks[chunk].assign(local_out.data(), local_out.data() + out_len);
 			}
+		};
 
-			if (lzo1x_1_compress(buffer_data + i, cur_len, out, &out_len, wrkmem) != LZO_E_OK)
-				PanicAlertT("Internal LZO Error - compression failed");
-
-			// The size of the data to write is 'out_len'
-			f.WriteArray((lzo_uint32*)&out_len, 1);
-			f.WriteBytes(out, out_len);
+		const size_t worker_count =
+			std::min<size_t>(chunk_count, std::max(cpu_info.num_cores, 1));
+		std::vector<std::thread> workers;
+		for (size_t i = 0; i < worker_count; i++)
+			workers.emplace_back(compress_worker);
+		for (auto& worker : workers)
+			worker.join();
 
-			if (cur_len != IN_LEN)
-				break;
+		if (failed.load())
+			PanicAlertT("Internal LZO Error - compression failed");
 
-			i += cur_len;
+		for (const std::vector<u8>& chunk : chunks)
+		{
+			const lzo_uint32 out_len = (lzo_uint32)chunk.size();
+			f.WriteArray(&out_len, 1);
+			f.WriteBytes(chunk.data(), chunk.size());
 		}
 	}
 	else  // uncompressed
@@ -392,6 +693,30 @@ static void CompressAndDumpState(CompressAndDumpState_args save_args)
 		f.WriteBytes(buffer_data, buffer_size);
 	}
 
+	f.Close();
+
+	// Read-back verification, still off the CPU thread: decompress what just
+	// hit the disk and compare it against the serialized state. A verified
+	// copy doubles as a prefetch entry, so reloading the slot right away
+	// skips the file entirely.
+	const u64 expected_hash = GetHash64(buffer_data, (u32)buffer_size, 0);
+	std::vector<u8> readback = AcquirePrefetchBuffer();
+	StateHeader readback_header;
+	if (ReadStateData(filename, &readback_header, readback, true) &&
+		readback.size() == buffer_size &&
+		GetHash64(readback.data(), (u32)buffer_size, 0) == expected_hash)
+	{
+		StorePrefetchedState(filename, std::move(readback), readback_header,
+			File::GetSize(filename));
+	}
+	else
+	{
+		ReleasePrefetchBuffer(std::move(readback));
+		Core::DisplayMessage(
+			StringFromFormat("Save state verification failed for %s", filename.c_str()), 4000);
+		return;
+	}
+
 	Core::DisplayMessage(StringFromFormat("Saved State to %s", filename.c_str()), 2000);
 	Host_UpdateMainFrame();
 }
@@ -469,14 +794,21 @@ std::string GetInfoStringOfSlot(int slot, bool translate)
 	return Common::Timer::GetDateTimeFormatted(header.time);
 }
 
-static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_data)
+// Reads and decompresses a state file into ret_data, leaving it empty on any
+// error. With silent set, nothing is printed to the OSD and no panic alerts
+// are raised; this variant also does not synchronize with the save thread, so
+// it is usable from the prefetch and verification threads. Interactive
+// callers go through LoadFileStateData below.
+static bool ReadStateData(const std::string& filename, StateHeader* out_header,
+	std::vector<u8>& ret_data, bool silent)
 {
-	Flush();
+	ret_data.clear();
 	File::IOFile f(filename, "rb");
 	if (!f)
 	{
-		Core::DisplayMessage("State not found", 2000);
-		return;
+		if (!silent)
+			Core::DisplayMessage("State not found", 2000);
+		return false;
 	}
 
 	StateHeader header;
@@ -484,40 +816,82 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
 
 	if (strncmp(SConfig::GetInstance().GetGameID().c_str(), header.gameID, 6))
 	{
-		Core::DisplayMessage(
-			StringFromFormat("State belongs to a different game (ID %.*s)", 6, header.gameID), 2000);
-		return;
+		if (!silent)
+		{
+			Core::DisplayMessage(
+				StringFromFormat("State belongs to a different game (ID %.*s)", 6, header.gameID), 2000);
+		}
+		return false;
 	}
 
+	// Reuse the caller's allocation; the prefetch path hands in pooled buffers.
 	std::vector<u8> buffer;
+	buffer.swap(ret_data);
+	buffer.clear();
 
 	if (header.size != 0)  // non-zero size means the state is compressed
 	{
-		Core::DisplayMessage("Decompressing State...", 500);
+		if (!silent)
+			Core::DisplayMessage("Decompressing State...", 500);
 
 		buffer.resize(header.size);
 
-		lzo_uint i = 0;
+		// Every chunk except the trailing one decompresses to exactly IN_LEN
+		// bytes, so the output offset of each chunk is known up front. Read the
+		// compressed chunks sequentially, then decompress them in parallel.
+		std::vector<std::vector<u8>> chunks;
 		while (true)
 		{
 			lzo_uint32 cur_len = 0;  // number of bytes to read
-			lzo_uint new_len = 0;    // number of bytes to write
 
 			if (!f.ReadArray(&cur_len, 1))
 				break;
 
-			f.ReadBytes(out, cur_len);
-			const int res = lzo1x_decompress(out, cur_len, &buffer[i], &new_len, nullptr);
-			if (res != LZO_E_OK)
+			std::vector<u8> chunk(cur_len);
+			f.ReadBytes(chunk.data(), cur_len);
+			chunks.push_back(std::move(chunk));
+		}
+
+		std::atomic<size_t> next_chunk{0};
+		std::atomic<int> failed_result{LZO_E_OK};
+
+		auto decompress_worker = [&]() {
+			size_t chunk;
+			while ((chunk = next_chunk.fetch_add(1)) < chunks.size() &&
+				failed_result.load() == LZO_E_OK)
+			{
+				const size_t offset = chunk * IN_LEN;
+				if (offset > buffer.size())
+				{
+					failed_result.store(LZO_E_ERROR);
+					return;
+				}
+				lzo_uint new_len = 0;  // number of bytes to write
+				const int res = lzo1x_decompress(chunks[chunk].data(), chunks[chunk].size(),
+					buffer.data() + offset, &new_len, nullptr);
+				if (res != LZO_E_OK)
+					failed_result.store(res);
+			}
+		};
+
+		const size_t worker_count =
+			std::min<size_t>(chunks.size(), std::max(cpu_info.num_cores, 1));
+		std::vector<std::thread> workers;
+		for (size_t i = 0; i < worker_count; i++)
+			workers.emplace_back(decompress_worker);
+		for (auto& worker : workers)
+			worker.join();
+
+		if (failed_result.load() != LZO_E_OK)
+		{
+			if (!silent)
 			{
 				// This doesn't seem to happen anymore.
-				PanicAlertT("Internal LZO Error - decompression failed (%d) (%li, %li) \n"
+				PanicAlertT("Internal LZO Error - decompression failed (%d) \n"
 					"Try loading the state again",
-					res, i, new_len);
-				return;
+					failed_result.load());
 			}
-
-			i += new_len;
+			return false;
 		}
 	}
 	else  // uncompressed
@@ -527,13 +901,105 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
 
 		if (!f.ReadBytes(&buffer[0], size))
 		{
-			PanicAlert("wtf? reading bytes: %zu", size);
-			return;
+			if (!silent)
+				PanicAlert("wtf? reading bytes: %zu", size);
+			return false;
 		}
 	}
 
 	// all good
+	if (out_header)
+		*out_header = header;
 	ret_data.swap(buffer);
+	return true;
+}
+
+static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_data)
+{
+	Flush();
+	ReadStateData(filename, nullptr, ret_data, false);
+}
+
+// The pool recycles the large decompression buffers between prefetches, so
+// reopening the menu doesn't reallocate hundreds of megabytes each time.
+static std::vector<u8> AcquirePrefetchBuffer()
+{
+	std::lock_guard<std::mutex> lk(s_prefetch_mutex);
+	if (s_prefetch_buffer_pool.empty())
+		return {};
+	std::vector<u8> buffer = std::move(s_prefetch_buffer_pool.back());
+	s_prefetch_buffer_pool.pop_back();
+	return buffer;
+}
+
+static void ReleasePrefetchBuffer(std::vector<u8>&& buffer)
+{
+	if (buffer.capacity() == 0)
+		return;
+	buffer.clear();
+	std::lock_guard<std::mutex> lk(s_prefetch_mutex);
+	if (s_prefetch_buffer_pool.size() < PREFETCH_CACHE_MAX_ENTRIES)
+		s_prefetch_buffer_pool.push_back(std::move(buffer));
+}
+
+static void StorePrefetchedState(const std::string& filename, std::vector<u8>&& data,
+	const StateHeader& header, u64 file_size)
+{
+	std::lock_guard<std::mutex> lk(s_prefetch_mutex);
+	auto iter = s_prefetch_cache.find(filename);
+	if (iter == s_prefetch_cache.end())
+	{
+		if (s_prefetch_cache.size() >= PREFETCH_CACHE_MAX_ENTRIES)
+		{
+			auto victim = s_prefetch_cache.begin();
+			if (victim->second.data.capacity() != 0 &&
+				s_prefetch_buffer_pool.size() < PREFETCH_CACHE_MAX_ENTRIES)
+			{
+				victim->second.data.clear();
+				s_prefetch_buffer_pool.push_back(std::move(victim->second.data));
+			}
+			s_prefetch_cache.erase(victim);
+		}
+		iter = s_prefetch_cache.emplace(filename, PrefetchedState()).first;
+	}
+	iter->second.data = std::move(data);
+	iter->second.header = header;
+	iter->second.file_size = file_size;
+}
+
+// Copies a cached slot into buffer if the cache entry still matches the file
+// on disk. The copy (rather than a move) keeps repeated loads of the same
+// slot - the common practice-session pattern - hitting the cache.
+static bool TakePrefetchedState(const std::string& filename, std::vector<u8>& buffer)
+{
+	// A save to this slot may still be in flight; its rename/rewrite would
+	// make the header check below race, so settle the save thread first.
+	Flush();
+
+	std::lock_guard<std::mutex> lk(s_prefetch_mutex);
+	auto iter = s_prefetch_cache.find(filename);
+	if (iter == s_prefetch_cache.end())
+		return false;
+
+	StateHeader header;
+	File::IOFile f(filename, "rb");
+	if (!f || !f.ReadArray(&header, 1) || f.GetSize() != iter->second.file_size ||
+		header.time != iter->second.header.time || header.size != iter->second.header.size)
+	{
+		// The slot was rewritten (or the prefetch read a file mid-write):
+		// drop the entry and let the caller take the slow path.
+		if (iter->second.data.capacity() != 0 &&
+			s_prefetch_buffer_pool.size() < PREFETCH_CACHE_MAX_ENTRIES)
+		{
+			iter->second.data.clear();
+			s_prefetch_buffer_pool.push_back(std::move(iter->second.data));
+		}
+		s_prefetch_cache.erase(iter);
+		return false;
+	}
+
+	buffer = iter->second.data;
+	return true;
 }
 
 void LoadAs(const std::string& filename)
@@ -571,7 +1037,8 @@ void LoadAs(const std::string& filename)
 	// brackets here are so buffer gets freed ASAP
 	{
 		std::vector<u8> buffer;
-		LoadFileStateData(filename, buffer);
+		if (!TakePrefetchedState(filename, buffer))
+			LoadFileStateData(filename, buffer);
 
 		if (!buffer.empty())
 		{
@@ -587,6 +1054,11 @@ void LoadAs(const std::string& filename)
 	{
 		if (loadedSuccessfully)
 		{
+			// Fault the fastmem views back in while the core is still paused, so
+			// the first seconds of play don't stutter on soft page faults. This
+			// matters most for practice sessions that load states constantly.
+			Memory::PreTouchViews();
+
 			Core::DisplayMessage(StringFromFormat("Loaded state from %s", filename.c_str()), 2000);
 			if (File::Exists(filename + ".dtm"))
 				Movie::LoadInput(filename + ".dtm");
@@ -643,6 +1115,81 @@ void VerifyAt(const std::string& filename)
 	Core::PauseAndLock(false, wasUnpaused);
 }
 
+static void JoinPrefetchThread()
+{
+	if (s_prefetch_thread.joinable())
+		s_prefetch_thread.join();
+}
+
+// Reads one slot file into the prefetch cache, unless the cached copy still
+// matches it. Runs on the prefetch thread; a save replacing the file mid-read
+// at worst produces an entry that fails revalidation on load.
+static void PrefetchFile(const std::string& filename)
+{
+	if (!File::Exists(filename))
+		return;
+
+	{
+		std::lock_guard<std::mutex> lk(s_prefetch_mutex);
+		auto iter = s_prefetch_cache.find(filename);
+		if (iter != s_prefetch_cache.end())
+		{
+			StateHeader header;
+			File::IOFile f(filename, "rb");
+			if (f && f.ReadArray(&header, 1) && f.GetSize() == iter->second.file_size &&
+				header.time == iter->second.header.time && header.size == iter->second.header.size)
+				return;
+		}
+	}
+
+	std::vector<u8> buffer = AcquirePrefetchBuffer();
+	StateHeader header;
+	if (!ReadStateData(filename, &header, buffer, true))
+	{
+		ReleasePrefetchBuffer(std::move(buffer));
+		return;
+	}
+	StorePrefetchedState(filename, std::move(buffer), header, File::GetSize(filename));
+}
+
+void PrefetchSlot(int slot)
+{
+	if (!Core::IsRunning())
+		return;
+	JoinPrefetchThread();
+	const std::string filename = MakeStateFilename(slot);
+	s_prefetch_thread = std::thread([filename]() {
+		Common::SetCurrentThreadName("Savestate prefetch");
+		PrefetchFile(filename);
+	});
+}
+
+void PrefetchRecentSlots()
+{
+	if (!Core::IsRunning())
+		return;
+
+	// Gather the filenames here: GetSavedStates synchronizes with the save
+	// thread, which only the caller's thread may safely do.
+	const std::map<double, int> saved_states = GetSavedStates();
+	std::vector<std::string> filenames;
+	for (const auto& age_and_slot : saved_states)
+	{
+		if (filenames.size() >= PREFETCH_SLOT_COUNT)
+			break;
+		filenames.push_back(MakeStateFilename(age_and_slot.second));
+	}
+	if (filenames.empty())
+		return;
+
+	JoinPrefetchThread();
+	s_prefetch_thread = std::thread([filenames]() {
+		Common::SetCurrentThreadName("Savestate prefetch");
+		for (const std::string& filename : filenames)
+			PrefetchFile(filename);
+	});
+}
+
 void Init()
 {
 	if (lzo_init() != LZO_E_OK)
@@ -652,6 +1199,13 @@ void Init()
 void Shutdown()
 {
 	Flush();
+	JoinPrefetchThread();
+
+	{
+		std::lock_guard<std::mutex> lk(s_prefetch_mutex);
+		s_prefetch_cache.clear();
+		s_prefetch_buffer_pool.clear();
+	}
 
 	// swapping with an empty vector, rather than clear()ing
 	// this gives a better guarantee to free the allocated memory right NOW (as opposed to, actually,
@@ -665,6 +1219,13 @@ void Shutdown()
 		std::lock_guard<std::mutex> lk(g_cs_undo_load_buffer);
 		std::vector<u8>().swap(g_undo_load_buffer);
 	}
+
+	{
+		std::lock_guard<std::mutex> lk(s_replay_ring_mutex);
+		s_replay_frames_to_dump = 0;
+		std::deque<ReplayRingEntry>().swap(s_replay_ring);
+		s_replay_ring_bases.clear();
+	}
 }
 
 static std::string MakeStateFilename(int number)
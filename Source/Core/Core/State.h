@@ -53,6 +53,43 @@ void SaveToBuffer(std::vector<u8>& buffer);
 void LoadFromBuffer(std::vector<u8>& buffer);
 void VerifyBuffer(std::vector<u8>& buffer);
 
+// Incremental snapshots for high-frequency (e.g. per-frame rollback) use.
+// SaveToBufferDelta stores only the 4KB pages which differ from the base
+// snapshot; when base is empty (or the state size changed) it refreshes base
+// with a full snapshot instead and leaves delta empty. LoadFromBufferDelta
+// reconstructs the full state from base plus delta and loads it.
+void SaveToBufferDelta(std::vector<u8>& base, std::vector<u8>& delta);
+void LoadFromBufferDelta(std::vector<u8>& base, std::vector<u8>& delta);
+
+// Netplay rollback reconciliation. Same as the delta paths above, but without
+// the interactive-savestate netplay guard: a rollback load is the mechanism
+// that re-converges an input-predicting client with the authoritative input
+// stream, not a user action. SaveRollbackSnapshot must run on the CPU thread
+// (it quiesces the sibling threads itself); LoadRollbackSnapshot must run on
+// the host thread.
+void SaveRollbackSnapshot(std::vector<u8>& base, std::vector<u8>& delta);
+void LoadRollbackSnapshot(std::vector<u8>& base, std::vector<u8>& delta);
+
+// Instant replay: keeps a ring of one delta snapshot per emulated second
+// covering the last `seconds` seconds. PlayInstantReplay (host thread only,
+// like Load) rewinds to the oldest snapshot in the ring and dumps frames with
+// the regular frame dump machinery until emulation catches back up to the
+// point where the rewind was requested. Replays are only deterministic while
+// a movie recording is active; otherwise the replayed span runs on live input.
+void EnableReplayRing(u32 seconds);
+void DisableReplayRing();
+// Called once per frame on the CPU thread (from Core::FrameUpdateOnCPUThread).
+void ReplayRingFrameUpdate();
+void PlayInstantReplay();
+
+// Decompress slot files into an in-memory cache on a background thread so a
+// subsequent Load skips the disk read and decompression. Entries are
+// revalidated against the file on use, so stale prefetches are harmless.
+// PrefetchRecentSlots covers the most recently written slots; PrefetchSlot
+// targets one slot (e.g. the one the user just selected).
+void PrefetchRecentSlots();
+void PrefetchSlot(int slot);
+
 void LoadLastSaved(int i = 1);
 void SaveFirstSaved();
 void UndoSaveState();
@@ -18,6 +18,7 @@
 #include "DiscIO/CompressedBlob.h"
 #include "DiscIO/DriveBlob.h"
 #include "DiscIO/FileBlob.h"
+#include "DiscIO/LZOBlob.h"
 #include "DiscIO/TGCBlob.h"
 #include "DiscIO/WbfsBlob.h"
 
@@ -196,6 +197,8 @@ std::unique_ptr<IBlobReader> CreateBlobReader(const std::string& filename)
 		return CISOFileReader::Create(std::move(file));
 	case GCZ_MAGIC:
 		return CompressedBlobReader::Create(std::move(file), filename);
+	case LZO_BLOB_MAGIC:
+		return LZOBlobReader::Create(std::move(file), filename);
 	case TGC_MAGIC:
 		return TGCFileReader::Create(std::move(file));
 	case WBFS_MAGIC:
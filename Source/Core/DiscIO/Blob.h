@@ -32,7 +32,8 @@ enum class BlobType
 	GCZ,
 	CISO,
 	WBFS,
-	TGC
+	TGC,
+	LZO
 };
 
 class IBlobReader
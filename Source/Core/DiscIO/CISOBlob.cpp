@@ -53,10 +53,21 @@ bool CISOFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 	{
 		u64 const block = offset / m_block_size;
 		u64 const data_offset = offset % m_block_size;
-		u64 const bytes_to_read = std::min(m_block_size - data_offset, nbytes);
+		u64 bytes_to_read = std::min(m_block_size - data_offset, nbytes);
 
 		if (block < CISO_MAP_SIZE && UNUSED_BLOCK_ID != m_ciso_map[block])
 		{
+			// Coalesce physically adjacent blocks into one read. Sequential guest
+			// reads through a CISO image are usually physically sequential too, so
+			// this issues a single large read instead of one per block.
+			u64 next = block + 1;
+			while (bytes_to_read < nbytes && next < CISO_MAP_SIZE &&
+				UNUSED_BLOCK_ID != m_ciso_map[next] && m_ciso_map[next] == m_ciso_map[next - 1] + 1)
+			{
+				bytes_to_read = std::min<u64>(bytes_to_read + m_block_size, nbytes);
+				++next;
+			}
+
 			// calculate the base address
 			u64 const file_off = CISO_HEADER_SIZE + m_ciso_map[block] * (u64)m_block_size + data_offset;
 
@@ -68,6 +79,14 @@ bool CISOFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 		}
 		else
 		{
+			// Zero-fill across the whole run of unused blocks in one go.
+			u64 next = block + 1;
+			while (bytes_to_read < nbytes &&
+				(next >= CISO_MAP_SIZE || UNUSED_BLOCK_ID == m_ciso_map[next]))
+			{
+				bytes_to_read = std::min<u64>(bytes_to_read + m_block_size, nbytes);
+				++next;
+			}
 			std::fill_n(out_ptr, bytes_to_read, 0);
 		}
 
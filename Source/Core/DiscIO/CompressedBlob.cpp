@@ -8,6 +8,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cinttypes>
 #include <cstdio>
 #include <cstring>
@@ -17,12 +18,14 @@
 #include <vector>
 #include <zlib.h>
 
+#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
 #include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
+#include "Common/ThreadPool.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/CompressedBlob.h"
 #include "DiscIO/DiscScrubber.h"
@@ -55,6 +58,10 @@ CompressedBlobReader::CompressedBlobReader(File::IOFile file, const std::string&
 // I still add some safety margin.
 	const u32 zlib_buffer_size = m_header.block_size + 64;
 	m_zlib_buffer.resize(zlib_buffer_size);
+
+	// Read several blocks per cache line so that large sequential reads reach
+	// ReadMultipleAlignedBlocks in spans big enough to inflate in parallel.
+	SetChunkSize(8);
 }
 
 std::unique_ptr<CompressedBlobReader> CompressedBlobReader::Create(File::IOFile file,
@@ -110,8 +117,14 @@ bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
 		return false;
 	}
 
+	return DecompressBlock(m_zlib_buffer.data(), comp_block_size, uncompressed, block_num, out_ptr);
+}
+
+bool CompressedBlobReader::DecompressBlock(const u8* in_ptr, u32 comp_block_size,
+	bool uncompressed, u64 block_num, u8* out_ptr) const
+{
 	// First, check hash.
-	u32 block_hash = HashAdler32(m_zlib_buffer.data(), comp_block_size);
+	u32 block_hash = HashAdler32(in_ptr, comp_block_size);
 	if (block_hash != m_hashes[block_num])
 		PanicAlertT("The disc image \"%s\" is corrupt.\n"
 			"Hash of block %" PRIu64 " is %08x instead of %08x.",
@@ -119,12 +132,12 @@ bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
 
 	if (uncompressed)
 	{
-		std::copy(m_zlib_buffer.begin(), m_zlib_buffer.begin() + comp_block_size, out_ptr);
+		std::copy(in_ptr, in_ptr + comp_block_size, out_ptr);
 	}
 	else
 	{
 		z_stream z = {};
-		z.next_in = m_zlib_buffer.data();
+		z.next_in = const_cast<u8*>(in_ptr);
 		z.avail_in = comp_block_size;
 		if (z.avail_in > m_header.block_size)
 		{
@@ -151,6 +164,75 @@ bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
 	return true;
 }
 
+bool CompressedBlobReader::ReadMultipleAlignedBlocks(u64 block_num, u64 num_blocks, u8* out_ptr)
+{
+	if (num_blocks < 2)
+		return SectorReader::ReadMultipleAlignedBlocks(block_num, num_blocks, out_ptr);
+
+	// The compressed data of consecutive blocks is contiguous in the file, so the
+	// whole span can be fetched with a single read instead of one seek+read per
+	// block, and the blocks are independent zlib streams that can inflate on
+	// separate cores.
+	constexpr u64 UNCOMPRESSED_FLAG = 1ULL << 63;
+	const u64 first_offset = m_block_pointers[block_num] & ~UNCOMPRESSED_FLAG;
+	const u64 last_block = block_num + num_blocks - 1;
+	const u64 total_size = (m_block_pointers[last_block] & ~UNCOMPRESSED_FLAG) +
+		(u32)GetBlockCompressedSize(last_block) - first_offset;
+
+	std::vector<u8> comp_buffer(total_size);
+	m_file.Seek(first_offset + m_data_offset, SEEK_SET);
+	if (!m_file.ReadBytes(comp_buffer.data(), total_size))
+	{
+		PanicAlertT("The disc image \"%s\" is truncated, some of the data is missing.",
+			m_file_name.c_str());
+		m_file.Clear();
+		return false;
+	}
+
+	struct InflateState
+	{
+		std::atomic<u64> next_block{ 0 };
+		std::atomic<u64> done_blocks{ 0 };
+		std::atomic<bool> failed{ false };
+	};
+	auto state = std::make_shared<InflateState>();
+
+	const u8* comp_data = comp_buffer.data();
+	const u64* block_pointers = m_block_pointers.data() + block_num;
+	const u32 block_size = m_header.block_size;
+	auto worker = [this, state, comp_data, block_pointers, first_offset, block_num, num_blocks,
+		block_size, out_ptr]() {
+		u64 i;
+		while ((i = state->next_block.fetch_add(1, std::memory_order_relaxed)) < num_blocks)
+		{
+			const u64 pointer = block_pointers[i];
+			if (!DecompressBlock(comp_data + ((pointer & ~UNCOMPRESSED_FLAG) - first_offset),
+				(u32)GetBlockCompressedSize(block_num + i), (pointer & UNCOMPRESSED_FLAG) != 0,
+				block_num + i, out_ptr + i * block_size))
+			{
+				state->failed.store(true, std::memory_order_relaxed);
+			}
+			state->done_blocks.fetch_add(1, std::memory_order_release);
+		}
+	};
+
+	if (num_blocks >= 4 && cpu_info.num_cores > 2)
+	{
+		// Workers claim blocks off the shared counter; the calling thread joins in.
+		// A task that starts after all blocks are claimed simply exits.
+		const u64 num_workers = std::min<u64>(num_blocks, cpu_info.num_cores) - 1;
+		for (u64 i = 0; i < num_workers; i++)
+			Common::AsyncWorker::ExecuteAsync(worker);
+	}
+	worker();
+
+	u32 loopcount = 0;
+	while (state->done_blocks.load(std::memory_order_acquire) < num_blocks)
+		Common::cYield(loopcount++);
+
+	return !state->failed.load(std::memory_order_relaxed);
+}
+
 bool CompressFileToBlob(const std::string& infile_path, const std::string& outfile_path,
 	u32 sub_type, int block_size, CompressCB callback, void* arg)
 {
@@ -192,10 +274,6 @@ bool CompressFileToBlob(const std::string& infile_path, const std::string& outfi
 		scrubbing = true;
 	}
 
-	z_stream z = {};
-	if (deflateInit(&z, 9) != Z_OK)
-		return false;
-
 	callback(GetStringT("Files opened, ready to compress."), 0, arg);
 
 	CompressedBlobHeader header;
@@ -209,8 +287,19 @@ bool CompressFileToBlob(const std::string& infile_path, const std::string& outfi
 
 	std::vector<u64> offsets(header.num_blocks);
 	std::vector<u32> hashes(header.num_blocks);
-	std::vector<u8> out_buf(block_size);
-	std::vector<u8> in_buf(block_size);
+
+	// Blocks are independent deflate streams, so a batch of them can be
+	// compressed on all cores at once while reading and writing stay serial
+	// and in order. Each worker owns a private z_stream.
+	const u32 batch_blocks = (cpu_info.num_cores > 2) ? cpu_info.num_cores * 4 : 1;
+	std::vector<std::vector<u8>> in_bufs(batch_blocks);
+	std::vector<std::vector<u8>> out_bufs(batch_blocks);
+	std::vector<int> comp_sizes(batch_blocks);  // < 0 means the block has to be stored raw
+	for (u32 i = 0; i < batch_blocks; i++)
+	{
+		in_bufs[i].resize(block_size);
+		out_bufs[i].resize(block_size);
+	}
 
 	// seek past the header (we will write it at the end)
 	outfile.Seek(sizeof(CompressedBlobHeader), SEEK_CUR);
@@ -223,22 +312,24 @@ bool CompressFileToBlob(const std::string& infile_path, const std::string& outfi
 	u64 position = 0;
 	int num_compressed = 0;
 	int num_stored = 0;
-	int progress_monitor = std::max<int>(1, header.num_blocks / 1000);
+	u32 progress_monitor = std::max<u32>(1, header.num_blocks / 1000);
+	u32 next_progress = 0;
 	bool success = true;
 
-	for (u32 i = 0; i < header.num_blocks; i++)
+	for (u32 first = 0; first < header.num_blocks && success; first += batch_blocks)
 	{
-		if (i % progress_monitor == 0)
+		if (first >= next_progress)
 		{
+			next_progress = first + progress_monitor;
 			const u64 inpos = infile.Tell();
 			int ratio = 0;
 			if (inpos != 0)
 				ratio = (int)(100 * position / inpos);
 
 			std::string temp =
-				StringFromFormat(GetStringT("%i of %i blocks. Compression ratio %i%%").c_str(), i,
+				StringFromFormat(GetStringT("%i of %i blocks. Compression ratio %i%%").c_str(), first,
 					header.num_blocks, ratio);
-			bool was_cancelled = !callback(temp, (float)i / (float)header.num_blocks, arg);
+			bool was_cancelled = !callback(temp, (float)first / (float)header.num_blocks, arg);
 			if (was_cancelled)
 			{
 				success = false;
@@ -246,64 +337,121 @@ bool CompressFileToBlob(const std::string& infile_path, const std::string& outfi
 			}
 		}
 
-		offsets[i] = position;
+		const u32 blocks_in_batch = std::min(batch_blocks, header.num_blocks - first);
 
-		size_t read_bytes;
-		if (scrubbing)
-			read_bytes = disc_scrubber.GetNextBlock(infile, in_buf.data());
-		else
-			infile.ReadArray(in_buf.data(), header.block_size, &read_bytes);
-		if (read_bytes < header.block_size)
-			std::fill(in_buf.begin() + read_bytes, in_buf.begin() + header.block_size, 0);
-
-		int retval = deflateReset(&z);
-		z.next_in = in_buf.data();
-		z.avail_in = header.block_size;
-		z.next_out = out_buf.data();
-		z.avail_out = block_size;
-
-		if (retval != Z_OK)
+		// Reading has to stay serial (the scrubber walks the input in order),
+		// so fill the whole batch before fanning out.
+		for (u32 i = 0; i < blocks_in_batch; i++)
 		{
-			ERROR_LOG(DISCIO, "Deflate failed");
-			success = false;
-			break;
+			size_t read_bytes;
+			if (scrubbing)
+				read_bytes = disc_scrubber.GetNextBlock(infile, in_bufs[i].data());
+			else
+				infile.ReadArray(in_bufs[i].data(), header.block_size, &read_bytes);
+			if (read_bytes < header.block_size)
+				std::fill(in_bufs[i].begin() + read_bytes, in_bufs[i].end(), 0);
 		}
 
-		int status = deflate(&z, Z_FINISH);
-		int comp_size = block_size - z.avail_out;
-
-		u8* write_buf;
-		int write_size;
-		if ((status != Z_STREAM_END) || (z.avail_out < 10))
+		struct DeflateState
 		{
-			// PanicAlert("%i %i Store %i", i*block_size, position, comp_size);
-			// let's store uncompressed
-			write_buf = in_buf.data();
-			offsets[i] |= 0x8000000000000000ULL;
-			write_size = block_size;
-			num_stored++;
-		}
-		else
+			std::atomic<u32> next_block{ 0 };
+			std::atomic<u32> done_blocks{ 0 };
+			std::atomic<bool> failed{ false };
+		};
+		auto state = std::make_shared<DeflateState>();
+
+		std::vector<u8>* in_ptr = in_bufs.data();
+		std::vector<u8>* out_ptr = out_bufs.data();
+		int* comp_ptr = comp_sizes.data();
+		const u32 blk_size = header.block_size;
+		auto worker = [state, in_ptr, out_ptr, comp_ptr, blocks_in_batch, blk_size]() {
+			z_stream z = {};
+			const bool init_ok = deflateInit(&z, 9) == Z_OK;
+			if (!init_ok)
+				state->failed.store(true, std::memory_order_relaxed);
+
+			u32 i;
+			while ((i = state->next_block.fetch_add(1, std::memory_order_relaxed)) < blocks_in_batch)
+			{
+				if (init_ok && deflateReset(&z) == Z_OK)
+				{
+					z.next_in = in_ptr[i].data();
+					z.avail_in = blk_size;
+					z.next_out = out_ptr[i].data();
+					z.avail_out = blk_size;
+
+					int status = deflate(&z, Z_FINISH);
+					// A block that did not shrink is stored raw, just as before.
+					if ((status != Z_STREAM_END) || (z.avail_out < 10))
+						comp_ptr[i] = -1;
+					else
+						comp_ptr[i] = (int)(blk_size - z.avail_out);
+				}
+				else
+				{
+					state->failed.store(true, std::memory_order_relaxed);
+				}
+				state->done_blocks.fetch_add(1, std::memory_order_release);
+			}
+
+			if (init_ok)
+				deflateEnd(&z);
+		};
+
+		if (blocks_in_batch >= 4 && cpu_info.num_cores > 2)
 		{
-			// let's store compressed
-			// PanicAlert("Comp %i to %i", block_size, comp_size);
-			write_buf = out_buf.data();
-			write_size = comp_size;
-			num_compressed++;
+			const u32 num_workers = std::min<u32>(blocks_in_batch, cpu_info.num_cores) - 1;
+			for (u32 i = 0; i < num_workers; i++)
+				Common::AsyncWorker::ExecuteAsync(worker);
 		}
+		worker();
+
+		u32 loopcount = 0;
+		while (state->done_blocks.load(std::memory_order_acquire) < blocks_in_batch)
+			Common::cYield(loopcount++);
 
-		if (!outfile.WriteBytes(write_buf, write_size))
+		if (state->failed.load(std::memory_order_relaxed))
 		{
-			PanicAlertT("Failed to write the output file \"%s\".\n"
-				"Check that you have enough space available on the target drive.",
-				outfile_path.c_str());
+			ERROR_LOG(DISCIO, "Deflate failed");
 			success = false;
 			break;
 		}
 
-		position += write_size;
+		for (u32 i = 0; i < blocks_in_batch; i++)
+		{
+			offsets[first + i] = position;
+
+			u8* write_buf;
+			int write_size;
+			if (comp_sizes[i] < 0)
+			{
+				// let's store uncompressed
+				write_buf = in_bufs[i].data();
+				offsets[first + i] |= 0x8000000000000000ULL;
+				write_size = blk_size;
+				num_stored++;
+			}
+			else
+			{
+				// let's store compressed
+				write_buf = out_bufs[i].data();
+				write_size = comp_sizes[i];
+				num_compressed++;
+			}
 
-		hashes[i] = HashAdler32(write_buf, write_size);
+			if (!outfile.WriteBytes(write_buf, write_size))
+			{
+				PanicAlertT("Failed to write the output file \"%s\".\n"
+					"Check that you have enough space available on the target drive.",
+					outfile_path.c_str());
+				success = false;
+				break;
+			}
+
+			position += write_size;
+
+			hashes[first + i] = HashAdler32(write_buf, write_size);
+		}
 	}
 
 	header.compressed_data_size = position;
@@ -323,9 +471,6 @@ bool CompressFileToBlob(const std::string& infile_path, const std::string& outfi
 		outfile.WriteArray(hashes.data(), header.num_blocks);
 	}
 
-	// Cleanup
-	deflateEnd(&z);
-
 	if (success)
 	{
 		callback(GetStringT("Done compressing disc image."), 1.0f, arg);
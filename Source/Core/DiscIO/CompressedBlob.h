@@ -54,9 +54,17 @@ public:
 	u64 GetBlockCompressedSize(u64 block_num) const;
 	bool GetBlock(u64 block_num, u8* out_ptr) override;
 
+protected:
+	bool ReadMultipleAlignedBlocks(u64 block_num, u64 num_blocks, u8* out_ptr) override;
+
 private:
 	CompressedBlobReader(File::IOFile file, const std::string& filename);
 
+	// Verifies and inflates (or copies) a single block. Only touches immutable
+	// reader state, so it's safe to call from several threads at once.
+	bool DecompressBlock(const u8* in_ptr, u32 comp_block_size, bool uncompressed, u64 block_num,
+		u8* out_ptr) const;
+
 	CompressedBlobHeader m_header;
 	std::vector<u64> m_block_pointers;
 	std::vector<u32> m_hashes;
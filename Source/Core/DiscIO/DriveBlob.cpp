@@ -13,6 +13,7 @@
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/Thread.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DriveBlob.h"
 
@@ -39,7 +40,7 @@ DriveReader::DriveReader(const std::string& drive)
 	// and just cause IO stalls from the read delay. Smaller values allow
 	// the OS IO and seeking overhead to ourstrip the time actually spent
 	// transferring bytes from the media.
-	SetChunkSize(32);  // 32*2048 = 64KiB
+	SetChunkSize(CHUNK_BLOCKS);  // 32*2048 = 64KiB
 	SetSectorSize(2048);
 #ifdef _WIN32
 	auto const path = UTF8ToTStr(std::string("\\\\.\\") + drive);
@@ -101,6 +102,16 @@ DriveReader::DriveReader(const std::string& drive)
 
 DriveReader::~DriveReader()
 {
+	// Stop the prefetch worker before closing the device.
+	if (m_prefetch_thread.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> guard(m_ring_mutex);
+			m_worker_shutdown = true;
+		}
+		m_worker_wakeup.notify_one();
+		m_prefetch_thread.join();
+	}
 #ifdef _WIN32
 #ifdef _LOCKDRIVE  // Do we want to lock the drive?
 	// Unlock the disc in the CD-ROM drive.
@@ -123,17 +134,146 @@ std::unique_ptr<DriveReader> DriveReader::Create(const std::string& drive)
 	auto reader = std::unique_ptr<DriveReader>(new DriveReader(drive));
 
 	if (!reader->IsOK())
+	{
 		reader.reset();
+	}
+	else
+	{
+		reader->m_total_blocks = reader->m_size / reader->GetSectorSize();
+		if (reader->m_total_blocks)
+		{
+			// With a known media size we can run the ring cache and read-ahead
+			// worker. If the size query failed we fall back to plain
+			// synchronous reads (m_ring stays empty).
+			reader->m_ring.resize(RING_CHUNKS);
+			reader->m_prefetch_thread = std::thread(&DriveReader::PrefetchThreadFunc, reader.get());
+		}
+	}
 
 	return reader;
 }
 
+u32 DriveReader::ChunkBlockCount(u64 chunk_idx) const
+{
+	const u64 first_block = chunk_idx * CHUNK_BLOCKS;
+	if (first_block >= m_total_blocks)
+		return 0;
+	return static_cast<u32>(std::min<u64>(u64(CHUNK_BLOCKS), m_total_blocks - first_block));
+}
+
 bool DriveReader::GetBlock(u64 block_num, u8* out_ptr)
 {
 	return DriveReader::ReadMultipleAlignedBlocks(block_num, 1, out_ptr);
 }
 
 bool DriveReader::ReadMultipleAlignedBlocks(u64 block_num, u64 num_blocks, u8* out_ptr)
+{
+	// Unknown media size means no cache and no worker; read directly.
+	if (m_ring.empty())
+		return ReadFromDrive(block_num, num_blocks, out_ptr);
+
+	while (num_blocks)
+	{
+		const u64 chunk_idx = block_num / CHUNK_BLOCKS;
+		const u32 offset_in_chunk = static_cast<u32>(block_num % CHUNK_BLOCKS);
+		const u32 blocks_wanted =
+			static_cast<u32>(std::min<u64>(num_blocks, u64(CHUNK_BLOCKS) - offset_in_chunk));
+
+		std::unique_lock<std::mutex> ring_guard(m_ring_mutex);
+		RingChunk& slot = m_ring[chunk_idx % RING_CHUNKS];
+		if (!slot.num_blocks || slot.chunk_idx != chunk_idx)
+		{
+			// Demand miss: fetch the chunk ourselves instead of waiting on
+			// the worker, which may be several chunks ahead of us.
+			const u32 chunk_blocks = ChunkBlockCount(chunk_idx);
+			if (!chunk_blocks)
+				return false;  // read past the end of the media
+
+			ring_guard.unlock();
+			std::vector<u8> chunk(CHUNK_BLOCKS * GetSectorSize());
+			{
+				std::lock_guard<std::mutex> device_guard(m_device_mutex);
+				if (!ReadFromDrive(chunk_idx * CHUNK_BLOCKS, chunk_blocks, chunk.data()))
+					return false;
+			}
+			ring_guard.lock();
+			slot.chunk_idx = chunk_idx;
+			slot.num_blocks = chunk_blocks;
+			slot.data.swap(chunk);
+		}
+		if (offset_in_chunk + blocks_wanted > slot.num_blocks)
+			return false;  // partial chunk at the end of the media
+
+		std::memcpy(out_ptr, slot.data.data() + offset_in_chunk * GetSectorSize(),
+			blocks_wanted * static_cast<size_t>(GetSectorSize()));
+
+		// Keep the worker READ_AHEAD_CHUNKS in front of wherever the emulated
+		// seek pattern just landed. Already-cached chunks are skipped by the
+		// worker, so re-arming the window on every access is cheap.
+		const u64 ahead_end = std::min(chunk_idx + 1 + READ_AHEAD_CHUNKS, TotalChunks());
+		if (ahead_end > m_prefetch_end || m_prefetch_pos > ahead_end)
+		{
+			m_prefetch_pos = chunk_idx + 1;
+			m_prefetch_end = ahead_end;
+			m_worker_wakeup.notify_one();
+		}
+		ring_guard.unlock();
+
+		block_num += blocks_wanted;
+		num_blocks -= blocks_wanted;
+		out_ptr += blocks_wanted * GetSectorSize();
+	}
+	return true;
+}
+
+void DriveReader::PrefetchThreadFunc()
+{
+	Common::SetCurrentThreadName("Disc prefetch");
+
+	std::unique_lock<std::mutex> ring_guard(m_ring_mutex);
+	while (!m_worker_shutdown)
+	{
+		// Find the next chunk in the read-ahead window that is not cached yet.
+		u64 chunk_idx = 0;
+		u32 chunk_blocks = 0;
+		while (m_prefetch_pos < m_prefetch_end)
+		{
+			const u64 candidate = m_prefetch_pos++;
+			const RingChunk& slot = m_ring[candidate % RING_CHUNKS];
+			if (!slot.num_blocks || slot.chunk_idx != candidate)
+			{
+				chunk_idx = candidate;
+				chunk_blocks = ChunkBlockCount(candidate);
+				break;
+			}
+		}
+		if (!chunk_blocks)
+		{
+			m_worker_wakeup.wait(ring_guard);
+			continue;
+		}
+
+		ring_guard.unlock();
+		std::vector<u8> chunk(CHUNK_BLOCKS * GetSectorSize());
+		bool ok;
+		{
+			std::lock_guard<std::mutex> device_guard(m_device_mutex);
+			ok = ReadFromDrive(chunk_idx * CHUNK_BLOCKS, chunk_blocks, chunk.data());
+		}
+		ring_guard.lock();
+		if (ok)
+		{
+			// The demand path may have raced us to this chunk; the contents
+			// are identical either way, so last write wins.
+			RingChunk& slot = m_ring[chunk_idx % RING_CHUNKS];
+			slot.chunk_idx = chunk_idx;
+			slot.num_blocks = chunk_blocks;
+			slot.data.swap(chunk);
+		}
+	}
+}
+
+bool DriveReader::ReadFromDrive(u64 block_num, u64 num_blocks, u8* out_ptr)
 {
 #ifdef _WIN32
 	LARGE_INTEGER offset;
@@ -4,8 +4,12 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
@@ -31,6 +35,43 @@ private:
 	bool GetBlock(u64 block_num, u8* out_ptr) override;
 	bool ReadMultipleAlignedBlocks(u64 block_num, u64 num_blocks, u8* out_ptr) override;
 
+	// One chunk worth of sectors in the LBA-keyed ring cache. A slot with
+	// num_blocks == 0 is empty; the slot for chunk N is m_ring[N % RING_CHUNKS].
+	struct RingChunk
+	{
+		u64 chunk_idx = 0;
+		u32 num_blocks = 0;
+		std::vector<u8> data;
+	};
+
+	// Raw synchronous device IO. Demand misses and the prefetch worker both
+	// end up here; m_device_mutex serializes them so the drive never sees
+	// overlapped requests (most optical drives handle those poorly anyway).
+	bool ReadFromDrive(u64 block_num, u64 num_blocks, u8* out_ptr);
+
+	void PrefetchThreadFunc();
+	u64 TotalChunks() const { return (m_total_blocks + CHUNK_BLOCKS - 1) / CHUNK_BLOCKS; }
+	u32 ChunkBlockCount(u64 chunk_idx) const;
+
+	// Must match the SetChunkSize() value in the constructor.
+	static const u32 CHUNK_BLOCKS = 32;
+	// 128 chunks * 64KiB = 8MiB of media kept around the current position.
+	// Direct-mapped by chunk index, so sequential playback cycles through
+	// the ring naturally and backtracking seeks within 8MiB still hit.
+	static const u32 RING_CHUNKS = 128;
+	// How many chunks the worker keeps queued in front of the last demand
+	// read. Small on purpose: a deep queue just delays the next real seek.
+	static const u32 READ_AHEAD_CHUNKS = 4;
+
+	std::vector<RingChunk> m_ring;
+	std::mutex m_ring_mutex;     // guards m_ring and the prefetch window
+	std::mutex m_device_mutex;   // serializes ReadFromDrive calls
+	std::condition_variable m_worker_wakeup;
+	std::thread m_prefetch_thread;
+	bool m_worker_shutdown = false;
+	u64 m_prefetch_pos = 0;  // next chunk the worker will fetch
+	u64 m_prefetch_end = 0;  // exclusive end of the read-ahead window
+
 #ifdef _WIN32
 	HANDLE m_disc_handle = INVALID_HANDLE_VALUE;
 	PREVENT_MEDIA_REMOVAL m_lock_cdrom;
@@ -40,6 +81,7 @@ private:
 	bool IsOK() const { return m_file.IsOpen() && m_file.IsGood(); }
 #endif
 	u64 m_size = 0;
+	u64 m_total_blocks = 0;
 };
 
 }  // namespace
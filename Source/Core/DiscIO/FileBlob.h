@@ -18,6 +18,7 @@ class PlainFileReader : public IBlobReader
 {
 public:
 	static std::unique_ptr<PlainFileReader> Create(File::IOFile file);
+	~PlainFileReader();
 
 	BlobType GetBlobType() const override { return BlobType::PLAIN; }
 	u64 GetDataSize() const override { return m_size; }
@@ -29,6 +30,14 @@ private:
 
 	File::IOFile m_file;
 	s64 m_size;
+
+	// Read-only mapping of the whole image on 64-bit hosts. Read becomes a
+	// single memcpy out of the page cache instead of a seek+read syscall pair.
+	// nullptr if mapping failed; we then fall back to plain file reads.
+	const u8* m_map = nullptr;
+#ifdef _WIN32
+	void* m_mapping_handle = nullptr;
+#endif
 };
 
 }  // namespace
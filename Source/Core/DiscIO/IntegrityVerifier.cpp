@@ -0,0 +1,218 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <zlib.h>
+
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+#include "Common/Thread.h"
+#include "DiscIO/IntegrityVerifier.h"
+
+namespace DiscIO
+{
+// 1MB keeps the requests large enough for sequential disk bandwidth while
+// letting cancellation and progress saving react quickly.
+static const size_t CHUNK_SIZE = 1024 * 1024;
+
+// Persist progress at most once per this many hashed bytes per file, so a
+// crash or shutdown mid-scan loses little work without turning the progress
+// file into write traffic of its own.
+static const u64 PROGRESS_SAVE_INTERVAL = 64 * 1024 * 1024;
+
+static std::string ProgressFilePath()
+{
+	return File::GetUserPath(D_CACHE_IDX) + "verify.cache";
+}
+
+IntegrityVerifier::IntegrityVerifier(std::vector<Job> jobs, ResultCallback callback)
+	: m_jobs(std::move(jobs)), m_callback(std::move(callback))
+{
+}
+
+IntegrityVerifier::~IntegrityVerifier()
+{
+	Stop();
+}
+
+void IntegrityVerifier::Start()
+{
+	if (m_jobs.empty() || m_running.exchange(true))
+		return;
+
+	m_cancel.store(false);
+	m_next_job.store(0);
+	LoadProgress();
+
+	// Two workers are enough to keep a disk busy; more would just turn the
+	// sequential reads into seek traffic.
+	const size_t worker_count = std::min<size_t>(m_jobs.size(), 2);
+	m_active_workers.store(worker_count);
+	for (size_t i = 0; i < worker_count; i++)
+		m_workers.emplace_back(&IntegrityVerifier::WorkerThread, this);
+}
+
+void IntegrityVerifier::Stop()
+{
+	m_cancel.store(true);
+	for (auto& worker : m_workers)
+	{
+		if (worker.joinable())
+			worker.join();
+	}
+	m_workers.clear();
+	m_cancel.store(false);
+}
+
+void IntegrityVerifier::WorkerThread()
+{
+	Common::SetCurrentThreadName("Integrity verifier");
+
+	while (!m_cancel.load())
+	{
+		const size_t index = m_next_job.fetch_add(1);
+		if (index >= m_jobs.size())
+			break;
+		VerifyFile(m_jobs[index]);
+	}
+
+	// The last worker out persists whatever progress is left (nothing after a
+	// completed scan, the partial offsets after a cancelled one).
+	if (m_active_workers.fetch_sub(1) == 1)
+	{
+		SaveProgress();
+		m_running.store(false);
+	}
+}
+
+bool IntegrityVerifier::VerifyFile(const Job& job)
+{
+	Result result;
+	result.path = job.path;
+
+	File::IOFile file(job.path, "rb");
+	if (!file)
+	{
+		result.status = Status::ReadError;
+		if (m_callback)
+			m_callback(result);
+		return false;
+	}
+
+	const u64 size = file.GetSize();
+	u64 offset = 0;
+	u32 crc = static_cast<u32>(crc32(0L, Z_NULL, 0));
+
+	{
+		std::lock_guard<std::mutex> lk(m_progress_lock);
+		const auto it = m_progress.find(job.path);
+		// Only resume if the file still has the size it had when the progress
+		// was recorded; otherwise start over.
+		if (it != m_progress.end() && it->second.size == size && it->second.offset <= size)
+		{
+			offset = it->second.offset;
+			crc = it->second.crc;
+		}
+	}
+
+	std::vector<u8> chunk(CHUNK_SIZE);
+	u64 last_saved = offset;
+	file.Seek(offset, SEEK_SET);
+
+	while (offset < size)
+	{
+		if (m_cancel.load())
+		{
+			std::lock_guard<std::mutex> lk(m_progress_lock);
+			FileProgress& progress = m_progress[job.path];
+			progress.offset = offset;
+			progress.size = size;
+			progress.crc = crc;
+			return false;
+		}
+
+		const size_t len = static_cast<size_t>(std::min<u64>(CHUNK_SIZE, size - offset));
+		if (!file.ReadBytes(chunk.data(), len))
+		{
+			{
+				std::lock_guard<std::mutex> lk(m_progress_lock);
+				m_progress.erase(job.path);
+			}
+			result.status = Status::ReadError;
+			if (m_callback)
+				m_callback(result);
+			return false;
+		}
+
+		crc = static_cast<u32>(crc32(crc, chunk.data(), static_cast<uInt>(len)));
+		offset += len;
+
+		if (offset - last_saved >= PROGRESS_SAVE_INTERVAL)
+		{
+			last_saved = offset;
+			{
+				std::lock_guard<std::mutex> lk(m_progress_lock);
+				FileProgress& progress = m_progress[job.path];
+				progress.offset = offset;
+				progress.size = size;
+				progress.crc = crc;
+			}
+			SaveProgress();
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lk(m_progress_lock);
+		m_progress.erase(job.path);
+	}
+
+	result.crc32 = crc;
+	if (job.expected_crc32 != 0 && crc != job.expected_crc32)
+		result.status = Status::Mismatch;
+	if (m_callback)
+		m_callback(result);
+	return result.status == Status::Ok;
+}
+
+// One line per unfinished file: offset, size and running CRC in hex, then the
+// path (which may contain spaces, so it goes last and takes the line's rest).
+void IntegrityVerifier::LoadProgress()
+{
+	std::lock_guard<std::mutex> lk(m_progress_lock);
+	m_progress.clear();
+
+	std::ifstream in;
+	OpenFStream(in, ProgressFilePath(), std::ios::in);
+	std::string line;
+	while (std::getline(in, line))
+	{
+		std::istringstream ss(line);
+		FileProgress progress;
+		std::string path;
+		ss >> std::hex >> progress.offset >> progress.size >> progress.crc;
+		std::getline(ss, path);
+		if (ss.fail())
+			continue;
+		path.erase(0, path.find_first_not_of(' '));
+		if (!path.empty())
+			m_progress[path] = progress;
+	}
+}
+
+void IntegrityVerifier::SaveProgress()
+{
+	std::lock_guard<std::mutex> lk(m_progress_lock);
+
+	std::ofstream out;
+	OpenFStream(out, ProgressFilePath(), std::ios::out | std::ios::trunc);
+	for (const auto& entry : m_progress)
+	{
+		out << StringFromFormat("%llx %llx %x ", (unsigned long long)entry.second.offset,
+			(unsigned long long)entry.second.size, entry.second.crc)
+			<< entry.first << "\n";
+	}
+}
+}  // namespace DiscIO
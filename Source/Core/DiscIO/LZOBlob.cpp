@@ -0,0 +1,307 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <lzo/lzo1x.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/Logging/Log.h"
+#include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/LZOBlob.h"
+
+namespace DiscIO
+{
+static bool IsLZOBlob(File::IOFile& file)
+{
+	const u64 position = file.Tell();
+	if (!file.Seek(0, SEEK_SET))
+		return false;
+	LZOBlobHeader header;
+	bool is_lzo = file.ReadArray(&header, 1) && header.magic_cookie == LZO_BLOB_MAGIC;
+	file.Seek(position, SEEK_SET);
+	return is_lzo;
+}
+
+LZOBlobReader::LZOBlobReader(File::IOFile file, const std::string& filename)
+	: m_file(std::move(file)), m_file_name(filename)
+{
+	m_file_size = m_file.GetSize();
+	m_file.Seek(0, SEEK_SET);
+	m_file.ReadArray(&m_header, 1);
+
+	SetSectorSize(m_header.block_size);
+
+	// cache block pointers and hashes
+	m_block_pointers.resize(m_header.num_blocks);
+	m_file.ReadArray(m_block_pointers.data(), m_header.num_blocks);
+	m_hashes.resize(m_header.num_blocks);
+	m_file.ReadArray(m_hashes.data(), m_header.num_blocks);
+
+	m_data_offset = (sizeof(LZOBlobHeader)) +
+		(sizeof(u64)) * m_header.num_blocks     // skip block pointers
+		+ (sizeof(u32)) * m_header.num_blocks;  // skip hashes
+
+	// A compressed block is never much longer than a decompressed one; the margin
+	// covers LZO's worst case for incompressible input.
+	const u32 lzo_buffer_size = m_header.block_size + m_header.block_size / 16 + 64 + 3;
+	m_lzo_buffer.resize(lzo_buffer_size);
+
+	// Let SectorReader fault several blocks per cache line; together with the 32
+	// cache lines this gives a few MB of decompressed LRU cache.
+	SetChunkSize(8);
+}
+
+std::unique_ptr<LZOBlobReader> LZOBlobReader::Create(File::IOFile file, const std::string& filename)
+{
+	if (lzo_init() != LZO_E_OK)
+	{
+		PanicAlertT("Internal LZO Error - lzo_init() failed");
+		return nullptr;
+	}
+
+	if (IsLZOBlob(file))
+		return std::unique_ptr<LZOBlobReader>(new LZOBlobReader(std::move(file), filename));
+
+	return nullptr;
+}
+
+LZOBlobReader::~LZOBlobReader()
+{
+}
+
+u64 LZOBlobReader::GetBlockCompressedSize(u64 block_num) const
+{
+	u64 start = m_block_pointers[block_num];
+	if (block_num < m_header.num_blocks - 1)
+		return m_block_pointers[block_num + 1] - start;
+	else if (block_num == m_header.num_blocks - 1)
+		return m_header.compressed_data_size - start;
+	else
+		PanicAlert("GetBlockCompressedSize - illegal block number %i", (int)block_num);
+	return 0;
+}
+
+bool LZOBlobReader::GetBlock(u64 block_num, u8* out_ptr)
+{
+	bool uncompressed = false;
+	u32 comp_block_size = (u32)GetBlockCompressedSize(block_num);
+	u64 offset = m_block_pointers[block_num] + m_data_offset;
+
+	if (offset & (1ULL << 63))
+	{
+		if (comp_block_size != m_header.block_size)
+			PanicAlert("Uncompressed block with wrong size");
+		uncompressed = true;
+		offset &= ~(1ULL << 63);
+	}
+
+	m_file.Seek(offset, SEEK_SET);
+	if (!m_file.ReadBytes(m_lzo_buffer.data(), comp_block_size))
+	{
+		PanicAlertT("The disc image \"%s\" is truncated, some of the data is missing.",
+			m_file_name.c_str());
+		m_file.Clear();
+		return false;
+	}
+
+	// First, check hash.
+	u32 block_hash = HashAdler32(m_lzo_buffer.data(), comp_block_size);
+	if (block_hash != m_hashes[block_num])
+		PanicAlertT("The disc image \"%s\" is corrupt.\n"
+			"Hash of block %" PRIu64 " is %08x instead of %08x.",
+			m_file_name.c_str(), block_num, block_hash, m_hashes[block_num]);
+
+	if (uncompressed)
+	{
+		std::copy(m_lzo_buffer.begin(), m_lzo_buffer.begin() + comp_block_size, out_ptr);
+	}
+	else
+	{
+		lzo_uint uncomp_size = m_header.block_size;
+		const int status =
+			lzo1x_decompress_safe(m_lzo_buffer.data(), comp_block_size, out_ptr, &uncomp_size, nullptr);
+		if (status != LZO_E_OK)
+		{
+			PanicAlert("Failure reading block %" PRIu64 " - LZO decompression failed (%d).", block_num,
+				status);
+			return false;
+		}
+		if (uncomp_size != m_header.block_size)
+		{
+			PanicAlert("Wrong block size");
+			return false;
+		}
+	}
+	return true;
+}
+
+bool CompressFileToLZOBlob(const std::string& infile_path, const std::string& outfile_path,
+	u32 sub_type, int block_size, CompressCB callback, void* arg)
+{
+	if (lzo_init() != LZO_E_OK)
+	{
+		PanicAlertT("Internal LZO Error - lzo_init() failed");
+		return false;
+	}
+
+	File::IOFile infile(infile_path, "rb");
+	if (IsLZOBlob(infile))
+	{
+		PanicAlertT("\"%s\" is already compressed! Cannot compress it further.", infile_path.c_str());
+		return false;
+	}
+
+	if (!infile)
+	{
+		PanicAlertT("Failed to open the input file \"%s\".", infile_path.c_str());
+		return false;
+	}
+
+	File::IOFile outfile(outfile_path, "wb");
+	if (!outfile)
+	{
+		PanicAlertT("Failed to open the output file \"%s\".\n"
+			"Check that you have permissions to write the target folder and that the media can "
+			"be written.",
+			outfile_path.c_str());
+		return false;
+	}
+
+	if (callback)
+		callback(GetStringT("Files opened, ready to compress."), 0, arg);
+
+	LZOBlobHeader header;
+	header.magic_cookie = LZO_BLOB_MAGIC;
+	header.sub_type = sub_type;
+	header.block_size = block_size;
+	header.data_size = infile.GetSize();
+
+	// round upwards!
+	header.num_blocks = (u32)((header.data_size + (block_size - 1)) / block_size);
+
+	std::vector<u64> offsets(header.num_blocks);
+	std::vector<u32> hashes(header.num_blocks);
+	std::vector<u8> out_buf(block_size + block_size / 16 + 64 + 3);
+	std::vector<u8> in_buf(block_size);
+	std::vector<u8> wrkmem(LZO1X_1_MEM_COMPRESS);
+
+	// seek past the header (we will write it at the end)
+	outfile.Seek(sizeof(LZOBlobHeader), SEEK_CUR);
+	// seek past the offset and hash tables (we will write them at the end)
+	outfile.Seek((sizeof(u64) + sizeof(u32)) * header.num_blocks, SEEK_CUR);
+	// seek to the start of the input file to make sure we get everything
+	infile.Seek(0, SEEK_SET);
+
+	// Now we are ready to write compressed data!
+	u64 position = 0;
+	int num_compressed = 0;
+	int num_stored = 0;
+	int progress_monitor = std::max<int>(1, header.num_blocks / 1000);
+	bool success = true;
+
+	for (u32 i = 0; i < header.num_blocks; i++)
+	{
+		if (callback && i % progress_monitor == 0)
+		{
+			const u64 inpos = infile.Tell();
+			int ratio = 0;
+			if (inpos != 0)
+				ratio = (int)(100 * position / inpos);
+
+			std::string temp =
+				StringFromFormat(GetStringT("%i of %i blocks. Compression ratio %i%%").c_str(), i,
+					header.num_blocks, ratio);
+			bool was_cancelled = !callback(temp, (float)i / (float)header.num_blocks, arg);
+			if (was_cancelled)
+			{
+				success = false;
+				break;
+			}
+		}
+
+		offsets[i] = position;
+
+		size_t read_bytes;
+		infile.ReadArray(in_buf.data(), header.block_size, &read_bytes);
+		if (read_bytes < header.block_size)
+			std::fill(in_buf.begin() + read_bytes, in_buf.begin() + header.block_size, 0);
+
+		lzo_uint comp_size = 0;
+		const int status = lzo1x_1_compress(in_buf.data(), header.block_size, out_buf.data(),
+			&comp_size, wrkmem.data());
+
+		if (status != LZO_E_OK)
+		{
+			ERROR_LOG(DISCIO, "LZO compression failed (%d)", status);
+			success = false;
+			break;
+		}
+
+		u8* write_buf;
+		u32 write_size;
+		if (comp_size + 10 >= header.block_size)
+		{
+			// let's store uncompressed
+			write_buf = in_buf.data();
+			offsets[i] |= 0x8000000000000000ULL;
+			write_size = header.block_size;
+			num_stored++;
+		}
+		else
+		{
+			// let's store compressed
+			write_buf = out_buf.data();
+			write_size = (u32)comp_size;
+			num_compressed++;
+		}
+
+		if (!outfile.WriteBytes(write_buf, write_size))
+		{
+			PanicAlertT("Failed to write the output file \"%s\".\n"
+				"Check that you have enough space available on the target drive.",
+				outfile_path.c_str());
+			success = false;
+			break;
+		}
+
+		position += write_size;
+
+		hashes[i] = HashAdler32(write_buf, write_size);
+	}
+
+	header.compressed_data_size = position;
+
+	if (!success)
+	{
+		// Remove the incomplete output file.
+		outfile.Close();
+		File::Delete(outfile_path);
+	}
+	else
+	{
+		// Okay, go back and fill in headers
+		outfile.Seek(0, SEEK_SET);
+		outfile.WriteArray(&header, 1);
+		outfile.WriteArray(offsets.data(), header.num_blocks);
+		outfile.WriteArray(hashes.data(), header.num_blocks);
+	}
+
+	if (success && callback)
+	{
+		callback(GetStringT("Done compressing disc image."), 1.0f, arg);
+	}
+	return success;
+}
+
+}  // namespace
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cinttypes>
 #include <cstddef>
 #include <cstdio>
@@ -16,7 +17,10 @@
 #include <utility>
 #include <vector>
 
+#include <mbedtls/sha1.h>
+
 #include "Common/Align.h"
+#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/AES.h"
 #include "Common/FileUtil.h"
@@ -25,6 +29,7 @@
 #include "Common/NandPaths.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
+#include "Common/ThreadPool.h"
 // TODO: kill this dependency.
 #include "Core/IOS/ES/Formats.h"
 
@@ -183,29 +188,73 @@ void CNANDContentLoader::InitializeContentEntries(const std::vector<u8>& data_ap
 	const std::vector<IOS::ES::Content> contents = m_tmd.GetContents();
 	m_Content.resize(contents.size());
 
-	u32 data_app_offset = 0;
 	const std::vector<u8> title_key = m_ticket.GetTitleKey();
-	IOS::ES::SharedContentMap shared_content{ Common::FromWhichRoot::FROM_SESSION_ROOT };
 
-	for (size_t i = 0; i < contents.size(); ++i)
+	if (m_IsWAD)
 	{
-		const auto& content = contents.at(i);
+		// Every content block is encrypted independently (the IV is derived
+		// from the content index, not chained from the previous block), so a
+		// WAD's contents can be decrypted in parallel across the worker pool.
+		// Loading a large WAD is otherwise dominated by this serial AES work.
+		std::vector<u32> offsets(contents.size());
+		u32 data_app_offset = 0;
+		for (size_t i = 0; i < contents.size(); ++i)
+		{
+			offsets[i] = data_app_offset;
+			data_app_offset += Common::AlignUp(static_cast<u32>(contents[i].size), 0x40);
+		}
 
-		if (m_IsWAD)
+		struct DecryptState
+		{
+			std::atomic<u32> next_entry{ 0 };
+			std::atomic<u32> done_entries{ 0 };
+		};
+		const u32 count = static_cast<u32>(contents.size());
+		std::shared_ptr<DecryptState> state = std::make_shared<DecryptState>();
+		const std::vector<IOS::ES::Content>* contents_ptr = &contents;
+		const std::vector<u8>* data_ptr = &data_app;
+		const std::vector<u32>* offsets_ptr = &offsets;
+		const u8* key_ptr = title_key.data();
+		auto decrypt_entries = [=]()
 		{
-			// The content index is used as IV (2 bytes); the remaining 14 bytes are zeroes.
-			std::array<u8, 16> iv{};
-			iv[0] = static_cast<u8>(content.index >> 8) & 0xFF;
-			iv[1] = static_cast<u8>(content.index) & 0xFF;
+			u32 entry;
+			while ((entry = state->next_entry.fetch_add(1)) < count)
+			{
+				const auto& content = (*contents_ptr)[entry];
 
-			u32 rounded_size = Common::AlignUp(static_cast<u32>(content.size), 0x40);
+				// The content index is used as IV (2 bytes); the remaining 14 bytes are zeroes.
+				std::array<u8, 16> iv{};
+				iv[0] = static_cast<u8>(content.index >> 8) & 0xFF;
+				iv[1] = static_cast<u8>(content.index) & 0xFF;
 
-			m_Content[i].m_Data = std::make_unique<CNANDContentDataBuffer>(Common::AES::Decrypt(
-				title_key.data(), iv.data(), &data_app[data_app_offset], rounded_size));
-			data_app_offset += rounded_size;
+				u32 rounded_size = Common::AlignUp(static_cast<u32>(content.size), 0x40);
+
+				m_Content[entry].m_Data = std::make_unique<CNANDContentDataBuffer>(Common::AES::Decrypt(
+					key_ptr, iv.data(), &(*data_ptr)[(*offsets_ptr)[entry]], rounded_size));
+				state->done_entries.fetch_add(1);
+			}
+		};
+		const u32 num_workers = std::min(count, static_cast<u32>(cpu_info.num_cores));
+		for (u32 i = 1; i < num_workers; ++i)
+		{
+			Common::AsyncWorker::ExecuteAsync(std::function<void()>(decrypt_entries));
 		}
-		else
+		decrypt_entries();
+		// Tasks that were still queued when the entry counter drained exit
+		// without doing any work, so waiting on the decrypted entries is enough.
+		u32 loopcount = 0;
+		while (state->done_entries.load() < count)
 		{
+			Common::cYield(loopcount++);
+		}
+	}
+	else
+	{
+		IOS::ES::SharedContentMap shared_content{ Common::FromWhichRoot::FROM_SESSION_ROOT };
+		for (size_t i = 0; i < contents.size(); ++i)
+		{
+			const auto& content = contents.at(i);
+
 			std::string filename;
 			if (content.IsShared())
 				filename = shared_content.GetFilenameFromSHA1(content.sha1);
@@ -214,9 +263,10 @@ void CNANDContentLoader::InitializeContentEntries(const std::vector<u8>& data_ap
 
 			m_Content[i].m_Data = std::make_unique<CNANDContentDataFile>(filename);
 		}
-
-		m_Content[i].m_metadata = std::move(content);
 	}
+
+	for (size_t i = 0; i < contents.size(); ++i)
+		m_Content[i].m_metadata = contents[i];
 }
 
 CNANDContentManager::~CNANDContentManager()
@@ -289,6 +339,104 @@ u64 CNANDContentManager::Install_WiiWAD(const std::string& filename)
 
 	std::string content_path(Common::GetTitleContentPath(title_id, Common::FROM_CONFIGURED_ROOT));
 	std::string tmd_filename(Common::GetTMDFileName(title_id, Common::FROM_CONFIGURED_ROOT));
+
+	const auto& raw_tmd = content_loader.GetTMD().GetRawTMD();
+	IOS::ES::SharedContentMap shared_content{ Common::FromWhichRoot::FROM_CONFIGURED_ROOT };
+
+	// Manifest-level short-circuit: if the installed TMD is identical and
+	// every content it lists is already on the NAND, there is nothing to
+	// decrypt, verify or write - just refresh the ticket and uid.sys entry.
+	// This makes reprovisioning a machine with mostly-installed titles fast.
+	if (File::Exists(tmd_filename) && File::GetSize(tmd_filename) == raw_tmd.size())
+	{
+		File::IOFile existing_tmd_file(tmd_filename, "rb");
+		std::vector<u8> existing_tmd(raw_tmd.size());
+		if (existing_tmd_file && existing_tmd_file.ReadBytes(existing_tmd.data(), existing_tmd.size()) &&
+			existing_tmd == raw_tmd)
+		{
+			const bool all_present = std::all_of(
+				content_loader.GetContent().begin(), content_loader.GetContent().end(),
+				[&](const SNANDContent& content) {
+					std::string app_filename;
+					if (content.m_metadata.IsShared())
+						app_filename = shared_content.GetFilenameFromSHA1(content.m_metadata.sha1);
+					else
+						app_filename = StringFromFormat("%s%08x.app", content_path.c_str(), content.m_metadata.id);
+					return app_filename != "unk" && File::Exists(app_filename);
+				});
+			if (all_present)
+			{
+				INFO_LOG(DISCIO, "Title %08x/%08x is already installed, skipping content copy.",
+					(u32)(title_id >> 32), (u32)title_id);
+				if (!AddTicket(content_loader.GetTicket()))
+				{
+					PanicAlertT("WAD installation failed: error creating ticket");
+					return 0;
+				}
+				IOS::ES::UIDSys uid_sys{ Common::FromWhichRoot::FROM_CONFIGURED_ROOT };
+				uid_sys.GetOrInsertUIDForTitle(title_id);
+				ClearCache();
+				return title_id;
+			}
+		}
+	}
+
+	// Verify every content against the SHA-1 in the TMD before writing
+	// anything to the NAND, so a corrupt WAD never leaves a half-installed
+	// title behind. Hashing is spread across the worker pool the same way
+	// WAD decryption is; contents are independent.
+	{
+		const std::vector<SNANDContent>& wad_contents = content_loader.GetContent();
+		const u32 count = static_cast<u32>(wad_contents.size());
+		struct VerifyState
+		{
+			std::atomic<u32> next_entry{ 0 };
+			std::atomic<u32> done_entries{ 0 };
+			std::atomic<u32> mismatches{ 0 };
+		};
+		std::shared_ptr<VerifyState> state = std::make_shared<VerifyState>();
+		const std::vector<SNANDContent>* contents_ptr = &wad_contents;
+		auto verify_entries = [=]()
+		{
+			u32 entry;
+			while ((entry = state->next_entry.fetch_add(1)) < count)
+			{
+				const SNANDContent& content = (*contents_ptr)[entry];
+				const std::vector<u8> data = content.m_Data->Get();
+				std::array<u8, 20> digest{};
+				if (data.size() < content.m_metadata.size)
+				{
+					state->mismatches.fetch_add(1);
+				}
+				else
+				{
+					mbedtls_sha1(data.data(), static_cast<size_t>(content.m_metadata.size),
+						digest.data());
+					if (digest != content.m_metadata.sha1)
+						state->mismatches.fetch_add(1);
+				}
+				state->done_entries.fetch_add(1);
+			}
+		};
+		const u32 num_workers = std::min(count, static_cast<u32>(cpu_info.num_cores));
+		for (u32 i = 1; i < num_workers; ++i)
+		{
+			Common::AsyncWorker::ExecuteAsync(std::function<void()>(verify_entries));
+		}
+		verify_entries();
+		u32 loopcount = 0;
+		while (state->done_entries.load() < count)
+		{
+			Common::cYield(loopcount++);
+		}
+		if (state->mismatches.load())
+		{
+			PanicAlertT("WAD installation failed: %u content(s) failed SHA-1 verification",
+				state->mismatches.load());
+			return 0;
+		}
+	}
+
 	File::CreateFullPath(tmd_filename);
 
 	File::IOFile tmd_file(tmd_filename, "wb");
@@ -298,10 +446,8 @@ u64 CNANDContentManager::Install_WiiWAD(const std::string& filename)
 		return 0;
 	}
 
-	const auto& raw_tmd = content_loader.GetTMD().GetRawTMD();
 	tmd_file.WriteBytes(raw_tmd.data(), raw_tmd.size());
 
-	IOS::ES::SharedContentMap shared_content{ Common::FromWhichRoot::FROM_CONFIGURED_ROOT };
 	for (const auto& content : content_loader.GetContent())
 	{
 		std::string app_filename;
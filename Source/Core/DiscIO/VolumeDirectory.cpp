@@ -112,28 +112,29 @@ bool CVolumeDirectory::Read(u64 offset, u64 length, u8* buffer, bool decrypt) co
 		return true;
 
 	// Determine which file the offset refers to
-	std::map<u64, std::string>::const_iterator fileIter = m_virtual_disk.lower_bound(offset);
-	if (fileIter->first > offset && fileIter != m_virtual_disk.begin())
+	std::vector<SFileExtent>::const_iterator fileIter =
+		std::upper_bound(m_virtual_disk.begin(), m_virtual_disk.end(), offset,
+			[](u64 off, const SFileExtent& extent) { return off < extent.offset; });
+	if (fileIter != m_virtual_disk.begin())
 		--fileIter;
 
 	// zero fill to start of file data
-	PadToAddress(fileIter->first, &offset, &length, &buffer);
+	PadToAddress(fileIter->offset, &offset, &length, &buffer);
 
 	while (fileIter != m_virtual_disk.end() && length > 0)
 	{
-		_dbg_assert_(DVDINTERFACE, fileIter->first <= offset);
-		u64 fileOffset = offset - fileIter->first;
-		const std::string fileName = fileIter->second;
+		_dbg_assert_(DVDINTERFACE, fileIter->offset <= offset);
+		u64 fileOffset = offset - fileIter->offset;
 
-		File::IOFile file(fileName, "rb");
-		if (!file)
-			return false;
-
-		u64 fileSize = file.GetSize();
-
-		if (fileOffset < fileSize)
+		// The extent carries the size the FST was built with, so reads that
+		// only cover the alignment padding never have to touch the file.
+		if (fileOffset < fileIter->size)
 		{
-			u64 fileBytes = std::min(fileSize - fileOffset, length);
+			File::IOFile& file = OpenCachedFile(fileIter->filename);
+			if (!file)
+				return false;
+
+			u64 fileBytes = std::min(fileIter->size - fileOffset, length);
 
 			if (!file.Seek(fileOffset, SEEK_SET))
 				return false;
@@ -149,14 +150,25 @@ bool CVolumeDirectory::Read(u64 offset, u64 length, u8* buffer, bool decrypt) co
 
 		if (fileIter != m_virtual_disk.end())
 		{
-			_dbg_assert_(DVDINTERFACE, fileIter->first >= offset);
-			PadToAddress(fileIter->first, &offset, &length, &buffer);
+			_dbg_assert_(DVDINTERFACE, fileIter->offset >= offset);
+			PadToAddress(fileIter->offset, &offset, &length, &buffer);
 		}
 	}
 
 	return true;
 }
 
+File::IOFile& CVolumeDirectory::OpenCachedFile(const std::string& filename) const
+{
+	if (m_cached_file_name != filename || !m_cached_file.IsOpen())
+	{
+		m_cached_file.Close();
+		m_cached_file.Open(filename, "rb");
+		m_cached_file_name = filename;
+	}
+	return m_cached_file;
+}
+
 std::string CVolumeDirectory::GetGameID() const
 {
 	return std::string(m_disk_header.begin(), m_disk_header.begin() + MAX_ID_LENGTH);
@@ -350,9 +362,13 @@ void CVolumeDirectory::SetDOL(const std::string& dol)
 void CVolumeDirectory::BuildFST()
 {
 	m_fst_data.clear();
+	m_virtual_disk.clear();
 
 	File::FSTEntry rootEntry = File::ScanDirectoryTree(m_root_directory, true);
 
+	// One entry per file at most; avoids regrowing for big extracted trees.
+	m_virtual_disk.reserve(rootEntry.size);
+
 	ConvertUTF8NamesToSHIFTJIS(rootEntry);
 
 	u32 name_table_size = ComputeNameSize(rootEntry);
@@ -484,9 +500,11 @@ void CVolumeDirectory::WriteDirectory(const File::FSTEntry& parent_entry, u32* f
 			WriteEntryData(fst_offset, FILE_ENTRY, *name_offset, *data_offset, entry.size);
 			WriteEntryName(name_offset, entry.virtualName);
 
-			// write entry to virtual disk
-			_dbg_assert_(DVDINTERFACE, m_virtual_disk.find(*data_offset) == m_virtual_disk.end());
-			m_virtual_disk.emplace(*data_offset, entry.physicalName);
+			// write entry to virtual disk; data offsets are handed out in
+			// increasing order, so the extent vector stays sorted by offset.
+			_dbg_assert_(DVDINTERFACE,
+				m_virtual_disk.empty() || m_virtual_disk.back().offset < *data_offset);
+			m_virtual_disk.push_back({ *data_offset, entry.size, entry.physicalName });
 
 			// 4 byte aligned
 			*data_offset = Common::AlignUp(*data_offset + std::max<u64>(entry.size, 1ull), 0x8000ull);
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
 #include "DiscIO/Volume.h"
 
 namespace File
@@ -90,9 +91,27 @@ private:
 	void WriteDirectory(const File::FSTEntry& parent_entry, u32* fst_offset, u32* name_offset,
 		u64* data_offset, u32 parent_entry_index);
 
+	// A file's position on the virtual disk. The extents are kept sorted by
+	// offset, so reads can locate their file with a binary search over a flat
+	// array instead of walking a tree of nodes.
+	struct SFileExtent
+	{
+		u64 offset;
+		u64 size;
+		std::string filename;
+	};
+
+	File::IOFile& OpenCachedFile(const std::string& filename) const;
+
 	std::string m_root_directory;
 
-	std::map<u64, std::string> m_virtual_disk;
+	std::vector<SFileExtent> m_virtual_disk;
+
+	// DVD reads overwhelmingly stream through one file at a time, so a single
+	// cached handle removes an open/close pair from every read without
+	// pinning a descriptor per file for big extracted trees.
+	mutable File::IOFile m_cached_file;
+	mutable std::string m_cached_file_name;
 
 	bool m_is_wii;
 
@@ -4,6 +4,8 @@
 
 #include "DiscIO/VolumeWiiCrypted.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <map>
@@ -15,7 +17,9 @@
 #include <vector>
 
 #include "Common/Assert.h"
+#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
+#include "Common/ThreadPool.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
@@ -31,7 +35,7 @@ namespace DiscIO
 CVolumeWiiCrypted::CVolumeWiiCrypted(std::unique_ptr<IBlobReader> reader, u64 _VolumeOffset,
 	const unsigned char* _pVolumeKey)
 	: m_pReader(std::move(reader)), m_AES_ctx(std::make_unique<mbedtls_aes_context>()),
-	m_VolumeOffset(_VolumeOffset), m_dataOffset(0x20000), m_LastDecryptedBlockOffset(-1)
+	m_VolumeOffset(_VolumeOffset), m_dataOffset(0x20000)
 {
 	_assert_(m_pReader);
 
@@ -41,7 +45,8 @@ CVolumeWiiCrypted::CVolumeWiiCrypted(std::unique_ptr<IBlobReader> reader, u64 _V
 bool CVolumeWiiCrypted::ChangePartition(u64 offset)
 {
 	m_VolumeOffset = offset;
-	m_LastDecryptedBlockOffset = -1;
+	for (auto& entry : m_cluster_cache)
+		entry.block = static_cast<u64>(-1);
 
 	u8 volume_key[16];
 	DiscIO::VolumeKeyForPartition(*m_pReader, offset, volume_key);
@@ -58,39 +63,26 @@ bool CVolumeWiiCrypted::Read(u64 _ReadOffset, u64 _Length, u8* _pBuffer, bool de
 	if (!decrypt)
 		return m_pReader->Read(_ReadOffset, _Length, _pBuffer);
 
-	std::vector<u8> read_buffer(BLOCK_TOTAL_SIZE);
 	while (_Length > 0)
 	{
 		// Calculate block offset
 		u64 Block = _ReadOffset / BLOCK_DATA_SIZE;
 		u64 Offset = _ReadOffset % BLOCK_DATA_SIZE;
 
-		if (m_LastDecryptedBlockOffset != Block)
+		const ClusterCacheEntry& entry = m_cluster_cache[Block % CLUSTER_CACHE_SIZE];
+		if (entry.block != Block)
 		{
-			// Read the current block
-			if (!m_pReader->Read(m_VolumeOffset + m_dataOffset + Block * BLOCK_TOTAL_SIZE,
-				BLOCK_TOTAL_SIZE, read_buffer.data()))
+			// Cache miss. Decrypt every cluster the rest of this request touches
+			// in one go (clamped so the run cannot evict its own clusters).
+			const u64 blocks_needed = (Offset + _Length + BLOCK_DATA_SIZE - 1) / BLOCK_DATA_SIZE;
+			if (!DecryptBlockRun(Block, std::min<u64>(blocks_needed, CLUSTER_CACHE_SIZE)))
 				return false;
-
-			// Decrypt the block's data.
-			// 0x3D0 - 0x3DF in m_pBuffer will be overwritten,
-			// but that won't affect anything, because we won't
-			// use the content of m_pBuffer anymore after this
-			mbedtls_aes_crypt_cbc(m_AES_ctx.get(), MBEDTLS_AES_DECRYPT, BLOCK_DATA_SIZE,
-				&read_buffer[0x3D0], &read_buffer[BLOCK_HEADER_SIZE],
-				m_LastDecryptedBlock);
-			m_LastDecryptedBlockOffset = Block;
-
-			// The only thing we currently use from the 0x000 - 0x3FF part
-			// of the block is the IV (at 0x3D0), but it also contains SHA-1
-			// hashes that IOS uses to check that discs aren't tampered with.
-			// http://wiibrew.org/wiki/Wii_Disc#Encrypted
 		}
 
 		// Copy the decrypted data
 		u64 MaxSizeToCopy = BLOCK_DATA_SIZE - Offset;
 		u64 CopySize = (_Length > MaxSizeToCopy) ? MaxSizeToCopy : _Length;
-		memcpy(_pBuffer, &m_LastDecryptedBlock[Offset], (size_t)CopySize);
+		memcpy(_pBuffer, &entry.data[Offset], (size_t)CopySize);
 
 		// Update offsets
 		_Length -= CopySize;
@@ -101,6 +93,62 @@ bool CVolumeWiiCrypted::Read(u64 _ReadOffset, u64 _Length, u8* _pBuffer, bool de
 	return true;
 }
 
+bool CVolumeWiiCrypted::DecryptBlockRun(u64 first_block, u64 num_blocks) const
+{
+	// Fetch the whole run with a single blob read.
+	std::vector<u8> read_buffer(num_blocks * BLOCK_TOTAL_SIZE);
+	if (!m_pReader->Read(m_VolumeOffset + m_dataOffset + first_block * BLOCK_TOTAL_SIZE,
+		num_blocks * BLOCK_TOTAL_SIZE, read_buffer.data()))
+		return false;
+
+	struct DecryptState
+	{
+		std::atomic<u64> next_block{ 0 };
+		std::atomic<u64> done_blocks{ 0 };
+	};
+	auto state = std::make_shared<DecryptState>();
+
+	u8* encrypted = read_buffer.data();
+	auto worker = [this, state, encrypted, first_block, num_blocks]() {
+		u64 i;
+		while ((i = state->next_block.fetch_add(1, std::memory_order_relaxed)) < num_blocks)
+		{
+			u8* cluster = encrypted + i * BLOCK_TOTAL_SIZE;
+			ClusterCacheEntry& entry = m_cluster_cache[(first_block + i) % CLUSTER_CACHE_SIZE];
+
+			// Decrypt the cluster's data straight into its cache slot. The IV
+			// lives at 0x3D0 in the cluster header and gets clobbered by CBC,
+			// which is fine since the header isn't kept. The rest of the header
+			// holds the SHA-1 hashes IOS uses to detect tampered discs.
+			// http://wiibrew.org/wiki/Wii_Disc#Encrypted
+			// mbedtls only reads the round keys while decrypting, so the
+			// context can be shared between workers.
+			mbedtls_aes_crypt_cbc(m_AES_ctx.get(), MBEDTLS_AES_DECRYPT, BLOCK_DATA_SIZE,
+				&cluster[0x3D0], &cluster[BLOCK_HEADER_SIZE], entry.data);
+			entry.block = first_block + i;
+
+			state->done_blocks.fetch_add(1, std::memory_order_release);
+		}
+	};
+
+	if (num_blocks >= 2 && cpu_info.num_cores > 2)
+	{
+		// Workers claim clusters off the shared counter; the calling thread
+		// joins in. A task that starts after all clusters are claimed exits
+		// without touching the buffers.
+		const u64 num_workers = std::min<u64>(num_blocks, cpu_info.num_cores) - 1;
+		for (u64 i = 0; i < num_workers; i++)
+			Common::AsyncWorker::ExecuteAsync(worker);
+	}
+	worker();
+
+	u32 loopcount = 0;
+	while (state->done_blocks.load(std::memory_order_acquire) < num_blocks)
+		Common::cYield(loopcount++);
+
+	return true;
+}
+
 bool CVolumeWiiCrypted::GetTitleID(u64* buffer) const
 {
 	return ReadSwapped(m_VolumeOffset + 0x1DC, buffer, false);
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 #include <mbedtls/aes.h>
 #include <memory>
@@ -62,14 +63,28 @@ public:
 	static constexpr unsigned int BLOCK_TOTAL_SIZE = BLOCK_HEADER_SIZE + BLOCK_DATA_SIZE;
 
 private:
+	// Reads and decrypts a run of consecutive clusters into the cluster cache.
+	// Each cluster is an independent CBC chain (the IV lives in its header),
+	// so the clusters of a run are decrypted on all cores in parallel.
+	bool DecryptBlockRun(u64 first_block, u64 num_blocks) const;
+
+	struct ClusterCacheEntry
+	{
+		u64 block = static_cast<u64>(-1);
+		u8 data[BLOCK_DATA_SIZE];
+	};
+
+	// Direct-mapped by block index; streaming reads are sequential, so
+	// consecutive clusters land in distinct slots.
+	static constexpr unsigned int CLUSTER_CACHE_SIZE = 16;
+
 	std::unique_ptr<IBlobReader> m_pReader;
 	std::unique_ptr<mbedtls_aes_context> m_AES_ctx;
 
 	u64 m_VolumeOffset;
 	u64 m_dataOffset;
 
-	mutable u64 m_LastDecryptedBlockOffset;
-	mutable unsigned char m_LastDecryptedBlock[BLOCK_DATA_SIZE];
+	mutable std::array<ClusterCacheEntry, CLUSTER_CACHE_SIZE> m_cluster_cache;
 };
 
 }  // namespace
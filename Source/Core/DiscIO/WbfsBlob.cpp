@@ -118,7 +118,7 @@ bool WbfsFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 	while (nbytes)
 	{
 		u64 read_size;
-		File::IOFile& data_file = SeekToCluster(offset, &read_size);
+		File::IOFile& data_file = SeekToCluster(offset, nbytes, &read_size);
 		if (read_size == 0)
 			return false;
 		read_size = std::min(read_size, nbytes);
@@ -137,7 +137,7 @@ bool WbfsFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 	return true;
 }
 
-File::IOFile& WbfsFileReader::SeekToCluster(u64 offset, u64* available)
+File::IOFile& WbfsFileReader::SeekToCluster(u64 offset, u64 max_bytes, u64* available)
 {
 	u64 base_cluster = (offset >> m_header.wbfs_sector_shift);
 	if (base_cluster < m_blocks_per_disc)
@@ -146,16 +146,34 @@ File::IOFile& WbfsFileReader::SeekToCluster(u64 offset, u64* available)
 		u64 cluster_offset = offset & (m_wbfs_sector_size - 1);
 		u64 final_address = cluster_address + cluster_offset;
 
-		for (FileEntry& file_entry : m_files)
+		// The file which served the previous read usually serves this one too,
+		// so try it before scanning the list.
+		for (size_t i = 0; i < m_files.size(); i++)
 		{
-			if (final_address < (file_entry.base_address + file_entry.size))
+			size_t index = (m_last_file_index + i) % m_files.size();
+			FileEntry& file_entry = m_files[index];
+			if (final_address >= file_entry.base_address &&
+				final_address < (file_entry.base_address + file_entry.size))
 			{
+				m_last_file_index = index;
 				file_entry.file.Seek(final_address - file_entry.base_address, SEEK_SET);
 				if (available)
 				{
 					u64 till_end_of_file = file_entry.size - (final_address - file_entry.base_address);
-					u64 till_end_of_sector = m_wbfs_sector_size - cluster_offset;
-					*available = std::min(till_end_of_file, till_end_of_sector);
+
+					// Extend the read across physically adjacent clusters, so
+					// sequential reads through a defragmented region become one
+					// large read instead of one per cluster. max_bytes bounds the
+					// table walk to what the caller actually wants.
+					u64 contiguous = m_wbfs_sector_size - cluster_offset;
+					u64 next = base_cluster + 1;
+					while (contiguous < max_bytes && next < m_blocks_per_disc &&
+						m_wlba_table[next] == m_wlba_table[next - 1] + 1)
+					{
+						contiguous += m_wbfs_sector_size;
+						++next;
+					}
+					*available = std::min(till_end_of_file, contiguous);
 				}
 
 				return file_entry.file;
@@ -39,7 +39,7 @@ private:
 	bool AddFileToList(File::IOFile file);
 	bool ReadHeader();
 
-	File::IOFile& SeekToCluster(u64 offset, u64* available);
+	File::IOFile& SeekToCluster(u64 offset, u64 max_bytes, u64* available);
 	bool IsGood() { return m_good; }
 	struct FileEntry
 	{
@@ -54,6 +54,7 @@ private:
 	};
 
 	std::vector<FileEntry> m_files;
+	size_t m_last_file_index = 0;
 
 	u64 m_size;
 
@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <OptionParser.h>
+#include <algorithm>
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
@@ -10,9 +11,12 @@
 #include <string>
 #include <thread>
 #include <unistd.h>
+#include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
+#include "Common/FileUtil.h"
 #include "Common/Flag.h"
 #include "Common/Logging/LogManager.h"
 #include "Common/MsgHandler.h"
@@ -21,12 +25,14 @@
 #include "Core/BootManager.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
 #include "Core/HW/Wiimote.h"
 #include "Core/Host.h"
 #include "Core/IOS/IPC.h"
 #include "Core/IOS/STM/STM.h"
 #include "Core/IOS/USB/Bluetooth/BTEmu.h"
 #include "Core/IOS/USB/Bluetooth/WiimoteDevice.h"
+#include "Core/PerfProfile.h"
 #include "Core/State.h"
 
 #include "UICommon/CommandLineParse.h"
@@ -429,23 +435,107 @@ int main(int argc, char* argv[])
 
   DolphinAnalytics::Instance()->ReportDolphinStart("nogui");
 
-  if (!BootManager::BootCore(boot_filename))
+  if (options.is_set("perf_profile"))
+    PerfProfile::SetProfileOverride(static_cast<const char*>(options.get("perf_profile")));
+
+  std::string report_path;
+  u32 benchmark_loops = 0;
+  if (options.is_set("benchmark"))
   {
-    fprintf(stderr, "Could not boot %s\n", boot_filename.c_str());
-    return 1;
+    benchmark_loops = static_cast<u32>(std::max(static_cast<int>(options.get("benchmark")), 1));
+    report_path = File::GetUserPath(D_DUMP_IDX) + "fifo_benchmark.json";
+    if (options.is_set("benchmark_output"))
+      report_path = static_cast<const char*>(options.get("benchmark_output"));
   }
 
-  while (!Core::IsRunning() && s_running.IsSet())
+  // Backend auto-bench: play the same fifo log once per available backend and
+  // compare the measured frame times instead of guessing which backend is
+  // fastest on this driver.
+  std::vector<std::string> bench_backends;
+  if (options.is_set("benchmark_all_backends"))
   {
-    Core::HostDispatchJobs();
-    updateMainFrameEvent.Wait();
+    if (benchmark_loops == 0)
+    {
+      fprintf(stderr, "--benchmark_all_backends requires --benchmark\n");
+      return 1;
+    }
+    for (const auto& backend : g_available_video_backends)
+      bench_backends.push_back(backend->GetName());
   }
+  else if (benchmark_loops != 0)
+  {
+    FifoPlayer::GetInstance().SetBenchmark(benchmark_loops, report_path);
+  }
+
+  std::vector<std::pair<std::string, std::string>> backend_reports;
+  const size_t num_runs = bench_backends.empty() ? 1 : bench_backends.size();
+  for (size_t run = 0; run < num_runs; ++run)
+  {
+    if (!bench_backends.empty())
+    {
+      const std::string& backend = bench_backends[run];
+      const std::string run_report = report_path + "." + backend + ".json";
+      SConfig::GetInstance().m_strVideoBackend = backend;
+      VideoBackendBase::ActivateBackend(backend);
+      FifoPlayer::GetInstance().SetBenchmark(benchmark_loops, run_report);
+      backend_reports.emplace_back(backend, run_report);
+      fprintf(stderr, "Benchmarking video backend %s (%zu/%zu)\n", backend.c_str(), run + 1,
+              num_runs);
+    }
+
+    s_running.Set();
+    if (!BootManager::BootCore(boot_filename))
+    {
+      fprintf(stderr, "Could not boot %s\n", boot_filename.c_str());
+      return 1;
+    }
+
+    while (!Core::IsRunning() && s_running.IsSet())
+    {
+      Core::HostDispatchJobs();
+      updateMainFrameEvent.Wait();
+    }
 
-  if (s_running.IsSet())
-    platform->MainLoop();
-  Core::Stop();
+    if (s_running.IsSet())
+      platform->MainLoop();
+    Core::Stop();
+
+    // Wait for the core to wind down completely before booting the next
+    // backend; Core::Init joins the previous emu thread.
+    while (Core::GetState() != Core::State::Uninitialized)
+    {
+      Core::HostDispatchJobs();
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    if (s_shutdown_requested.IsSet())
+      break;
+  }
 
   Core::Shutdown();
+
+  // A/B harness: diff the fresh benchmark report against the baseline run.
+  if (!report_path.empty() && options.is_set("benchmark_baseline"))
+  {
+    const std::string baseline = static_cast<const char*>(options.get("benchmark_baseline"));
+    PerfProfile::WriteBenchmarkDelta(baseline, report_path, report_path + ".delta.json");
+  }
+
+  if (!backend_reports.empty())
+  {
+    std::string best_backend;
+    if (PerfProfile::WriteBackendComparison(backend_reports, report_path, &best_backend))
+    {
+      fprintf(stderr, "Fastest video backend: %s\n", best_backend.c_str());
+      if (options.is_set("benchmark_set_backend"))
+      {
+        SConfig::GetInstance().m_strVideoBackend = best_backend;
+        SConfig::GetInstance().SaveSettings();
+        fprintf(stderr, "Saved %s as the default video backend\n", best_backend.c_str());
+      }
+    }
+  }
+
   platform->Shutdown();
   UICommon::Shutdown();
 
@@ -23,6 +23,7 @@
 
 #include "Common/CommonPaths.h"
 #include "Common/CommonTypes.h"
+#include "Common/EventTrace.h"
 #include "Common/FileUtil.h"
 #include "Common/IniFile.h"
 #include "Common/MsgHandler.h"
@@ -159,6 +160,35 @@ void CCodeWindow::OnProfilerMenu(wxCommandEvent& event)
 				wxExecute(OpenCommand, wxEXEC_SYNC);
 		}
 		break;
+	case IDM_SAMPLE_BLOCKS:
+		// No pause or cache clear needed: the sampler runs on its own thread
+		// and touches no generated code.
+		if (GetParentMenuBar()->IsChecked(IDM_SAMPLE_BLOCKS))
+			Profiler::StartSampling();
+		else
+			Profiler::StopSampling();
+		break;
+	case IDM_WRITE_SAMPLES:
+	{
+		std::string filename = File::GetUserPath(D_DUMP_IDX) + "Debug/profiler_stacks.txt";
+		File::CreateFullPath(filename);
+		Profiler::WriteSampleResults(filename);
+	}
+	break;
+	case IDM_TRACE_EVENTS:
+		if (GetParentMenuBar()->IsChecked(IDM_TRACE_EVENTS))
+			Common::Trace::Start();
+		else
+			Common::Trace::Stop();
+		break;
+	case IDM_WRITE_TRACE:
+	{
+		// Load the resulting file into chrome://tracing or ui.perfetto.dev.
+		std::string filename = File::GetUserPath(D_DUMP_IDX) + "Debug/trace.json";
+		File::CreateFullPath(filename);
+		Common::Trace::WriteChromeTrace(filename);
+	}
+	break;
 	}
 }
 
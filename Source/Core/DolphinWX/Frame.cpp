@@ -38,6 +38,7 @@
 #include "Common/FileUtil.h"
 #include "Common/Flag.h"
 #include "Common/Logging/ConsoleListener.h"
+#include "Common/PerformanceHud.h"
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
 
@@ -49,6 +50,7 @@
 #include "Core/HW/Wiimote.h"
 #include "Core/HW/WiimoteEmu/WiimoteEmu.h"
 #include "Core/HotkeyManager.h"
+#include "Core/FifoPlayer/FifoRecorder.h"
 #include "Core/IOS/IPC.h"
 #include "Core/IOS/USB/Bluetooth/BTBase.h"
 #include "Core/Movie.h"
@@ -68,6 +70,7 @@
 #include "InputCommon/ControllerInterface/ControllerInterface.h"
 #include "InputCommon/GCPadStatus.h"
 
+#include "VideoCommon/Debugger.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/PostProcessing.h"
 #include "VideoCommon/RenderBase.h"
@@ -1506,6 +1509,42 @@ void CFrame::ParseHotkeys()
 		g_Config.bHiresMaterialMaps = !g_Config.bHiresMaterialMaps;
 	}
 
+	if (IsHotkey(HK_TOGGLE_PERF_HUD))
+		PerfHud::Toggle();
+
+	if (IsHotkey(HK_TOGGLE_FIFO_FLIGHT_RECORDING))
+	{
+		FifoRecorder& recorder = FifoRecorder::GetInstance();
+		if (recorder.IsFlightRecording())
+		{
+			recorder.StopFlightRecording();
+			GFXStateRecorder::Disarm();
+			OSD::AddMessage("FIFO flight recording disarmed");
+		}
+		else
+		{
+			recorder.StartFlightRecording();
+			GFXStateRecorder::Arm();
+			OSD::AddMessage("FIFO flight recording armed");
+		}
+	}
+
+	if (IsHotkey(HK_SAVE_FIFO_FLIGHT_RECORDING))
+	{
+		const std::string filename = File::GetUserPath(D_DUMP_IDX) + "FlightRecording.dff";
+		if (FifoRecorder::GetInstance().SaveFlightRecording(filename))
+		{
+			OSD::AddMessage("Saved FIFO flight recording to " + filename);
+			// The per-draw BP/XF/CP history goes next to the fifo log, so the
+			// state an expensive draw used can be matched up with its data.
+			GFXStateRecorder::Save(File::GetUserPath(D_DUMP_IDX) + "FlightRecordingState.txt");
+		}
+		else
+		{
+			OSD::AddMessage("No FIFO flight recording to save - arm it first");
+		}
+	}
+
 	static float debugSpeed = 1.0f;
 	if (IsHotkey(HK_FREELOOK_DECREASE_SPEED, true))
 		debugSpeed /= 1.1f;
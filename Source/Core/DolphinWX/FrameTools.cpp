@@ -1396,6 +1396,7 @@ void CFrame::OnSelectSlot(wxCommandEvent& event)
 	Core::DisplayMessage(StringFromFormat("Selected slot %d - %s", m_saveSlot,
 		State::GetInfoStringOfSlot(m_saveSlot, false).c_str()),
 		2500);
+	State::PrefetchSlot(m_saveSlot);
 }
 
 void CFrame::OnLoadCurrentSlot(wxCommandEvent& event)
@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <atomic>
 #include <cinttypes>
 #include <cmath>
 #include <cstddef>
@@ -37,6 +38,7 @@
 #endif
 
 #include "Common/CDUtils.h"
+#include "Common/CPUDetect.h"
 #include "Common/CommonPaths.h"
 #include "Common/CommonTypes.h"
 #include "Common/FileSearch.h"
@@ -44,6 +46,8 @@
 #include "Common/MathUtil.h"
 #include "Common/StringUtil.h"
 #include "Common/SysConf.h"
+#include "Common/Thread.h"
+#include "Common/ThreadPool.h"
 #include "Core/Boot/Boot.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
@@ -675,22 +679,53 @@ void CGameListCtrl::ScanForISOs()
 			wxPD_REMAINING_TIME | wxPD_SMOOTH  // - makes updates as small as possible (down to 1px)
 		);
 
-		for (u32 i = 0; i < rFilenames.size(); i++)
+		// Every item is self-contained: a cache file read on a hit, a volume
+		// parse plus banner decode on a miss. Build them on the worker pool
+		// and keep this thread to pumping the progress dialog. wxImage is
+		// safe off the GUI thread as long as nothing touches the GUI.
+		struct ScanState
 		{
-			std::string FileName;
-			SplitPath(rFilenames[i], nullptr, &FileName, nullptr);
+			std::atomic<u32> next_index{ 0 };
+			std::atomic<u32> done_count{ 0 };
+			std::atomic<u32> idle_workers{ 0 };
+			std::atomic<bool> cancelled{ false };
+		};
+		const u32 count = static_cast<u32>(rFilenames.size());
+		auto state = std::make_shared<ScanState>();
+		std::vector<std::unique_ptr<GameListItem>> items(count);
+
+		const u32 num_workers = std::max(cpu_info.num_cores - 1, 1);
+		for (u32 worker = 0; worker < num_workers; worker++)
+		{
+			Common::AsyncWorker::ExecuteAsync(std::function<void()>(
+				[state, count, &items, &rFilenames, &custom_titles]() {
+				while (!state->cancelled.load())
+				{
+					u32 i = state->next_index.fetch_add(1);
+					if (i >= count)
+						break;
+					items[i] = std::make_unique<GameListItem>(rFilenames[i], custom_titles);
+					state->done_count.fetch_add(1);
+				}
+				state->idle_workers.fetch_add(1);
+			}));
+		}
 
-			// Update with the progress (i) and the message
-			dialog.Update(i, wxString::Format(_("Scanning %s"), StrToWxStr(FileName)));
+		// The workers reference our stack, so we may not leave this scope
+		// until every one of them has bowed out.
+		while (state->idle_workers.load() < num_workers)
+		{
+			u32 done = std::min(state->done_count.load(), count - 1);
+			dialog.Update((int)done, wxString::Format(_("Scanned %u of %u"), done, count));
 			if (dialog.WasCancelled())
-				break;
-
-			auto iso_file = std::make_unique<GameListItem>(rFilenames[i], custom_titles);
+				state->cancelled.store(true);
+			Common::SleepCurrentThread(50);
+		}
 
-			if (iso_file->IsValid() && ShouldDisplayGameListItem(*iso_file))
-			{
+		for (auto& iso_file : items)
+		{
+			if (iso_file && iso_file->IsValid() && ShouldDisplayGameListItem(*iso_file))
 				m_ISOFiles.push_back(std::move(iso_file));
-			}
 		}
 	}
 
@@ -243,6 +243,10 @@ enum
 	// Profiler
 	IDM_PROFILE_BLOCKS,
 	IDM_WRITE_PROFILE,
+	IDM_SAMPLE_BLOCKS,
+	IDM_WRITE_SAMPLES,
+	IDM_TRACE_EVENTS,
+	IDM_WRITE_TRACE,
 	// --------------------------------------------------------------
 
 	// --------------------------------------------------------------
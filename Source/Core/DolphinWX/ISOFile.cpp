@@ -36,7 +36,7 @@
 #include "DolphinWX/ISOFile.h"
 #include "DolphinWX/WxUtils.h"
 
-static const u32 CACHE_REVISION = 0x129;  // Last changed in PR 5102
+static const u32 CACHE_REVISION = 0x12A;  // Last changed when BlobType gained LZO
 
 static std::string GetLanguageString(DiscIO::Language language,
 	std::map<DiscIO::Language, std::string> strings)
@@ -245,12 +245,13 @@ std::string GameListItem::CreateCacheFilename() const
 	if (Filename.empty())
 		return Filename;  // Disc Drive
 
-						  // Filename.extension_HashOfFolderPath_Size.cache
-						  // Append hash to prevent ISO name-clashing in different folders.
+						  // Filename.extension_HashOfFolderPath_Size_MTime.cache
+						  // Append hash to prevent ISO name-clashing in different folders, and the
+						  // size and modification time so a replaced file misses the stale cache.
 	Filename.append(
-		StringFromFormat("%s_%x_%" PRIx64 ".cache", extension.c_str(),
+		StringFromFormat("%s_%x_%" PRIx64 "_%" PRIx64 ".cache", extension.c_str(),
 			HashFletcher((const u8*)LegalPathname.c_str(), LegalPathname.size()),
-			File::GetSize(m_FileName)));
+			File::GetSize(m_FileName), File::GetModTime(m_FileName)));
 
 	std::string fullname(File::GetUserPath(D_CACHE_IDX));
 	fullname += Filename;
@@ -292,6 +292,7 @@ void CISOProperties::CreateGUIControls()
 	arrayStringFor_GPUDeterminism.Add(_("Not Set"));
 	arrayStringFor_GPUDeterminism.Add(_("auto"));
 	arrayStringFor_GPUDeterminism.Add(_("none"));
+	arrayStringFor_GPUDeterminism.Add(_("bounded-sync"));
 	arrayStringFor_GPUDeterminism.Add(_("fake-completion"));
 	GPUDeterminism = new wxChoice(m_GameConfig, ID_GPUDETERMINISM, wxDefaultPosition, wxDefaultSize,
 		arrayStringFor_GPUDeterminism);
@@ -589,8 +590,10 @@ void CISOProperties::LoadGameConfig()
 		GPUDeterminism->SetSelection(1);
 	else if (sTemp == "none")
 		GPUDeterminism->SetSelection(2);
-	else if (sTemp == "fake-completion")
+	else if (sTemp == "bounded-sync")
 		GPUDeterminism->SetSelection(3);
+	else if (sTemp == "fake-completion")
+		GPUDeterminism->SetSelection(4);
 
 	IniFile::Section* default_stereoscopy = GameIniDefault.GetOrCreateSection("Video_Stereoscopy");
 	default_stereoscopy->Get("StereoDepthPercentage", &iTemp, 100);
@@ -681,6 +684,8 @@ bool CISOProperties::SaveGameConfig()
 	else if (GPUDeterminism->GetSelection() == 2)
 		tmp = "none";
 	else if (GPUDeterminism->GetSelection() == 3)
+		tmp = "bounded-sync";
+	else if (GPUDeterminism->GetSelection() == 4)
 		tmp = "fake-completion";
 
 	SAVE_IF_NOT_DEFAULT("Core", "GPUDeterminismMode", tmp, "Not Set");
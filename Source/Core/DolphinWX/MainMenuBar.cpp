@@ -488,6 +488,13 @@ wxMenu* MainMenuBar::CreateProfilerMenu() const
 	profiler_menu->AppendCheckItem(IDM_PROFILE_BLOCKS, _("&Profile Blocks"));
 	profiler_menu->AppendSeparator();
 	profiler_menu->Append(IDM_WRITE_PROFILE, _("&Write to profile.txt, Show"));
+	profiler_menu->AppendSeparator();
+	// i18n: "Sample" is used as a verb; the profiler periodically samples the guest PC.
+	profiler_menu->AppendCheckItem(IDM_SAMPLE_BLOCKS, _("&Sample Guest PC"));
+	profiler_menu->Append(IDM_WRITE_SAMPLES, _("Write &Flame Graph Stacks"));
+	profiler_menu->AppendSeparator();
+	profiler_menu->AppendCheckItem(IDM_TRACE_EVENTS, _("&Trace Events"));
+	profiler_menu->Append(IDM_WRITE_TRACE, _("Write &Chrome Trace"));
 
 	return profiler_menu;
 }
@@ -535,6 +542,9 @@ void MainMenuBar::RefreshPlayMenuLabel() const
 
 void MainMenuBar::RefreshSaveStateMenuLabels() const
 {
+	// The user is about to pick a slot; start decompressing the likely ones now.
+	State::PrefetchRecentSlots();
+
 	for (unsigned int i = 0; i < State::NUM_STATES; i++)
 	{
 		const auto slot_number = i + 1;
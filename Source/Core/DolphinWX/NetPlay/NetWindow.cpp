@@ -335,6 +335,7 @@ void NetPlayDialog::GetNetSettings(NetSettings& settings)
 	settings.m_CopyWiiSave = m_copy_wii_save->GetValue();
 	settings.m_OCEnable = instance.m_OCEnable;
 	settings.m_OCFactor = instance.m_OCFactor;
+	settings.m_DeterministicAudioTiming = instance.bDeterministicAudioTiming;
 	settings.m_EXIDevice[0] = instance.m_EXIDevice[0];
 	settings.m_EXIDevice[1] = instance.m_EXIDevice[1];
 }
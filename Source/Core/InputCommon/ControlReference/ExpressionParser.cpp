@@ -207,6 +207,10 @@ public:
 	}
 };
 
+// Maximum value-stack depth a compiled program may need. Deeper trees (which
+// would take an expression of hundreds of terms) fall back to tree evaluation.
+static const size_t EVAL_STACK_SIZE = 32;
+
 class ExpressionNode
 {
 public:
@@ -214,6 +218,10 @@ public:
 	virtual ControlState GetValue() const { return 0; }
 	virtual void SetValue(ControlState state) {}
 	virtual int CountNumControls() const { return 0; }
+	virtual void Emit(std::vector<Expression::Op>& program) const
+	{
+		program.push_back({Expression::OpCode::PushZero, nullptr});
+	}
 	virtual operator std::string() const { return ""; }
 };
 
@@ -244,6 +252,10 @@ public:
 	ControlState GetValue() const override { return control->ToInput()->GetState(); }
 	void SetValue(ControlState value) override { control->ToOutput()->SetState(value); }
 	int CountNumControls() const override { return 1; }
+	void Emit(std::vector<Expression::Op>& program) const override
+	{
+		program.push_back({Expression::OpCode::ReadControl, control});
+	}
 	operator std::string() const override { return "`" + (std::string)qualifier + "`"; }
 private:
 	std::shared_ptr<Device> m_device;
@@ -297,6 +309,26 @@ public:
 		return lhs->CountNumControls() + rhs->CountNumControls();
 	}
 
+	void Emit(std::vector<Expression::Op>& program) const override
+	{
+		lhs->Emit(program);
+		rhs->Emit(program);
+		switch (op)
+		{
+		case TOK_AND:
+			program.push_back({Expression::OpCode::And, nullptr});
+			break;
+		case TOK_OR:
+			program.push_back({Expression::OpCode::Or, nullptr});
+			break;
+		case TOK_ADD:
+			program.push_back({Expression::OpCode::Add, nullptr});
+			break;
+		default:
+			assert(false);
+		}
+	}
+
 	operator std::string() const override
 	{
 		return OpName(op) + "(" + (std::string)(*lhs) + ", " + (std::string)(*rhs) + ")";
@@ -338,6 +370,13 @@ public:
 	}
 
 	int CountNumControls() const override { return inner->CountNumControls(); }
+
+	void Emit(std::vector<Expression::Op>& program) const override
+	{
+		inner->Emit(program);
+		program.push_back({Expression::OpCode::Not, nullptr});
+	}
+
 	operator std::string() const override { return OpName(op) + "(" + (std::string)(*inner) + ")"; }
 };
 
@@ -503,7 +542,64 @@ private:
 
 ControlState Expression::GetValue() const
 {
-	return node->GetValue();
+	if (m_program.empty())
+		return node->GetValue();
+
+	// Poll every bound control up front. That is the unavoidable per-frame
+	// cost; the operator walk below is skipped when nothing moved since the
+	// previous poll.
+	bool dirty = !m_cache_valid;
+	size_t input = 0;
+	for (const Op& op : m_program)
+	{
+		if (op.code != OpCode::ReadControl)
+			continue;
+		const ControlState state = op.control->ToInput()->GetState();
+		if (state != m_input_states[input])
+		{
+			m_input_states[input] = state;
+			dirty = true;
+		}
+		++input;
+	}
+
+	if (!dirty)
+		return m_cached_value;
+
+	ControlState stack[EVAL_STACK_SIZE];
+	size_t sp = 0;
+	input = 0;
+	for (const Op& op : m_program)
+	{
+		switch (op.code)
+		{
+		case OpCode::PushZero:
+			stack[sp++] = 0;
+			break;
+		case OpCode::ReadControl:
+			stack[sp++] = m_input_states[input++];
+			break;
+		case OpCode::Not:
+			stack[sp - 1] = 1.0 - stack[sp - 1];
+			break;
+		case OpCode::And:
+			--sp;
+			stack[sp - 1] = std::min(stack[sp - 1], stack[sp]);
+			break;
+		case OpCode::Or:
+			--sp;
+			stack[sp - 1] = std::max(stack[sp - 1], stack[sp]);
+			break;
+		case OpCode::Add:
+			--sp;
+			stack[sp - 1] = std::min(stack[sp - 1] + stack[sp], 1.0);
+			break;
+		}
+	}
+
+	m_cached_value = (sp == 1) ? stack[0] : 0;
+	m_cache_valid = true;
+	return m_cached_value;
 }
 
 void Expression::SetValue(ControlState value)
@@ -511,10 +607,52 @@ void Expression::SetValue(ControlState value)
 	node->SetValue(value);
 }
 
+// Flatten the tree into postfix form and size the input cache. Done once at
+// parse time, so per-poll evaluation never recurses or resolves names.
+void Expression::Compile()
+{
+	m_program.clear();
+	node->Emit(m_program);
+
+	size_t depth = 0;
+	size_t max_depth = 0;
+	size_t num_inputs = 0;
+	for (const Op& op : m_program)
+	{
+		switch (op.code)
+		{
+		case OpCode::ReadControl:
+			++num_inputs;
+			++depth;
+			break;
+		case OpCode::PushZero:
+			++depth;
+			break;
+		case OpCode::Not:
+			break;
+		default:
+			// Binary operators pop two values and push one.
+			--depth;
+			break;
+		}
+		max_depth = std::max(max_depth, depth);
+	}
+
+	if (max_depth > EVAL_STACK_SIZE)
+	{
+		m_program.clear();
+		return;
+	}
+
+	m_input_states.assign(num_inputs, 0);
+	m_cache_valid = false;
+}
+
 Expression::Expression(ExpressionNode* node_)
 {
 	node = node_;
 	num_controls = node->CountNumControls();
+	Compile();
 }
 
 Expression::~Expression()
@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 #include "InputCommon/ControllerInterface/Device.h"
 
 namespace ciface
@@ -50,6 +51,24 @@ class ExpressionNode;
 class Expression
 {
 public:
+	// One step of the flat program an expression tree compiles down to.
+	// Control reads carry their resolved control pointer, so evaluating a
+	// program never does a device or control lookup.
+	enum class OpCode
+	{
+		PushZero,  // unbound control (missing device)
+		ReadControl,
+		Not,
+		And,
+		Or,
+		Add,
+	};
+	struct Op
+	{
+		OpCode code;
+		Core::Device::Control* control;
+	};
+
 	Expression() : node(nullptr) {}
 	Expression(ExpressionNode* node);
 	~Expression();
@@ -57,6 +76,20 @@ public:
 	void SetValue(ControlState state);
 	int num_controls;
 	ExpressionNode* node;
+
+private:
+	void Compile();
+
+	// The tree flattened into postfix form, evaluated with a small value
+	// stack instead of recursing through virtual calls. Left empty (falling
+	// back to tree evaluation) when the program would exceed that stack.
+	std::vector<Op> m_program;
+
+	// Last state read from each bound control, in program order. When no
+	// control moved between polls the previous result is reused.
+	mutable std::vector<ControlState> m_input_states;
+	mutable ControlState m_cached_value = 0;
+	mutable bool m_cache_valid = false;
 };
 
 enum class ParseStatus
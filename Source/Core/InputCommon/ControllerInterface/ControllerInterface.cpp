@@ -81,10 +81,14 @@ void ControllerInterface::RefreshDevices()
 	if (!m_is_init)
 		return;
 
-	{
-		std::lock_guard<std::mutex> lk(m_devices_mutex);
-		m_devices.clear();
-	}
+	// Scans open device nodes and query drivers, which can take a while.
+	// They run against a staging list while input keeps polling the previous
+	// device generation; the finished list is published in a single swap
+	// below, so UpdateInput never observes a half-built list and never
+	// waits on enumeration.
+	std::lock_guard<std::recursive_mutex> lk(m_devices_mutex);
+	m_staging_devices.clear();
+	m_is_populating = true;
 
 #ifdef CIFACE_USE_DINPUT
 	ciface::DInput::PopulateDevices(reinterpret_cast<HWND>(m_hwnd));
@@ -111,6 +115,11 @@ void ControllerInterface::RefreshDevices()
 #ifdef CIFACE_USE_PIPES
 	ciface::Pipes::PopulateDevices();
 #endif
+
+	m_is_populating = false;
+	PublishDeviceList(
+		std::make_shared<const ciface::Core::DeviceContainer::DeviceList>(std::move(m_staging_devices)));
+	m_staging_devices.clear();
 }
 
 //
@@ -124,16 +133,18 @@ void ControllerInterface::Shutdown()
 		return;
 
 	{
-		std::lock_guard<std::mutex> lk(m_devices_mutex);
+		std::lock_guard<std::recursive_mutex> lk(m_devices_mutex);
 
-		for (const auto& d : m_devices)
+		const auto devices = GetDeviceSnapshot();
+		for (const auto& d : *devices)
 		{
 			// Set outputs to ZERO before destroying device
 			for (ciface::Core::Device::Output* o : d->Outputs())
 				o->SetState(0);
 		}
 
-		m_devices.clear();
+		// Devices are destroyed once the last in-flight snapshot is released.
+		PublishDeviceList(std::make_shared<const ciface::Core::DeviceContainer::DeviceList>());
 	}
 
 #ifdef CIFACE_USE_XINPUT
@@ -165,30 +176,46 @@ void ControllerInterface::Shutdown()
 
 void ControllerInterface::AddDevice(std::shared_ptr<ciface::Core::Device> device)
 {
-	std::lock_guard<std::mutex> lk(m_devices_mutex);
+	std::lock_guard<std::recursive_mutex> lk(m_devices_mutex);
+
+	// During a scan new devices land in the staging list and all become
+	// visible at once when the scan publishes; a hotplugged device outside
+	// a scan gets its own copy-and-swap.
+	ciface::Core::DeviceContainer::DeviceList new_list;
+	if (!m_is_populating)
+		new_list = *GetDeviceSnapshot();
+	ciface::Core::DeviceContainer::DeviceList& list = m_is_populating ? m_staging_devices : new_list;
+
 	// Try to find an ID for this device
 	int id = 0;
 	while (true)
 	{
-		const auto it = std::find_if(m_devices.begin(), m_devices.end(), [&device, &id](const auto& d) {
+		const auto it = std::find_if(list.begin(), list.end(), [&device, &id](const auto& d) {
 			return d->GetSource() == device->GetSource() && d->GetName() == device->GetName() &&
 				d->GetId() == id;
 		});
-		if (it == m_devices.end())  // no device with the same name with this ID, so we can use it
+		if (it == list.end())  // no device with the same name with this ID, so we can use it
 			break;
 		else
 			id++;
 	}
 	device->SetId(id);
-	m_devices.emplace_back(std::move(device));
+	list.emplace_back(std::move(device));
+
+	if (!m_is_populating)
+		PublishDeviceList(
+			std::make_shared<const ciface::Core::DeviceContainer::DeviceList>(std::move(new_list)));
 }
 
 void ControllerInterface::RemoveDevice(std::function<bool(const ciface::Core::Device*)> callback)
 {
-	std::lock_guard<std::mutex> lk(m_devices_mutex);
-	m_devices.erase(std::remove_if(m_devices.begin(), m_devices.end(),
+	std::lock_guard<std::recursive_mutex> lk(m_devices_mutex);
+	auto new_list = *GetDeviceSnapshot();
+	new_list.erase(std::remove_if(new_list.begin(), new_list.end(),
 		[&callback](const auto& dev) { return callback(dev.get()); }),
-		m_devices.end());
+		new_list.end());
+	PublishDeviceList(
+		std::make_shared<const ciface::Core::DeviceContainer::DeviceList>(std::move(new_list)));
 }
 
 //
@@ -198,13 +225,12 @@ void ControllerInterface::RemoveDevice(std::function<bool(const ciface::Core::De
 //
 void ControllerInterface::UpdateInput()
 {
-	// Don't block the UI or CPU thread (to avoid a short but noticeable frame drop)
-	if (m_devices_mutex.try_lock())
-	{
-		std::lock_guard<std::mutex> lk(m_devices_mutex, std::adopt_lock);
-		for (const auto& d : m_devices)
-			d->UpdateInput();
-	}
+	// Poll against a lock-free snapshot so neither the UI nor the CPU thread
+	// ever blocks on (or skips a poll because of) a device scan; polls that
+	// race a scan simply use the previous device generation.
+	const auto devices = GetDeviceSnapshot();
+	for (const auto& d : *devices)
+		d->UpdateInput();
 }
 
 //
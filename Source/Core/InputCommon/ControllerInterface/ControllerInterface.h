@@ -44,7 +44,7 @@
 class ControllerInterface : public ciface::Core::DeviceContainer
 {
 public:
-	ControllerInterface() : m_is_init(false), m_hwnd(nullptr) {}
+	ControllerInterface() : m_is_init(false), m_is_populating(false), m_hwnd(nullptr) {}
 	void Initialize(void* const hwnd);
 	void RefreshDevices();
 	void Shutdown();
@@ -59,6 +59,10 @@ public:
 private:
 	std::vector<std::function<void()>> m_hotplug_callbacks;
 	bool m_is_init;
+	// Set while RefreshDevices is scanning; AddDevice then appends to the
+	// staging list, and the result is published in one swap at the end.
+	bool m_is_populating;
+	ciface::Core::DeviceContainer::DeviceList m_staging_devices;
 	void* m_hwnd;
 };
 
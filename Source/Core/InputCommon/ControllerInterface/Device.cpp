@@ -125,10 +125,24 @@ bool DeviceQualifier::operator==(const DeviceQualifier& devq) const
 	return std::tie(cid, name, source) == std::tie(devq.cid, devq.name, devq.source);
 }
 
+DeviceContainer::DeviceContainer() : m_devices(std::make_shared<DeviceList>())
+{
+}
+
+std::shared_ptr<const DeviceContainer::DeviceList> DeviceContainer::GetDeviceSnapshot() const
+{
+	return std::atomic_load(&m_devices);
+}
+
+void DeviceContainer::PublishDeviceList(std::shared_ptr<const DeviceList> devices)
+{
+	std::atomic_store(&m_devices, std::move(devices));
+}
+
 std::shared_ptr<Device> DeviceContainer::FindDevice(const DeviceQualifier& devq) const
 {
-	std::lock_guard<std::mutex> lk(m_devices_mutex);
-	for (const auto& d : m_devices)
+	const auto devices = GetDeviceSnapshot();
+	for (const auto& d : *devices)
 	{
 		if (devq == d.get())
 			return d;
@@ -139,12 +153,12 @@ std::shared_ptr<Device> DeviceContainer::FindDevice(const DeviceQualifier& devq)
 
 std::vector<std::string> DeviceContainer::GetAllDeviceStrings() const
 {
-	std::lock_guard<std::mutex> lk(m_devices_mutex);
+	const auto devices = GetDeviceSnapshot();
 
 	std::vector<std::string> device_strings;
 	DeviceQualifier device_qualifier;
 
-	for (const auto& d : m_devices)
+	for (const auto& d : *devices)
 	{
 		device_qualifier.FromDevice(d.get());
 		device_strings.emplace_back(device_qualifier.ToString());
@@ -155,12 +169,12 @@ std::vector<std::string> DeviceContainer::GetAllDeviceStrings() const
 
 std::string DeviceContainer::GetDefaultDeviceString() const
 {
-	std::lock_guard<std::mutex> lk(m_devices_mutex);
-	if (m_devices.empty())
+	const auto devices = GetDeviceSnapshot();
+	if (devices->empty())
 		return "";
 
 	DeviceQualifier device_qualifier;
-	device_qualifier.FromDevice(m_devices[0].get());
+	device_qualifier.FromDevice((*devices)[0].get());
 	return device_qualifier.ToString();
 }
 
@@ -173,8 +187,8 @@ Device::Input* DeviceContainer::FindInput(const std::string& name, const Device*
 			return inp;
 	}
 
-	std::lock_guard<std::mutex> lk(m_devices_mutex);
-	for (const auto& d : m_devices)
+	const auto devices = GetDeviceSnapshot();
+	for (const auto& d : *devices)
 	{
 		Device::Input* const i = d->FindInput(name);
 
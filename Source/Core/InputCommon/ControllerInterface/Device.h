@@ -147,6 +147,10 @@ public:
 class DeviceContainer
 {
 public:
+	using DeviceList = std::vector<std::shared_ptr<Device>>;
+
+	DeviceContainer();
+
 	Device::Input* FindInput(const std::string& name, const Device* def_dev) const;
 	Device::Output* FindOutput(const std::string& name, const Device* def_dev) const;
 
@@ -155,8 +159,18 @@ public:
 	std::shared_ptr<Device> FindDevice(const DeviceQualifier& devq) const;
 
 protected:
-	mutable std::mutex m_devices_mutex;
-	std::vector<std::shared_ptr<Device>> m_devices;
+	// The device list is published as an immutable snapshot. Readers grab it
+	// without taking any lock, so input polling never waits on device
+	// enumeration; writers build a replacement list and swap it in whole.
+	std::shared_ptr<const DeviceList> GetDeviceSnapshot() const;
+	void PublishDeviceList(std::shared_ptr<const DeviceList> devices);
+
+	// Serializes writers only. Recursive because a device scan holds it
+	// across backend population, which calls back into AddDevice.
+	mutable std::recursive_mutex m_devices_mutex;
+
+private:
+	std::shared_ptr<const DeviceList> m_devices;
 };
 }
 }
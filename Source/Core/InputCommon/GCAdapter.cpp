@@ -3,12 +3,15 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <atomic>
 #include <libusb.h>
 #include <mutex>
 
+#include "Common/CommonFuncs.h"
 #include "Common/Flag.h"
 #include "Common/Logging/Log.h"
 #include "Common/Thread.h"
+#include "Common/Timer.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -34,11 +37,39 @@ static u8 s_controller_type[SerialInterface::MAX_SI_CHANNELS] = {
 	ControllerTypes::CONTROLLER_NONE, ControllerTypes::CONTROLLER_NONE };
 static u8 s_controller_rumble[4];
 
-static std::mutex s_mutex;
 static u8 s_controller_payload[37];
 static u8 s_controller_payload_swap[37];
-
-static std::atomic<int> s_controller_payload_size = { 0 };
+static int s_controller_payload_size = 0;
+static u64 s_controller_payload_timestamp = 0;  // host time at USB read completion, in us
+
+// Sequence lock guarding s_controller_payload/s_controller_payload_size. The read
+// thread bumps the counter to an odd value before publishing a new payload and to
+// an even value afterwards; the CPU thread retries its copy if it observed a write
+// in progress. This keeps polling from ever blocking behind the USB read thread.
+static std::atomic<u32> s_controller_payload_seq = { 0 };
+
+// CPU thread's snapshot of the last published payload. All four SI channels are
+// polled back to back from a single UpdateDevices event, so only the first channel
+// to observe a new USB report pays for the copy; the other channels reuse it.
+static u8 s_snapshot_payload[37];
+static int s_snapshot_size = 0;
+static u64 s_snapshot_timestamp = 0;
+static u32 s_snapshot_seq = 1;  // odd, so it never matches a published sequence
+
+// Histogram of adapter-read-to-poll latency, i.e. how stale a USB report was when
+// the SI poll consumed it. Bucket n counts latencies below (1 << n) * 250us, the
+// last bucket counts everything above. Dumped (and reset) on Shutdown.
+static u64 s_latency_histogram[8];
+
+// Running estimate (EMA) of the read-to-poll staleness, in us. This is the
+// host-side part of the input latency and is shared by all channels, since they
+// are decoded from the same USB report.
+static u64 s_staleness_ema_us = 0;
+
+// A wireless pad (WaveBird) delivers its reports to the adapter roughly one RF
+// frame later than a wired pad. The delay is invisible in the USB stream, so it
+// is accounted for as a fixed allowance on top of the measured staleness.
+static const u32 WIRELESS_REPORT_DELAY_US = 6000;
 
 static std::thread s_adapter_thread;
 static Common::Flag s_adapter_thread_running;
@@ -74,9 +105,14 @@ static void Read()
 			sizeof(s_controller_payload_swap), &payload_size, 16);
 
 		{
-			std::lock_guard<std::mutex> lk(s_mutex);
+			const u64 timestamp = Common::Timer::GetTimeUs();
+			const u32 seq = s_controller_payload_seq.load(std::memory_order_relaxed);
+			s_controller_payload_seq.store(seq + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
 			std::swap(s_controller_payload_swap, s_controller_payload);
-			s_controller_payload_size.store(payload_size);
+			s_controller_payload_size = payload_size;
+			s_controller_payload_timestamp = timestamp;
+			s_controller_payload_seq.store(seq + 2, std::memory_order_release);
 		}
 
 		Common::YieldCPU();
@@ -325,9 +361,35 @@ static void AddGCAdapter(libusb_device* device)
 	ResetRumbleLockNeeded();
 }
 
+u64 GetLastInputTimestamp()
+{
+	return s_snapshot_timestamp;
+}
+
+void LogInputLatencyHistogram()
+{
+	for (size_t i = 0; i < ArraySize(s_latency_histogram); i++)
+	{
+		if (!s_latency_histogram[i])
+			continue;
+		if (i == ArraySize(s_latency_histogram) - 1)
+		{
+			INFO_LOG(SERIALINTERFACE, "Adapter read-to-poll latency >= %lluus: %llu polls",
+				(unsigned long long)(250ull << (i - 1)), (unsigned long long)s_latency_histogram[i]);
+		}
+		else
+		{
+			INFO_LOG(SERIALINTERFACE, "Adapter read-to-poll latency < %lluus: %llu polls",
+				(unsigned long long)(250ull << i), (unsigned long long)s_latency_histogram[i]);
+		}
+		s_latency_histogram[i] = 0;
+	}
+}
+
 void Shutdown()
 {
 	StopScanThread();
+	LogInputLatencyHistogram();
 #if defined(LIBUSB_API_VERSION) && LIBUSB_API_VERSION >= 0x01000102
 	if (s_libusb_context && s_libusb_hotplug_enabled)
 		libusb_hotplug_deregister_callback(s_libusb_context, s_hotplug_handle);
@@ -379,33 +441,48 @@ GCPadStatus Input(int chan)
 	if (s_handle == nullptr || !s_detected)
 		return {};
 
-	int payload_size = 0;
-	u8 controller_payload_copy[37];
-
+	// Only called from the CPU thread, so the snapshot needs no protection of its own.
+	if (s_controller_payload_seq.load(std::memory_order_acquire) != s_snapshot_seq)
 	{
-		std::lock_guard<std::mutex> lk(s_mutex);
-		std::copy(std::begin(s_controller_payload), std::end(s_controller_payload),
-			std::begin(controller_payload_copy));
-		payload_size = s_controller_payload_size.load();
+		u32 seq_begin, seq_end;
+		do
+		{
+			seq_begin = s_controller_payload_seq.load(std::memory_order_acquire);
+			std::copy(std::begin(s_controller_payload), std::end(s_controller_payload),
+				std::begin(s_snapshot_payload));
+			s_snapshot_size = s_controller_payload_size;
+			s_snapshot_timestamp = s_controller_payload_timestamp;
+			std::atomic_thread_fence(std::memory_order_acquire);
+			seq_end = s_controller_payload_seq.load(std::memory_order_relaxed);
+		} while ((seq_begin & 1) || seq_begin != seq_end);
+		s_snapshot_seq = seq_begin;
+
+		// Only count the latency once per fresh report; the other channels consume
+		// the same snapshot in the same poll.
+		const u64 latency = Common::Timer::GetTimeUs() - s_snapshot_timestamp;
+		size_t bucket = 0;
+		while (bucket < ArraySize(s_latency_histogram) - 1 && latency >= (250ull << bucket))
+			bucket++;
+		s_latency_histogram[bucket]++;
+		s_staleness_ema_us += ((s64)latency - (s64)s_staleness_ema_us) / 8;
 	}
 
 	GCPadStatus pad = {};
-	if (payload_size != sizeof(controller_payload_copy) ||
-		controller_payload_copy[0] != LIBUSB_DT_HID)
+	if (s_snapshot_size != sizeof(s_snapshot_payload) || s_snapshot_payload[0] != LIBUSB_DT_HID)
 	{
-		ERROR_LOG(SERIALINTERFACE, "error reading payload (size: %d, type: %02x)", payload_size,
-			controller_payload_copy[0]);
+		ERROR_LOG(SERIALINTERFACE, "error reading payload (size: %d, type: %02x)", s_snapshot_size,
+			s_snapshot_payload[0]);
 		Reset();
 	}
 	else
 	{
 		bool get_origin = false;
-		u8 type = controller_payload_copy[1 + (9 * chan)] >> 4;
+		u8 type = s_snapshot_payload[1 + (9 * chan)] >> 4;
 		if (type != ControllerTypes::CONTROLLER_NONE &&
 			s_controller_type[chan] == ControllerTypes::CONTROLLER_NONE)
 		{
 			NOTICE_LOG(SERIALINTERFACE, "New device connected to Port %d of Type: %02x", chan + 1,
-				controller_payload_copy[1 + (9 * chan)]);
+				s_snapshot_payload[1 + (9 * chan)]);
 			get_origin = true;
 		}
 
@@ -413,8 +490,8 @@ GCPadStatus Input(int chan)
 
 		if (s_controller_type[chan] != ControllerTypes::CONTROLLER_NONE)
 		{
-			u8 b1 = controller_payload_copy[1 + (9 * chan) + 1];
-			u8 b2 = controller_payload_copy[1 + (9 * chan) + 2];
+			u8 b1 = s_snapshot_payload[1 + (9 * chan) + 1];
+			u8 b2 = s_snapshot_payload[1 + (9 * chan) + 2];
 
 			if (b1 & (1 << 0))
 				pad.button |= PAD_BUTTON_A;
@@ -446,12 +523,12 @@ GCPadStatus Input(int chan)
 			if (get_origin)
 				pad.button |= PAD_GET_ORIGIN;
 
-			pad.stickX = controller_payload_copy[1 + (9 * chan) + 3];
-			pad.stickY = controller_payload_copy[1 + (9 * chan) + 4];
-			pad.substickX = controller_payload_copy[1 + (9 * chan) + 5];
-			pad.substickY = controller_payload_copy[1 + (9 * chan) + 6];
-			pad.triggerLeft = controller_payload_copy[1 + (9 * chan) + 7];
-			pad.triggerRight = controller_payload_copy[1 + (9 * chan) + 8];
+			pad.stickX = s_snapshot_payload[1 + (9 * chan) + 3];
+			pad.stickY = s_snapshot_payload[1 + (9 * chan) + 4];
+			pad.substickX = s_snapshot_payload[1 + (9 * chan) + 5];
+			pad.substickY = s_snapshot_payload[1 + (9 * chan) + 6];
+			pad.triggerLeft = s_snapshot_payload[1 + (9 * chan) + 7];
+			pad.triggerRight = s_snapshot_payload[1 + (9 * chan) + 8];
 		}
 		else if (!Core::WantsDeterminism())
 		{
@@ -470,6 +547,14 @@ bool DeviceConnected(int chan)
 	return s_controller_type[chan] != ControllerTypes::CONTROLLER_NONE;
 }
 
+u32 GetChannelLatencyUs(int chan)
+{
+	u32 latency = static_cast<u32>(s_staleness_ema_us);
+	if (s_controller_type[chan] == ControllerTypes::CONTROLLER_WIRELESS)
+		latency += WIRELESS_REPORT_DELAY_US;
+	return latency;
+}
+
 bool UseAdapter()
 {
 	const auto& si_devices = SConfig::GetInstance().m_SIDevice;
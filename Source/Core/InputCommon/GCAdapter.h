@@ -25,6 +25,15 @@ void SetAdapterCallback(std::function<void(void)> func);
 void StartScanThread();
 void StopScanThread();
 GCPadStatus Input(int chan);
+// Host time (us) at which the USB report consumed by the last Input() call was read.
+// Lets SI devices reason about how stale the data they were handed is.
+u64 GetLastInputTimestamp();
+// Dumps (and resets) the histogram of adapter-read-to-poll latencies; called
+// automatically on Shutdown.
+void LogInputLatencyHistogram();
+// Estimated input latency of the given channel in us: the measured read-to-poll
+// staleness, plus a fixed allowance for the radio hop on wireless pads.
+u32 GetChannelLatencyUs(int chan);
 void Output(int chan, u8 rumble_command);
 bool IsDetected();
 bool IsDriverDetected();
@@ -407,4 +407,18 @@ void SetAdapterCallback(std::function<void(void)> func)
 {
 }
 
+u64 GetLastInputTimestamp()
+{
+	return 0;
+}
+
+void LogInputLatencyHistogram()
+{
+}
+
+u32 GetChannelLatencyUs(int chan)
+{
+	return 0;
+}
+
 }  // end of namespace GCAdapter
@@ -87,6 +87,33 @@ std::unique_ptr<optparse::OptionParser> CreateParser(ParserOptions options)
 		parser->add_option("-c", "--confirm").action("store_true").help("Set Confirm on Stop");
 	}
 
+	parser->add_option("--benchmark")
+		.action("store")
+		.metavar("<N>")
+		.type("int")
+		.help("Play a fifo log N times and exit (headless benchmark)");
+	parser->add_option("--benchmark_output")
+		.action("store")
+		.metavar("<file>")
+		.type("string")
+		.help("Where the benchmark JSON report is written");
+	parser->add_option("--benchmark_baseline")
+		.action("store")
+		.metavar("<file>")
+		.type("string")
+		.help("Baseline benchmark report to diff the new report against");
+	parser->add_option("--benchmark_all_backends")
+		.action("store_true")
+		.help("Run the fifo log benchmark once per available video backend and report the fastest");
+	parser->add_option("--benchmark_set_backend")
+		.action("store_true")
+		.help("Save the fastest backend found by --benchmark_all_backends as the default");
+	parser->add_option("--perf_profile")
+		.action("store")
+		.metavar("<name>")
+		.type("string")
+		.help("Apply the named performance profile from the game ini");
+
 	parser->set_defaults("video_backend", "");
 	parser->set_defaults("audio_emulation", "");
 	parser->add_option("-v", "--video_backend").action("store").help("Specify a video backend");
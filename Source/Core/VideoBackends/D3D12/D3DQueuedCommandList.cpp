@@ -415,7 +415,9 @@ ID3D12QueuedCommandList::ID3D12QueuedCommandList(ID3D12GraphicsCommandList* back
 
 	m_queue_array_back = m_queue_array;
 
-	m_begin_execution_event = CreateSemaphore(nullptr, 0, 256, nullptr);
+	// The maximum count needs to accommodate one pending wakeup per draw kick,
+	// see CheckForKick().
+	m_begin_execution_event = CreateSemaphore(nullptr, 0, LONG_MAX, nullptr);
 	m_stop_execution_event = CreateEvent(nullptr, FALSE, FALSE, nullptr);
 
 	m_background_thread = std::thread(BackgroundThreadFunction, this);
@@ -453,6 +455,20 @@ void ID3D12QueuedCommandList::ResetQueueOverflowTracking()
 	m_queue_array_back_at_start_of_frame = m_queue_array_back;
 }
 
+void ID3D12QueuedCommandList::CheckForKick()
+{
+	// Wake the worker thread every QUEUED_DRAWS_PER_KICK draws, so that it
+	// records into the backing command list in parallel with this thread
+	// appending further items, instead of only at execute boundaries. The
+	// command list is not closed or executed here; the worker simply chews
+	// through the queued items and then waits for the next wakeup.
+	if (++m_queued_draws_since_last_kick < QUEUED_DRAWS_PER_KICK)
+		return;
+
+	m_queued_draws_since_last_kick = 0;
+	ProcessQueuedItems();
+}
+
 void ID3D12QueuedCommandList::QueueExecute()
 {
 	reinterpret_cast<D3DQueueItem*>(m_queue_array_back)->Type = D3DQueueItemType::ExecuteCommandList;
@@ -713,6 +729,7 @@ void STDMETHODCALLTYPE ID3D12QueuedCommandList::DrawInstanced(
 
 	m_queue_array_back += BufferOffsetForQueueItemType<DrawInstancedArguments>();
 	CheckForOverflow();
+	CheckForKick();
 }
 
 void STDMETHODCALLTYPE ID3D12QueuedCommandList::DrawIndexedInstanced(
@@ -736,6 +753,7 @@ void STDMETHODCALLTYPE ID3D12QueuedCommandList::DrawIndexedInstanced(
 	m_queue_array_back += BufferOffsetForQueueItemType<DrawIndexedInstancedArguments>();
 
 	CheckForOverflow();
+	CheckForKick();
 }
 
 void STDMETHODCALLTYPE ID3D12QueuedCommandList::Dispatch(
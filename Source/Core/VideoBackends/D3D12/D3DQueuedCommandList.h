@@ -14,6 +14,12 @@ namespace DX12
 
 static const unsigned int QUEUE_ARRAY_SIZE = 24 * 1024 * 1024;
 
+// Number of draws batched up before the worker thread is woken to translate
+// them into the backing command list. Small enough that recording overlaps
+// with the video thread filling the queue, large enough that the wakeup cost
+// is amortized over many draws.
+static const unsigned int QUEUED_DRAWS_PER_KICK = 16;
+
 enum D3DQueueItemType
 {
 	AbortProcessing = 0,
@@ -638,6 +644,7 @@ private:
 
 	void ResetQueueOverflowTracking();
 	void CheckForOverflow();
+	void CheckForKick();
 
 	static void BackgroundThreadFunction(ID3D12QueuedCommandList* parent_queued_command_list);
 
@@ -646,6 +653,8 @@ private:
 
 	byte* m_queue_array_back_at_start_of_frame = m_queue_array_back;
 
+	unsigned int m_queued_draws_since_last_kick = 0;
+
 	std::thread m_background_thread;
 
 	HANDLE m_begin_execution_event;
@@ -15,6 +15,7 @@
 
 #include "VideoCommon/Debugger.h"
 #include "VideoCommon/HLSLCompiler.h"
+#include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/ObjectUsageProfiler.h"
 
@@ -213,10 +214,12 @@ void ShaderCache::Init()
 			item.CalculateUIDHash();
 			HandlePSUIDChange(item, true);
 			shader_count++;
-			if ((shader_count & 7) == 0)
+			s_compiler->WaitForRepositorySlot();
+			if ((shader_count & 31) == 0)
 			{
-				Host_UpdateTitle(StringFromFormat("Compiling Pixel Shaders %i %% (%i/%i)", (shader_count * 100) / total, shader_count, total));
-				s_compiler->WaitForFinish();
+				std::string msg = StringFromFormat("Compiling Pixel Shaders %i %% (%i/%i)", (shader_count * 100) / total, shader_count, total);
+				Host_UpdateTitle(msg);
+				OSD::AddTypedMessage(OSD::MessageType::ShaderCompileProgress, msg);
 			}
 		},
 			[](ByteCodeCacheEntry& entry)
@@ -233,10 +236,12 @@ void ShaderCache::Init()
 			item.CalculateUIDHash();
 			HandleVSUIDChange(item, true);
 			shader_count++;
+			s_compiler->WaitForRepositorySlot();
 			if ((shader_count & 31) == 0)
 			{
-				Host_UpdateTitle(StringFromFormat("Compiling Vertex Shaders %i %% (%i/%i)", (shader_count * 100) / total, shader_count, total));
-				s_compiler->WaitForFinish();
+				std::string msg = StringFromFormat("Compiling Vertex Shaders %i %% (%i/%i)", (shader_count * 100) / total, shader_count, total);
+				Host_UpdateTitle(msg);
+				OSD::AddTypedMessage(OSD::MessageType::ShaderCompileProgress, msg);
 			}
 		},
 			[](ByteCodeCacheEntry& entry)
@@ -253,10 +258,12 @@ void ShaderCache::Init()
 			item.CalculateUIDHash();
 			HandleGSUIDChange(item, true);
 			shader_count++;
-			if ((shader_count & 7) == 0)
+			s_compiler->WaitForRepositorySlot();
+			if ((shader_count & 31) == 0)
 			{
-				Host_UpdateTitle(StringFromFormat("Compiling Geometry Shaders %i %% (%i/%i)", (shader_count * 100) / total, shader_count, total));
-				s_compiler->WaitForFinish();
+				std::string msg = StringFromFormat("Compiling Geometry Shaders %i %% (%i/%i)", (shader_count * 100) / total, shader_count, total);
+				Host_UpdateTitle(msg);
+				OSD::AddTypedMessage(OSD::MessageType::ShaderCompileProgress, msg);
 			}
 		},
 			[](ByteCodeCacheEntry& entry)
@@ -273,10 +280,12 @@ void ShaderCache::Init()
 			item.CalculateUIDHash();
 			HandleTSUIDChange(item, true);
 			shader_count++;
+			s_compiler->WaitForRepositorySlot();
 			if ((shader_count & 31) == 0)
 			{
-				Host_UpdateTitle(StringFromFormat("Compiling Tessellation Shaders %i %% (%i/%i)", (shader_count * 100) / total, shader_count, total));
-				s_compiler->WaitForFinish();
+				std::string msg = StringFromFormat("Compiling Tessellation Shaders %i %% (%i/%i)", (shader_count * 100) / total, shader_count, total);
+				Host_UpdateTitle(msg);
+				OSD::AddTypedMessage(OSD::MessageType::ShaderCompileProgress, msg);
 			}
 		},
 			[](std::pair<ByteCodeCacheEntry, ByteCodeCacheEntry>& entry)
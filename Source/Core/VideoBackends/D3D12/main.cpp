@@ -105,6 +105,7 @@ void VideoBackend::InitBackendInfo()
 	g_Config.backend_info.bSupportsBBox = true;
 	g_Config.backend_info.bSupportsBBox = true;
 	g_Config.backend_info.bSupportsGSInstancing = true;
+	g_Config.backend_info.bSupportsVertexShaderLayer = false;
 	g_Config.backend_info.bSupportsTessellation = true;
 	g_Config.backend_info.bSupportsSSAA = true;
 	g_Config.backend_info.bSupportsGPUTextureDecoding = false;
@@ -2,6 +2,7 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include "Common/Assert.h"
 #include "Common/Logging/Log.h"
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
@@ -20,25 +21,11 @@ namespace D3D
 
 StateManager* stateman;
 
-template<typename T> AutoState<T>::AutoState(const T* object) : state(object)
-{
-	((IUnknown*)state)->AddRef();
-}
-
-template<typename T> AutoState<T>::AutoState(const AutoState<T> &source)
-{
-	state = source.get();
-	((T*)state)->AddRef();
-}
-
-template<typename T> AutoState<T>::~AutoState()
-{
-	if (state) ((T*)state)->Release();
-	state = nullptr;
-}
-
 StateManager::StateManager()
-	: m_currentBlendState(nullptr)
+	: m_blendStackDepth(0)
+	, m_depthStackDepth(0)
+	, m_rasterizerStackDepth(0)
+	, m_currentBlendState(nullptr)
 	, m_currentDepthState(nullptr)
 	, m_currentRasterizerState(nullptr)
 	, m_dirtyFlags(~0u)
@@ -50,56 +37,65 @@ StateManager::StateManager()
 
 void StateManager::PushBlendState(const ID3D11BlendState* state)
 {
-	m_blendStates.push(AutoBlendState(state));
+	_dbg_assert_(VIDEO, m_blendStackDepth < MAX_STATE_STACK_DEPTH);
+	m_blendStates[m_blendStackDepth++] = (ID3D11BlendState*)state;
 }
 void StateManager::PushDepthState(const ID3D11DepthStencilState* state)
 {
-	m_depthStates.push(AutoDepthStencilState(state));
+	_dbg_assert_(VIDEO, m_depthStackDepth < MAX_STATE_STACK_DEPTH);
+	m_depthStates[m_depthStackDepth++] = (ID3D11DepthStencilState*)state;
 }
 void StateManager::PushRasterizerState(const ID3D11RasterizerState* state)
 {
-	m_rasterizerStates.push(AutoRasterizerState(state));
+	_dbg_assert_(VIDEO, m_rasterizerStackDepth < MAX_STATE_STACK_DEPTH);
+	m_rasterizerStates[m_rasterizerStackDepth++] = (ID3D11RasterizerState*)state;
 }
 void StateManager::PopBlendState()
 {
-	m_blendStates.pop();
+	_dbg_assert_(VIDEO, m_blendStackDepth > 0);
+	m_blendStackDepth--;
 }
 void StateManager::PopDepthState()
 {
-	m_depthStates.pop();
+	_dbg_assert_(VIDEO, m_depthStackDepth > 0);
+	m_depthStackDepth--;
 }
 void StateManager::PopRasterizerState()
 {
-	m_rasterizerStates.pop();
+	_dbg_assert_(VIDEO, m_rasterizerStackDepth > 0);
+	m_rasterizerStackDepth--;
 }
 
 void StateManager::Apply()
 {
-	if (!m_blendStates.empty())
+	if (m_blendStackDepth)
 	{
-		if (m_currentBlendState != m_blendStates.top().get())
+		ID3D11BlendState* blendState = m_blendStates[m_blendStackDepth - 1];
+		if (m_currentBlendState != blendState)
 		{
-			m_currentBlendState = (ID3D11BlendState*)m_blendStates.top().get();
+			m_currentBlendState = blendState;
 			D3D::context->OMSetBlendState(m_currentBlendState, nullptr, 0xFFFFFFFF);
 		}
 	}
 	else ERROR_LOG(VIDEO, "Tried to apply without blend state!");
 
-	if (!m_depthStates.empty())
+	if (m_depthStackDepth)
 	{
-		if (m_currentDepthState != m_depthStates.top().get())
+		ID3D11DepthStencilState* depthState = m_depthStates[m_depthStackDepth - 1];
+		if (m_currentDepthState != depthState)
 		{
-			m_currentDepthState = (ID3D11DepthStencilState*)m_depthStates.top().get();
+			m_currentDepthState = depthState;
 			D3D::context->OMSetDepthStencilState(m_currentDepthState, 0);
 		}
 	}
 	else ERROR_LOG(VIDEO, "Tried to apply without depth state!");
 
-	if (!m_rasterizerStates.empty())
+	if (m_rasterizerStackDepth)
 	{
-		if (m_currentRasterizerState != m_rasterizerStates.top().get())
+		ID3D11RasterizerState* rasterizerState = m_rasterizerStates[m_rasterizerStackDepth - 1];
+		if (m_currentRasterizerState != rasterizerState)
 		{
-			m_currentRasterizerState = (ID3D11RasterizerState*)m_rasterizerStates.top().get();
+			m_currentRasterizerState = rasterizerState;
 			D3D::context->RSSetState(m_currentRasterizerState);
 		}
 	}
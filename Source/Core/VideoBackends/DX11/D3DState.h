@@ -4,7 +4,6 @@
 
 #pragma once
 
-#include <stack>
 #include <unordered_map>
 
 #include "Common/BitField.h"
@@ -88,26 +87,6 @@ private:
 
 namespace D3D
 {
-template<typename T> class AutoState
-{
-public:
-	AutoState(const T* object);
-	AutoState(const AutoState<T> &source);
-	~AutoState();
-
-	const inline T* get() const
-	{
-		return state;
-	}
-
-private:
-	const T* state;
-};
-
-typedef AutoState<ID3D11BlendState> AutoBlendState;
-typedef AutoState<ID3D11DepthStencilState> AutoDepthStencilState;
-typedef AutoState<ID3D11RasterizerState> AutoRasterizerState;
-
 class StateManager
 {
 public:
@@ -313,9 +292,18 @@ public:
 
 private:
 
-	std::stack<AutoBlendState> m_blendStates;
-	std::stack<AutoDepthStencilState> m_depthStates;
-	std::stack<AutoRasterizerState> m_rasterizerStates;
+	// Flat fixed-depth stacks: every draw pushes and pops the three GX states,
+	// so the old std::stack of refcounting wrappers cost six interlocked
+	// AddRef/Release pairs and deque traffic per draw for states that are
+	// owned by the state cache (or the utility caller) the whole time anyway.
+	static const size_t MAX_STATE_STACK_DEPTH = 8;
+
+	ID3D11BlendState* m_blendStates[MAX_STATE_STACK_DEPTH];
+	ID3D11DepthStencilState* m_depthStates[MAX_STATE_STACK_DEPTH];
+	ID3D11RasterizerState* m_rasterizerStates[MAX_STATE_STACK_DEPTH];
+	size_t m_blendStackDepth;
+	size_t m_depthStackDepth;
+	size_t m_rasterizerStackDepth;
 
 	ID3D11BlendState* m_currentBlendState;
 	ID3D11DepthStencilState* m_currentDepthState;
@@ -18,6 +18,9 @@
 #include "VideoBackends/DX11/PixelShaderCache.h"
 #include "VideoBackends/DX11/VertexShaderCache.h"
 
+#include "VideoCommon/ConstantManager.h"
+#include "VideoCommon/PixelShaderGen.h"
+#include "VideoCommon/VertexShaderManager.h"
 #include "VideoCommon/VideoConfig.h"
 
 namespace DX11
@@ -111,17 +114,20 @@ ConstantStreamBuffer::~ConstantStreamBuffer()
 	m_buf->Release();
 }
 
-// returns vertex offset to the new data
-void ConstantStreamBuffer::AppendData(void* data, u32 size)
+// returns a descriptor for the newly written data
+BufferDescriptor ConstantStreamBuffer::AppendData(void* data, u32 size)
 {
 	D3D11_MAPPED_SUBRESOURCE map;
 	m_offset = Common::AlignUpSizePow2(m_offset, 256); // align offset to 256 bytes (16 units) as requested by microsoft documentation
 	if (m_offset + size >= m_max_size || m_need_init)
 	{
-		// wrap buffer around
+		// wrap buffer around and notify observers that older data is gone
 		m_offset = 0;
 		context->Map(m_buf, 0, D3D11_MAP_WRITE_DISCARD, 0, &map);
 		m_need_init = !m_use_partial_buffer_update;
+
+		for (bool* observer : m_observers)
+			*observer = true;
 	}
 	else
 	{
@@ -131,6 +137,58 @@ void ConstantStreamBuffer::AppendData(void* data, u32 size)
 	context->Unmap(m_buf, 0);
 	m_current_size = size;
 	m_offset += size;
+	return GetDescriptor();
+}
+
+void ConstantStreamBuffer::EnsureSpace(u32 size)
+{
+	if (Common::AlignUpSizePow2(m_offset, 256) + size >= m_max_size && !m_need_init)
+	{
+		// make the next append discard the buffer and warn observers now, so
+		// they all refresh their descriptors before anything is bound
+		m_need_init = true;
+
+		for (bool* observer : m_observers)
+			*observer = true;
+	}
+}
+
+void ConstantStreamBuffer::AddWrapObserver(bool* observer)
+{
+	m_observers.push_back(observer);
+}
+
+static ConstantStreamBuffer* constant_stream_buf = nullptr;
+
+// worst case amount of constant data a single draw can append to the shared ring
+static u32 ConstantStreamDrawSize()
+{
+	return static_cast<u32>(
+		Common::AlignUpSizePow2(VertexShaderManager::ConstantBufferSize * sizeof(float), 256)
+		+ Common::AlignUpSizePow2(C_PCONST_END * 4 * sizeof(float), 256)
+		+ Common::AlignUpSizePow2(sizeof(GeometryShaderConstants), 256)
+		+ Common::AlignUpSizePow2(sizeof(TessellationShaderConstants), 256));
+}
+
+ConstantStreamBuffer* GetConstantStreamBuffer()
+{
+	if (constant_stream_buf == nullptr)
+	{
+		// One ring shared by every stage so the constants of a draw stay
+		// contiguous, mirroring the single UBO ring the OGL backend streams into.
+		bool use_partial_buffer_update = D3D::SupportPartialContantBufferUpdate();
+		u32 cbsize = ConstantStreamDrawSize() * (use_partial_buffer_update ? 1024 : 1);
+		constant_stream_buf = new ConstantStreamBuffer(cbsize);
+		ID3D11Buffer* buf = constant_stream_buf->GetBuffer();
+		CHECK(buf != nullptr, "Create shader constant stream buffer (size=%u)", cbsize);
+		D3D::SetDebugObjectName(buf, "constant stream buffer shared by the shader stages");
+	}
+	return constant_stream_buf;
+}
+
+void ReserveConstantStreamSpace()
+{
+	GetConstantStreamBuffer()->EnsureSpace(ConstantStreamDrawSize());
 }
 
 CD3DFont font;
@@ -545,6 +603,7 @@ void ShutdownUtils()
 	point_copy_sampler.reset();
 	font.Shutdown();
 	SAFE_DELETE(util_vbuf);
+	SAFE_DELETE(constant_stream_buf);
 }
 
 void SetPointCopySampler()
@@ -90,8 +90,12 @@ public:
 	ConstantStreamBuffer(u32 size);
 	~ConstantStreamBuffer();
 
-	// returns vertex offset to the new data
-	void AppendData(void* data, u32 size);
+	// returns a descriptor for the newly written data
+	BufferDescriptor AppendData(void* data, u32 size);
+	// forces the next append to wrap (and notify observers) if size bytes
+	// would not fit contiguously, so a batch of appends never wraps mid batch
+	void EnsureSpace(u32 size);
+	void AddWrapObserver(bool* observer);
 
 	inline ID3D11Buffer* &GetBuffer()
 	{
@@ -108,8 +112,16 @@ private:
 	u32 m_current_size = 0;
 	bool m_use_partial_buffer_update = false;
 	bool m_need_init = true;
+
+	std::list<bool*> m_observers;
 };
 
+// Ring of constant data shared by the GX shader stages, created on first use.
+ConstantStreamBuffer* GetConstantStreamBuffer();
+// Wraps the shared ring up front if a full draw worth of constants would not
+// fit, so stage descriptors fetched earlier in the same draw never go stale.
+void ReserveConstantStreamSpace();
+
 extern CD3DFont font;
 
 void InitUtils();
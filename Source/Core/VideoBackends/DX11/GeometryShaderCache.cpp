@@ -23,6 +23,7 @@
 #include "VideoCommon/GeometryShaderGen.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/HLSLCompiler.h"
+#include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -51,18 +52,20 @@ ID3D11GeometryShader* GeometryShaderCache::GetCopyGeometryShader()
 	return (g_ActiveConfig.iStereoMode > 0) ? CopyGeometryShader.get() : nullptr;
 }
 
-D3D::ConstantStreamBuffer* gscbuf = nullptr;
+static D3D::BufferDescriptor s_gscbuf_descriptor;
+static bool s_gscbuf_stale = true;
 
 D3D::BufferDescriptor  GeometryShaderCache::GetConstantBuffer()
 {
-	if (GeometryShaderManager::IsDirty())
+	if (GeometryShaderManager::IsDirty() || s_gscbuf_stale)
 	{
 		const size_t gscbuf_size = sizeof(GeometryShaderConstants);
-		gscbuf->AppendData((void*)&GeometryShaderManager::constants, gscbuf_size);
+		s_gscbuf_descriptor = D3D::GetConstantStreamBuffer()->AppendData((void*)&GeometryShaderManager::constants, gscbuf_size);
+		s_gscbuf_stale = false;
 		GeometryShaderManager::Clear();
 		ADDSTAT(stats.thisFrame.bytesUniformStreamed, gscbuf_size);
 	}
-	return gscbuf->GetDescriptor();
+	return s_gscbuf_descriptor;
 }
 
 // this class will load the precompiled shaders into our cache
@@ -149,12 +152,7 @@ void GeometryShaderCache::Init()
 {
 	s_compiler = &HLSLAsyncCompiler::getInstance();
 	s_geometry_shaders_lock.unlock();
-	bool use_partial_buffer_update = D3D::SupportPartialContantBufferUpdate();
-	u32 gbsize = static_cast<u32>(Common::AlignUpSizePow2(sizeof(GeometryShaderConstants), 16) * (use_partial_buffer_update ? 1024 : 1)); // must be a multiple of 16
-	gscbuf = new D3D::ConstantStreamBuffer(gbsize);
-	ID3D11Buffer* buf = gscbuf->GetBuffer();
-	CHECK(buf != nullptr, "Create geometry shader constant buffer (size=%u)", gbsize);
-	D3D::SetDebugObjectName(buf, "geometry shader constant buffer used to emulate the GX pipeline");
+	D3D::GetConstantStreamBuffer()->AddWrapObserver(&s_gscbuf_stale);
 
 	// used when drawing clear quads
 	ClearGeometryShader = D3D::CompileAndCreateGeometryShader(gs_clear_shader_code);
@@ -195,10 +193,12 @@ void GeometryShaderCache::Init()
 			item.CalculateUIDHash();
 			CompileGShader(item, true);
 			shader_count++;
-			if ((shader_count & 7) == 0)
+			s_compiler->WaitForRepositorySlot();
+			if ((shader_count & 31) == 0)
 			{
-				Host_UpdateTitle(StringFromFormat("Compiling Geometry Shaders %i %% (%i/%i)", (shader_count * 100) / total, shader_count, total));
-				s_compiler->WaitForFinish();
+				std::string msg = StringFromFormat("Compiling Geometry Shaders %i %% (%i/%i)", (shader_count * 100) / total, shader_count, total);
+				Host_UpdateTitle(msg);
+				OSD::AddTypedMessage(OSD::MessageType::ShaderCompileProgress, msg);
 			}
 		},
 			[](GSCacheEntry& entry)
@@ -234,12 +234,6 @@ void GeometryShaderCache::Shutdown()
 	{
 		s_compiler->WaitForFinish();
 	}
-	if (gscbuf != nullptr)
-	{
-		delete gscbuf;
-		gscbuf = nullptr;
-	}
-
 	ClearGeometryShader.reset();
 	CopyGeometryShader.reset();
 
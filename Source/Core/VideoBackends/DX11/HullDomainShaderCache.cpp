@@ -22,6 +22,7 @@
 #include "VideoCommon/Debugger.h"
 #include "VideoCommon/TessellationShaderManager.h"
 #include "VideoCommon/HLSLCompiler.h"
+#include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -36,21 +37,23 @@ TessellationShaderUid HullDomainShaderCache::s_external_last_uid;
 static HLSLAsyncCompiler *s_compiler;
 static Common::SpinLock<true> s_hulldomain_shaders_lock;
 
-std::unique_ptr<D3D::ConstantStreamBuffer> hdscbuf;
+static D3D::BufferDescriptor s_hdscbuf_descriptor;
+static bool s_hdscbuf_stale = true;
 
 LinearDiskCache<TessellationShaderUid, u8> g_hs_disk_cache;
 LinearDiskCache<TessellationShaderUid, u8> g_ds_disk_cache;
 
 D3D::BufferDescriptor  HullDomainShaderCache::GetConstantBuffer()
 {
-	if (TessellationShaderManager::IsDirty())
+	if (TessellationShaderManager::IsDirty() || s_hdscbuf_stale)
 	{
 		const size_t hdscbuf_size = sizeof(TessellationShaderConstants);
-		hdscbuf->AppendData((void*)&TessellationShaderManager::constants, hdscbuf_size);
+		s_hdscbuf_descriptor = D3D::GetConstantStreamBuffer()->AppendData((void*)&TessellationShaderManager::constants, hdscbuf_size);
+		s_hdscbuf_stale = false;
 		TessellationShaderManager::Clear();
 		ADDSTAT(stats.thisFrame.bytesUniformStreamed, hdscbuf_size);
 	}
-	return hdscbuf->GetDescriptor();
+	return s_hdscbuf_descriptor;
 }
 
 // this class will load the precompiled shaders into our cache
@@ -77,12 +80,7 @@ void HullDomainShaderCache::Init()
 	s_compiler = &HLSLAsyncCompiler::getInstance();
 	s_hulldomain_shaders_lock.unlock();
 
-	bool use_partial_buffer_update = D3D::SupportPartialContantBufferUpdate();
-	u32 gbsize = static_cast<u32>(Common::AlignUpSizePow2(sizeof(TessellationShaderConstants), 16) * (use_partial_buffer_update ? 1024 : 1)); // must be a multiple of 16
-	hdscbuf.reset(new D3D::ConstantStreamBuffer(gbsize));
-	ID3D11Buffer* buf = hdscbuf->GetBuffer();
-	CHECK(buf != nullptr, "Create Hull Domain shader constant buffer (size=%u)", gbsize);
-	D3D::SetDebugObjectName(buf, "Hull Domain shader constant buffer used to emulate the GX pipeline");
+	D3D::GetConstantStreamBuffer()->AddWrapObserver(&s_hdscbuf_stale);
 	Clear();
 
 	if (!File::Exists(File::GetUserPath(D_SHADERCACHE_IDX)))
@@ -120,10 +118,12 @@ void HullDomainShaderCache::Init()
 			item.CalculateUIDHash();
 			CompileHDShader(item, true);
 			shader_count++;
-			if ((shader_count & 7) == 0)
+			s_compiler->WaitForRepositorySlot();
+			if ((shader_count & 31) == 0)
 			{
-				Host_UpdateTitle(StringFromFormat("Compiling Tessellation Shaders %i %% (%i/%i)", (shader_count * 100) / total, shader_count, total));
-				s_compiler->WaitForFinish();
+				std::string msg = StringFromFormat("Compiling Tessellation Shaders %i %% (%i/%i)", (shader_count * 100) / total, shader_count, total);
+				Host_UpdateTitle(msg);
+				OSD::AddTypedMessage(OSD::MessageType::ShaderCompileProgress, msg);
 			}
 		},
 			[](HDCacheEntry& entry)
@@ -158,8 +158,6 @@ void HullDomainShaderCache::Shutdown()
 	{
 		s_compiler->WaitForFinish();
 	}
-	hdscbuf.reset();
-
 	Clear();
 	delete s_hulldomain_shaders;
 	s_hulldomain_shaders = nullptr;
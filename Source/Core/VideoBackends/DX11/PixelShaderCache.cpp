@@ -17,6 +17,7 @@
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/HLSLCompiler.h"
+#include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/PixelShaderManager.h"
 
 
@@ -41,7 +42,8 @@ D3D::PixelShaderPtr s_ClearProgram;
 D3D::PixelShaderPtr s_rgba6_to_rgb8[2];
 D3D::PixelShaderPtr s_rgb8_to_rgba6[2];
 
-D3D::ConstantStreamBuffer* pscbuf;
+static D3D::BufferDescriptor s_pscbuf_descriptor;
+static bool s_pscbuf_stale = true;
 
 const char* clear_program_code = R"hlsl(
 	void main(
@@ -436,15 +438,16 @@ ID3D11PixelShader* PixelShaderCache::GetClearProgram()
 
 D3D::BufferDescriptor PixelShaderCache::GetConstantBuffer()
 {
-	if (PixelShaderManager::IsDirty())
+	if (PixelShaderManager::IsDirty() || s_pscbuf_stale)
 	{
 		const int sz = C_PCONST_END * 4 * sizeof(float);
 		// TODO: divide the global variables of the generated shaders into about 5 constant buffers to speed this up
-		pscbuf->AppendData((void*)PixelShaderManager::GetBuffer(), sz);
+		s_pscbuf_descriptor = D3D::GetConstantStreamBuffer()->AppendData((void*)PixelShaderManager::GetBuffer(), sz);
+		s_pscbuf_stale = false;
 		PixelShaderManager::Clear();
 		ADDSTAT(stats.thisFrame.bytesUniformStreamed, sz);
 	}
-	return pscbuf->GetDescriptor();
+	return s_pscbuf_descriptor;
 }
 
 // this class will load the precompiled shaders into our cache
@@ -461,12 +464,7 @@ void PixelShaderCache::Init()
 {
 	s_compiler = &HLSLAsyncCompiler::getInstance();
 	s_pixel_shaders_lock.unlock();
-	bool use_partial_buffer_update = D3D::SupportPartialContantBufferUpdate();
-	u32 cbsize = C_PCONST_END * 4 * sizeof(float) * (use_partial_buffer_update ? 1024 : 1); // is always a multiple of 16	
-	pscbuf = new D3D::ConstantStreamBuffer(cbsize);
-	ID3D11Buffer* buf = pscbuf->GetBuffer();
-	CHECK(buf != nullptr, "Create pixel shader constant buffer");
-	D3D::SetDebugObjectName(buf, "pixel shader constant buffer used to emulate the GX pipeline");
+	D3D::GetConstantStreamBuffer()->AddWrapObserver(&s_pscbuf_stale);
 
 	// used when drawing clear quads
 	s_ClearProgram = D3D::CompileAndCreatePixelShader(clear_program_code);
@@ -524,10 +522,12 @@ void PixelShaderCache::Init()
 			item.CalculateUIDHash();
 			CompilePShader(item, true);
 			shader_count++;
-			if ((shader_count & 7) == 0)
+			s_compiler->WaitForRepositorySlot();
+			if ((shader_count & 31) == 0)
 			{
-				Host_UpdateTitle(StringFromFormat("Compiling Pixel Shaders %i %% (%i/%i)", (shader_count * 100) / total, shader_count, total));
-				s_compiler->WaitForFinish();
+				std::string msg = StringFromFormat("Compiling Pixel Shaders %i %% (%i/%i)", (shader_count * 100) / total, shader_count, total);
+				Host_UpdateTitle(msg);
+				OSD::AddTypedMessage(OSD::MessageType::ShaderCompileProgress, msg);
 			}
 		},
 			[](PSCacheEntry& entry)
@@ -573,11 +573,6 @@ void PixelShaderCache::Shutdown()
 	{
 		s_compiler->WaitForFinish();
 	}
-	if (pscbuf != nullptr)
-	{
-		delete pscbuf;
-	}
-	pscbuf = nullptr;
 	s_ClearProgram.reset();
 	s_DepthResolveProgram.reset();
 	for (auto & p : s_ColorCopyProgram)
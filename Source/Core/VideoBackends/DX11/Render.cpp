@@ -825,6 +825,7 @@ void Renderer::ApplyState(bool bUseDstAlpha)
 		// restore actual state
 		SetLogicOpMode();
 	}
+	D3D::ReserveConstantStreamSpace();
 	D3D::BufferDescriptor vbuffer = VertexShaderCache::GetConstantBuffer();
 	D3D::BufferDescriptor pbuffer = PixelShaderCache::GetConstantBuffer();
 	ID3D11GeometryShader* geometry_shader = GeometryShaderCache::GetActiveShader();
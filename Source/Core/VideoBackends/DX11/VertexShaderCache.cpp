@@ -11,6 +11,7 @@
 
 #include "VideoCommon/Debugger.h"
 #include "VideoCommon/HLSLCompiler.h"
+#include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexShaderGen.h"
 #include "VideoCommon/VertexShaderManager.h"
@@ -52,19 +53,21 @@ ID3D11InputLayout* VertexShaderCache::GetClearInputLayout()
 	return s_clear_layout.get();
 }
 
-D3D::ConstantStreamBuffer* vscbuf = nullptr;
+static D3D::BufferDescriptor s_vscbuf_descriptor;
+static bool s_vscbuf_stale = true;
 
 D3D::BufferDescriptor VertexShaderCache::GetConstantBuffer()
 {
 	// TODO: divide the global variables of the generated shaders into about 5 constant buffers to speed this up
-	if (VertexShaderManager::IsDirty())
+	if (VertexShaderManager::IsDirty() || s_vscbuf_stale)
 	{
 		const size_t size = sizeof(float) * VertexShaderManager::ConstantBufferSize;
-		vscbuf->AppendData((void*)VertexShaderManager::GetBuffer(), size);
+		s_vscbuf_descriptor = D3D::GetConstantStreamBuffer()->AppendData((void*)VertexShaderManager::GetBuffer(), size);
+		s_vscbuf_stale = false;
 		VertexShaderManager::Clear();
 		ADDSTAT(stats.thisFrame.bytesUniformStreamed, size);
 	}
-	return vscbuf->GetDescriptor();
+	return s_vscbuf_descriptor;
 }
 
 // this class will load the precompiled shaders into our cache
@@ -128,13 +131,7 @@ void VertexShaderCache::Init()
 		{ "COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
 	};
 
-	bool use_partial_buffer_update = D3D::SupportPartialContantBufferUpdate();
-	u32 cbsize = VertexShaderManager::ConstantBufferSize * sizeof(float) * (use_partial_buffer_update ? 1024 : 1); // is always multiple of 16
-	vscbuf = new D3D::ConstantStreamBuffer(cbsize);
-	ID3D11Buffer* buf = vscbuf->GetBuffer();
-
-	CHECK(buf != nullptr, "Create vertex shader constant buffer (size=%u)", cbsize);
-	D3D::SetDebugObjectName(buf, "vertex shader constant buffer used to emulate the GX pipeline");
+	D3D::GetConstantStreamBuffer()->AddWrapObserver(&s_vscbuf_stale);
 
 	D3DBlob blob;
 	D3D::CompileShader(D3D::ShaderType::Vertex, simple_shader_code, blob);
@@ -188,10 +185,12 @@ void VertexShaderCache::Init()
 			item.CalculateUIDHash();
 			CompileVShader(item, true);
 			shader_count++;
-			if ((shader_count & 7) == 0)
+			s_compiler->WaitForRepositorySlot();
+			if ((shader_count & 31) == 0)
 			{
-				Host_UpdateTitle(StringFromFormat("Compiling Vertex Shaders %i %% (%i/%i)", (shader_count * 100) / total, shader_count, total));
-				s_compiler->WaitForFinish();
+				std::string msg = StringFromFormat("Compiling Vertex Shaders %i %% (%i/%i)", (shader_count * 100) / total, shader_count, total);
+				Host_UpdateTitle(msg);
+				OSD::AddTypedMessage(OSD::MessageType::ShaderCompileProgress, msg);
 			}
 		},
 			[](VSCacheEntry& entry)
@@ -225,11 +224,6 @@ void VertexShaderCache::Shutdown()
 	{
 		s_compiler->WaitForFinish();
 	}
-	if (vscbuf != nullptr)
-	{
-		delete vscbuf;
-	}
-
 	s_simple_vertex_shader.reset();
 	s_clear_vertex_shader.reset();
 
@@ -142,6 +142,7 @@ void VideoBackend::InitBackendInfo()
 			g_Config.backend_info.bSupportsBBox = shader_model_5_supported;
 			// Requires the instance attribute (only available in shader model 5)
 			g_Config.backend_info.bSupportsGSInstancing = shader_model_5_supported;
+			g_Config.backend_info.bSupportsVertexShaderLayer = false;
 			g_Config.backend_info.bSupportsTessellation = shader_model_5_supported;
 			g_Config.backend_info.bSupportsSSAA = shader_model_5_supported;
 			g_Config.backend_info.bSupportsGPUTextureDecoding = shader_model_5_supported;
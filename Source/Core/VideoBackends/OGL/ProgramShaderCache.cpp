@@ -512,6 +512,15 @@ void ProgramShaderCache::GetShaderId(SHADERUID* uid, PIXEL_SHADER_RENDER_MODE re
 	GetPixelShaderUID(uid->puid, render_mode, components, xfmem, bpmem);
 	GetVertexShaderUID(uid->vuid, components, xfmem, bpmem);
 	GetGeometryShaderUid(uid->guid, primitive_type, xfmem, components);
+
+	// Triangle programs drop the geometry stage on the instanced stereoscopy
+	// path (see GetGeometryShaderUid), so the vertex shader selects the eye.
+	if (primitive_type == PRIMITIVE_TRIANGLES && g_ActiveConfig.UseVertexShaderLayerStereo())
+	{
+		uid->vuid.GetUidData<vertex_shader_uid_data>().stereo_layer = 1;
+		uid->vuid.ClearHASH();
+		uid->vuid.CalculateUIDHash();
+	}
 }
 
 void ProgramShaderCache::Init()
@@ -654,6 +663,15 @@ void ProgramShaderCache::CreateHeader()
 	default: SupportedESPointSize = ""; break;
 	}
 
+	std::string SupportedVertexLayer;
+	switch (g_ogl_config.SupportedVertexLayer)
+	{
+	case 1: SupportedVertexLayer = "#extension GL_ARB_shader_viewport_layer_array : enable"; break;
+	case 2: SupportedVertexLayer = "#extension GL_AMD_vertex_shader_layer : enable"; break;
+	case 3: SupportedVertexLayer = "#extension GL_NV_viewport_array2 : enable"; break;
+	default: SupportedVertexLayer = ""; break;
+	}
+
 	switch (g_ogl_config.SupportedESTextureBuffer)
 	{
 	case ES_TEXBUF_TYPE::TEXBUF_EXT:
@@ -697,6 +715,7 @@ void ProgramShaderCache::CreateHeader()
 		"%s\n" // shader5
 		"%s\n" // SSAA
 		"%s\n" // Geometry point size
+		"%s\n" // Vertex shader layer
 		"%s\n" // AEP
 		"%s\n" // texture buffer
 		"%s\n" // ES texture buffer
@@ -766,6 +785,7 @@ void ProgramShaderCache::CreateHeader()
 		, !is_glsles && g_ActiveConfig.backend_info.bSupportsBBox ? "#extension GL_ARB_shader_storage_buffer_object : enable" : ""
 		, !is_glsles && g_ActiveConfig.backend_info.bSupportsGSInstancing ? "#extension GL_ARB_gpu_shader5 : enable" : ""
 		, SupportedESPointSize.c_str()
+		, SupportedVertexLayer.c_str()
 		, g_ogl_config.bSupportsAEP ? "#extension GL_ANDROID_extension_pack_es31a : enable" : ""
 		, v < GLSL_140 && g_ActiveConfig.backend_info.bSupportsPaletteConversion ? "#extension GL_ARB_texture_buffer_object : enable" : ""
 		, v < GLSL_400 && g_ActiveConfig.backend_info.bSupportsSSAA ? "#extension GL_ARB_sample_shading : enable" : ""
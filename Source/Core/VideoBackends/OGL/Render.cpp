@@ -448,6 +448,15 @@ Renderer::Renderer()
 	g_Config.backend_info.bSupportsBBox =
 		GLExtensions::Supports("GL_ARB_shader_storage_buffer_object");
 	g_Config.backend_info.bSupportsGSInstancing = GLExtensions::Supports("GL_ARB_gpu_shader5");
+	// Several extensions allow gl_Layer writes from the vertex shader; remember
+	// which one so the GLSL header can enable it.
+	g_ogl_config.SupportedVertexLayer =
+		GLExtensions::Supports("GL_ARB_shader_viewport_layer_array") ?
+		1 :
+		GLExtensions::Supports("GL_AMD_vertex_shader_layer") ?
+		2 :
+		GLExtensions::Supports("GL_NV_viewport_array2") ? 3 : 0;
+	g_Config.backend_info.bSupportsVertexShaderLayer = g_ogl_config.SupportedVertexLayer > 0;
 	g_Config.backend_info.bSupportsSSAA = GLExtensions::Supports("GL_ARB_gpu_shader5") &&
 		GLExtensions::Supports("GL_ARB_sample_shading");
 	g_Config.backend_info.bSupportsGeometryShaders =
@@ -49,6 +49,7 @@ struct VideoConfig
 	bool bSupportsDebug;
 	bool bSupportsCopySubImage;
 	u8 SupportedESPointSize;
+	u8 SupportedVertexLayer;
 	ES_TEXBUF_TYPE SupportedESTextureBuffer;
 	bool bSupportsTextureStorage;
 	bool bSupports2DTextureStorageMultisample;
@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include "Common/Align.h"
+#include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
 #include "Common/GL/GLUtil.h"
 
@@ -32,6 +33,7 @@ StreamBuffer::StreamBuffer(u32 type, u32 size, u32 align_size, bool need_cpu_buf
 	m_iterator = 0;
 	m_used_iterator = 0;
 	m_free_iterator = 0;
+	m_lap = 0;
 	for (int i = 0; i < SYNC_POINTS; i++)
 	{
 		m_fences[i] = 0;
@@ -112,6 +114,7 @@ void StreamBuffer::AllocMemory(u32 size)
 
 		// move to the start
 		m_used_iterator = m_iterator = 0; // offset 0 is always aligned
+		m_lap++;
 
 		// wait for space at the start
 		start_fence = 0;
@@ -121,7 +124,21 @@ void StreamBuffer::AllocMemory(u32 size)
 	{
 		if (m_fences[i])
 		{
-			glClientWaitSync(m_fences[i], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+			// Cheap non-blocking check first: the slot has usually been retired
+			// long ago, and this avoids flushing the command stream.
+			GLenum result = glClientWaitSync(m_fences[i], 0, 0);
+			if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED)
+			{
+				// The GPU still owns this part of the ring, so we have to stall.
+				// If this happens all the time, the ring is too small to cover
+				// the CPU-GPU distance for this workload.
+				if (++m_stall_count == 256)
+				{
+					WARN_LOG(VIDEO, "Stream buffer of size %u KB stalls frequently waiting for the "
+						"GPU, it is undersized for this workload.", m_size / 1024);
+				}
+				glClientWaitSync(m_fences[i], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+			}
 			glDeleteSync(m_fences[i]);
 			m_fences[i] = 0;
 		}
@@ -129,6 +146,25 @@ void StreamBuffer::AllocMemory(u32 size)
 	m_free_iterator = m_iterator + size;
 }
 
+void StreamBuffer::ReuseRange(u32 offset, u32 size)
+{
+	if (size == 0)
+		return;
+	// Only slots which already carry a fence need a newer one; slots between
+	// m_used_iterator and m_iterator get their fence created on the next
+	// AllocMemory, which already postdates the reusing draw. Buffers without
+	// fences (orphaning) keep old storage alive for pending draws by
+	// themselves.
+	for (int i = Slot(offset); i <= Slot(offset + size - 1); i++)
+	{
+		if (m_fences[i])
+		{
+			glDeleteSync(m_fences[i]);
+			m_fences[i] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		}
+	}
+}
+
 /* The usual way to stream data to the GPU.
 * Described here: https://www.opengl.org/wiki/Buffer_Object_Streaming#Unsynchronized_buffer_mapping
 * Just do unsync appends until the buffer is full.
@@ -148,12 +184,17 @@ public:
 	~MapAndOrphan()
 	{}
 
+	// Orphaning keeps the old storage alive for pending draws on its own, so
+	// same-lap ranges can be redrawn without any fence bookkeeping.
+	bool SupportsRetainedRanges() const override { return true; }
+
 	u32 Stream(u32 size, const void* src) override
 	{
 		if (m_iterator + size >= m_size)
 		{
 			glBufferData(m_buffertype, m_size, nullptr, GL_STREAM_DRAW);
 			m_iterator = 0;
+			m_lap++;
 		}
 		u32 iter = m_iterator;
 		m_iterator += size;
@@ -188,6 +229,8 @@ public:
 		DeleteFences();
 	}
 
+	bool SupportsRetainedRanges() const override { return true; }
+
 	u32 Stream(u32 size, const void* src) override
 	{
 		AllocMemory(size);
@@ -240,6 +283,8 @@ public:
 		glBindBuffer(m_buffertype, 0);
 	}
 
+	bool SupportsRetainedRanges() const override { return true; }
+
 	u32 Stream(u32 size, const void* src) override
 	{
 		AllocMemory(size);
@@ -284,6 +329,8 @@ public:
 		m_pointer = nullptr;
 	}
 
+	bool SupportsRetainedRanges() const override { return true; }
+
 	u32 Stream(u32 size, const void* src) override
 	{
 		AllocMemory(size);
@@ -371,8 +418,10 @@ std::unique_ptr<StreamBuffer> StreamBuffer::Create(u32 type, u32 size)
 			return std::make_unique<PinnedMemory>(type, size);
 
 		// buffer storage works well in most situations
-		// coherent enabled hits the fast path on latest nvidia drivers
-		bool coherent = true; // DriverDetails::HasBug(DriverDetails::BUG_BROKEN_EXPLICIT_FLUSH);
+		// coherent mapping hits the fast path on recent nvidia drivers, and explicit
+		// flushing is slow on drivers with BUG_BROKEN_EXPLICIT_FLUSH, so coherent is
+		// the verified default everywhere we enable buffer storage
+		bool coherent = true;
 		if (g_ogl_config.bSupportsGLBufferStorage &&
 			!(DriverDetails::HasBug(DriverDetails::BUG_BROKEN_BUFFER_STORAGE) && type == GL_ARRAY_BUFFER) &&
 			!(DriverDetails::HasBug(DriverDetails::BUG_INTEL_BROKEN_BUFFER_STORAGE) && type == GL_ELEMENT_ARRAY_BUFFER))
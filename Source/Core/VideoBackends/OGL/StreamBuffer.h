@@ -47,6 +47,23 @@ public:
 	{
 		return (m_iterator + size + stride) <= m_size;
 	}
+
+	// Whether data returned by a previous Stream() call may be drawn from again
+	// later, as long as the lap below has not advanced. Buffers which orphan or
+	// reallocate their storage per upload cannot retain anything.
+	virtual bool SupportsRetainedRanges() const { return false; }
+
+	// Counts the passes over the ring. Content streamed during lap N is gone
+	// once the write position wraps back to the start: strictly it survives
+	// until overwritten, but treating the wrap as a full invalidation keeps
+	// the validity check a single compare.
+	u32 GetLap() const { return m_lap; }
+
+	// Tells the buffer that [offset, offset+size) is referenced by draws issued
+	// after the range was originally streamed. Re-arms the covering fences so
+	// the wrap-around overwrite waits for those draws too.
+	void ReuseRange(u32 offset, u32 size);
+
 	const u32 m_buffer;
 
 protected:
@@ -61,9 +78,13 @@ protected:
 	u32 m_iterator;
 	u32 m_used_iterator;
 	u32 m_free_iterator;
-	
+	u32 m_lap;
+
 private:
-	static constexpr int SYNC_POINTS = 8;
+	// More sync points means shorter stalls: a wait can only block until the
+	// GPU has consumed one slot's worth of data, so the granularity of a
+	// stall shrinks with the slot size.
+	static constexpr int SYNC_POINTS = 16;
 	int Slot(u32 x) const
 	{
 		return x >> m_bit_per_slot;
@@ -71,6 +92,7 @@ private:
 	const int m_bit_per_slot;
 
 	std::array<GLsync, SYNC_POINTS> m_fences{};
+	u32 m_stall_count = 0;
 };
 
 }
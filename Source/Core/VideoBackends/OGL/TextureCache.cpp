@@ -550,6 +550,11 @@ void TextureCache::CopyEFB(u8* dst, const EFBCopyFormat& format, u32 native_widt
 		memory_stride, is_depth_copy, src_rect, scale_by_half);
 }
 
+void TextureCache::FlushEFBCopies()
+{
+	TextureConverter::FlushPendingEFBCopies();
+}
+
 bool TextureCache::Palettize(TCacheEntryBase* src_entry, const TCacheEntryBase* base_entry)
 {
 	TextureCache::TCacheEntry* entry = (TextureCache::TCacheEntry*)src_entry;
@@ -76,6 +76,7 @@ private:
 	void CopyEFB(u8* dst, const EFBCopyFormat& format, u32 native_width, u32 bytes_per_row,
 		u32 num_blocks_y, u32 memory_stride, bool is_depth_copy,
 		const EFBRectangle& src_rect, bool scale_by_half) override;
+	void FlushEFBCopies() override;
 	bool Palettize(TCacheEntryBase* entry, const TCacheEntryBase* base_entry) override;
 	void LoadLut(u32 lutFmt, void* addr, u32 size) override;
 	bool CompileShaders() override;
@@ -20,6 +20,7 @@
 #include "VideoBackends/OGL/TextureConverter.h"
 
 #include "VideoCommon/DriverDetails.h"
+#include "VideoCommon/Fifo.h"
 #include "VideoCommon/ImageWrite.h"
 #include "VideoCommon/TextureConversionShader.h"
 #include "VideoCommon/VideoConfig.h"
@@ -54,6 +55,63 @@ static std::map<EFBCopyFormat, EncodingProgram> s_encoding_programs;
 
 static GLuint s_PBO = 0; // for readback with different strides
 
+// Ring of PBOs for deferred EFB-to-RAM readbacks. An encode is drawn, read
+// into the next slot and fenced; the result is only copied into emulated RAM
+// once the game is told the GPU is done (FlushPendingEFBCopies) or the slot
+// is needed again, so the video thread no longer stalls on every EFB copy.
+struct PendingReadback
+{
+	GLuint pbo = 0;
+	GLsync fence = nullptr;
+	u8* dest = nullptr;
+	u32 line_size = 0;
+	u32 stride = 0;
+	u32 height = 0;
+	bool pending = false;
+};
+static constexpr u32 NUM_READBACK_PBOS = 4;
+static PendingReadback s_readbacks[NUM_READBACK_PBOS];
+static u32 s_next_readback = 0;
+
+static void CompleteReadback(PendingReadback& readback)
+{
+	glClientWaitSync(readback.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+	glDeleteSync(readback.fence);
+	readback.fence = nullptr;
+	readback.pending = false;
+
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo);
+	u8* pbo = (u8*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, readback.line_size * readback.height,
+		GL_MAP_READ_BIT);
+	u8* dest = readback.dest;
+	if (readback.line_size == readback.stride)
+	{
+		memcpy(dest, pbo, readback.line_size * readback.height);
+	}
+	else
+	{
+		for (u32 i = 0; i < readback.height; i++)
+		{
+			memcpy(dest, pbo, readback.line_size);
+			pbo += readback.line_size;
+			dest += readback.stride;
+		}
+	}
+	glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+void FlushPendingEFBCopies()
+{
+	// Complete in issue order so overlapping copies land in RAM in FIFO order.
+	for (u32 i = 0; i < NUM_READBACK_PBOS; i++)
+	{
+		PendingReadback& readback = s_readbacks[(s_next_readback + i) % NUM_READBACK_PBOS];
+		if (readback.pending)
+			CompleteReadback(readback);
+	}
+}
+
 static void CreatePrograms()
 {
 	/* TODO: Accuracy Improvements
@@ -191,15 +249,29 @@ void Init()
 	glGenBuffers(1, &s_PBO);
 	glBindBuffer(GL_PIXEL_PACK_BUFFER, s_PBO);
 	glBufferData(GL_PIXEL_PACK_BUFFER, 1024*1024*4, nullptr, GL_STREAM_READ);
+	for (auto& readback : s_readbacks)
+	{
+		glGenBuffers(1, &readback.pbo);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo);
+		glBufferData(GL_PIXEL_PACK_BUFFER, 1024*1024*4, nullptr, GL_STREAM_READ);
+	}
 	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	s_next_readback = 0;
 	CreatePrograms();
 }
 
 void Shutdown()
 {
+	FlushPendingEFBCopies();
+
 	glDeleteTextures(1, &s_srcTexture);
 	glDeleteTextures(1, &s_dstTexture);
 	glDeleteBuffers(1, &s_PBO);
+	for (auto& readback : s_readbacks)
+	{
+		glDeleteBuffers(1, &readback.pbo);
+		readback.pbo = 0;
+	}
 	glDeleteFramebuffers(2, s_texConvFrameBuffer);
 
 	s_rgbToYuyvProgram.Destroy();
@@ -219,7 +291,7 @@ void Shutdown()
 // dst_line_size, writeStride in bytes
 static void EncodeToRamUsingShader(GLuint srcTexture,
 	u8* destAddr, u32 dst_line_size, u32 dstHeight,
-	u32 writeStride, bool linearFilter)
+	u32 writeStride, bool linearFilter, bool deferred)
 {
 	u32 dstWidth = (dst_line_size / 4);
 	// switch to texture converter frame buffer
@@ -244,6 +316,29 @@ static void EncodeToRamUsingShader(GLuint srcTexture,
 	// .. and then read back the results.
 	int dstSize = dst_line_size * dstHeight;
 
+	if (deferred)
+	{
+		// Issue the readback into the ring and return without waiting; the
+		// memcpy into emulated RAM happens in FlushPendingEFBCopies. If every
+		// slot is still in flight, completing the oldest throttles us to the
+		// GPU, which at that point has a full ring of encodes queued anyway.
+		PendingReadback& readback = s_readbacks[s_next_readback];
+		if (readback.pending)
+			CompleteReadback(readback);
+
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo);
+		glReadPixels(0, 0, (GLsizei)dstWidth, (GLsizei)dstHeight, GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
+		readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		readback.dest = destAddr;
+		readback.line_size = dst_line_size;
+		readback.stride = writeStride;
+		readback.height = dstHeight;
+		readback.pending = true;
+		s_next_readback = (s_next_readback + 1) % NUM_READBACK_PBOS;
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		return;
+	}
+
 	// When the dst_line_size and writeStride are the same, we could use glReadPixels directly to RAM.
 	// But instead we always copy the data via a PBO, because macOS inexplicably prefers this for some
 	// reason.
@@ -283,9 +378,12 @@ void EncodeToRamFromTexture(u8* dest_ptr, const EFBCopyFormat& format, u32 nativ
 		FramebufferManager::ResolveAndGetDepthTarget(src_rect) :
 		FramebufferManager::ResolveAndGetRenderTarget(src_rect);
 
+	// Deterministic GPU thread mode delivers tokens on the CPU thread, where we
+	// cannot flush pending readbacks, so stay synchronous there.
 	EncodeToRamUsingShader(read_texture,
 		dest_ptr, bytes_per_row, num_blocks_y,
-		memory_stride, scale_by_half && !is_depth_copy);
+		memory_stride, scale_by_half && !is_depth_copy,
+		!Fifo::UseDeterministicGPUThread());
 
 	FramebufferManager::SetFramebuffer(0);
 	g_renderer->RestoreAPIState();
@@ -303,7 +401,7 @@ void EncodeToRamYUYV(GLuint srcTexture, const TargetRectangle& sourceRc, u8* des
 	// We enable linear filtering, because the GameCube does filtering in the vertical direction when
 	// yscale is enabled.
 	// Otherwise we get jaggies when a game uses yscaling (most PAL games)
-	EncodeToRamUsingShader(srcTexture, destAddr, dstWidth * 2, dstHeight, dstStride, true);
+	EncodeToRamUsingShader(srcTexture, destAddr, dstWidth * 2, dstHeight, dstStride, true, false);
 	FramebufferManager::SetFramebuffer(0);
 	TextureCache::DisableStage(0);
 	g_renderer->RestoreAPIState();
@@ -30,6 +30,9 @@ void EncodeToRamFromTexture(u8* dest_ptr, const EFBCopyFormat& format, u32 nativ
 	u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
 	bool is_depth_copy, const EFBRectangle& src_rect, bool scale_by_half);
 
+// Writes every in-flight deferred EFB copy back to emulated RAM.
+void FlushPendingEFBCopies();
+
 }
 
 }  // namespace OGL
@@ -10,6 +10,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
 #include "Common/GL/GLExtensions/GLExtensions.h"
+#include "Common/Hash.h"
 #include "Common/StringUtil.h"
 
 #include "VideoBackends/OGL/BoundingBox.h"
@@ -30,6 +31,11 @@ namespace OGL
 const u32 MAX_IBUFFER_SIZE = 2 * 1024 * 1024;
 const u32 MAX_VBUFFER_SIZE = 32 * 1024 * 1024;
 
+// Hashing very large dynamic spans costs more than the upload it might save,
+// so the dedup cache only considers spans up to this size.
+const u32 DEDUP_MAX_VERTEX_BYTES = 1024 * 1024;
+const u32 UPLOAD_CACHE_MAX_ENTRIES = 16384;
+
 
 VertexManager::VertexManager() : m_cpu_v_buffer(MAXVBUFFERSIZE), m_cpu_i_buffer(MAXIBUFFERSIZE)
 {
@@ -50,18 +56,80 @@ void VertexManager::CreateDeviceObjects()
 	m_index_buffers = m_indexBuffer->m_buffer;
 
 	m_last_vao = 0;
+
+	// Deduplicated draws reference old offsets in both rings, which needs base
+	// vertex support and streaming methods that keep old content around.
+	m_dedup_supported = g_ogl_config.bSupportsGLBaseVertex &&
+		m_vertexBuffer->SupportsRetainedRanges() && m_indexBuffer->SupportsRetainedRanges();
+	m_upload_cache.clear();
+	m_reuse_pending = false;
 }
 
 void VertexManager::DestroyDeviceObjects()
 {
 	m_vertexBuffer.reset();
 	m_indexBuffer.reset();
+	m_upload_cache.clear();
 }
 
 void VertexManager::PrepareDrawBuffers(u32 stride)
 {
 	u32 vertex_data_size = IndexGenerator::GetNumVerts() * stride;
 	u32 index_data_size = IndexGenerator::GetIndexLen() * sizeof(u16);
+
+	m_reuse_pending = false;
+	if (m_dedup_supported && vertex_data_size <= DEDUP_MAX_VERTEX_BYTES)
+	{
+		u64 hash = GetHash64(m_cpu_v_buffer.data(), vertex_data_size, 0);
+		hash = hash * 0x9E3779B97F4A7C15ull ^
+			GetHash64(reinterpret_cast<u8*>(m_cpu_i_buffer.data()), index_data_size, 0);
+
+		auto iter = m_upload_cache.find(hash);
+		if (iter != m_upload_cache.end())
+		{
+			const UploadCacheEntry& entry = iter->second;
+			if (entry.v_lap == m_vertexBuffer->GetLap() && entry.i_lap == m_indexBuffer->GetLap() &&
+				entry.vertex_size == vertex_data_size && entry.index_size == index_data_size &&
+				entry.stride == stride)
+			{
+				// Identical span is still resident: draw from the cached range.
+				m_baseVertex = entry.base_vertex;
+				m_index_offset = entry.index_offset;
+				m_reuse_pending = true;
+				m_reuse_v_offset = static_cast<u32>(entry.base_vertex * stride);
+				m_reuse_v_size = vertex_data_size;
+				m_reuse_i_offset = static_cast<u32>(entry.index_offset);
+				m_reuse_i_size = index_data_size;
+				ADDSTAT(stats.thisFrame.bytesVertexDeduplicated, vertex_data_size);
+				ADDSTAT(stats.thisFrame.bytesIndexDeduplicated, index_data_size);
+				return;
+			}
+			// The ring lapped past the old copy (or the hash collided on
+			// differing metadata): upload again and refresh the entry.
+			m_upload_cache.erase(iter);
+		}
+
+		m_baseVertex = m_vertexBuffer->Stream(vertex_data_size, stride, m_cpu_v_buffer.data()) / stride;
+		m_index_offset = m_indexBuffer->Stream(index_data_size, m_cpu_i_buffer.data());
+		ADDSTAT(stats.thisFrame.bytesVertexStreamed, vertex_data_size);
+		ADDSTAT(stats.thisFrame.bytesIndexStreamed, index_data_size);
+
+		// Laps are read after streaming so a wrap during the upload stamps the
+		// entry with the lap its data actually lives in.
+		if (m_upload_cache.size() >= UPLOAD_CACHE_MAX_ENTRIES)
+			m_upload_cache.clear();
+		UploadCacheEntry entry;
+		entry.base_vertex = m_baseVertex;
+		entry.index_offset = m_index_offset;
+		entry.vertex_size = vertex_data_size;
+		entry.index_size = index_data_size;
+		entry.stride = stride;
+		entry.v_lap = m_vertexBuffer->GetLap();
+		entry.i_lap = m_indexBuffer->GetLap();
+		m_upload_cache.emplace(hash, entry);
+		return;
+	}
+
 	m_baseVertex = m_vertexBuffer->Stream(vertex_data_size, stride, m_cpu_v_buffer.data()) / stride;
 	m_index_offset = m_indexBuffer->Stream(index_data_size, m_cpu_i_buffer.data());
 	ADDSTAT(stats.thisFrame.bytesVertexStreamed, vertex_data_size);
@@ -93,13 +161,23 @@ void VertexManager::Draw(u32 stride)
 		glDisable(GL_CULL_FACE);
 	}
 
+	// On the instanced stereoscopy path triangles carry no geometry shader, so
+	// they are drawn once per eye with the vertex shader picking the layer.
+	const bool stereo_instances = primitive_mode == GL_TRIANGLES &&
+		g_ActiveConfig.UseVertexShaderLayerStereo();
 	if (g_ogl_config.bSupportsGLBaseVertex)
 	{
-		glDrawRangeElementsBaseVertex(primitive_mode, 0, max_index, index_size, GL_UNSIGNED_SHORT, (u8*)nullptr + m_index_offset, (GLint)m_baseVertex);
+		if (stereo_instances)
+			glDrawElementsInstancedBaseVertex(primitive_mode, index_size, GL_UNSIGNED_SHORT, (u8*)nullptr + m_index_offset, 2, (GLint)m_baseVertex);
+		else
+			glDrawRangeElementsBaseVertex(primitive_mode, 0, max_index, index_size, GL_UNSIGNED_SHORT, (u8*)nullptr + m_index_offset, (GLint)m_baseVertex);
 	}
 	else
 	{
-		glDrawRangeElements(primitive_mode, 0, max_index, index_size, GL_UNSIGNED_SHORT, (u8*)nullptr + m_index_offset);
+		if (stereo_instances)
+			glDrawElementsInstanced(primitive_mode, index_size, GL_UNSIGNED_SHORT, (u8*)nullptr + m_index_offset, 2);
+		else
+			glDrawRangeElements(primitive_mode, 0, max_index, index_size, GL_UNSIGNED_SHORT, (u8*)nullptr + m_index_offset);
 	}
 
 	INCSTAT(stats.thisFrame.numDrawCalls);
@@ -197,6 +275,15 @@ void VertexManager::vFlush(bool useDstAlpha)
 		if (logic_op_enabled)
 			glEnable(GL_COLOR_LOGIC_OP);
 	}
+	if (m_reuse_pending)
+	{
+		// The wrap-around overwrite of the reused ranges must now wait for the
+		// draws above, not just for the draws pending when the data was first
+		// streamed.
+		m_vertexBuffer->ReuseRange(m_reuse_v_offset, m_reuse_v_size);
+		m_indexBuffer->ReuseRange(m_reuse_i_offset, m_reuse_i_size);
+		m_reuse_pending = false;
+	}
 	g_Config.iSaveTargetId++;
 
 	ClearEFBCache();
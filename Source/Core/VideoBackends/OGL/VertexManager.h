@@ -3,6 +3,8 @@
 // Refer to the license.txt file included.
 
 #pragma once
+#include <unordered_map>
+
 #include "Common/MemoryUtil.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/VertexManagerBase.h"
@@ -46,6 +48,21 @@ private:
 	void vFlush(bool useDstAlpha) override;
 	void PrepareDrawBuffers(u32 stride);
 
+	// Dedup cache: hash of a vertex+index span -> where it already lives in the
+	// stream buffers. Games which resubmit identical geometry every frame
+	// (menus, HUDs, static stage meshes) then draw from the cached range
+	// instead of re-uploading. Entries die when the ring laps past them.
+	struct UploadCacheEntry
+	{
+		size_t base_vertex;
+		size_t index_offset;
+		u32 vertex_size;
+		u32 index_size;
+		u32 stride;
+		u32 v_lap;
+		u32 i_lap;
+	};
+
 	// Alternative buffers in CPU memory for primatives we are going to discard.
 	std::vector<u8, Common::aligned_allocator<u8, 16>> m_cpu_v_buffer;
 	std::vector<u16, Common::aligned_allocator<u16, 16>> m_cpu_i_buffer;
@@ -54,5 +71,14 @@ private:
 	size_t m_baseVertex;
 	size_t m_index_offset;
 	u16* m_index_buffer_base;
+	std::unordered_map<u64, UploadCacheEntry> m_upload_cache;
+	bool m_dedup_supported = false;
+	// Set when the current flush draws from a cached range; vFlush re-arms the
+	// stream buffer fences for it after the draws have been issued.
+	bool m_reuse_pending = false;
+	u32 m_reuse_v_offset = 0;
+	u32 m_reuse_v_size = 0;
+	u32 m_reuse_i_offset = 0;
+	u32 m_reuse_i_size = 0;
 };
 }
@@ -3,9 +3,13 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <memory>
 
 #include "Common/CommonTypes.h"
+#include "Common/CPUDetect.h"
+#include "Common/ThreadPool.h"
 #include "VideoBackends/Software/EfbInterface.h"
 #include "VideoBackends/Software/NativeVertexFormat.h"
 #include "VideoBackends/Software/Rasterizer.h"
@@ -97,7 +101,7 @@ void SetTevReg(int reg, int comp, bool konst, s16 color)
 	tev.SetRegColor(reg, comp, konst, color);
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+static void Draw(Tev& t, const RasterBlock& block, s32 x, s32 y, s32 xi, s32 yi)
 {
 	INCSTAT(stats.thisFrame.rasterizedPixels);
 
@@ -119,11 +123,11 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
 		EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
 	}
 
-	RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+	const RasterBlockPixel& pixel = block.Pixel[xi][yi];
 
-	tev.Position[0] = x;
-	tev.Position[1] = y;
-	tev.Position[2] = z;
+	t.Position[0] = x;
+	t.Position[1] = y;
+	t.Position[2] = z;
 
 	//  colors
 	for (unsigned int i = 0; i < bpmem.genMode.numcolchans.Value(); i++)
@@ -135,7 +139,7 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
 			// clamp color value to 0
 			u16 mask = ~(color >> 8);
 
-			tev.Color[i][comp] = color & mask;
+			t.Color[i][comp] = color & mask;
 		}
 	}
 
@@ -143,23 +147,23 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
 	for (unsigned int i = 0; i < bpmem.genMode.numtexgens.Value(); i++)
 	{
 		// multiply by 128 because TEV stores UVs as s17.7
-		tev.Uv[i].s = (s32)(pixel.Uv[i][0] * 128);
-		tev.Uv[i].t = (s32)(pixel.Uv[i][1] * 128);
+		t.Uv[i].s = (s32)(pixel.Uv[i][0] * 128);
+		t.Uv[i].t = (s32)(pixel.Uv[i][1] * 128);
 	}
 
 	for (unsigned int i = 0; i < bpmem.genMode.numindstages.Value(); i++)
 	{
-		tev.IndirectLod[i] = rasterBlock.IndirectLod[i];
-		tev.IndirectLinear[i] = rasterBlock.IndirectLinear[i];
+		t.IndirectLod[i] = block.IndirectLod[i];
+		t.IndirectLinear[i] = block.IndirectLinear[i];
 	}
 
 	for (unsigned int i = 0; i <= bpmem.genMode.numtevstages.Value(); i++)
 	{
-		tev.TextureLod[i] = rasterBlock.TextureLod[i];
-		tev.TextureLinear[i] = rasterBlock.TextureLinear[i];
+		t.TextureLod[i] = block.TextureLod[i];
+		t.TextureLinear[i] = block.TextureLinear[i];
 	}
 
-	tev.Draw();
+	t.Draw();
 }
 
 static void InitTriangle(float X1, float Y1, s32 xi, s32 yi)
@@ -186,7 +190,7 @@ static void InitSlope(Slope *slope, float f1, float f2, float f3, float DX31, fl
 	slope->f0 = f1;
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(const RasterBlock& block, s32* lodp, bool* linear, u32 texmap, u32 texcoord)
 {
 	const FourTexUnits& texUnit = bpmem.tex[(texmap >> 2) & 1];
 	const u8 subTexmap = texmap & 3;
@@ -199,17 +203,17 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 	float sDelta, tDelta;
 	if (tm0.diag_lod)
 	{
-		float *uv0 = rasterBlock.Pixel[0][0].Uv[texcoord];
-		float *uv1 = rasterBlock.Pixel[1][1].Uv[texcoord];
+		const float *uv0 = block.Pixel[0][0].Uv[texcoord];
+		const float *uv1 = block.Pixel[1][1].Uv[texcoord];
 
 		sDelta = fabsf(uv0[0] - uv1[0]);
 		tDelta = fabsf(uv0[1] - uv1[1]);
 	}
 	else
 	{
-		float *uv0 = rasterBlock.Pixel[0][0].Uv[texcoord];
-		float *uv1 = rasterBlock.Pixel[1][0].Uv[texcoord];
-		float *uv2 = rasterBlock.Pixel[0][1].Uv[texcoord];
+		const float *uv0 = block.Pixel[0][0].Uv[texcoord];
+		const float *uv1 = block.Pixel[1][0].Uv[texcoord];
+		const float *uv2 = block.Pixel[0][1].Uv[texcoord];
 
 		sDelta = std::max(fabsf(uv0[0] - uv1[0]), fabsf(uv0[0] - uv2[0]));
 		tDelta = std::max(fabsf(uv0[1] - uv1[1]), fabsf(uv0[1] - uv2[1]));
@@ -234,13 +238,13 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 	*lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(RasterBlock& block, s32 blockX, s32 blockY)
 {
 	for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
 	{
 		for (s32 xi = 0; xi < BLOCK_SIZE; xi++)
 		{
-			RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+			RasterBlockPixel& pixel = block.Pixel[xi][yi];
 
 			float dx = vertexOffsetX + (float)(xi + blockX - vertex0X);
 			float dy = vertexOffsetY + (float)(yi + blockY - vertex0Y);
@@ -273,7 +277,7 @@ static void BuildBlock(s32 blockX, s32 blockY)
 		u32 texcoord = indref & 3;
 		indref >>= 3;
 
-		CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+		CalculateLOD(block, &block.IndirectLod[i], &block.IndirectLinear[i], texmap, texcoord);
 	}
 
 	for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -285,7 +289,7 @@ static void BuildBlock(s32 blockX, s32 blockY)
 			u32 texmap = order.getTexMap(stageOdd);
 			u32 texcoord = order.getTexCoord(stageOdd);
 
-			CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+			CalculateLOD(block, &block.TextureLod[i], &block.TextureLinear[i], texmap, texcoord);
 		}
 	}
 }
@@ -302,10 +306,163 @@ static inline void PrepareBlock(s32 blockX, s32 blockY)
 	{
 		x = blockX;
 		y = blockY;
-		BuildBlock(x, y);
+		BuildBlock(rasterBlock, x, y);
 	}
 }
 
+// Per-triangle rasterization constants, gathered into a struct (rather than
+// more file statics) so that strips of the same triangle can be rasterized
+// concurrently.
+struct TriangleConsts
+{
+	s32 minx, maxx;
+	s32 C1, C2, C3;
+	s32 DX12, DX23, DX31;
+	s32 DY12, DY23, DY31;
+	s32 FDX12, FDX23, FDX31;
+	s32 FDY12, FDY23, FDY31;
+};
+
+// Rasterizes the block rows covering [miny, maxy). The Tev and RasterBlock
+// to draw with are passed in so that concurrent strips of the same triangle
+// do not share mutable per-pixel state.
+static void RasterizeRows(const TriangleConsts& tri, s32 miny, s32 maxy, Tev& t, RasterBlock& block)
+{
+	// Loop through blocks
+	for (s32 y = miny; y < maxy; y += BLOCK_SIZE)
+	{
+		for (s32 x = tri.minx; x < tri.maxx; x += BLOCK_SIZE)
+		{
+			// Corners of block
+			s32 x0 = x << 4;
+			s32 x1 = (x + BLOCK_SIZE - 1) << 4;
+			s32 y0 = y << 4;
+			s32 y1 = (y + BLOCK_SIZE - 1) << 4;
+
+			// Evaluate half-space functions
+			bool a00 = tri.C1 + tri.DX12 * y0 - tri.DY12 * x0 > 0;
+			bool a10 = tri.C1 + tri.DX12 * y0 - tri.DY12 * x1 > 0;
+			bool a01 = tri.C1 + tri.DX12 * y1 - tri.DY12 * x0 > 0;
+			bool a11 = tri.C1 + tri.DX12 * y1 - tri.DY12 * x1 > 0;
+			int a = (a00 << 0) | (a10 << 1) | (a01 << 2) | (a11 << 3);
+
+			bool b00 = tri.C2 + tri.DX23 * y0 - tri.DY23 * x0 > 0;
+			bool b10 = tri.C2 + tri.DX23 * y0 - tri.DY23 * x1 > 0;
+			bool b01 = tri.C2 + tri.DX23 * y1 - tri.DY23 * x0 > 0;
+			bool b11 = tri.C2 + tri.DX23 * y1 - tri.DY23 * x1 > 0;
+			int b = (b00 << 0) | (b10 << 1) | (b01 << 2) | (b11 << 3);
+
+			bool c00 = tri.C3 + tri.DX31 * y0 - tri.DY31 * x0 > 0;
+			bool c10 = tri.C3 + tri.DX31 * y0 - tri.DY31 * x1 > 0;
+			bool c01 = tri.C3 + tri.DX31 * y1 - tri.DY31 * x0 > 0;
+			bool c11 = tri.C3 + tri.DX31 * y1 - tri.DY31 * x1 > 0;
+			int c = (c00 << 0) | (c10 << 1) | (c01 << 2) | (c11 << 3);
+
+			// Skip block when outside an edge
+			if (a == 0x0 || b == 0x0 || c == 0x0)
+				continue;
+
+			BuildBlock(block, x, y);
+
+			// Accept whole block when totally covered
+			if (a == 0xF && b == 0xF && c == 0xF)
+			{
+				for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
+				{
+					for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
+					{
+						Draw(t, block, x + ix, y + iy, ix, iy);
+					}
+				}
+			}
+			else // Partially covered block
+			{
+				s32 CY1 = tri.C1 + tri.DX12 * y0 - tri.DY12 * x0;
+				s32 CY2 = tri.C2 + tri.DX23 * y0 - tri.DY23 * x0;
+				s32 CY3 = tri.C3 + tri.DX31 * y0 - tri.DY31 * x0;
+
+				for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
+				{
+					s32 CX1 = CY1;
+					s32 CX2 = CY2;
+					s32 CX3 = CY3;
+
+					for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
+					{
+						if (CX1 > 0 && CX2 > 0 && CX3 > 0)
+						{
+							Draw(t, block, x + ix, y + iy, ix, iy);
+						}
+
+						CX1 -= tri.FDY12;
+						CX2 -= tri.FDY23;
+						CX3 -= tri.FDY31;
+					}
+
+					CY1 += tri.FDX12;
+					CY2 += tri.FDX23;
+					CY3 += tri.FDX31;
+				}
+			}
+		}
+	}
+}
+
+// Rasterizes a triangle as strips of whole block rows claimed off a shared
+// counter by the thread pool. Strips cover disjoint pixels, so the EFB
+// accesses of different workers never conflict; every worker draws through
+// its own Tev and RasterBlock copy. Triangles still retire in submission
+// order because we do not return until the whole triangle has been drawn.
+static void RasterizeTriangleParallel(const TriangleConsts& tri, s32 miny, s32 maxy)
+{
+	struct StripState
+	{
+		std::atomic<u32> next_strip{ 0 };
+		std::atomic<u32> done_strips{ 0 };
+	};
+	const s32 height = maxy - miny;
+	s32 strip_height = std::max(height / cpu_info.num_cores, 8);
+	strip_height = (strip_height + (BLOCK_SIZE - 1)) & ~(BLOCK_SIZE - 1);
+	const u32 num_strips = (height + strip_height - 1) / strip_height;
+	std::shared_ptr<StripState> state = std::make_shared<StripState>();
+	auto rasterize_strips = [=]()
+	{
+		// A plain copy leaves the Tev input LUTs pointing into the global
+		// object; Init() rebuilds them against the copy without touching
+		// the copied register and konstant colors.
+		Tev strip_tev = tev;
+		strip_tev.Init();
+		RasterBlock strip_block = {};
+		u32 strip;
+		while ((strip = state->next_strip.fetch_add(1)) < num_strips)
+		{
+			const s32 top = miny + strip * strip_height;
+			RasterizeRows(tri, top, std::min(top + strip_height, maxy), strip_tev, strip_block);
+			state->done_strips.fetch_add(1);
+		}
+	};
+	for (u32 i = 1; i < num_strips; i++)
+	{
+		Common::AsyncWorker::ExecuteAsync(std::function<void()>(rasterize_strips));
+	}
+	rasterize_strips();
+	// The slope and vertex statics must stay valid until every claimed strip
+	// has drawn; tasks that find the counter drained exit without drawing,
+	// so waiting on the strips actually rasterized is enough.
+	u32 loopcount = 0;
+	while (state->done_strips.load() < num_strips)
+	{
+		Common::cYield(loopcount++);
+	}
+}
+
+// Splitting a triangle across the pool only pays off once it covers enough
+// pixels to amortize the per-worker Tev copy and the task hand-off.
+static bool UseParallelRasterization(s32 minx, s32 maxx, s32 miny, s32 maxy)
+{
+	return (maxx - minx) * (maxy - miny) >= 4096 && cpu_info.num_cores > 2;
+}
+
 void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVertexData *v2)
 {
 	INCSTAT(stats.thisFrame.numTrianglesDrawn);
@@ -402,84 +559,15 @@ void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVer
 		// Start in corner of 8x8 block
 		minx &= ~(BLOCK_SIZE - 1);
 		miny &= ~(BLOCK_SIZE - 1);
-		// Loop through blocks
-		for (s32 y = miny; y < maxy; y += BLOCK_SIZE)
-		{
-			for (s32 x = minx; x < maxx; x += BLOCK_SIZE)
-			{
-				// Corners of block
-				s32 x0 = x << 4;
-				s32 x1 = (x + BLOCK_SIZE - 1) << 4;
-				s32 y0 = y << 4;
-				s32 y1 = (y + BLOCK_SIZE - 1) << 4;
-
-				// Evaluate half-space functions
-				bool a00 = C1 + DX12 * y0 - DY12 * x0 > 0;
-				bool a10 = C1 + DX12 * y0 - DY12 * x1 > 0;
-				bool a01 = C1 + DX12 * y1 - DY12 * x0 > 0;
-				bool a11 = C1 + DX12 * y1 - DY12 * x1 > 0;
-				int a = (a00 << 0) | (a10 << 1) | (a01 << 2) | (a11 << 3);
-
-				bool b00 = C2 + DX23 * y0 - DY23 * x0 > 0;
-				bool b10 = C2 + DX23 * y0 - DY23 * x1 > 0;
-				bool b01 = C2 + DX23 * y1 - DY23 * x0 > 0;
-				bool b11 = C2 + DX23 * y1 - DY23 * x1 > 0;
-				int b = (b00 << 0) | (b10 << 1) | (b01 << 2) | (b11 << 3);
-
-				bool c00 = C3 + DX31 * y0 - DY31 * x0 > 0;
-				bool c10 = C3 + DX31 * y0 - DY31 * x1 > 0;
-				bool c01 = C3 + DX31 * y1 - DY31 * x0 > 0;
-				bool c11 = C3 + DX31 * y1 - DY31 * x1 > 0;
-				int c = (c00 << 0) | (c10 << 1) | (c01 << 2) | (c11 << 3);
-
-				// Skip block when outside an edge
-				if (a == 0x0 || b == 0x0 || c == 0x0)
-					continue;
-
-				BuildBlock(x, y);
-
-				// Accept whole block when totally covered
-				if (a == 0xF && b == 0xF && c == 0xF)
-				{
-					for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
-					{
-						for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
-						{
-							Draw(x + ix, y + iy, ix, iy);
-						}
-					}
-				}
-				else // Partially covered block
-				{
-					s32 CY1 = C1 + DX12 * y0 - DY12 * x0;
-					s32 CY2 = C2 + DX23 * y0 - DY23 * x0;
-					s32 CY3 = C3 + DX31 * y0 - DY31 * x0;
-
-					for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
-					{
-						s32 CX1 = CY1;
-						s32 CX2 = CY2;
-						s32 CX3 = CY3;
 
-						for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
-						{
-							if (CX1 > 0 && CX2 > 0 && CX3 > 0)
-							{
-								Draw(x + ix, y + iy, ix, iy);
-							}
-
-							CX1 -= FDY12;
-							CX2 -= FDY23;
-							CX3 -= FDY31;
-						}
+		const TriangleConsts tri = { minx, maxx, C1, C2, C3,
+			DX12, DX23, DX31, DY12, DY23, DY31,
+			FDX12, FDX23, FDX31, FDY12, FDY23, FDY31 };
 
-						CY1 += FDX12;
-						CY2 += FDX23;
-						CY3 += FDX31;
-					}
-				}
-			}
-		}
+		if (UseParallelRasterization(minx, maxx, miny, maxy))
+			RasterizeTriangleParallel(tri, miny, maxy);
+		else
+			RasterizeRows(tri, miny, maxy, tev, rasterBlock);
 	}
 	else
 	{
@@ -533,7 +621,7 @@ void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVer
 				{
 					// Build the new raster block every other pixel
 					PrepareBlock(x, y);
-					Draw(x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
+					Draw(tev, rasterBlock, x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
 
 					if (y >= BoundingBox::coords[BoundingBox::TOP])
 						break;
@@ -573,7 +661,7 @@ void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVer
 				if (CY1 > 0 && CY2 > 0 && CY3 > 0)
 				{
 					PrepareBlock(x, y);
-					Draw(x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
+					Draw(tev, rasterBlock, x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
 
 					if (x >= BoundingBox::coords[BoundingBox::LEFT])
 						break;
@@ -613,7 +701,7 @@ void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVer
 				{
 					// Build the new raster block every other pixel
 					PrepareBlock(x, y);
-					Draw(x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
+					Draw(tev, rasterBlock, x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
 
 					if (y <= BoundingBox::coords[BoundingBox::BOTTOM])
 						break;
@@ -654,7 +742,7 @@ void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVer
 				{
 					// Build the new raster block every other pixel
 					PrepareBlock(x, y);
-					Draw(x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
+					Draw(tev, rasterBlock, x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
 
 					if (x <= BoundingBox::coords[BoundingBox::RIGHT])
 						break;
@@ -188,16 +188,20 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8 *sample)
 
 		if (!(ti0.format == GX_TF_RGBA8 && texUnit.texImage1[subTexmap].image_type))
 		{
-			TexDecoder_DecodeTexel(sampledTex, imageSrc, imageS, imageT, imageWidth, ti0.format, tlut, tlutfmt);
+			// Resolve the decoder for this (format, TLUT format) pair once
+			// instead of re-dispatching inside all four texel decodes.
+			TexelDecoderFn decodeTexel = TexDecoder_GetTexelDecoder(ti0.format, tlutfmt);
+
+			decodeTexel(sampledTex, imageSrc, imageS, imageT, imageWidth, tlut);
 			SetTexel(sampledTex, texel, (128 - fractS) * (128 - fractT));
 
-			TexDecoder_DecodeTexel(sampledTex, imageSrc, imageSPlus1, imageT, imageWidth, ti0.format, tlut, tlutfmt);
+			decodeTexel(sampledTex, imageSrc, imageSPlus1, imageT, imageWidth, tlut);
 			AddTexel(sampledTex, texel, (fractS) * (128 - fractT));
 
-			TexDecoder_DecodeTexel(sampledTex, imageSrc, imageS, imageTPlus1, imageWidth, ti0.format, tlut, tlutfmt);
+			decodeTexel(sampledTex, imageSrc, imageS, imageTPlus1, imageWidth, tlut);
 			AddTexel(sampledTex, texel, (128 - fractS) * (fractT));
 
-			TexDecoder_DecodeTexel(sampledTex, imageSrc, imageSPlus1, imageTPlus1, imageWidth, ti0.format, tlut, tlutfmt);
+			decodeTexel(sampledTex, imageSrc, imageSPlus1, imageTPlus1, imageWidth, tlut);
 			AddTexel(sampledTex, texel, (fractS) * (fractT));
 		}
 		else
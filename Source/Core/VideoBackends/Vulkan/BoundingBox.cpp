@@ -2,6 +2,7 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <functional>
 #include <vector>
 
 #include "Common/Assert.h"
@@ -16,6 +17,8 @@
 #include "VideoBackends/Vulkan/Util.h"
 #include "VideoBackends/Vulkan/VulkanContext.h"
 
+#include "VideoCommon/VideoConfig.h"
+
 namespace Vulkan
 {
 BoundingBox::BoundingBox()
@@ -26,6 +29,7 @@ BoundingBox::~BoundingBox()
 {
 	if (m_gpu_buffer != VK_NULL_HANDLE)
 	{
+		g_command_buffer_mgr->RemoveFencePointCallback(this);
 		vkDestroyBuffer(g_vulkan_context->GetDevice(), m_gpu_buffer, nullptr);
 		vkFreeMemory(g_vulkan_context->GetDevice(), m_gpu_memory, nullptr);
 	}
@@ -45,6 +49,11 @@ bool BoundingBox::Initialize()
 	if (!CreateReadbackBuffer())
 		return false;
 
+	g_command_buffer_mgr->AddFencePointCallback(
+		this, std::bind(&BoundingBox::OnCommandBufferQueued, this, std::placeholders::_1,
+			std::placeholders::_2),
+		std::bind(&BoundingBox::OnCommandBufferExecuted, this, std::placeholders::_1));
+
 	return true;
 }
 
@@ -117,6 +126,17 @@ s32 BoundingBox::Get(size_t index)
 {
 	_assert_(index < NUM_VALUES);
 
+	// Serve from the last completed per-frame readback when fast access is
+	// enabled. Values the game has written since then are still held in the
+	// dirty cache, so only clean values can be answered this way.
+	if (g_ActiveConfig.bEFBFastAccess && m_ready_async_buffer >= 0 && !m_values_dirty[index])
+	{
+		s32 value;
+		m_async_buffers[m_ready_async_buffer].buffer->Read(index * sizeof(s32), &value, sizeof(value),
+			false);
+		return value;
+	}
+
 	if (!m_valid)
 		Readback();
 
@@ -210,10 +230,30 @@ bool BoundingBox::CreateReadbackBuffer()
 	if (!m_readback_buffer || !m_readback_buffer->Map())
 		return false;
 
+	for (AsyncReadbackBuffer& entry : m_async_buffers)
+	{
+		entry.buffer = StagingBuffer::Create(STAGING_BUFFER_TYPE_READBACK, BUFFER_SIZE,
+			VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+		if (!entry.buffer || !entry.buffer->Map())
+			return false;
+	}
+
 	return true;
 }
 
 void BoundingBox::Readback()
+{
+	CopyToStagingBuffer(m_readback_buffer.get());
+
+	// Wait until these commands complete.
+	Util::ExecuteCurrentCommandsAndRestoreState(false, true);
+
+	// Cache is now valid.
+	m_readback_buffer->InvalidateCPUCache();
+	m_valid = true;
+}
+
+void BoundingBox::CopyToStagingBuffer(StagingBuffer* dst)
 {
 	// Can't be done within a render pass.
 	StateTracker::GetInstance()->EndRenderPass();
@@ -223,29 +263,70 @@ void BoundingBox::Readback()
 		g_command_buffer_mgr->GetCurrentCommandBuffer(), m_gpu_buffer,
 		VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, 0,
 		BUFFER_SIZE, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-	m_readback_buffer->PrepareForGPUWrite(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+	dst->PrepareForGPUWrite(g_command_buffer_mgr->GetCurrentCommandBuffer(),
 		VK_ACCESS_TRANSFER_WRITE_BIT,
 		VK_PIPELINE_STAGE_TRANSFER_BIT);
 
 	// Copy from GPU -> readback buffer.
 	VkBufferCopy region = { 0, 0, BUFFER_SIZE };
-	vkCmdCopyBuffer(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_gpu_buffer,
-		m_readback_buffer->GetBuffer(), 1, &region);
+	vkCmdCopyBuffer(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_gpu_buffer, dst->GetBuffer(),
+		1, &region);
 
 	// Restore GPU buffer access.
 	Util::BufferMemoryBarrier(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_gpu_buffer,
 		VK_ACCESS_TRANSFER_READ_BIT,
 		VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, 0, BUFFER_SIZE,
 		VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
-	m_readback_buffer->FlushGPUCache(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+	dst->FlushGPUCache(g_command_buffer_mgr->GetCurrentCommandBuffer(),
 		VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+}
 
-	// Wait until these commands complete.
-	Util::ExecuteCurrentCommandsAndRestoreState(false, true);
+void BoundingBox::QueueAsyncReadback()
+{
+	if (m_gpu_buffer == VK_NULL_HANDLE)
+		return;
 
-	// Cache is now valid.
-	m_readback_buffer->InvalidateCPUCache();
-	m_valid = true;
+	AsyncReadbackBuffer& entry = m_async_buffers[m_current_async_buffer];
+	if (entry.pending)
+	{
+		// Every buffer in the ring is still in flight on the GPU. Skip this
+		// frame rather than stalling, the last completed buffer stays current.
+		return;
+	}
+
+	CopyToStagingBuffer(entry.buffer.get());
+
+	// The fence is assigned in OnCommandBufferQueued once it is known.
+	entry.pending = true;
+	entry.pending_fence = VK_NULL_HANDLE;
+	m_current_async_buffer = (m_current_async_buffer + 1) % NUM_ASYNC_READBACK_BUFFERS;
+}
+
+void BoundingBox::OnCommandBufferQueued(VkCommandBuffer command_buffer, VkFence fence)
+{
+	// Associate queued readbacks with the fence of the command buffer carrying them.
+	for (AsyncReadbackBuffer& entry : m_async_buffers)
+	{
+		if (entry.pending && entry.pending_fence == VK_NULL_HANDLE)
+			entry.pending_fence = fence;
+	}
+}
+
+void BoundingBox::OnCommandBufferExecuted(VkFence fence)
+{
+	for (size_t i = 0; i < NUM_ASYNC_READBACK_BUFFERS; i++)
+	{
+		AsyncReadbackBuffer& entry = m_async_buffers[i];
+		if (!entry.pending || entry.pending_fence != fence)
+			continue;
+
+		entry.pending = false;
+		entry.pending_fence = VK_NULL_HANDLE;
+		entry.buffer->InvalidateCPUCache();
+
+		// This is now the most recent completed copy of the bounding box.
+		m_ready_async_buffer = static_cast<int>(i);
+	}
 }
 
 }  // namespace Vulkan
@@ -33,10 +33,18 @@ public:
 	void Invalidate();
 	void Flush();
 
+	// Queues a copy of the current bounding box values to one of a ring of
+	// host-visible buffers, so that Get() can return last-completed-frame
+	// values without syncing with the GPU when EFB fast access is enabled.
+	void QueueAsyncReadback();
+
 private:
 	bool CreateGPUBuffer();
 	bool CreateReadbackBuffer();
 	void Readback();
+	void CopyToStagingBuffer(StagingBuffer* dst);
+	void OnCommandBufferQueued(VkCommandBuffer command_buffer, VkFence fence);
+	void OnCommandBufferExecuted(VkFence fence);
 
 	VkBuffer m_gpu_buffer = VK_NULL_HANDLE;
 	VkDeviceMemory m_gpu_memory = VK_NULL_HANDLE;
@@ -47,6 +55,18 @@ private:
 	std::unique_ptr<StagingBuffer> m_readback_buffer;
 	std::array<bool, NUM_VALUES> m_values_dirty = {};
 	bool m_valid = true;
+
+	// Asynchronous readback ring, see QueueAsyncReadback().
+	static const size_t NUM_ASYNC_READBACK_BUFFERS = 3;
+	struct AsyncReadbackBuffer
+	{
+		std::unique_ptr<StagingBuffer> buffer;
+		VkFence pending_fence = VK_NULL_HANDLE;
+		bool pending = false;
+	};
+	std::array<AsyncReadbackBuffer, NUM_ASYNC_READBACK_BUFFERS> m_async_buffers;
+	size_t m_current_async_buffer = 0;
+	int m_ready_async_buffer = -1;
 };
 
 }  // namespace Vulkan
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 
 #include "Common/CommonFuncs.h"
 #include "Common/Logging/Log.h"
@@ -43,6 +44,7 @@ FramebufferManager::~FramebufferManager()
 
 	DestroyConversionShaders();
 
+	DestroyAsyncPeekBuffers();
 	DestroyReadbackFramebuffer();
 	DestroyReadbackTextures();
 	DestroyReadbackShaders();
@@ -96,6 +98,11 @@ bool FramebufferManager::Initialize()
 		PanicAlert("Failed to create readback framebuffer");
 		return false;
 	}
+	if (!CreateAsyncPeekBuffers())
+	{
+		PanicAlert("Failed to create asynchronous EFB readback buffers");
+		return false;
+	}
 
 	CreatePokeVertexFormat();
 	if (!CreatePokeVertexBuffer())
@@ -667,6 +674,17 @@ void FramebufferManager::DestroyConversionShaders()
 
 u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
 {
+	// Serve the peek from the last completed asynchronous readback when fast
+	// access is enabled. The value is at most a frame stale, which is the
+	// accuracy the user traded away for not syncing with the GPU here.
+	if (g_ActiveConfig.bEFBFastAccess && m_ready_async_peek_buffer >= 0)
+	{
+		u32 value;
+		m_async_peek_buffers[m_ready_async_peek_buffer].color_texture->ReadTexel(x, y, &value,
+			sizeof(value));
+		return value;
+	}
+
 	if (!m_color_readback_texture_valid && !PopulateColorReadbackTexture())
 		return 0;
 
@@ -676,10 +694,28 @@ u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
 }
 
 bool FramebufferManager::PopulateColorReadbackTexture()
+{
+	// A CPU-side peek this frame likely means more will follow, execute the
+	// command buffer early next frame to shorten the next wait.
+	StateTracker::GetInstance()->OnReadback();
+
+	CopyColorToReadbackTexture(m_color_readback_texture.get());
+
+	// Wait until the copy is complete.
+	Util::ExecuteCurrentCommandsAndRestoreState(false, true);
+
+	// Map to host memory.
+	if (!m_color_readback_texture->IsMapped() && !m_color_readback_texture->Map())
+		return false;
+
+	m_color_readback_texture_valid = true;
+	return true;
+}
+
+void FramebufferManager::CopyColorToReadbackTexture(StagingTexture2D* dst)
 {
 	// Can't be in our normal render pass.
 	StateTracker::GetInstance()->EndRenderPass();
-	StateTracker::GetInstance()->OnReadback();
 
 	// Issue a copy from framebuffer -> copy texture if we have >1xIR or MSAA on.
 	VkRect2D src_region = { { 0, 0 },{ m_efb_width, m_efb_height } };
@@ -723,7 +759,7 @@ bool FramebufferManager::PopulateColorReadbackTexture()
 	// Copy from EFB or copy texture to staging texture.
 	src_texture->TransitionToLayout(g_command_buffer_mgr->GetCurrentCommandBuffer(),
 		VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
-	m_color_readback_texture->CopyFromImage(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+	dst->CopyFromImage(g_command_buffer_mgr->GetCurrentCommandBuffer(),
 		src_texture->GetImage(), src_aspect, 0, 0, EFB_WIDTH,
 		EFB_HEIGHT, 0, 0);
 
@@ -733,20 +769,19 @@ bool FramebufferManager::PopulateColorReadbackTexture()
 		src_texture->TransitionToLayout(g_command_buffer_mgr->GetCurrentCommandBuffer(),
 			VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
 	}
-
-	// Wait until the copy is complete.
-	Util::ExecuteCurrentCommandsAndRestoreState(false, true);
-
-	// Map to host memory.
-	if (!m_color_readback_texture->IsMapped() && !m_color_readback_texture->Map())
-		return false;
-
-	m_color_readback_texture_valid = true;
-	return true;
 }
 
 float FramebufferManager::PeekEFBDepth(u32 x, u32 y)
 {
+	// See PeekEFBColor() for why stale values are acceptable here.
+	if (g_ActiveConfig.bEFBFastAccess && m_ready_async_peek_buffer >= 0)
+	{
+		float value;
+		m_async_peek_buffers[m_ready_async_peek_buffer].depth_texture->ReadTexel(x, y, &value,
+			sizeof(value));
+		return value;
+	}
+
 	if (!m_depth_readback_texture_valid && !PopulateDepthReadbackTexture())
 		return 0.0f;
 
@@ -756,10 +791,28 @@ float FramebufferManager::PeekEFBDepth(u32 x, u32 y)
 }
 
 bool FramebufferManager::PopulateDepthReadbackTexture()
+{
+	// A CPU-side peek this frame likely means more will follow, execute the
+	// command buffer early next frame to shorten the next wait.
+	StateTracker::GetInstance()->OnReadback();
+
+	CopyDepthToReadbackTexture(m_depth_readback_texture.get());
+
+	// Wait until the copy is complete.
+	Util::ExecuteCurrentCommandsAndRestoreState(false, true);
+
+	// Map to host memory.
+	if (!m_depth_readback_texture->IsMapped() && !m_depth_readback_texture->Map())
+		return false;
+
+	m_depth_readback_texture_valid = true;
+	return true;
+}
+
+void FramebufferManager::CopyDepthToReadbackTexture(StagingTexture2D* dst)
 {
 	// Can't be in our normal render pass.
 	StateTracker::GetInstance()->EndRenderPass();
-	StateTracker::GetInstance()->OnReadback();
 
 	// Issue a copy from framebuffer -> copy texture if we have >1xIR or MSAA on.
 	VkRect2D src_region = { { 0, 0 },{ m_efb_width, m_efb_height } };
@@ -807,7 +860,7 @@ bool FramebufferManager::PopulateDepthReadbackTexture()
 	// Copy from EFB or copy texture to staging texture.
 	src_texture->TransitionToLayout(g_command_buffer_mgr->GetCurrentCommandBuffer(),
 		VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
-	m_depth_readback_texture->CopyFromImage(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+	dst->CopyFromImage(g_command_buffer_mgr->GetCurrentCommandBuffer(),
 		src_texture->GetImage(), src_aspect, 0, 0, EFB_WIDTH,
 		EFB_HEIGHT, 0, 0);
 
@@ -817,22 +870,104 @@ bool FramebufferManager::PopulateDepthReadbackTexture()
 		src_texture->TransitionToLayout(g_command_buffer_mgr->GetCurrentCommandBuffer(),
 			VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
 	}
+}
 
-	// Wait until the copy is complete.
-	Util::ExecuteCurrentCommandsAndRestoreState(false, true);
+void FramebufferManager::InvalidatePeekCache()
+{
+	m_color_readback_texture_valid = false;
+	m_depth_readback_texture_valid = false;
+}
 
-	// Map to host memory.
-	if (!m_depth_readback_texture->IsMapped() && !m_depth_readback_texture->Map())
-		return false;
+void FramebufferManager::QueueAsyncPeekReadback()
+{
+	AsyncPeekBuffer& entry = m_async_peek_buffers[m_current_async_peek_buffer];
+	if (entry.pending)
+	{
+		// Every buffer in the ring is still in flight on the GPU. Skip this
+		// frame rather than stalling, the last completed buffer stays current.
+		return;
+	}
+
+	CopyColorToReadbackTexture(entry.color_texture.get());
+	CopyDepthToReadbackTexture(entry.depth_texture.get());
+
+	// The fence is assigned in OnCommandBufferQueued once it is known.
+	entry.pending = true;
+	entry.pending_fence = VK_NULL_HANDLE;
+	m_current_async_peek_buffer = (m_current_async_peek_buffer + 1) % NUM_ASYNC_PEEK_BUFFERS;
+}
+
+bool FramebufferManager::CreateAsyncPeekBuffers()
+{
+	for (AsyncPeekBuffer& entry : m_async_peek_buffers)
+	{
+		entry.color_texture = StagingTexture2D::Create(STAGING_BUFFER_TYPE_READBACK, EFB_WIDTH,
+			EFB_HEIGHT, EFB_COLOR_TEXTURE_FORMAT);
+		entry.depth_texture = StagingTexture2D::Create(STAGING_BUFFER_TYPE_READBACK, EFB_WIDTH,
+			EFB_HEIGHT, EFB_DEPTH_TEXTURE_FORMAT);
+		if (!entry.color_texture || !entry.depth_texture)
+		{
+			ERROR_LOG(VIDEO, "Failed to create asynchronous EFB readback textures");
+			return false;
+		}
+
+		// As with the synchronous readback textures, leave these mapped.
+		if (!entry.color_texture->Map() || !entry.depth_texture->Map())
+		{
+			ERROR_LOG(VIDEO, "Failed to map asynchronous EFB readback textures");
+			return false;
+		}
+	}
+
+	g_command_buffer_mgr->AddFencePointCallback(
+		this, std::bind(&FramebufferManager::OnCommandBufferQueued, this, std::placeholders::_1,
+			std::placeholders::_2),
+		std::bind(&FramebufferManager::OnCommandBufferExecuted, this, std::placeholders::_1));
 
-	m_depth_readback_texture_valid = true;
 	return true;
 }
 
-void FramebufferManager::InvalidatePeekCache()
+void FramebufferManager::DestroyAsyncPeekBuffers()
 {
-	m_color_readback_texture_valid = false;
-	m_depth_readback_texture_valid = false;
+	g_command_buffer_mgr->RemoveFencePointCallback(this);
+
+	for (AsyncPeekBuffer& entry : m_async_peek_buffers)
+	{
+		entry.color_texture.reset();
+		entry.depth_texture.reset();
+		entry.pending_fence = VK_NULL_HANDLE;
+		entry.pending = false;
+	}
+	m_current_async_peek_buffer = 0;
+	m_ready_async_peek_buffer = -1;
+}
+
+void FramebufferManager::OnCommandBufferQueued(VkCommandBuffer command_buffer, VkFence fence)
+{
+	// Associate queued readbacks with the fence of the command buffer carrying them.
+	for (AsyncPeekBuffer& entry : m_async_peek_buffers)
+	{
+		if (entry.pending && entry.pending_fence == VK_NULL_HANDLE)
+			entry.pending_fence = fence;
+	}
+}
+
+void FramebufferManager::OnCommandBufferExecuted(VkFence fence)
+{
+	for (size_t i = 0; i < NUM_ASYNC_PEEK_BUFFERS; i++)
+	{
+		AsyncPeekBuffer& entry = m_async_peek_buffers[i];
+		if (!entry.pending || entry.pending_fence != fence)
+			continue;
+
+		entry.pending = false;
+		entry.pending_fence = VK_NULL_HANDLE;
+		entry.color_texture->InvalidateCPUCache();
+		entry.depth_texture->InvalidateCPUCache();
+
+		// This is now the most recent completed copy of the EFB.
+		m_ready_async_peek_buffer = static_cast<int>(i);
+	}
 }
 
 bool FramebufferManager::CreateReadbackRenderPasses()
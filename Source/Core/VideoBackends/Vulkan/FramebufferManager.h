@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 
 #include "Common/CommonTypes.h"
@@ -74,6 +75,13 @@ public:
 	float PeekEFBDepth(u32 x, u32 y);
 	void InvalidatePeekCache();
 
+	// Queues a copy of this frame's EFB color/depth values to one of a ring of
+	// host-visible buffers. Once the GPU has completed the copy, peeks are
+	// serviced from the most recent completed buffer without a pipeline stall,
+	// at the cost of the values being up to a frame stale. Called once per
+	// frame when EFB fast access is enabled.
+	void QueueAsyncPeekReadback();
+
 	// Writes a value to the framebuffer. This will never block, and writes will be batched.
 	void PokeEFBColor(u32 x, u32 y, u32 color);
 	void PokeEFBDepth(u32 x, u32 y, float depth);
@@ -111,6 +119,13 @@ private:
 
 	bool PopulateColorReadbackTexture();
 	bool PopulateDepthReadbackTexture();
+	void CopyColorToReadbackTexture(StagingTexture2D* dst);
+	void CopyDepthToReadbackTexture(StagingTexture2D* dst);
+
+	bool CreateAsyncPeekBuffers();
+	void DestroyAsyncPeekBuffers();
+	void OnCommandBufferQueued(VkCommandBuffer command_buffer, VkFence fence);
+	void OnCommandBufferExecuted(VkFence fence);
 
 	void CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x, u32 y, float z,
 		u32 color);
@@ -153,6 +168,19 @@ private:
 	bool m_color_readback_texture_valid = false;
 	bool m_depth_readback_texture_valid = false;
 
+	// Asynchronously-populated EFB readback ring, see QueueAsyncPeekReadback().
+	static const size_t NUM_ASYNC_PEEK_BUFFERS = 3;
+	struct AsyncPeekBuffer
+	{
+		std::unique_ptr<StagingTexture2D> color_texture;
+		std::unique_ptr<StagingTexture2D> depth_texture;
+		VkFence pending_fence = VK_NULL_HANDLE;
+		bool pending = false;
+	};
+	std::array<AsyncPeekBuffer, NUM_ASYNC_PEEK_BUFFERS> m_async_peek_buffers;
+	size_t m_current_async_peek_buffer = 0;
+	int m_ready_async_peek_buffer = -1;
+
 	// EFB poke drawing setup
 	std::unique_ptr<VertexFormat> m_poke_vertex_format;
 	std::unique_ptr<StreamBuffer> m_poke_vertex_stream_buffer;
@@ -5,12 +5,18 @@
 #include "VideoBackends/Vulkan/ObjectCache.h"
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <sstream>
 #include <type_traits>
+#include <unordered_set>
 #include <xxhash.h>
 
 #include "Common/CommonFuncs.h"
+#include "Common/CPUDetect.h"
 #include "Common/LinearDiskCache.h"
+#include "Common/ThreadPool.h"
+#include "Common/Timer.h"
 #include "Core/ConfigManager.h"
 #include "Core/Host.h"
 
@@ -35,12 +41,21 @@ static_assert(std::is_trivially_copyable<PipelineInfo>::value,
 
 std::unique_ptr<ObjectCache> g_object_cache;
 
+// Serializes background shader compiles: neither glslang's contexts nor the
+// disk cache appends are safe to run from multiple workers at once. Static so
+// queued tasks can still take it safely after the cache has been destroyed.
+static std::mutex s_async_compile_lock;
+
 ObjectCache::ObjectCache()
 {
 }
 
 ObjectCache::~ObjectCache()
 {
+	{
+		std::lock_guard<std::mutex> guard(s_async_compile_lock);
+		*m_async_compile_token = false;
+	}
 	DestroyPipelineCache();
 	DestroyShaderCaches();
 	DestroySharedShaders();
@@ -312,6 +327,76 @@ std::pair<VkPipeline, bool> ObjectCache::GetPipelineWithCacheResult(const Pipeli
 	return{ pipeline, false };
 }
 
+// Budget for boot-time pipeline pre-creation. Once exceeded, the remaining
+// pipelines are left to be created on first use, so a slow driver degrades
+// back to the old hitching behaviour instead of stalling boot indefinitely.
+static constexpr u32 PIPELINE_PRECACHE_BUDGET_MS = 15000;
+
+void ObjectCache::PrecachePipelines(const std::vector<PipelineInfo>& infos)
+{
+	struct PrecacheState
+	{
+		std::vector<PipelineInfo> pending;
+		std::vector<VkPipeline> pipelines;
+		std::atomic<u32> next_entry{ 0 };
+		std::atomic<u32> done_entries{ 0 };
+		u32 start_time = 0;
+	};
+	std::shared_ptr<PrecacheState> state = std::make_shared<PrecacheState>();
+
+	// Filter out duplicates and pipelines that already exist (e.g. from an
+	// earlier cache reload), since the workers create every entry they claim.
+	std::unordered_set<PipelineInfo, PipelineInfoHash> seen;
+	state->pending.reserve(infos.size());
+	for (const PipelineInfo& info : infos)
+	{
+		if (m_pipeline_objects.find(info) == m_pipeline_objects.end() && seen.insert(info).second)
+			state->pending.push_back(info);
+	}
+	if (state->pending.empty())
+		return;
+
+	const u32 count = static_cast<u32>(state->pending.size());
+	state->pipelines.resize(count, VK_NULL_HANDLE);
+	state->start_time = Common::Timer::GetTimeMs();
+
+	// Pipeline creation against the same VkPipelineCache is internally
+	// synchronized by the driver, so the workers only share the claim counter.
+	auto create_task = [this, state, count]() {
+		u32 entry;
+		while ((entry = state->next_entry.fetch_add(1)) < count)
+		{
+			// Past the budget we still drain the counter so the join below sees
+			// every entry accounted for, we just stop asking the driver for more.
+			if (Common::Timer::GetTimeMs() - state->start_time < PIPELINE_PRECACHE_BUDGET_MS)
+				state->pipelines[entry] = CreatePipeline(state->pending[entry]);
+			state->done_entries.fetch_add(1);
+		}
+	};
+	const u32 num_tasks = std::min(count, static_cast<u32>(cpu_info.num_cores));
+	for (u32 i = 1; i < num_tasks; i++)
+	{
+		Common::AsyncWorker::ExecuteAsync(std::function<void()>(create_task));
+	}
+	create_task();
+	u32 loopcount = 0;
+	while (state->done_entries.load() < count)
+	{
+		Common::cYield(loopcount++);
+	}
+
+	u32 created = 0;
+	for (u32 i = 0; i < count; i++)
+	{
+		if (state->pipelines[i] == VK_NULL_HANDLE)
+			continue;
+		m_pipeline_objects.emplace(state->pending[i], state->pipelines[i]);
+		created++;
+	}
+	INFO_LOG(VIDEO, "Pre-created %u of %u pipelines in %u ms", created, count,
+		Common::Timer::GetTimeMs() - state->start_time);
+}
+
 VkPipeline ObjectCache::CreateComputePipeline(const ComputePipelineInfo& info)
 {
 	VkComputePipelineCreateInfo pipeline_info = { VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
@@ -718,9 +803,11 @@ void ObjectCache::CompileVertexShaderForUid(const VertexShaderUid& uid, ObjectCa
 			INCSTAT(stats.numVertexShadersAlive);
 		}
 	}
-	it.compiled = true;
 	// We still insert null entries to prevent further compilation attempts.
+	// The module is published before the compiled flag so an asynchronous
+	// reader never observes the flag without the module.
 	it.module = module;
+	it.compiled = true;
 }
 void ObjectCache::CompileGeometryShaderForUid(const GeometryShaderUid& uid, ObjectCache::vkShaderItem& it)
 {
@@ -738,9 +825,9 @@ void ObjectCache::CompileGeometryShaderForUid(const GeometryShaderUid& uid, Obje
 		if (module != VK_NULL_HANDLE)
 			m_gs_cache.disk_cache.Append(uid, spv.data(), static_cast<u32>(spv.size()));
 	}
-	it.compiled = true;
 	// We still insert null entries to prevent further compilation attempts.
 	it.module = module;
+	it.compiled = true;
 }
 
 void ObjectCache::CompilePixelShaderForUid(const PixelShaderUid& uid, ObjectCache::vkShaderItem& it)
@@ -763,16 +850,31 @@ void ObjectCache::CompilePixelShaderForUid(const PixelShaderUid& uid, ObjectCach
 			INCSTAT(stats.numPixelShadersAlive);
 		}
 	}
-	it.compiled = true;
 	// We still insert null entries to prevent further compilation attempts.
 	it.module = module;
+	it.compiled = true;
 }
 
 VkShaderModule ObjectCache::GetVertexShaderForUid(const VertexShaderUid& uid)
 {
 	vkShaderItem& it = m_vs_cache.shader_map->GetOrAdd(uid);
 	if (it.initialized.test_and_set())
-		return it.module;
+	{
+		// A null module with the compiled flag clear means a background compile
+		// is still outstanding; the caller drops the draw until it lands.
+		return it.compiled ? it.module : VK_NULL_HANDLE;
+	}
+
+	if (g_ActiveConfig.bFullAsyncShaderCompilation)
+	{
+		std::shared_ptr<bool> token = m_async_compile_token;
+		Common::AsyncWorker::ExecuteAsync(std::function<void()>([this, uid, &it, token]() {
+			std::lock_guard<std::mutex> guard(s_async_compile_lock);
+			if (*token)
+				CompileVertexShaderForUid(uid, it);
+		}));
+		return VK_NULL_HANDLE;
+	}
 
 	CompileVertexShaderForUid(uid, it);
 	return it.module;
@@ -783,7 +885,18 @@ VkShaderModule ObjectCache::GetGeometryShaderForUid(const GeometryShaderUid& uid
 	_assert_(g_vulkan_context->SupportsGeometryShaders());
 	vkShaderItem& it = m_gs_cache.shader_map->GetOrAdd(uid);
 	if (it.initialized.test_and_set())
-		return it.module;
+		return it.compiled ? it.module : VK_NULL_HANDLE;
+
+	if (g_ActiveConfig.bFullAsyncShaderCompilation)
+	{
+		std::shared_ptr<bool> token = m_async_compile_token;
+		Common::AsyncWorker::ExecuteAsync(std::function<void()>([this, uid, &it, token]() {
+			std::lock_guard<std::mutex> guard(s_async_compile_lock);
+			if (*token)
+				CompileGeometryShaderForUid(uid, it);
+		}));
+		return VK_NULL_HANDLE;
+	}
 
 	CompileGeometryShaderForUid(uid, it);
 	return it.module;
@@ -793,7 +906,18 @@ VkShaderModule ObjectCache::GetPixelShaderForUid(const PixelShaderUid& uid)
 {
 	vkShaderItem& it = m_ps_cache.shader_map->GetOrAdd(uid);
 	if (it.initialized.test_and_set())
-		return it.module;
+		return it.compiled ? it.module : VK_NULL_HANDLE;
+
+	if (g_ActiveConfig.bFullAsyncShaderCompilation)
+	{
+		std::shared_ptr<bool> token = m_async_compile_token;
+		Common::AsyncWorker::ExecuteAsync(std::function<void()>([this, uid, &it, token]() {
+			std::lock_guard<std::mutex> guard(s_async_compile_lock);
+			if (*token)
+				CompilePixelShaderForUid(uid, it);
+		}));
+		return VK_NULL_HANDLE;
+	}
 
 	CompilePixelShaderForUid(uid, it);
 	return it.module;
@@ -8,8 +8,10 @@
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/LinearDiskCache.h"
@@ -149,6 +151,8 @@ public:
 	std::string GetUtilityShaderHeader() const;
 
 	// Accesses ShaderGen shader caches
+	// With full async shader compilation enabled these return VK_NULL_HANDLE
+	// while the module is still being compiled in the background.
 	VkShaderModule GetVertexShaderForUid(const VertexShaderUid& uid);
 	VkShaderModule GetGeometryShaderForUid(const GeometryShaderUid& uid);
 	VkShaderModule GetPixelShaderForUid(const PixelShaderUid& uid);
@@ -173,6 +177,12 @@ public:
 	// otherwise for a cache hit it will be true.
 	std::pair<VkPipeline, bool> GetPipelineWithCacheResult(const PipelineInfo& info);
 
+	// Creates any pipelines from the list that do not exist yet, fanning the
+	// driver work out across the worker pool. Creation stops once the time
+	// budget is exhausted, leaving the remainder to on-demand creation, so a
+	// slow driver only lengthens startup rather than stalling it indefinitely.
+	void PrecachePipelines(const std::vector<PipelineInfo>& infos);
+
 	// Creates a compute pipeline, and does not track the handle.
 	VkPipeline CreateComputePipeline(const ComputePipelineInfo& info);
 
@@ -249,6 +259,11 @@ private:
 	GShaderCache m_gs_cache;
 	PShaderCache m_ps_cache;
 
+	// Invalidated in the destructor so background compile tasks that are still
+	// queued on the worker pool turn into no-ops instead of touching a dead
+	// cache.
+	std::shared_ptr<bool> m_async_compile_token = std::make_shared<bool>(true);
+
 	std::unordered_map<PipelineInfo, VkPipeline, PipelineInfoHash> m_pipeline_objects;
 	std::unordered_map<ComputePipelineInfo, VkPipeline, ComputePipelineInfoHash>
 		m_compute_pipeline_objects;
@@ -513,6 +513,14 @@ void Renderer::SwapImpl(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height
 	StateTracker::GetInstance()->EndRenderPass();
 	StateTracker::GetInstance()->OnEndFrame();
 
+	// Schedule a copy of this frame's EFB and bounding box values to host
+	// memory, so that peeks next frame can be serviced without a GPU sync.
+	if (g_ActiveConfig.bEFBFastAccess)
+	{
+		FramebufferManager::GetInstance()->QueueAsyncPeekReadback();
+		m_bounding_box->QueueAsyncReadback();
+	}
+
 	// There are a few variables which can alter the final window draw rectangle, and some of them
 	// are determined by guest state. Currently, the only way to catch these is to update every frame.
 	UpdateDrawRectangle();
@@ -5,6 +5,7 @@
 #include "VideoBackends/Vulkan/StateTracker.h"
 
 #include <cstring>
+#include <vector>
 
 #include "Common/Align.h"
 #include "Common/Assert.h"
@@ -123,22 +124,36 @@ void StateTracker::LoadPipelineUIDCache()
 	class PipelineInserter final : public LinearDiskCacheReader<SerializedPipelineUID, u32>
 	{
 	public:
-		explicit PipelineInserter(StateTracker* this_ptr_) : this_ptr(this_ptr_) {}
+		explicit PipelineInserter(std::vector<SerializedPipelineUID>* uids_) : uids(uids_) {}
 		void Read(const SerializedPipelineUID& key, const u32* value, u32 value_size)
 		{
-			this_ptr->PrecachePipelineUID(key);
+			uids->push_back(key);
 		}
 
 	private:
-		StateTracker* this_ptr;
+		std::vector<SerializedPipelineUID>* uids;
 	};
 
 	std::string filename = g_object_cache->GetDiskUIDCacheFileName();
-	PipelineInserter inserter(this);
+	std::vector<SerializedPipelineUID> uids;
+	PipelineInserter inserter(&uids);
 
 	// OpenAndRead calls Close() first, which will flush all data to disk when reloading.
 	// This assertion must hold true, otherwise data corruption will result.
 	m_uid_cache.OpenAndRead(filename, inserter);
+
+	// Resolve the UIDs to full pipeline descriptions on this thread, since the
+	// shader maps are not thread-safe, then hand the driver work off to the
+	// worker pool in one go.
+	std::vector<PipelineInfo> infos;
+	infos.reserve(uids.size());
+	for (const SerializedPipelineUID& uid : uids)
+	{
+		PipelineInfo pinfo;
+		if (PreparePipelineUID(uid, &pinfo))
+			infos.push_back(pinfo);
+	}
+	g_object_cache->PrecachePipelines(infos);
 }
 
 void StateTracker::AppendToPipelineUIDCache(const PipelineInfo& info)
@@ -157,7 +172,7 @@ void StateTracker::AppendToPipelineUIDCache(const PipelineInfo& info)
 	m_uid_cache.Append(sinfo, &dummy_value, 1);
 }
 
-bool StateTracker::PrecachePipelineUID(const SerializedPipelineUID& uid)
+bool StateTracker::PreparePipelineUID(const SerializedPipelineUID& uid, PipelineInfo* out_pinfo)
 {
 	PipelineInfo pinfo = {};
 
@@ -194,14 +209,9 @@ bool StateTracker::PrecachePipelineUID(const SerializedPipelineUID& uid)
 	pinfo.depth_stencil_state.bits = uid.depth_stencil_state_bits;
 	pinfo.primitive_topology = uid.primitive_topology;
 
-	VkPipeline pipeline = g_object_cache->GetPipeline(pinfo);
-	if (pipeline == VK_NULL_HANDLE)
-	{
-		WARN_LOG(VIDEO, "Failed to get pipeline from cached UID.");
-		return false;
-	}
-
-	// We don't need to do anything with this pipeline, just make sure it exists.
+	// BitField deletes the assignment operators, but the struct is memcmp'd
+	// everywhere anyway, so copy it out the same way.
+	std::memcpy(out_pinfo, &pinfo, sizeof(pinfo));
 	return true;
 }
 
@@ -319,6 +329,12 @@ bool StateTracker::CheckForShaderChanges(u32 gx_primitive_type, u32 components,
 		m_vs_uid = vs_uid;
 		changed = true;
 	}
+	else if (m_pipeline_state.vs == VK_NULL_HANDLE)
+	{
+		// An asynchronous compile may have finished since the last look-up.
+		m_pipeline_state.vs = g_object_cache->GetVertexShaderForUid(vs_uid);
+		changed |= m_pipeline_state.vs != VK_NULL_HANDLE;
+	}
 
 	if (g_vulkan_context->SupportsGeometryShaders())
 	{
@@ -334,6 +350,11 @@ bool StateTracker::CheckForShaderChanges(u32 gx_primitive_type, u32 components,
 			m_gs_uid = gs_uid;
 			changed = true;
 		}
+		else if (m_pipeline_state.gs == VK_NULL_HANDLE && !gs_uid.GetUidData().IsPassthrough())
+		{
+			m_pipeline_state.gs = g_object_cache->GetGeometryShaderForUid(gs_uid);
+			changed |= m_pipeline_state.gs != VK_NULL_HANDLE;
+		}
 	}
 
 	if (ps_uid != m_ps_uid)
@@ -342,6 +363,11 @@ bool StateTracker::CheckForShaderChanges(u32 gx_primitive_type, u32 components,
 		m_ps_uid = ps_uid;
 		changed = true;
 	}
+	else if (m_pipeline_state.ps == VK_NULL_HANDLE)
+	{
+		m_pipeline_state.ps = g_object_cache->GetPixelShaderForUid(ps_uid);
+		changed |= m_pipeline_state.ps != VK_NULL_HANDLE;
+	}
 
 	if (m_dstalpha_mode != dstalpha_mode)
 	{
@@ -606,6 +632,7 @@ void StateTracker::UnbindTexture(VkImageView view)
 void StateTracker::InvalidateDescriptorSets()
 {
 	m_descriptor_sets.fill(VK_NULL_HANDLE);
+	m_sampler_set_cache.clear();
 	m_dirty_flags |= DIRTY_FLAG_ALL_DESCRIPTOR_SETS;
 
 	// Defer SSBO descriptor update until bbox is actually enabled.
@@ -709,7 +736,10 @@ bool StateTracker::Bind(bool rebind_all /*= false*/)
 	// Get new pipeline object if any parts have changed
 	if (m_dirty_flags & DIRTY_FLAG_PIPELINE && !UpdatePipeline())
 	{
-		ERROR_LOG(VIDEO, "Failed to get pipeline object, skipping draw");
+		// With full async shader compilation, dropped draws while a compile is
+		// outstanding are expected and resolve by themselves - don't spam then.
+		if (!g_ActiveConfig.bFullAsyncShaderCompilation)
+			ERROR_LOG(VIDEO, "Failed to get pipeline object, skipping draw");
 		return false;
 	}
 
@@ -926,6 +956,12 @@ bool StateTracker::UpdatePipeline()
 	if (m_pipeline_state.vs == VK_NULL_HANDLE || m_pipeline_state.ps == VK_NULL_HANDLE)
 		return false;
 
+	// A non-passthrough geometry shader that hasn't finished compiling yet also
+	// has to hold the draw back, otherwise it would render without one.
+	if (g_vulkan_context->SupportsGeometryShaders() && m_pipeline_state.gs == VK_NULL_HANDLE &&
+		!m_gs_uid.GetUidData().IsPassthrough())
+		return false;
+
 	// Grab a new pipeline object, this can fail.
 	// We have to use a different blend state for the alpha pass of the dstalpha fallback.
 	if (m_dstalpha_mode == PSRM_ALPHA_PASS)
@@ -982,35 +1018,53 @@ bool StateTracker::UpdateDescriptorSet()
 	if (m_dirty_flags & DIRTY_FLAG_PS_SAMPLERS ||
 		m_descriptor_sets[DESCRIPTOR_SET_BIND_POINT_PIXEL_SHADER_SAMPLERS] == VK_NULL_HANDLE)
 	{
-		VkDescriptorSetLayout layout =
-			g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_PIXEL_SHADER_SAMPLERS);
-		VkDescriptorSet set = g_command_buffer_mgr->AllocateDescriptorSet(layout);
-		if (set == VK_NULL_HANDLE)
-			return false;
-
+		SamplerSetKey key;
 		for (size_t i = 0; i < NUM_PIXEL_SHADER_SAMPLERS; i++)
 		{
-			const VkDescriptorImageInfo& info = m_bindings.ps_samplers[i];
-			if (info.imageView != VK_NULL_HANDLE && info.sampler != VK_NULL_HANDLE)
+			key.views[i] = m_bindings.ps_samplers[i].imageView;
+			key.samplers[i] = m_bindings.ps_samplers[i].sampler;
+		}
+
+		auto cache_iter = m_sampler_set_cache.find(key);
+		if (cache_iter != m_sampler_set_cache.end())
+		{
+			// This tuple was already written into a set for this command buffer.
+			m_descriptor_sets[DESCRIPTOR_SET_BIND_POINT_PIXEL_SHADER_SAMPLERS] = cache_iter->second;
+			m_dirty_flags |= DIRTY_FLAG_DESCRIPTOR_SET_BINDING;
+		}
+		else
+		{
+			VkDescriptorSetLayout layout =
+				g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_PIXEL_SHADER_SAMPLERS);
+			VkDescriptorSet set = g_command_buffer_mgr->AllocateDescriptorSet(layout);
+			if (set == VK_NULL_HANDLE)
+				return false;
+
+			for (size_t i = 0; i < NUM_PIXEL_SHADER_SAMPLERS; i++)
 			{
-				writes[num_writes++] =
+				const VkDescriptorImageInfo& info = m_bindings.ps_samplers[i];
+				if (info.imageView != VK_NULL_HANDLE && info.sampler != VK_NULL_HANDLE)
 				{
-					VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-					nullptr,
-					set,
-					static_cast<uint32_t>(i),
-					0,
-					1,
-					VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-					&info,
-					nullptr,
-					nullptr
-				};
+					writes[num_writes++] =
+					{
+						VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+						nullptr,
+						set,
+						static_cast<uint32_t>(i),
+						0,
+						1,
+						VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+						&info,
+						nullptr,
+						nullptr
+					};
+				}
 			}
-		}
 
-		m_descriptor_sets[DESCRIPTOR_SET_BIND_POINT_PIXEL_SHADER_SAMPLERS] = set;
-		m_dirty_flags |= DIRTY_FLAG_DESCRIPTOR_SET_BINDING;
+			m_sampler_set_cache.emplace(key, set);
+			m_descriptor_sets[DESCRIPTOR_SET_BIND_POINT_PIXEL_SHADER_SAMPLERS] = set;
+			m_dirty_flags |= DIRTY_FLAG_DESCRIPTOR_SET_BINDING;
+		}
 	}
 
 	if (m_bbox_enabled &&
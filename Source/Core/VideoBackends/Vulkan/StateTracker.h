@@ -6,7 +6,9 @@
 
 #include <array>
 #include <cstddef>
+#include <cstring>
 #include <memory>
+#include <unordered_map>
 
 #include "Common/CommonTypes.h"
 #include "VideoBackends/Vulkan/Constants.h"
@@ -131,6 +133,37 @@ private:
 		VkPrimitiveTopology primitive_topology;
 	};
 
+	// Sampler descriptor sets live in the per-frame pool, so they are only
+	// valid for the current command buffer, but within it the same
+	// texture/sampler tuple recurs constantly as draws alternate between a
+	// handful of textures. Cache the written sets by tuple so a re-bind is a
+	// map hit instead of a pool allocation plus vkUpdateDescriptorSets. The
+	// cache is dropped along with the pool in InvalidateDescriptorSets().
+	struct SamplerSetKey
+	{
+		std::array<VkImageView, NUM_PIXEL_SHADER_SAMPLERS> views;
+		std::array<VkSampler, NUM_PIXEL_SHADER_SAMPLERS> samplers;
+
+		bool operator==(const SamplerSetKey& rhs) const
+		{
+			return std::memcmp(this, &rhs, sizeof(rhs)) == 0;
+		}
+	};
+
+	struct SamplerSetKeyHash
+	{
+		size_t operator()(const SamplerSetKey& key) const
+		{
+			size_t h = -1;
+			for (size_t i = 0; i < NUM_PIXEL_SHADER_SAMPLERS; i++)
+			{
+				h = h * 137 + (uintptr_t)key.views[i];
+				h = h * 137 + (uintptr_t)key.samplers[i];
+			}
+			return h;
+		}
+	};
+
 	// Number of descriptor sets for game draws.
 	enum
 	{
@@ -164,8 +197,9 @@ private:
 	// The info is here so that we can store variations of a UID, e.g. blend state.
 	void AppendToPipelineUIDCache(const PipelineInfo& info);
 
-	// Precaches a pipeline based on the UID information.
-	bool PrecachePipelineUID(const SerializedPipelineUID& uid);
+	// Resolves a serialized UID into a full pipeline description, compiling
+	// shaders as necessary. Returns false if any component is unavailable.
+	bool PreparePipelineUID(const SerializedPipelineUID& uid, PipelineInfo* pinfo);
 
 	// Check that the specified viewport is within the render area.
 	// If not, ends the render pass if it is a clear render pass.
@@ -221,6 +255,7 @@ private:
 	} m_bindings;
 	u32 m_num_active_descriptor_sets = 0;
 	size_t m_uniform_buffer_reserve_size = 0;
+	std::unordered_map<SamplerSetKey, VkDescriptorSet, SamplerSetKeyHash> m_sampler_set_cache;
 
 	// rasterization
 	VkViewport m_viewport = { 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f };
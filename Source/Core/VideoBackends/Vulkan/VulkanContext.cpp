@@ -240,6 +240,7 @@ void VulkanContext::PopulateBackendInfo(VideoConfig* config)
 	config->backend_info.bSupportsDualSourceBlend = false;      // Dependent on features.
 	config->backend_info.bSupportsGeometryShaders = false;      // Dependent on features.
 	config->backend_info.bSupportsGSInstancing = false;         // Dependent on features.
+	config->backend_info.bSupportsVertexShaderLayer = false;    // No support yet.
 	config->backend_info.bSupportsBBox = false;                 // Dependent on features.
 	config->backend_info.bSupportsSSAA = false;                 // Dependent on features.
 	config->backend_info.bSupportsDepthClamp = false;           // Dependent on features.
@@ -262,7 +263,7 @@ void VulkanContext::PopulateBackendInfo(VideoConfig* config)
 	config->backend_info.bSupportsPostProcessing = false;
 	config->backend_info.bSupportsNormalMaps = true;
 	config->backend_info.bSupportsInternalResolutionFrameDumps = true;
-	config->backend_info.bSupportsAsyncShaderCompilation = false;
+	config->backend_info.bSupportsAsyncShaderCompilation = true;
 }
 
 void VulkanContext::PopulateBackendInfoAdapters(VideoConfig* config, const GPUList& gpu_list)
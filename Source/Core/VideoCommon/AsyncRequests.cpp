@@ -5,8 +5,11 @@
 #include <mutex>
 
 #include "VideoCommon/AsyncRequests.h"
+#include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/Fifo.h"
+#include "VideoCommon/FramebufferManagerBase.h"
+#include "VideoCommon/LatencyTracker.h"
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoCommon.h"
@@ -14,8 +17,13 @@
 
 AsyncRequests AsyncRequests::s_singleton;
 
+// Pokes accumulate on the CPU thread until this many are pending, a poke of
+// the other type arrives, or FlushEFBPokes() is called. Big enough that a
+// CPU-rendered frame only crosses the thread boundary a handful of times.
+static const size_t EFB_POKE_FLUSH_SIZE = 2048;
+
 AsyncRequests::AsyncRequests()
-	: m_enable(false), m_passthrough(true)
+	: m_enable(false), m_passthrough(true), m_pokes_pending(false), m_pending_pokes_color(false)
 {}
 
 void AsyncRequests::PullEventsInternal()
@@ -27,6 +35,22 @@ void AsyncRequests::PullEventsInternal()
 	{
 		Event e = m_queue.front();
 
+		if (e.type == Event::EFB_POKE_BATCH)
+		{
+			std::vector<EfbPokeData> pokes = std::move(m_poke_batches.front());
+			m_poke_batches.pop_front();
+			m_queue.pop();
+
+			EFBAccessType t = e.efb_poke_batch.is_color ? EFBAccessType::PokeColor : EFBAccessType::PokeZ;
+
+			lock.unlock();
+			BPFunctions::FlushPendingEFBClear();
+			FramebufferManagerBase::FlushDeferredXFBCopy();
+			g_renderer->PokeEFB(t, pokes.data(), pokes.size());
+			lock.lock();
+			continue;
+		}
+
 		// try to merge as many efb pokes as possible
 		// it's a bit hacky, but some games render a complete frame in this way
 		if ((e.type == Event::EFB_POKE_COLOR || e.type == Event::EFB_POKE_Z))
@@ -49,6 +73,8 @@ void AsyncRequests::PullEventsInternal()
 			} while (!m_queue.empty() && m_queue.front().type == first_event.type);
 
 			lock.unlock();
+			BPFunctions::FlushPendingEFBClear();
+			FramebufferManagerBase::FlushDeferredXFBCopy();
 			g_renderer->PokeEFB(t, m_merged_efb_pokes.data(), m_merged_efb_pokes.size());
 			lock.lock();
 			continue;
@@ -70,6 +96,33 @@ void AsyncRequests::PullEventsInternal()
 
 void AsyncRequests::PushEvent(const AsyncRequests::Event& event, bool blocking)
 {
+	// EFB pokes are the only high frequency event passing through here (some
+	// games paint whole frames this way, one pixel each). They are
+	// write-combined on the CPU thread and submitted as a single batch, so the
+	// common case pays neither a lock nor a GPU kick per pixel. Any other
+	// event flushes the batch first, which keeps pokes ordered against peeks,
+	// swaps and everything else crossing this interface.
+	if (event.type == Event::EFB_POKE_COLOR || event.type == Event::EFB_POKE_Z)
+	{
+		const bool is_color = event.type == Event::EFB_POKE_COLOR;
+		if (m_pokes_pending && m_pending_pokes_color != is_color)
+			FlushEFBPokesInternal();
+
+		EfbPokeData d;
+		d.x = event.efb_poke.x;
+		d.y = event.efb_poke.y;
+		d.data = event.efb_poke.data;
+		m_pending_pokes.push_back(d);
+		m_pending_pokes_color = is_color;
+		m_pokes_pending = true;
+
+		if (m_pending_pokes.size() >= EFB_POKE_FLUSH_SIZE)
+			FlushEFBPokesInternal();
+		return;
+	}
+
+	FlushEFBPokes();
+
 	std::unique_lock<std::mutex> lock(m_mutex);
 
 	if (m_passthrough)
@@ -96,6 +149,43 @@ void AsyncRequests::PushEvent(const AsyncRequests::Event& event, bool blocking)
 	}
 }
 
+void AsyncRequests::FlushEFBPokesInternal()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_pokes_pending = false;
+
+	EFBAccessType t = m_pending_pokes_color ? EFBAccessType::PokeColor : EFBAccessType::PokeZ;
+
+	if (m_passthrough)
+	{
+		BPFunctions::FlushPendingEFBClear();
+		FramebufferManagerBase::FlushDeferredXFBCopy();
+		g_renderer->PokeEFB(t, m_pending_pokes.data(), m_pending_pokes.size());
+		m_pending_pokes.clear();
+		return;
+	}
+
+	m_empty.Clear();
+
+	if (!m_enable)
+	{
+		m_pending_pokes.clear();
+		return;
+	}
+
+	Event e;
+	e.type = Event::EFB_POKE_BATCH;
+	e.time = 0;
+	e.efb_poke_batch.count = static_cast<u32>(m_pending_pokes.size());
+	e.efb_poke_batch.is_color = m_pending_pokes_color;
+
+	m_poke_batches.emplace_back(std::move(m_pending_pokes));
+	m_pending_pokes.clear();
+	m_queue.push(e);
+
+	Fifo::RunGpu();
+}
+
 void AsyncRequests::SetEnable(bool enable)
 {
 	std::unique_lock<std::mutex> lock(m_mutex);
@@ -106,6 +196,9 @@ void AsyncRequests::SetEnable(bool enable)
 		// flush the queue on disabling
 		while (!m_queue.empty())
 			m_queue.pop();
+		m_poke_batches.clear();
+		m_pending_pokes.clear();
+		m_pokes_pending = false;
 		if (m_wake_me_up_again)
 			m_cond.notify_all();
 	}
@@ -113,12 +206,17 @@ void AsyncRequests::SetEnable(bool enable)
 
 void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
 {
+	// Every event here either reads the EFB or presents it, so a pending
+	// clear has to land before it is serviced.
+	BPFunctions::FlushPendingEFBClear();
+
 	EFBRectangle rc;
 	switch (e.type)
 	{
 	case Event::EFB_POKE_COLOR:
 	{
 		EfbPokeData poke = { e.efb_poke.x, e.efb_poke.y, e.efb_poke.data };
+		FramebufferManagerBase::FlushDeferredXFBCopy();
 		g_renderer->PokeEFB(EFBAccessType::PokeColor, &poke, 1);
 	}
 	break;
@@ -126,10 +224,16 @@ void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
 	case Event::EFB_POKE_Z:
 	{
 		EfbPokeData poke = { e.efb_poke.x, e.efb_poke.y, e.efb_poke.data };
+		FramebufferManagerBase::FlushDeferredXFBCopy();
 		g_renderer->PokeEFB(EFBAccessType::PokeZ, &poke, 1);
 	}
 	break;
 
+	case Event::EFB_POKE_BATCH:
+		// Never dispatched through here; batches are consumed directly by
+		// PullEventsInternal and FlushEFBPokesInternal.
+		break;
+
 	case Event::EFB_PEEK_COLOR:
 		*e.efb_peek.data = g_renderer->AccessEFB(EFBAccessType::PeekColor, e.efb_peek.x, e.efb_peek.y, 0);
 		break;
@@ -138,8 +242,28 @@ void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
 		*e.efb_peek.data = g_renderer->AccessEFB(EFBAccessType::PeekZ, e.efb_peek.x, e.efb_peek.y, 0);
 		break;
 
+	// One blocking round trip fills a whole tile; the CPU side answers
+	// subsequent peeks from it until the EFB is dirtied again.
+	case Event::EFB_PEEK_TILE_COLOR:
+	case Event::EFB_PEEK_TILE_Z:
+	{
+		const EFBAccessType access =
+			e.type == Event::EFB_PEEK_TILE_COLOR ? EFBAccessType::PeekColor : EFBAccessType::PeekZ;
+		u32* data = e.efb_peek_tile.data;
+		for (u32 row = 0; row < e.efb_peek_tile.h; row++)
+		{
+			for (u32 col = 0; col < e.efb_peek_tile.w; col++)
+			{
+				data[row * EFB_WIDTH + col] =
+					g_renderer->AccessEFB(access, e.efb_peek_tile.x + col, e.efb_peek_tile.y + row, 0);
+			}
+		}
+	}
+	break;
+
 	case Event::SWAP_EVENT:
 		g_renderer->Swap(e.swap_event.xfbAddr, e.swap_event.fbWidth, e.swap_event.fbStride, e.swap_event.fbHeight, rc, e.time);
+		LatencyTracker::OnFramePresented();
 		break;
 
 	case Event::BBOX_READ:
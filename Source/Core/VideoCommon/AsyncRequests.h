@@ -5,6 +5,7 @@
 #pragma once
 
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <queue>
 #include <vector>
@@ -23,8 +24,11 @@ public:
 		{
 			EFB_POKE_COLOR,
 			EFB_POKE_Z,
+			EFB_POKE_BATCH,
 			EFB_PEEK_COLOR,
 			EFB_PEEK_Z,
+			EFB_PEEK_TILE_COLOR,
+			EFB_PEEK_TILE_Z,
 			SWAP_EVENT,
 			BBOX_READ,
 			PERF_QUERY,
@@ -40,6 +44,12 @@ public:
 				u32 data;
 			} efb_poke;
 
+			struct
+			{
+				u32 count;  // payload lives in m_poke_batches
+				bool is_color;
+			} efb_poke_batch;
+
 			struct
 			{
 				u16 x;
@@ -47,6 +57,15 @@ public:
 				u32* data;
 			} efb_peek;
 
+			struct
+			{
+				u16 x;
+				u16 y;
+				u16 w;
+				u16 h;
+				u32* data;  // tile origin inside an EFB_WIDTH-stride buffer
+			} efb_peek_tile;
+
 			struct
 			{
 				u32 xfbAddr;
@@ -74,6 +93,16 @@ public:
 			PullEventsInternal();
 	}
 	void PushEvent(const Event& event, bool blocking = false);
+
+	// CPU thread only: submit any write-combined EFB pokes to the GPU. Must be
+	// called before anything that has to see their effect is queued up, e.g.
+	// further FIFO data or a savestate.
+	void FlushEFBPokes()
+	{
+		if (m_pokes_pending)
+			FlushEFBPokesInternal();
+	}
+
 	void SetEnable(bool enable);
 	void SetPassthrough(bool enable);
 
@@ -84,6 +113,7 @@ public:
 
 private:
 	void PullEventsInternal();
+	void FlushEFBPokesInternal();
 	void HandleEvent(const Event& e);
 
 	static AsyncRequests s_singleton;
@@ -98,4 +128,12 @@ private:
 	bool m_passthrough;
 
 	std::vector<EfbPokeData> m_merged_efb_pokes;
+
+	// Write-combining buffer for EFB pokes. Only ever touched by the CPU
+	// thread, so appending to it needs no lock; m_poke_batches hands the
+	// finished batches over to the GPU thread and is guarded by m_mutex.
+	bool m_pokes_pending;
+	bool m_pending_pokes_color;
+	std::vector<EfbPokeData> m_pending_pokes;
+	std::deque<std::vector<EfbPokeData>> m_poke_batches;
 };
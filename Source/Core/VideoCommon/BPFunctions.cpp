@@ -2,14 +2,19 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
+
 #include "Common/Common.h"
 #include "Common/Logging/Log.h"
 
 #include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/FramebufferManagerBase.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/RenderBase.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
 #include "VideoCommon/VideoCommon.h"
@@ -92,6 +97,82 @@ void SetColorMask()
 	g_renderer->SetColorMask();
 }
 
+// Pending EFB clear, in the same spirit as the deferred XFB copy: instead of
+// issuing a backend clear per guest clear command, the most recent one is held
+// back here. A following clear with identical parameters whose rectangle merges
+// cleanly grows the pending region; everything else that could observe the EFB
+// flushes it. Titles that clear in horizontal strips collapse to a single
+// backend clear call this way.
+static struct
+{
+	bool pending = false;
+	EFBRectangle rc;
+	bool colorEnable;
+	bool alphaEnable;
+	bool zEnable;
+	u32 color;
+	u32 z;
+} s_pending_clear;
+
+// The union of two clear rectangles is only itself a rectangle if one contains
+// the other, or they share one axis and touch or overlap on the other — which
+// is exactly the shape of the strip patterns this is meant to catch.
+static bool TryMergeClearRect(EFBRectangle* merged, const EFBRectangle& rc)
+{
+	if (rc.left <= merged->left && rc.top <= merged->top &&
+		rc.right >= merged->right && rc.bottom >= merged->bottom)
+	{
+		*merged = rc;
+		return true;
+	}
+	if (merged->left <= rc.left && merged->top <= rc.top &&
+		merged->right >= rc.right && merged->bottom >= rc.bottom)
+	{
+		return true;
+	}
+	if (merged->left == rc.left && merged->right == rc.right &&
+		rc.top <= merged->bottom && rc.bottom >= merged->top)
+	{
+		merged->top = std::min(merged->top, rc.top);
+		merged->bottom = std::max(merged->bottom, rc.bottom);
+		return true;
+	}
+	if (merged->top == rc.top && merged->bottom == rc.bottom &&
+		rc.left <= merged->right && rc.right >= merged->left)
+	{
+		merged->left = std::min(merged->left, rc.left);
+		merged->right = std::max(merged->right, rc.right);
+		return true;
+	}
+	return false;
+}
+
+void FlushPendingEFBClear()
+{
+	if (!s_pending_clear.pending)
+		return;
+
+	s_pending_clear.pending = false;
+
+	FramebufferManagerBase::FlushDeferredXFBCopy();
+	g_efb_peek_version++;
+	g_renderer->ClearScreen(s_pending_clear.rc, s_pending_clear.colorEnable,
+		s_pending_clear.alphaEnable, s_pending_clear.zEnable,
+		s_pending_clear.color, s_pending_clear.z);
+}
+
+bool PendingEFBClearIntersects(const EFBRectangle &rc)
+{
+	return s_pending_clear.pending &&
+		rc.left < s_pending_clear.rc.right && rc.right > s_pending_clear.rc.left &&
+		rc.top < s_pending_clear.rc.bottom && rc.bottom > s_pending_clear.rc.top;
+}
+
+void DropPendingEFBClear()
+{
+	s_pending_clear.pending = false;
+}
+
 /* Explanation of the magic behind ClearScreen:
 There's numerous possible formats for the pixel data in the EFB.
 However, in the HW accelerated backends we're always using RGBA8
@@ -138,7 +219,27 @@ void ClearScreen(const EFBRectangle &rc)
 			color = RGBA8ToRGB565ToRGBA8(color);
 			z = Z24ToZ16ToZ24(z);
 		}
-		g_renderer->ClearScreen(rc, colorEnable, alphaEnable, zEnable, color, z);
+		// Backend clears are parameter-driven (the values above are resolved
+		// here, not at flush time), so the clear can safely be held back until
+		// something observes the EFB. A compatible follow-up clear just grows
+		// the pending rectangle; each merge saves a full-rate backend clear.
+		if (s_pending_clear.pending && s_pending_clear.colorEnable == colorEnable &&
+			s_pending_clear.alphaEnable == alphaEnable && s_pending_clear.zEnable == zEnable &&
+			s_pending_clear.color == color && s_pending_clear.z == z &&
+			TryMergeClearRect(&s_pending_clear.rc, rc))
+		{
+			INCSTAT(stats.thisFrame.numEFBClearsMerged);
+			return;
+		}
+
+		FlushPendingEFBClear();
+		s_pending_clear.pending = true;
+		s_pending_clear.rc = rc;
+		s_pending_clear.colorEnable = colorEnable;
+		s_pending_clear.alphaEnable = alphaEnable;
+		s_pending_clear.zEnable = zEnable;
+		s_pending_clear.color = color;
+		s_pending_clear.z = z;
 	}
 }
 
@@ -206,6 +307,10 @@ void OnPixelFormatChange()
 		goto skip;
 	}
 
+	// The reinterpretation reads the whole EFB back.
+	FlushPendingEFBClear();
+	FramebufferManagerBase::FlushDeferredXFBCopy();
+	g_efb_peek_version++;
 	g_renderer->ReinterpretPixelData(convtype);
 
 skip:
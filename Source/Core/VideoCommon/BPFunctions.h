@@ -25,6 +25,15 @@ void SetBlendMode();
 void SetLogicOpMode();
 void SetColorMask();
 void ClearScreen(const EFBRectangle &rc);
+// ClearScreen defers the actual backend clear so that consecutive compatible
+// clears (strip-clearing titles issue dozens per frame) consolidate into one.
+// Anything about to read the EFB must flush the pending clear first.
+void FlushPendingEFBClear();
+// Whether a pending clear touches the given region; used by the EFB copy
+// path to keep disjoint strip clears pending across the copies between them.
+bool PendingEFBClearIntersects(const EFBRectangle &rc);
+// Discards a pending clear without issuing it; only for (re)initialization.
+void DropPendingEFBClear();
 void OnPixelFormatChange();
 void SetInterlacingMode(const BPCmd &bp);
 };
\ No newline at end of file
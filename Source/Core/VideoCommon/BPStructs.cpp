@@ -22,6 +22,7 @@
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/PixelEngine.h"
+#include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/Statistics.h"
@@ -48,6 +49,62 @@ static const float s_gammaLUT[] =
 	1.0f
 };
 
+// Registers whose value never feeds GetPixelShaderUID: scissor/line state,
+// perf counters, EFB copy and clear parameters, texture image/TLUT state and
+// TEV color register values. Everything else conservatively invalidates the
+// cached UID - a register may only be listed here if no pixel_shader_uid_data
+// field depends on it.
+static bool BPRegAffectsPixelShaderUID(int address)
+{
+	switch (address)
+	{
+	case BPMEM_SCISSORTL:
+	case BPMEM_SCISSORBR:
+	case BPMEM_LINEPTWIDTH:
+	case BPMEM_PERF0_TRI:
+	case BPMEM_PERF0_QUAD:
+	case BPMEM_SETDRAWDONE:
+	case BPMEM_BUSCLOCK0:
+	case BPMEM_PE_TOKEN_ID:
+	case BPMEM_PE_TOKEN_INT_ID:
+	case BPMEM_EFB_TL:
+	case BPMEM_EFB_BR:
+	case BPMEM_EFB_ADDR:
+	case BPMEM_MIPMAP_STRIDE:
+	case BPMEM_COPYYSCALE:
+	case BPMEM_CLEAR_AR:
+	case BPMEM_CLEAR_GB:
+	case BPMEM_CLEAR_Z:
+	case BPMEM_TRIGGER_EFB_COPY:
+	case BPMEM_COPYFILTER0:
+	case BPMEM_COPYFILTER1:
+	case BPMEM_CLEAR_PIXEL_PERF:
+	case BPMEM_SCISSOROFFSET:
+	case BPMEM_PRELOAD_ADDR:
+	case BPMEM_PRELOAD_TMEMEVEN:
+	case BPMEM_PRELOAD_TMEMODD:
+	case BPMEM_PRELOAD_MODE:
+	case BPMEM_LOADTLUT0:
+	case BPMEM_LOADTLUT1:
+	case BPMEM_TEXINVALIDATE:
+	case BPMEM_PERF1:
+	case BPMEM_BUSCLOCK1:
+	case BPMEM_CONSTANTALPHA:
+	case BPMEM_FOGCOLOR:
+	case BPMEM_BIAS:
+		return false;
+	default:
+		break;
+	}
+	// Texture image/sampler state (0x80-0xBF) and the TEV color registers
+	// (0xE0-0xE7); both only feed constants, never the UID.
+	if (address >= BPMEM_TX_SETMODE0 && address < BPMEM_TEV_COLOR_ENV)
+		return false;
+	if (address >= BPMEM_TEV_COLOR_RA && address < BPMEM_FOGRANGE)
+		return false;
+	return true;
+}
+
 void BPInit()
 {
 	memset(&bpmem, 0, sizeof(bpmem));
@@ -56,6 +113,8 @@ void BPInit()
 	mapTexAddress = 0;
 	numWrites = 0;
 	mapTexFound = false;
+
+	DropPendingEFBClear();
 }
 
 void BPWritten(const BPCmd& bp)
@@ -121,6 +180,9 @@ void BPWritten(const BPCmd& bp)
 
 	((u32*)&bpmem)[bp.address] = bp.newvalue;
 
+	if (BPRegAffectsPixelShaderUID(bp.address))
+		MarkPixelShaderUIDDirty();
+
 	switch (bp.address)
 	{
 	case BPMEM_GENMODE: // Set the Generation Mode
@@ -212,7 +274,12 @@ void BPWritten(const BPCmd& bp)
 		{
 		case 0x02:
 			if (!Fifo::UseDeterministicGPUThread())
+			{
+				// The game may read EFB copy results as soon as it sees the
+				// finish interrupt, so deferred readbacks must land now.
+				g_texture_cache->FlushEFBCopies();
 				PixelEngine::SetFinish(); // may generate interrupt
+			}
 			DEBUG_LOG(VIDEO, "GXSetDrawDone SetPEFinish (value: 0x%02X)", (bp.newvalue & 0xFFFF));
 			return;
 
@@ -223,12 +290,18 @@ void BPWritten(const BPCmd& bp)
 		return;
 	case BPMEM_PE_TOKEN_ID: // Pixel Engine Token ID
 		if (!Fifo::UseDeterministicGPUThread())
+		{
+			g_texture_cache->FlushEFBCopies();
 			PixelEngine::SetToken(static_cast<u16>(bp.newvalue & 0xFFFF), false);
+		}
 		DEBUG_LOG(VIDEO, "SetPEToken 0x%04x", (bp.newvalue & 0xFFFF));
 		return;
 	case BPMEM_PE_TOKEN_INT_ID: // Pixel Engine Interrupt Token ID
 		if (!Fifo::UseDeterministicGPUThread())
+		{
+			g_texture_cache->FlushEFBCopies();
 			PixelEngine::SetToken(static_cast<u16>(bp.newvalue & 0xFFFF), true);
+		}
 		DEBUG_LOG(VIDEO, "SetPEToken + INT 0x%04x", (bp.newvalue & 0xFFFF));
 		return;
 
@@ -253,6 +326,12 @@ void BPWritten(const BPCmd& bp)
 		srcRect.bottom = (int)(bpmem.copyTexSrcXY.y + bpmem.copyTexSrcWH.y + 1);
 		UPE_Copy PE_copy = bpmem.triggerEFBCopy;
 
+		// The copy reads its source rectangle, so a pending clear touching it
+		// has to land first. Disjoint strip clears stay pending and keep
+		// merging across the copies between them.
+		if (PendingEFBClearIntersects(srcRect))
+			FlushPendingEFBClear();
+
 		// Check if we are to copy from the EFB or draw to the XFB
 		if (PE_copy.copy_to_xfb == 0)
 		{
@@ -269,6 +348,7 @@ void BPWritten(const BPCmd& bp)
 			// the number of lines copied is determined by the y scale * source efb height
 
 			BoundingBox::active = false;
+			MarkPixelShaderUIDDirty();
 
 			float yScale;
 			if (PE_copy.scale_invert)
@@ -6,6 +6,7 @@
 #include <cstring>
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
+#include "Common/Swap.h"
 
 class DataReader
 {
@@ -2,15 +2,23 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "Common/FileUtil.h"
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
 
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/CPMemory.h"
 #include "VideoCommon/Debugger.h"
+#include "VideoCommon/RenderBase.h"
 #include "VideoCommon/VideoConfig.h"
+#include "VideoCommon/XFMemory.h"
 
 //void UpdateFPSDisplay(const char *text);
 
@@ -154,3 +162,166 @@ void GFXDebuggerBase::DumpStats(const std::string& path)
 {
 	// TODO
 }
+
+
+namespace GFXStateRecorder
+{
+// Delta words carry the register block in their top bits, the register
+// offset in the rest.
+enum : u32
+{
+	SRC_BP = 0u << 30,
+	SRC_XF = 1u << 30,
+	SRC_CP = 2u << 30,
+	SRC_MASK = 3u << 30,
+};
+
+struct DrawRecord
+{
+	u32 frame;
+	u32 draw;  // index of the draw within its frame
+	u32 num_indices;
+	std::vector<u32> deltas;  // (source | offset, value) pairs
+};
+
+// Budget for the retained delta words, a few MB / several seconds of typical
+// scenes. The first record after arming holds the full state; once it falls
+// off the back, the remaining history is relative but still names every
+// register an expensive draw depends on.
+static const size_t HISTORY_WORD_BUDGET = 1024 * 1024;
+
+static std::atomic<bool> s_armed{ false };
+static std::mutex s_mutex;
+static std::deque<DrawRecord> s_history;  // guarded by s_mutex
+static size_t s_history_words = 0;        // guarded by s_mutex
+
+// Video thread only: the state of the previously captured draw, and the
+// per-frame draw numbering.
+static u32 s_prev_bp[sizeof(BPMemory) / 4];
+static u32 s_prev_xf[sizeof(XFMemory) / 4];
+static u32 s_prev_cp[256];
+static bool s_have_prev = false;
+static int s_prev_frame = -1;
+static u32 s_draw_index = 0;
+
+void Arm()
+{
+	std::lock_guard<std::mutex> lk(s_mutex);
+	s_history.clear();
+	s_history_words = 0;
+	s_have_prev = false;
+	s_prev_frame = -1;
+	s_draw_index = 0;
+	s_armed.store(true, std::memory_order_release);
+}
+
+void Disarm()
+{
+	s_armed.store(false, std::memory_order_release);
+}
+
+bool IsArmed()
+{
+	return s_armed.load(std::memory_order_relaxed);
+}
+
+static void CaptureDeltas(std::vector<u32>* deltas, u32 source, const u32* current,
+	u32* previous, size_t count, bool full)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		if (full || current[i] != previous[i])
+		{
+			deltas->push_back(source | static_cast<u32>(i));
+			deltas->push_back(current[i]);
+		}
+	}
+	memcpy(previous, current, count * sizeof(u32));
+}
+
+void OnDraw(u32 num_indices)
+{
+	if (!IsArmed())
+		return;
+
+	if (frameCount != s_prev_frame)
+	{
+		s_prev_frame = frameCount;
+		s_draw_index = 0;
+	}
+
+	DrawRecord record;
+	record.frame = static_cast<u32>(frameCount);
+	record.draw = s_draw_index++;
+	record.num_indices = num_indices;
+
+	u32 cp[256];
+	FillCPMemoryArray(cp);
+
+	const bool full = !s_have_prev;
+	CaptureDeltas(&record.deltas, SRC_BP, reinterpret_cast<const u32*>(&bpmem), s_prev_bp,
+		sizeof(BPMemory) / 4, full);
+	CaptureDeltas(&record.deltas, SRC_XF, reinterpret_cast<const u32*>(&xfmem), s_prev_xf,
+		sizeof(XFMemory) / 4, full);
+	CaptureDeltas(&record.deltas, SRC_CP, cp, s_prev_cp, 256, full);
+	s_have_prev = true;
+
+	std::lock_guard<std::mutex> lk(s_mutex);
+	s_history_words += record.deltas.size() + 4;
+	s_history.push_back(std::move(record));
+	while (s_history_words > HISTORY_WORD_BUDGET && s_history.size() > 1)
+	{
+		s_history_words -= s_history.front().deltas.size() + 4;
+		s_history.pop_front();
+	}
+}
+
+bool Save(const std::string& filename)
+{
+	// Work on a copy so capture continues while the text is formatted.
+	std::deque<DrawRecord> history;
+	{
+		std::lock_guard<std::mutex> lk(s_mutex);
+		if (s_history.empty())
+			return false;
+		history = s_history;
+	}
+
+	std::string output;
+	output.reserve(history.size() * 64);
+	for (const DrawRecord& record : history)
+	{
+		output += StringFromFormat("frame %u draw %u indices %u\n", record.frame, record.draw,
+			record.num_indices);
+		for (size_t i = 0; i + 1 < record.deltas.size(); i += 2)
+		{
+			const u32 offset = record.deltas[i] & ~SRC_MASK;
+			const u32 value = record.deltas[i + 1];
+			switch (record.deltas[i] & SRC_MASK)
+			{
+			case SRC_BP:
+			{
+				// GetBPRegInfo parses a big-endian BP load: register id
+				// followed by the 24-bit payload.
+				u8 cmd[4] = { static_cast<u8>(offset), static_cast<u8>(value >> 16),
+					static_cast<u8>(value >> 8), static_cast<u8>(value) };
+				std::string name, desc;
+				GetBPRegInfo(cmd, &name, &desc);
+				output += StringFromFormat("  bp[0x%02x] = 0x%08x  %s\n", offset, value,
+					name.c_str());
+				break;
+			}
+			case SRC_XF:
+				output += StringFromFormat("  xf[0x%04x] = 0x%08x\n", offset, value);
+				break;
+			case SRC_CP:
+				output += StringFromFormat("  cp[0x%02x] = 0x%08x\n", offset, value);
+				break;
+			}
+		}
+	}
+
+	return File::WriteStringToFile(output, filename);
+}
+
+}  // namespace GFXStateRecorder
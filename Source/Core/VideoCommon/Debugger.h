@@ -53,6 +53,24 @@ enum PauseEvent
 	NEXT_ERROR = 1 << 14, // TODO
 };
 
+// Continuous GPU state flight recorder. While armed, the BP/XF/CP register
+// deltas of every draw are captured into a bounded history, cheap enough to
+// leave running at full speed; the history is saved on hotkey alongside the
+// FIFO flight recording, so the exact TEV/xform state an expensive draw used
+// can be inspected without pausing or attaching a graphics debugger.
+namespace GFXStateRecorder
+{
+void Arm();
+void Disarm();
+bool IsArmed();
+
+// Video thread: capture the state the upcoming draw will be rendered with.
+void OnDraw(u32 num_indices);
+
+// Writes the retained history as text. Capture continues afterwards.
+bool Save(const std::string& filename);
+}
+
 extern GFXDebuggerBase *g_pdebugger;
 extern volatile bool GFXDebuggerPauseFlag;
 extern volatile PauseEvent GFXDebuggerToPauseAtNext;
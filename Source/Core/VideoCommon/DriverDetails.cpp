@@ -54,6 +54,12 @@ static BugInfo m_known_bugs[] = {
 	BUG_BROKEN_NEGATED_BOOLEAN, -1.0, -1.0, true },
 	{ API_OPENGL, OS_ALL, VENDOR_QUALCOMM, DRIVER_QUALCOMM, Family::UNKNOWN,
 	BUG_BROKEN_EXPLICIT_FLUSH, -1.0, -1.0, true },
+	{ API_OPENGL, OS_ALL, VENDOR_QUALCOMM, DRIVER_QUALCOMM, Family::UNKNOWN,
+	BUG_SLOW_GEOMETRY_SHADERS, -1.0, -1.0, true },
+	{ API_OPENGL, OS_ALL, VENDOR_ARM, DRIVER_ARM, Family::UNKNOWN, BUG_SLOW_GEOMETRY_SHADERS, -1.0,
+	-1.0, true },
+	{ API_OPENGL, OS_ALL, VENDOR_IMGTEC, DRIVER_IMGTEC, Family::UNKNOWN, BUG_SLOW_GEOMETRY_SHADERS,
+	-1.0, -1.0, true },
 	{ API_OPENGL, OS_ALL, VENDOR_ARM, DRIVER_ARM, Family::UNKNOWN, BUG_BROKEN_BUFFER_STREAM, -1.0,
 	-1.0, true },
 	{ API_OPENGL, OS_ALL, VENDOR_ARM, DRIVER_ARM, Family::UNKNOWN, BUG_BROKEN_VSYNC, -1.0, -1.0,
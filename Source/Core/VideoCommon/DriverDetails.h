@@ -240,6 +240,16 @@ enum Bug
 	// sometimes this happens in the kernel mode part of the driver resulting in a BSOD.
 	// Disable dual-source blending support for now.
 	BUG_BROKEN_DUAL_SOURCE_BLENDING,
+
+	// Bug: The geometry shader stage is disproportionately expensive
+	// Affected Devices: Qualcomm, ARM Mali, PowerVR
+	// Started Version: -1
+	// Ended Version: -1
+	// Tiled renderers run their binning pass per geometry shader output, so even a
+	// passthrough-ish geometry shader (like our stereoscopy expansion) can halve the
+	// framerate. Where the driver allows writing gl_Layer from the vertex shader, we
+	// render stereoscopy with two instances and no geometry stage instead.
+	BUG_SLOW_GEOMETRY_SHADERS,
 };
 
 // Initializes our internal vendor, device family, and driver version
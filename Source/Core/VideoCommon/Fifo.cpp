@@ -2,6 +2,7 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <atomic>
 #include <cstring>
 
@@ -10,6 +11,7 @@
 #include "Common/BlockingLoop.h"
 #include "Common/ChunkFile.h"
 #include "Common/Event.h"
+#include "Common/EventTrace.h"
 #include "Common/FPURoundMode.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
@@ -36,6 +38,10 @@ namespace Fifo
 {
 static constexpr u32 FIFO_SIZE = 2 * 1024 * 1024;
 static constexpr int GPU_TIME_SLOT_SIZE = 1000;
+// Maximum number of 32-byte blocks RunGpuLoop() pulls out of the emulated
+// FIFO in one copy/publication step. Bounded so CP status (watermarks,
+// interrupts) is still updated with reasonable granularity.
+static constexpr u32 MAX_FIFO_READ_BLOCKS = 16;
 
 static Common::BlockingLoop s_gpu_mainloop;
 
@@ -50,6 +56,13 @@ static u8* s_fifo_aux_read_ptr;
 // and can change at runtime.
 static bool s_use_deterministic_gpu_thread;
 
+// Bounded-sync determinism: run the ordinary dual-core GPU thread, but force
+// the SyncGPU skew budget on even if the user hasn't enabled SyncGPU, so the
+// threads can never drift apart by more than iSyncGpuMaxDistance cycles.
+// Toggled together with s_use_deterministic_gpu_thread in
+// UpdateWantDeterminism, i.e. only while we are paused.
+static bool s_use_bounded_sync;
+
 static CoreTiming::EventType* s_event_sync_gpu;
 
 // STATE_TO_SAVE
@@ -118,6 +131,8 @@ void Init()
 	ResetVideoBuffer();
 	if (SConfig::GetInstance().bCPUThread)
 		s_gpu_mainloop.Prepare();
+	s_gpu_mainloop.SetWaitSiteName("Fifo::SyncGPU");
+	s_sync_wakeup_event.SetWaitSite(Common::GetWaitSite("Fifo::SyncGPU wakeup"));
 	s_sync_ticks.store(0);
 }
 
@@ -160,6 +175,10 @@ void EmulatorState(bool running)
 
 void SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
 {
+	// Syncing only makes sense once everything the CPU produced has actually
+	// been handed over, including any write-combined EFB pokes.
+	AsyncRequests::GetInstance()->FlushEFBPokes();
+
 	if (s_use_deterministic_gpu_thread)
 	{
 		s_gpu_mainloop.Wait();
@@ -223,9 +242,11 @@ void* PopFifoAuxBuffer(size_t size)
 }
 
 // Description: RunGpuLoop() sends data through this function.
-static void ReadDataFromFifo(u32 readPtr)
+// num_blocks 32-byte blocks are copied in one go; the caller guarantees they
+// are contiguous in the emulated FIFO (no CPEnd wraparound in between).
+static void ReadDataFromFifo(u32 readPtr, u32 num_blocks)
 {
-	size_t len = 32;
+	size_t len = 32 * num_blocks;
 	if (len > (size_t)(s_video_buffer + FIFO_SIZE - s_video_buffer_write_ptr))
 	{
 		size_t existing_len = s_video_buffer_write_ptr - s_video_buffer_read_ptr;
@@ -333,35 +354,47 @@ void RunGpuLoop()
 			while (!CommandProcessor::IsInterruptWaiting() && fifo.bFF_GPReadEnable &&
 				fifo.CPReadWriteDistance && !AtBreakpoint())
 			{
-				if (param.bSyncGPU && s_sync_ticks.load() < param.iSyncGpuMinDistance)
+				if ((param.bSyncGPU || s_use_bounded_sync) &&
+					s_sync_ticks.load() < param.iSyncGpuMinDistance)
 					break;
 
 				u32 cyclesExecuted = 0;
 				u32 readPtr = fifo.CPReadPointer;
-				ReadDataFromFifo(readPtr);
 
-				if (readPtr == fifo.CPEnd)
+				// Batch contiguous blocks into a single copy and write pointer
+				// publication. Fall back to single stepping while a breakpoint
+				// is armed, so we can never read past it.
+				u32 num_blocks = 1;
+				if (!fifo.bFF_BPEnable)
+				{
+					num_blocks = std::min(std::max(fifo.CPReadWriteDistance / 32, 1u), MAX_FIFO_READ_BLOCKS);
+					num_blocks = std::min(num_blocks, (fifo.CPEnd - readPtr) / 32 + 1);
+				}
+				const u32 bytes_read = 32 * num_blocks;
+				ReadDataFromFifo(readPtr, num_blocks);
+
+				if (readPtr + bytes_read - 32 == fifo.CPEnd)
 					readPtr = fifo.CPBase;
 				else
-					readPtr += 32;
+					readPtr += bytes_read;
 
-				_assert_msg_(COMMANDPROCESSOR, (s32)fifo.CPReadWriteDistance - 32 >= 0,
+				_assert_msg_(COMMANDPROCESSOR, (s32)fifo.CPReadWriteDistance - (s32)bytes_read >= 0,
 					"Negative fifo.CPReadWriteDistance = %i in FIFO Loop !\nThat can produce "
 					"instability in the game. Please report it.",
-					fifo.CPReadWriteDistance - 32);
+					fifo.CPReadWriteDistance - bytes_read);
 
 				u8* write_ptr = s_video_buffer_write_ptr;
 				g_VideoData.SetReadPosition(s_video_buffer_read_ptr, write_ptr);
 				s_video_buffer_read_ptr = OpcodeDecoder::Run(g_VideoData, &cyclesExecuted);
 
 				Common::AtomicStore(fifo.CPReadPointer, readPtr);
-				Common::AtomicAdd(fifo.CPReadWriteDistance, -32);
+				Common::AtomicAdd(fifo.CPReadWriteDistance, 0 - bytes_read);
 				if ((write_ptr - s_video_buffer_read_ptr) == 0)
 					Common::AtomicStore(fifo.SafeCPReadPointer, fifo.CPReadPointer);
 
 				CommandProcessor::SetCPStatusFromGPU();
 
-				if (param.bSyncGPU)
+				if (param.bSyncGPU || s_use_bounded_sync)
 				{
 					cyclesExecuted = (int)(cyclesExecuted / param.fSyncGpuOverclock);
 					int old = s_sync_ticks.fetch_sub(cyclesExecuted);
@@ -429,7 +462,7 @@ void RunGpu()
 
 	// if the sync GPU callback is suspended, wake it up.
 	if (!SConfig::GetInstance().bCPUThread || s_use_deterministic_gpu_thread ||
-		SConfig::GetInstance().bSyncGPU)
+		SConfig::GetInstance().bSyncGPU || s_use_bounded_sync)
 	{
 		if (s_syncing_suspended)
 		{
@@ -460,7 +493,7 @@ static int RunGpuOnCpu(int ticks)
 				FPURoundMode::LoadDefaultSIMDState();
 				reset_simd_state = true;
 			}
-			ReadDataFromFifo(fifo.CPReadPointer);
+			ReadDataFromFifo(fifo.CPReadPointer, 1);
 			u32 cycles = 0;
 			g_VideoData.SetReadPosition(s_video_buffer_read_ptr, s_video_buffer_write_ptr);
 				s_video_buffer_read_ptr = OpcodeDecoder::Run(g_VideoData, &cycles);
@@ -507,6 +540,9 @@ void UpdateWantDeterminism(bool want)
 	case GPU_DETERMINISM_NONE:
 		gpu_thread = false;
 		break;
+	case GPU_DETERMINISM_BOUNDED_SYNC:
+		gpu_thread = false;
+		break;
 	case GPU_DETERMINISM_FAKE_COMPLETION:
 		gpu_thread = true;
 		break;
@@ -514,6 +550,9 @@ void UpdateWantDeterminism(bool want)
 
 	gpu_thread = gpu_thread && param.bCPUThread;
 
+	s_use_bounded_sync = want && param.bCPUThread &&
+		param.m_GPUDeterminismMode == GPU_DETERMINISM_BOUNDED_SYNC;
+
 	if (s_use_deterministic_gpu_thread != gpu_thread)
 	{
 		s_use_deterministic_gpu_thread = gpu_thread;
@@ -544,6 +583,10 @@ static int WaitForGpuThread(int ticks)
 	int old = s_sync_ticks.fetch_add(ticks);
 	int now = old + ticks;
 
+	// The current CPU-GPU skew in cycles; trace it so the distribution (and
+	// how often we hit the hard budget) is visible on the timeline.
+	TRACE_COUNTER("cpu-gpu skew", now);
+
 	// GPU is idle, so stop polling.
 	if (old >= 0 && s_gpu_mainloop.IsDone())
 		return -1;
@@ -558,7 +601,10 @@ static int WaitForGpuThread(int ticks)
 
 	// Wait for GPU
 	if (now >= param.iSyncGpuMaxDistance)
+	{
+		TRACE_EVENT("Fifo::WaitForGpuThread");
 		s_sync_wakeup_event.Wait();
+	}
 
 	return GPU_TIME_SLOT_SIZE;
 }
@@ -572,7 +618,7 @@ static void SyncGPUCallback(u64 ticks, s64 cyclesLate)
 	{
 		next = RunGpuOnCpu((int)ticks);
 	}
-	else if (SConfig::GetInstance().bSyncGPU)
+	else if (SConfig::GetInstance().bSyncGPU || s_use_bounded_sync)
 	{
 		next = WaitForGpuThread((int)ticks);
 	}
@@ -0,0 +1,73 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Common/CommonTypes.h"
+#include "Common/Thread.h"
+#include "Common/Timer.h"
+#include "VideoCommon/FramePacer.h"
+#include "VideoCommon/VideoConfig.h"
+
+static constexpr u64 PACING_REFRESH_INTERVAL = 1000;
+// Sleep in 1ms steps until this close to the present slot, then spin;
+// OS sleep granularity is too coarse to hit the slot directly.
+static constexpr u64 PACING_SPIN_WINDOW_US = 2000;
+
+FramePacer::FramePacer()
+{
+	m_update_time.Update();
+}
+
+void FramePacer::ScheduleNextPresent(u32 target_refresh_rate)
+{
+	if (!g_ActiveConfig.bFramePacing || target_refresh_rate == 0)
+		return;
+
+	const u64 target = 1000000 / target_refresh_rate;
+	u64 now = Common::Timer::GetTimeUs();
+
+	// Resync the cadence grid after startup, a stutter or a rate change
+	// instead of rushing presents out to catch up.
+	if (m_next_present_time <= now || m_next_present_time > now + 2 * target)
+	{
+		m_next_present_time = now + target;
+		return;
+	}
+
+	while (now < m_next_present_time)
+	{
+		if (m_next_present_time - now > PACING_SPIN_WINDOW_US)
+			Common::SleepCurrentThread(1);
+		now = Common::Timer::GetTimeUs();
+	}
+	m_next_present_time += target;
+}
+
+void FramePacer::Update()
+{
+	const u64 now = Common::Timer::GetTimeUs();
+	if (m_last_present_time)
+	{
+		const u64 interval = now - m_last_present_time;
+		m_accumulated_time += interval;
+		m_present_counter++;
+
+		// Deviation is measured against the last published average, which is
+		// stable enough over a one second window to make jitter meaningful.
+		const u64 deviation =
+			interval > m_interval ? interval - m_interval : m_interval - interval;
+		if (m_interval && deviation > m_max_deviation)
+			m_max_deviation = deviation;
+	}
+	m_last_present_time = now;
+
+	if (m_update_time.GetTimeDifference() >= PACING_REFRESH_INTERVAL && m_present_counter)
+	{
+		m_update_time.Update();
+		m_interval = (u32)(m_accumulated_time / m_present_counter);
+		m_jitter = (u32)m_max_deviation;
+		m_accumulated_time = 0;
+		m_present_counter = 0;
+		m_max_deviation = 0;
+	}
+}
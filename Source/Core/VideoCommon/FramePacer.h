@@ -0,0 +1,47 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+#include "Common/Timer.h"
+
+class FramePacer
+{
+public:
+	FramePacer();
+
+	// Called right before the backend presents a frame. When frame pacing is
+	// enabled this blocks until the next slot on the target cadence grid, so
+	// presents are evenly spaced at the emulated refresh rate. On displays
+	// running at a multiple of that rate this yields clean pulldown (each
+	// 60Hz frame is shown for exactly two vsyncs of a 120Hz display).
+	void ScheduleNextPresent(u32 target_refresh_rate);
+
+	// Called right after the backend presents (updated every second).
+	void Update();
+
+	// Average present-to-present time over the last second, in microseconds.
+	u32 GetPresentIntervalUs() const
+	{
+		return m_interval;
+	}
+
+	// Largest deviation from that average seen over the last second.
+	u32 GetPresentJitterUs() const
+	{
+		return m_jitter;
+	}
+
+private:
+	u64 m_last_present_time = 0;
+	u64 m_next_present_time = 0;
+
+	u64 m_accumulated_time = 0;
+	u64 m_max_deviation = 0;
+	u32 m_present_counter = 0;
+	u32 m_interval = 0;
+	u32 m_jitter = 0;
+	Common::Timer m_update_time;
+};
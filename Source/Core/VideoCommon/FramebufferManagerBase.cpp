@@ -14,6 +14,7 @@ std::unique_ptr<FramebufferManagerBase> g_framebuffer_manager;
 
 std::unique_ptr<XFBSourceBase> FramebufferManagerBase::m_realXFBSource; // Only used in Real XFB mode
 FramebufferManagerBase::VirtualXFBListType FramebufferManagerBase::m_virtualXFBList; // Only used in Virtual XFB mode
+FramebufferManagerBase::DeferredXFBCopy FramebufferManagerBase::m_deferred_copy; // Only used with XFBDirectPresent
 std::array<const XFBSourceBase*, FramebufferManagerBase::MAX_VIRTUAL_XFB> FramebufferManagerBase::m_overlappingXFBArray;
 
 unsigned int FramebufferManagerBase::s_last_xfb_width = 1;
@@ -33,6 +34,7 @@ FramebufferManagerBase::~FramebufferManagerBase()
 	// (they really shouldn't be and should be refactored at some point).
 	m_virtualXFBList.clear();
 	m_realXFBSource.reset();
+	m_deferred_copy.pending = false;
 }
 
 const XFBSourceBase* const* FramebufferManagerBase::GetXFBSource(u32 xfbAddr, u32 fbWidth, u32 fbHeight, u32* xfbCountP)
@@ -120,10 +122,62 @@ void FramebufferManagerBase::CopyToXFB(u32 xfbAddr, u32 fbStride, u32 fbHeight,
 	}
 	else
 	{
+		if (g_ActiveConfig.bXFBDirectPresent)
+		{
+			// Pass-through detection: hold the copy back instead of performing
+			// it. If the present consumes it before anything writes the EFB,
+			// the copy (and its full-resolution memory traffic) never happens;
+			// the first EFB write materializes it with the EFB still intact.
+			if (m_deferred_copy.pending && m_deferred_copy.xfbAddr != xfbAddr)
+				FlushDeferredXFBCopy();
+			m_deferred_copy.pending = true;
+			m_deferred_copy.xfbAddr = xfbAddr;
+			m_deferred_copy.fbStride = fbStride;
+			m_deferred_copy.fbHeight = fbHeight;
+			m_deferred_copy.sourceRc = sourceRc;
+			m_deferred_copy.gamma = Gamma;
+			return;
+		}
 		CopyToVirtualXFB(xfbAddr, fbStride, fbHeight, sourceRc, Gamma);
 	}
 }
 
+void FramebufferManagerBase::FlushDeferredXFBCopy()
+{
+	if (!m_deferred_copy.pending)
+		return;
+
+	m_deferred_copy.pending = false;
+	CopyToVirtualXFB(m_deferred_copy.xfbAddr, m_deferred_copy.fbStride, m_deferred_copy.fbHeight,
+		m_deferred_copy.sourceRc, m_deferred_copy.gamma);
+}
+
+bool FramebufferManagerBase::ConsumeDeferredXFBCopy(u32 xfbAddr, u32 fbWidth, u32 fbHeight, EFBRectangle* source_rc, float* gamma)
+{
+	if (!m_deferred_copy.pending)
+		return false;
+
+	if (m_deferred_copy.xfbAddr == xfbAddr)
+	{
+		// Nothing has touched the EFB since the copy was requested, so the EFB
+		// is exactly the image being presented.
+		*source_rc = m_deferred_copy.sourceRc;
+		*gamma = m_deferred_copy.gamma;
+		return true;
+	}
+
+	// Presenting some other XFB. If its range overlaps the deferred target,
+	// the virtual XFB texture there is stale, so materialize the copy first.
+	const u32 presentLower = xfbAddr;
+	const u32 presentUpper = xfbAddr + 2 * fbWidth * fbHeight;
+	const u32 copyLower = m_deferred_copy.xfbAddr;
+	const u32 copyUpper = m_deferred_copy.xfbAddr + 2 * m_deferred_copy.fbStride * m_deferred_copy.fbHeight;
+	if (AddressRangesOverlap(presentLower, presentUpper, copyLower, copyUpper))
+		FlushDeferredXFBCopy();
+
+	return false;
+}
+
 void FramebufferManagerBase::CopyToVirtualXFB(u32 xfbAddr, u32 fbStride, u32 fbHeight, const EFBRectangle& sourceRc, float Gamma)
 {
 	if (!g_framebuffer_manager)
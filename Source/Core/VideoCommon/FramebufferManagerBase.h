@@ -52,6 +52,18 @@ public:
 	static void CopyToXFB(u32 xfbAddr, u32 fbStride, u32 fbHeight, const EFBRectangle& sourceRc, float Gamma);
 	static const XFBSourceBase* const* GetXFBSource(u32 xfbAddr, u32 fbWidth, u32 fbHeight, u32* xfbCount);
 
+	// Deferred-copy support for the XFBDirectPresent hack. With the hack
+	// enabled, CopyToXFB holds the virtual XFB copy back instead of performing
+	// it; anything about to modify the EFB must call FlushDeferredXFBCopy()
+	// first so a materialized copy still sees the presented image.
+	static void FlushDeferredXFBCopy();
+	// Called at present time. Returns true if the deferred copy is the source
+	// of the given XFB, in which case the EFB itself still holds the presented
+	// image and the copy can be skipped entirely; fills in the EFB rectangle
+	// and gamma to draw with. The copy stays deferred, in case the region is
+	// presented again or written later.
+	static bool ConsumeDeferredXFBCopy(u32 xfbAddr, u32 fbWidth, u32 fbHeight, EFBRectangle* source_rc, float* gamma);
+
 	static void SetLastXfbWidth(unsigned int width)
 	{
 		s_last_xfb_width = width;
@@ -110,8 +122,19 @@ private:
 	static const XFBSourceBase* const* GetRealXFBSource(u32 xfbAddr, u32 fbWidth, u32 fbHeight, u32* xfbCount);
 	static const XFBSourceBase* const* GetVirtualXFBSource(u32 xfbAddr, u32 fbWidth, u32 fbHeight, u32* xfbCount);
 
+	struct DeferredXFBCopy
+	{
+		bool pending = false;
+		u32 xfbAddr = 0;
+		u32 fbStride = 0;
+		u32 fbHeight = 0;
+		EFBRectangle sourceRc;
+		float gamma = 1.0f;
+	};
+
 	static std::unique_ptr<XFBSourceBase> m_realXFBSource; // Only used in Real XFB mode
 	static VirtualXFBListType m_virtualXFBList; // Only used in Virtual XFB mode
+	static DeferredXFBCopy m_deferred_copy; // Only used with XFBDirectPresent
 
 	static std::array<const XFBSourceBase*, MAX_VIRTUAL_XFB> m_overlappingXFBArray;
 
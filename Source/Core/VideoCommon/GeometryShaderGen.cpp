@@ -37,6 +37,11 @@ void GetGeometryShaderUid(GeometryShaderUid& out, u32 primitive_type, const XFMe
 	uid_data.msaa = g_ActiveConfig.iMultisamples > 1;
 	uid_data.ssaa = g_ActiveConfig.iMultisamples > 1 && g_ActiveConfig.bSSAA;
 	uid_data.stereo = g_ActiveConfig.iStereoMode > 0;
+	// When the vertex shader handles eye selection, triangles don't need the
+	// geometry stage at all; IsPassthrough() then lets the backend skip it.
+	if (uid_data.stereo && primitive_type == PRIMITIVE_TRIANGLES &&
+		g_ActiveConfig.UseVertexShaderLayerStereo())
+		uid_data.stereo = 0;
 	uid_data.numTexGens = xfr.numTexGen.numTexGens;
 	uid_data.pixel_lighting = g_ActiveConfig.PixelLightingEnabled(xfr, components);
 	out.CalculateUIDHash();
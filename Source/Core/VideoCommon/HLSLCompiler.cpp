@@ -58,6 +58,7 @@ void ShaderCompilerWorkUnit::Release()
 
 HLSLAsyncCompiler::HLSLAsyncCompiler() :
 	m_repositoryIndex(0),
+	m_unitsInFlight(0),
 	m_input(256),
 	m_output(256)
 {
@@ -103,6 +104,7 @@ bool HLSLAsyncCompiler::NextTask()
 ShaderCompilerWorkUnit* HLSLAsyncCompiler::NewUnit(u32 codesize)
 {
 	Common::ThreadPool::NotifyWorkPending();
+	m_unitsInFlight.fetch_add(1);
 	u32 index = m_repositoryIndex.fetch_add(1);
 	ShaderCompilerWorkUnit* result = &WorkUnitRepository[index & 255];
 	result->Clear();
@@ -125,6 +127,7 @@ void HLSLAsyncCompiler::ProcCompilationResults()
 		while (m_output.try_pop(unit))
 		{
 			unit->ResultHandler(unit);
+			m_unitsInFlight.fetch_sub(1);
 		}
 	}
 }
@@ -149,10 +152,23 @@ void HLSLAsyncCompiler::WaitForFinish()
 		while (m_output.try_pop(unit))
 		{
 			unit->ResultHandler(unit);
+			m_unitsInFlight.fetch_sub(1);
 		}
 	}
 }
 
+void HLSLAsyncCompiler::WaitForRepositorySlot()
+{
+	// Keep a good margin below the 256 units backing NewUnit(): the producer
+	// may allocate a few more units before the next call to this function.
+	u32 loopcount = 0;
+	while (m_unitsInFlight.load() >= 192)
+	{
+		ProcCompilationResults();
+		Common::cYield(loopcount++);
+	}
+}
+
 
 
 HLSLCompiler& HLSLCompiler::getInstance()
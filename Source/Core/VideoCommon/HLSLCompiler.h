@@ -39,6 +39,7 @@ class HLSLAsyncCompiler final : Common::IWorker
 	pD3DCompile PD3DCompile;
 	HLSLAsyncCompiler();
 	std::atomic<s32> m_repositoryIndex;
+	std::atomic<s32> m_unitsInFlight;
 	ShaderCompilerWorkUnit* WorkUnitRepository;
 	Common::ManyToManyQueue<ShaderCompilerWorkUnit*, Common::CircularQueue<ShaderCompilerWorkUnit*>> m_input;
 	Common::ManyToOneQueue<ShaderCompilerWorkUnit*, Common::CircularQueue<ShaderCompilerWorkUnit*>> m_output;
@@ -55,6 +56,11 @@ public:
 	bool CompilationFinished();
 	void WaitForCompilationFinished();
 	void WaitForFinish();
+	// Blocks until the fixed-size work unit repository has room again,
+	// draining finished results while waiting. Needed by the boot-time
+	// warm-up loops, which push whole UID databases at once and must not
+	// lap the in-flight tail of the repository.
+	void WaitForRepositorySlot();
 };
 
 class HLSLCompiler
@@ -9,6 +9,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 #include <xxhash.h>
@@ -79,6 +80,67 @@ struct HiresTextureCacheItem
 typedef std::unordered_map<std::string, HiresTextureCacheItem> HiresTextureCache;
 static HiresTextureCache s_textureMap;
 
+// Negative cache over the scanned pack, rebuilt together with s_textureMap:
+// a bloom filter of every texture name plus an exact set of the
+// width/height/mipmap/format combinations the pack contains. Search() rejects
+// names missing from the filter with one short hash and two bit tests, and
+// GenBaseName() skips hashing the texture contents entirely when no file in
+// the pack even has matching dimensions.
+static u64 s_name_bloom[1024];  // 65536 bits, two probes per name
+static std::unordered_set<u64> s_dimension_index;
+
+static u64 DimensionKey(u32 width, u32 height, bool has_mipmaps, int format)
+{
+	return (u64(width) << 40) | (u64(height & 0xFFFFFF) << 16) | (has_mipmaps ? 0x8000 : 0) |
+		(format & 0x7FFF);
+}
+
+// Extracts the fields GenBaseName embeds in a new-format name. Returns false
+// for old-format (game id based) names, which are hashed with the cheaper
+// sampled hash and not worth gating.
+static bool ParseDimensionKey(const std::string& name, u64* key)
+{
+	u32 width = 0;
+	u32 height = 0;
+	int pos = 0;
+	if (sscanf(name.c_str(), "tex1_%ux%u%n", &width, &height, &pos) != 2)
+		return false;
+	const bool has_mipmaps = name.compare(pos, 2, "_m") == 0;
+	const size_t fmt_pos = name.find_last_of('_');
+	int format = 0;
+	if (fmt_pos == std::string::npos || sscanf(name.c_str() + fmt_pos + 1, "%d", &format) != 1)
+		return false;
+	*key = DimensionKey(width, height, has_mipmaps, format);
+	return true;
+}
+
+static void PackIndexAdd(const std::string& name)
+{
+	const u64 h = XXH64(name.data(), name.size(), 0);
+	const u32 bit1 = h & 0xFFFF;
+	const u32 bit2 = (h >> 32) & 0xFFFF;
+	s_name_bloom[bit1 >> 6] |= u64(1) << (bit1 & 63);
+	s_name_bloom[bit2 >> 6] |= u64(1) << (bit2 & 63);
+	u64 key;
+	if (ParseDimensionKey(name, &key))
+		s_dimension_index.insert(key);
+}
+
+static bool PackIndexTest(const std::string& name)
+{
+	const u64 h = XXH64(name.data(), name.size(), 0);
+	const u32 bit1 = h & 0xFFFF;
+	const u32 bit2 = (h >> 32) & 0xFFFF;
+	return (s_name_bloom[bit1 >> 6] & (u64(1) << (bit1 & 63))) != 0 &&
+		(s_name_bloom[bit2 >> 6] & (u64(1) << (bit2 & 63))) != 0;
+}
+
+static void PackIndexClear()
+{
+	memset(s_name_bloom, 0, sizeof(s_name_bloom));
+	s_dimension_index.clear();
+}
+
 static std::unordered_map<std::string, std::shared_ptr<HiresTexture>> s_textureCache;
 static std::mutex s_textureCacheMutex;
 static Common::Flag s_textureCacheAbortLoading;
@@ -87,8 +149,118 @@ static bool s_check_native_format;
 static bool s_check_new_format;
 static std::atomic<size_t> size_sum;
 static size_t max_mem = 0;
+static std::atomic<u64> s_use_counter;
 static std::thread s_prefetcher;
 
+// Baked pack archive. The first full pass over a pack (the prefetcher)
+// writes every texture's final upload-ready buffer - decoded, packed and
+// with all present mip levels - into one indexed file next to the other
+// caches. As long as the pack's source files are unchanged, later runs
+// serve Load() straight out of that archive with a single read, so the
+// per-texture PNG decode cost is only ever paid once per pack revision.
+struct BakedEntry
+{
+	PC_TexFormat format;
+	u32 width;
+	u32 height;
+	u32 levels;
+	u32 nrm_levels;
+	bool emissive_in_color;
+	u64 data_offset;
+	u64 data_size;
+};
+static const u32 BAKE_MAGIC = 0x31425448;  // "HTB1"
+static std::unordered_map<std::string, BakedEntry> s_bake_index;
+static File::IOFile s_bake_file;
+static std::mutex s_bake_mutex;
+static u64 s_bake_fingerprint;
+static bool s_bake_valid;
+
+static std::string GetBakePath()
+{
+	return File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".htb";
+}
+
+// Summarizes the scanned pack so a stale archive is never used: one hash per
+// source file over its path, size and mtime, combined order-independently so
+// directory enumeration order cannot force a rebake. The material build
+// settings are part of the seed because they change what Load() produces.
+static u64 ComputePackFingerprint()
+{
+	const u64 seed = (g_ActiveConfig.bHiresMaterialMapsBuild ? 1 : 0) |
+		(g_ActiveConfig.HiresMaterialMapsEnabled() ? 2 : 0);
+	u64 fingerprint = XXH64(&seed, sizeof(seed), 0);
+	for (const auto& entry : s_textureMap)
+	{
+		for (const auto& map : entry.second.maps)
+		{
+			for (const hires_mip_level& mip : map)
+			{
+				if (mip.path.empty())
+					continue;
+				u64 meta[2] = { File::GetSize(mip.path), File::GetModTime(mip.path) };
+				fingerprint += XXH64(mip.path.data(), mip.path.size(), XXH64(meta, sizeof(meta), seed));
+			}
+		}
+	}
+	return fingerprint;
+}
+
+// Called with s_bake_mutex held. Opens the archive and walks its entry table;
+// any inconsistency just drops the archive and the pack loads from source.
+static bool LoadBakeIndex(u64 fingerprint)
+{
+	s_bake_index.clear();
+	s_bake_file.Close();
+	if (!s_bake_file.Open(GetBakePath(), "rb"))
+		return false;
+
+	u32 magic = 0;
+	u64 baked_fingerprint = 0;
+	u32 count = 0;
+	if (!s_bake_file.ReadBytes(&magic, sizeof(magic)) || magic != BAKE_MAGIC ||
+		!s_bake_file.ReadBytes(&baked_fingerprint, sizeof(baked_fingerprint)) ||
+		baked_fingerprint != fingerprint || !s_bake_file.ReadBytes(&count, sizeof(count)))
+	{
+		s_bake_file.Close();
+		return false;
+	}
+
+	for (u32 i = 0; i < count; i++)
+	{
+		u32 name_len = 0;
+		if (!s_bake_file.ReadBytes(&name_len, sizeof(name_len)) || name_len > 1024)
+			break;
+		std::string name(name_len, '\0');
+		BakedEntry entry;
+		u32 format = 0;
+		if (!s_bake_file.ReadBytes(&name[0], name_len) ||
+			!s_bake_file.ReadBytes(&format, sizeof(format)) ||
+			!s_bake_file.ReadBytes(&entry.width, sizeof(entry.width)) ||
+			!s_bake_file.ReadBytes(&entry.height, sizeof(entry.height)) ||
+			!s_bake_file.ReadBytes(&entry.levels, sizeof(entry.levels)) ||
+			!s_bake_file.ReadBytes(&entry.nrm_levels, sizeof(entry.nrm_levels)) ||
+			!s_bake_file.ReadBytes(&entry.emissive_in_color, sizeof(entry.emissive_in_color)) ||
+			!s_bake_file.ReadBytes(&entry.data_size, sizeof(entry.data_size)))
+		{
+			break;
+		}
+		entry.format = static_cast<PC_TexFormat>(format);
+		entry.data_offset = s_bake_file.Tell();
+		if (!s_bake_file.Seek(entry.data_size, SEEK_CUR))
+			break;
+		s_bake_index.emplace(std::move(name), entry);
+	}
+
+	if (s_bake_index.size() != count)
+	{
+		s_bake_index.clear();
+		s_bake_file.Close();
+		return false;
+	}
+	return true;
+}
+
 static const std::string s_format_prefix = "tex1_";
 HiresTexture::HiresTexture() :
 	m_format(PC_TEX_FMT_NONE),
@@ -96,7 +268,8 @@ HiresTexture::HiresTexture() :
 	m_levels(0),
 	m_nrm_levels(0),
 	m_cached_data(nullptr),
-	m_cached_data_size(0)
+	m_cached_data_size(0),
+	m_last_use(0)
 {}
 
 void HiresTexture::Init()
@@ -106,6 +279,11 @@ void HiresTexture::Init()
 	size_t recommended_min_mem = 2 * size_t(1024 * 1024 * 1024);
 	// keep 2GB memory for system stability if system RAM is 4GB+ - use half of memory in other cases
 	max_mem = (sys_mem / 2 < recommended_min_mem) ? (sys_mem / 2) : (sys_mem - recommended_min_mem);
+	// a user supplied budget overrides the automatic one, so packs larger than
+	// RAM can still be used by streaming against a smaller resident set
+	if (g_ActiveConfig.iCacheHiresTexturesBudgetMB > 0)
+		max_mem = size_t(g_ActiveConfig.iCacheHiresTexturesBudgetMB) * 1024 * 1024;
+	s_use_counter.store(0);
 	Update();
 }
 
@@ -119,6 +297,12 @@ void HiresTexture::Shutdown()
 
 	s_textureMap.clear();
 	s_textureCache.clear();
+	PackIndexClear();
+
+	std::lock_guard<std::mutex> lk(s_bake_mutex);
+	s_bake_index.clear();
+	s_bake_file.Close();
+	s_bake_valid = false;
 }
 
 std::string HiresTexture::GetTextureDirectory(const std::string& game_id)
@@ -147,7 +331,12 @@ void HiresTexture::Update()
 	{
 		s_textureMap.clear();
 		s_textureCache.clear();
+		PackIndexClear();
 		size_sum.store(0);
+		std::lock_guard<std::mutex> lk(s_bake_mutex);
+		s_bake_index.clear();
+		s_bake_file.Close();
+		s_bake_valid = false;
 		return;
 	}
 
@@ -256,6 +445,28 @@ void HiresTexture::Update()
 		}
 	}
 
+	PackIndexClear();
+	for (const auto& entry : s_textureMap)
+		PackIndexAdd(entry.first);
+
+	// Check for a bake of the scanned pack; if it matches, loads below are
+	// served straight from the archive. A stale or missing archive is rebuilt
+	// by the prefetcher, which has to pay for the full decode pass anyway.
+	{
+		std::lock_guard<std::mutex> lk(s_bake_mutex);
+		s_bake_valid = false;
+		if (s_textureMap.size() > 0)
+		{
+			s_bake_fingerprint = ComputePackFingerprint();
+			s_bake_valid = LoadBakeIndex(s_bake_fingerprint);
+		}
+		else
+		{
+			s_bake_index.clear();
+			s_bake_file.Close();
+		}
+	}
+
 	if (g_ActiveConfig.bCacheHiresTextures && s_textureMap.size() > 0)
 	{
 		// remove cached but deleted textures
@@ -277,11 +488,121 @@ void HiresTexture::Update()
 	}
 }
 
+// called from the prefetcher thread
+//
+// Writes the archive described above GetBakePath. Every texture the pack
+// contains is loaded once through the regular decode path and its finished
+// buffer appended to the archive; textures that fit the memory budget are
+// handed to the RAM cache on the way through so the decode work is not paid
+// twice. The archive is built under a temporary name and only renamed into
+// place when complete, so an aborted bake leaves no half-written file.
+void HiresTexture::Bake()
+{
+	const std::string final_path = GetBakePath();
+	const std::string temp_path = final_path + ".tmp";
+	File::IOFile file(temp_path, "wb");
+	if (!file.IsOpen())
+	{
+		WARN_LOG(VIDEO, "Custom texture bake: could not create %s", temp_path.c_str());
+		return;
+	}
+
+	u32 count = 0;
+	std::unordered_map<std::string, BakedEntry> index;
+
+	file.WriteBytes(&BAKE_MAGIC, sizeof(BAKE_MAGIC));
+	file.WriteBytes(&s_bake_fingerprint, sizeof(s_bake_fingerprint));
+	file.WriteBytes(&count, sizeof(count));
+
+	for (const auto& map_entry : s_textureMap)
+	{
+		if (s_textureCacheAbortLoading.IsSet())
+		{
+			file.Close();
+			File::Delete(temp_path);
+			return;
+		}
+
+		HiresTexture* ptr = Load(map_entry.first, [](size_t requested_size)
+		{
+			return new u8[requested_size];
+		}, true);
+		if (ptr == nullptr)
+			continue;
+
+		BakedEntry entry;
+		entry.format = ptr->m_format;
+		entry.width = ptr->m_width;
+		entry.height = ptr->m_height;
+		entry.levels = ptr->m_levels;
+		entry.nrm_levels = ptr->m_nrm_levels;
+		entry.emissive_in_color = ptr->emissive_in_color;
+		entry.data_size = ptr->m_cached_data_size;
+
+		const u32 name_len = (u32)map_entry.first.size();
+		const u32 format = (u32)entry.format;
+		file.WriteBytes(&name_len, sizeof(name_len));
+		file.WriteBytes(map_entry.first.data(), name_len);
+		file.WriteBytes(&format, sizeof(format));
+		file.WriteBytes(&entry.width, sizeof(entry.width));
+		file.WriteBytes(&entry.height, sizeof(entry.height));
+		file.WriteBytes(&entry.levels, sizeof(entry.levels));
+		file.WriteBytes(&entry.nrm_levels, sizeof(entry.nrm_levels));
+		file.WriteBytes(&entry.emissive_in_color, sizeof(entry.emissive_in_color));
+		file.WriteBytes(&entry.data_size, sizeof(entry.data_size));
+		entry.data_offset = file.Tell();
+		file.WriteBytes(ptr->m_cached_data.get(), ptr->m_cached_data_size);
+		index.emplace(map_entry.first, entry);
+		count++;
+
+		// Hand the texture to the RAM cache while the budget lasts, so the
+		// prefetch pass that follows doesn't decode it a second time.
+		{
+			std::lock_guard<std::mutex> lk(s_textureCacheMutex);
+			if (size_sum.load() + ptr->m_cached_data_size <= max_mem &&
+				s_textureCache.find(map_entry.first) == s_textureCache.end())
+			{
+				size_sum.fetch_add(ptr->m_cached_data_size);
+				s_textureCache.emplace(map_entry.first, std::shared_ptr<HiresTexture>(ptr));
+				ptr = nullptr;
+			}
+		}
+		delete ptr;
+	}
+
+	if (!file.Seek(sizeof(BAKE_MAGIC) + sizeof(s_bake_fingerprint), SEEK_SET) ||
+		!file.WriteBytes(&count, sizeof(count)) || !file.Close())
+	{
+		File::Delete(temp_path);
+		return;
+	}
+	if (!File::Rename(temp_path, final_path))
+	{
+		File::Delete(temp_path);
+		return;
+	}
+
+	std::lock_guard<std::mutex> lk(s_bake_mutex);
+	s_bake_file.Close();
+	if (s_bake_file.Open(final_path, "rb"))
+	{
+		s_bake_index = std::move(index);
+		s_bake_valid = true;
+		OSD::AddMessage(StringFromFormat("Custom texture pack baked, %u textures", count), 10000);
+	}
+}
+
 void HiresTexture::Prefetch()
 {
 	Common::SetCurrentThreadName("Prefetcher");
 
 	u32 starttime = Common::Timer::GetTimeMs();
+
+	// An up to date bake means Load() below is a read from the archive; a
+	// missing or stale one means we pay the decode pass once to rebuild it.
+	if (!s_bake_valid)
+		Bake();
+
 	for (const auto& entry : s_textureMap)
 	{
 		const std::string& base_filename = entry.first;
@@ -311,9 +632,10 @@ void HiresTexture::Prefetch()
 
 		if (size_sum.load() > max_mem)
 		{
-			g_Config.bCacheHiresTextures = false;
-
-			OSD::AddMessage(StringFromFormat("Custom Textures prefetching after %.1f MB aborted, not enough RAM available", size_sum / (1024.0 * 1024.0)), 10000);
+			// Budget reached - stop warming the cache here. The remaining
+			// textures are streamed on first use and the least recently used
+			// cached ones get evicted to make room for them.
+			OSD::AddMessage(StringFromFormat("Custom Textures prefetching stopped at budget (%.1f MB), streaming the rest on demand", size_sum / (1024.0 * 1024.0)), 10000);
 			return;
 		}
 	}
@@ -351,6 +673,16 @@ std::string HiresTexture::GenBaseName(
 	}
 	if (dump || s_check_new_format || convert)
 	{
+		// A new-format name can only hit the pack if some scanned file shares
+		// its dimensions, mipmap flag and format. Checking that first keeps the
+		// unsampled content hash below off the path for the (usually large)
+		// majority of textures a pack doesn't replace.
+		if (!dump && !convert &&
+			s_dimension_index.find(DimensionKey(width, height, has_mipmaps, format)) ==
+			s_dimension_index.end())
+		{
+			return name;
+		}
 		// checking for min/max on paletted textures
 		u32 min = 0xffff;
 		u32 max = 0;
@@ -421,6 +753,7 @@ std::string HiresTexture::GenBaseName(
 					newitem.maps[MapType::color][level] = hires_mip_level(dst, convert_iter->second.maps[MapType::color][level].extension, convert_iter->second.maps[MapType::color][level].is_compressed);
 				}
 				s_textureMap.emplace(fullname, newitem);
+				PackIndexAdd(fullname);
 			}
 			else
 			{
@@ -616,10 +949,35 @@ inline void BuildMaterial(const HiresTextureCacheItem& item, ImageLoaderParams &
 }
 
 
+// Called with s_textureCacheMutex held. Frees the least recently used cached
+// textures until required additional bytes fit into the memory budget.
+// Textures loaded by the prefetcher but never bound carry a use stamp of 0 and
+// are therefore dropped first. Entries still referenced by the texture cache
+// stay alive through their shared_ptr until rebound or flushed.
+static void EvictFromCache(size_t required)
+{
+	while (size_sum.load() + required > max_mem && !s_textureCache.empty())
+	{
+		auto lru = s_textureCache.begin();
+		for (auto iter = s_textureCache.begin(); iter != s_textureCache.end(); ++iter)
+		{
+			if (iter->second->m_last_use < lru->second->m_last_use)
+				lru = iter;
+		}
+		size_sum.fetch_sub(lru->second->m_cached_data_size);
+		s_textureCache.erase(lru);
+	}
+}
+
 std::shared_ptr<HiresTexture> HiresTexture::Search(
 	const std::string& basename,
 	std::function<u8*(size_t)> request_buffer_delegate)
 {
+	// Names not in the pack are rejected here with one short hash and two bit
+	// tests, without touching the cache mutex or the texture maps. False
+	// positives just fall through to the real lookup below.
+	if (!PackIndexTest(basename))
+		return nullptr;
 	if (g_ActiveConfig.bCacheHiresTextures)
 	{
 		std::unique_lock<std::mutex> lk(s_textureCacheMutex);
@@ -628,28 +986,32 @@ std::shared_ptr<HiresTexture> HiresTexture::Search(
 		if (iter != s_textureCache.end())
 		{
 			HiresTexture* current = iter->second.get();
+			current->m_last_use = ++s_use_counter;
 			u8* dst = request_buffer_delegate(current->m_cached_data_size);
 			memcpy(dst, current->m_cached_data.get(), current->m_cached_data_size);
 			return iter->second;
 		}
 		lk.unlock();
-		if (size_sum.load() < max_mem)
+		std::shared_ptr<HiresTexture> ptr(Load(basename, [](size_t requested_size)
 		{
-			std::shared_ptr<HiresTexture> ptr(Load(basename, [](size_t requested_size)
-			{
-				return new u8[requested_size];
-			}, true));
-			lk.lock();
-			if (ptr)
+			return new u8[requested_size];
+		}, true));
+		lk.lock();
+		if (ptr)
+		{
+			HiresTexture* current = ptr.get();
+			current->m_last_use = ++s_use_counter;
+			EvictFromCache(current->m_cached_data_size);
+			// if a single texture exceeds the whole budget just stream it uncached
+			if (size_sum.load() + current->m_cached_data_size <= max_mem)
 			{
 				s_textureCache[basename] = ptr;
-				HiresTexture* current = ptr.get();
 				size_sum.fetch_add(current->m_cached_data_size);
-				u8* dst = request_buffer_delegate(current->m_cached_data_size);
-				memcpy(dst, current->m_cached_data.get(), current->m_cached_data_size);
 			}
-			return ptr;
+			u8* dst = request_buffer_delegate(current->m_cached_data_size);
+			memcpy(dst, current->m_cached_data.get(), current->m_cached_data_size);
 		}
+		return ptr;
 	}
 	return std::shared_ptr<HiresTexture>(Load(basename, request_buffer_delegate, false));
 }
@@ -676,6 +1038,40 @@ HiresTexture* HiresTexture::Load(const std::string& basename,
 	{
 		return nullptr;
 	}
+
+	// Baked fast path: the archive already holds the exact buffer this
+	// function would build, so a single read replaces the whole decode below.
+	{
+		std::lock_guard<std::mutex> lk(s_bake_mutex);
+		auto baked = s_bake_index.find(basename);
+		if (baked != s_bake_index.end())
+		{
+			const BakedEntry& entry = baked->second;
+			u8* dst = request_buffer_delegate(entry.data_size);
+			if (dst != nullptr && s_bake_file.Seek(entry.data_offset, SEEK_SET) &&
+				s_bake_file.ReadBytes(dst, entry.data_size))
+			{
+				HiresTexture* baked_ret = new HiresTexture();
+				baked_ret->m_format = entry.format;
+				baked_ret->m_width = entry.width;
+				baked_ret->m_height = entry.height;
+				baked_ret->m_levels = entry.levels;
+				baked_ret->m_nrm_levels = entry.nrm_levels;
+				baked_ret->emissive_in_color = entry.emissive_in_color;
+				if (cacheresult)
+				{
+					baked_ret->m_cached_data.reset(dst);
+					baked_ret->m_cached_data_size = entry.data_size;
+				}
+				return baked_ret;
+			}
+			// A failed read falls back to decoding from source.
+			s_bake_file.Clear();
+			if (cacheresult && dst != nullptr)
+				delete[] dst;
+		}
+	}
+
 	HiresTexture* ret = nullptr;
 	u8* buffer_pointer;
 	u32 maxwidth = 0;
@@ -37,10 +37,13 @@ public:
 	bool emissive_in_color;
 	std::unique_ptr<u8> m_cached_data;
 	size_t m_cached_data_size;
+	// Recency stamp used by the cache budget eviction, 0 until first use.
+	u64 m_last_use;
 private:
 	static HiresTexture* Load(const std::string& base_filename,
 		std::function<u8*(size_t)> request_buffer_delegate, bool cacheresult);
 	static void Prefetch();
+	static void Bake();
 	HiresTexture();
 	static std::string GetTextureDirectory(const std::string& game_id);
 };
\ No newline at end of file
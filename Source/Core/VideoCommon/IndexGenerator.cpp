@@ -5,6 +5,7 @@
 #include <cstddef>
 
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/Logging/Log.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -46,6 +47,40 @@ void IndexGenerator::AddIndices(int primitive, u32 numVerts)
 	base_index += numVerts;
 }
 
+// Every expansion below emits an affine index pattern: a constant offset
+// sequence plus a per-block step. That allows SIMD expansion with plain
+// adds and 8-wide stores, no shuffles needed; the scalar loops remain as
+// the tail (and non-x86) path.
+#if _M_SSE >= 0x200
+static u16* WriteSequence(u16* ptr, u32 start, u32 count)
+{
+	__m128i v = _mm_add_epi16(_mm_set1_epi16((s16)start), _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7));
+	const __m128i step = _mm_set1_epi16(8);
+	while (count >= 8)
+	{
+		_mm_storeu_si128((__m128i*)ptr, v);
+		v = _mm_add_epi16(v, step);
+		ptr += 8;
+		start += 8;
+		count -= 8;
+	}
+	while (count--)
+	{
+		*ptr++ = start++;
+	}
+	return ptr;
+}
+#else
+static u16* WriteSequence(u16* ptr, u32 start, u32 count)
+{
+	while (count--)
+	{
+		*ptr++ = start++;
+	}
+	return ptr;
+}
+#endif
+
 // Triangles
 __forceinline u16* IndexGenerator::WriteTriangle(u16* ptr, u32 index1, u32 index2, u32 index3)
 {
@@ -57,24 +92,43 @@ __forceinline u16* IndexGenerator::WriteTriangle(u16* ptr, u32 index1, u32 index
 
 void IndexGenerator::AddList(u32 const numVerts)
 {
-	u32 i = base_index + 2;
-	u32 top = (base_index + numVerts);
-	u16* ptr = index_buffer_current;
-	while (i < top)
-	{
-		ptr = WriteTriangle(ptr, i - 2, i - 1, i);
-		i += 3;
-	}
-	index_buffer_current = ptr;
+	// a list expands to the identity sequence, three indices per triangle
+	index_buffer_current = WriteSequence(index_buffer_current, base_index, numVerts - (numVerts % 3));
 }
 
 void IndexGenerator::AddStrip(u32 const numVerts)
 {
 	u16* ptr = index_buffer_current;
-	u32 top = (base_index + numVerts);
 	u32 a = base_index;
 	u32 i = a + 2;
+	u32 top = (base_index + numVerts);
 	u32 wind = 1;
+#if _M_SSE >= 0x200
+	if (numVerts >= 2 + 8)
+	{
+		// eight triangles (24 indices) per iteration; eight is even, so the
+		// scalar tail always resumes with the same winding
+		const __m128i step = _mm_set1_epi16(8);
+		const __m128i base = _mm_set1_epi16((s16)a);
+		__m128i v0 = _mm_add_epi16(base, _mm_setr_epi16(0, 1, 2, 1, 3, 2, 2, 3));
+		__m128i v1 = _mm_add_epi16(base, _mm_setr_epi16(4, 3, 5, 4, 4, 5, 6, 5));
+		__m128i v2 = _mm_add_epi16(base, _mm_setr_epi16(7, 6, 6, 7, 8, 7, 9, 8));
+		u32 numTris = numVerts - 2;
+		while (numTris >= 8)
+		{
+			_mm_storeu_si128((__m128i*)(ptr + 0), v0);
+			_mm_storeu_si128((__m128i*)(ptr + 8), v1);
+			_mm_storeu_si128((__m128i*)(ptr + 16), v2);
+			v0 = _mm_add_epi16(v0, step);
+			v1 = _mm_add_epi16(v1, step);
+			v2 = _mm_add_epi16(v2, step);
+			ptr += 24;
+			a += 8;
+			numTris -= 8;
+		}
+		i = a + 2;
+	}
+#endif
 	while (i < top)
 	{
 		u32 b = i - wind;
@@ -116,6 +170,32 @@ void IndexGenerator::AddFan(u32 numVerts)
 	u32 top = (base_index + numVerts);
 	u16* ptr = index_buffer_current;
 
+#if _M_SSE >= 0x200
+	if (numVerts >= 2 + 8)
+	{
+		// eight triangles per iteration; the center lanes keep a zero step
+		const __m128i base = _mm_set1_epi16((s16)base_index);
+		__m128i v0 = _mm_add_epi16(base, _mm_setr_epi16(0, 1, 2, 0, 2, 3, 0, 3));
+		__m128i v1 = _mm_add_epi16(base, _mm_setr_epi16(4, 0, 4, 5, 0, 5, 6, 0));
+		__m128i v2 = _mm_add_epi16(base, _mm_setr_epi16(6, 7, 0, 7, 8, 0, 8, 9));
+		const __m128i step0 = _mm_setr_epi16(0, 8, 8, 0, 8, 8, 0, 8);
+		const __m128i step1 = _mm_setr_epi16(8, 0, 8, 8, 0, 8, 8, 0);
+		const __m128i step2 = _mm_setr_epi16(8, 8, 0, 8, 8, 0, 8, 8);
+		u32 numTris = numVerts - 2;
+		while (numTris >= 8)
+		{
+			_mm_storeu_si128((__m128i*)(ptr + 0), v0);
+			_mm_storeu_si128((__m128i*)(ptr + 8), v1);
+			_mm_storeu_si128((__m128i*)(ptr + 16), v2);
+			v0 = _mm_add_epi16(v0, step0);
+			v1 = _mm_add_epi16(v1, step1);
+			v2 = _mm_add_epi16(v2, step2);
+			ptr += 24;
+			i += 8;
+			numTris -= 8;
+		}
+	}
+#endif
 	while (i < top)
 	{
 		ptr = WriteTriangle(ptr, base_index, i - 1, i);
@@ -146,6 +226,30 @@ void IndexGenerator::AddQuads(u32 numVerts)
 	u32 i = base_index + 3;
 	u32 top = (base_index + numVerts);
 	u16* ptr = index_buffer_current;
+#if _M_SSE >= 0x200
+	if (numVerts >= 4 * 4)
+	{
+		// four quads (24 indices) per iteration
+		const __m128i step = _mm_set1_epi16(16);
+		const __m128i base = _mm_set1_epi16((s16)base_index);
+		__m128i v0 = _mm_add_epi16(base, _mm_setr_epi16(0, 1, 2, 0, 2, 3, 4, 5));
+		__m128i v1 = _mm_add_epi16(base, _mm_setr_epi16(6, 4, 6, 7, 8, 9, 10, 8));
+		__m128i v2 = _mm_add_epi16(base, _mm_setr_epi16(10, 11, 12, 13, 14, 12, 14, 15));
+		u32 numQuads = numVerts / 4;
+		while (numQuads >= 4)
+		{
+			_mm_storeu_si128((__m128i*)(ptr + 0), v0);
+			_mm_storeu_si128((__m128i*)(ptr + 8), v1);
+			_mm_storeu_si128((__m128i*)(ptr + 16), v2);
+			v0 = _mm_add_epi16(v0, step);
+			v1 = _mm_add_epi16(v1, step);
+			v2 = _mm_add_epi16(v2, step);
+			ptr += 24;
+			i += 16;
+			numQuads -= 4;
+		}
+	}
+#endif
 	while (i < top)
 	{
 		ptr = WriteTriangle(ptr, i - 3, i - 2, i - 1);
@@ -170,16 +274,8 @@ void IndexGenerator::AddQuads_nonstandard(u32 numVerts)
 // Lines
 void IndexGenerator::AddLineList(u32 numVerts)
 {
-	u32 i = base_index + 1;
-	u32 top = (base_index + numVerts);
-	u16* ptr = index_buffer_current;
-	while (i < top)
-	{
-		*ptr++ = i - 1;
-		*ptr++ = i;
-		i += 2;
-	}
-	index_buffer_current = ptr;
+	// pairs of sequential indices, so this is the identity sequence too
+	index_buffer_current = WriteSequence(index_buffer_current, base_index, numVerts - (numVerts & 1));
 }
 
 // shouldn't be used as strips as LineLists are much more common
@@ -189,6 +285,23 @@ void IndexGenerator::AddLineStrip(u32 numVerts)
 	u32 i = base_index + 1;
 	u32 top = (base_index + numVerts);
 	u16* ptr = index_buffer_current;
+#if _M_SSE >= 0x200
+	if (numVerts >= 1 + 4)
+	{
+		// four lines (eight indices) per iteration
+		const __m128i step = _mm_set1_epi16(4);
+		__m128i v = _mm_add_epi16(_mm_set1_epi16((s16)base_index), _mm_setr_epi16(0, 1, 1, 2, 2, 3, 3, 4));
+		u32 numLines = numVerts - 1;
+		while (numLines >= 4)
+		{
+			_mm_storeu_si128((__m128i*)ptr, v);
+			v = _mm_add_epi16(v, step);
+			ptr += 8;
+			i += 4;
+			numLines -= 4;
+		}
+	}
+#endif
 	while (i < top)
 	{
 		*ptr++ = i - 1;
@@ -201,13 +314,5 @@ void IndexGenerator::AddLineStrip(u32 numVerts)
 // Points
 void IndexGenerator::AddPoints(u32 numVerts)
 {
-	u32 i = base_index;
-	u32 top = (base_index + numVerts);
-	u16 *ptr = index_buffer_current;
-	while (i < top)
-	{
-		*ptr++ = i;
-		++i;
-	}
-	index_buffer_current = ptr;
+	index_buffer_current = WriteSequence(index_buffer_current, base_index, numVerts);
 }
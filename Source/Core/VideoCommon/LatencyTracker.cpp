@@ -0,0 +1,127 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+
+#include "Common/CommonTypes.h"
+#include "Common/StringUtil.h"
+#include "Common/Timer.h"
+#include "Common/Logging/Log.h"
+#include "VideoCommon/LatencyTracker.h"
+
+namespace LatencyTracker
+{
+// Most recent SI poll, written by the CPU thread.
+static std::atomic<u64> s_last_poll_us{0};
+
+// Swap requests in flight between the CPU and video thread, carrying the poll
+// timestamp latched at request time. Single producer (CPU), single consumer
+// (video); requests are rare enough that dropping on a full ring is fine.
+static constexpr size_t PENDING_SWAPS = 8;
+static u64 s_pending_swap_us[PENDING_SWAPS];
+static std::atomic<size_t> s_pending_write{0};
+static std::atomic<size_t> s_pending_read{0};
+
+// Latency distribution, touched only by the video thread. 1 ms buckets; the
+// last bucket collects everything above.
+static constexpr size_t NUM_BUCKETS = 64;
+static u32 s_buckets[NUM_BUCKETS];
+static u64 s_count;
+static u64 s_sum_us;
+static u64 s_min_us;
+static u64 s_max_us;
+
+void Reset()
+{
+	s_last_poll_us.store(0, std::memory_order_relaxed);
+	s_pending_write.store(0, std::memory_order_relaxed);
+	s_pending_read.store(0, std::memory_order_relaxed);
+	std::fill(std::begin(s_buckets), std::end(s_buckets), 0);
+	s_count = 0;
+	s_sum_us = 0;
+	s_min_us = 0;
+	s_max_us = 0;
+}
+
+void OnInputPolled()
+{
+	s_last_poll_us.store(Common::Timer::GetTimeUs(), std::memory_order_relaxed);
+}
+
+void OnSwapRequested()
+{
+	u64 poll_us = s_last_poll_us.load(std::memory_order_relaxed);
+	if (poll_us == 0)
+		return;
+
+	size_t write = s_pending_write.load(std::memory_order_relaxed);
+	size_t read = s_pending_read.load(std::memory_order_acquire);
+	if (write - read >= PENDING_SWAPS)
+		return;
+
+	s_pending_swap_us[write % PENDING_SWAPS] = poll_us;
+	s_pending_write.store(write + 1, std::memory_order_release);
+}
+
+void OnFramePresented()
+{
+	size_t read = s_pending_read.load(std::memory_order_relaxed);
+	size_t write = s_pending_write.load(std::memory_order_acquire);
+	if (read == write)
+		return;
+
+	u64 poll_us = s_pending_swap_us[read % PENDING_SWAPS];
+	s_pending_read.store(read + 1, std::memory_order_release);
+
+	u64 now_us = Common::Timer::GetTimeUs();
+	if (now_us <= poll_us)
+		return;
+
+	u64 latency_us = now_us - poll_us;
+	size_t bucket = std::min<size_t>(latency_us / 1000, NUM_BUCKETS - 1);
+	s_buckets[bucket]++;
+	s_count++;
+	s_sum_us += latency_us;
+	if (s_min_us == 0 || latency_us < s_min_us)
+		s_min_us = latency_us;
+	s_max_us = std::max(s_max_us, latency_us);
+}
+
+// Smallest bucket upper bound below which the given fraction of samples falls.
+static u32 Percentile(double fraction)
+{
+	u64 threshold = static_cast<u64>(s_count * fraction);
+	u64 seen = 0;
+	for (size_t i = 0; i < NUM_BUCKETS; i++)
+	{
+		seen += s_buckets[i];
+		if (seen >= threshold)
+			return static_cast<u32>(i + 1);
+	}
+	return NUM_BUCKETS;
+}
+
+std::string GetReport()
+{
+	if (s_count == 0)
+		return "";
+
+	return StringFromFormat(
+		"Input-to-present latency over %llu frames: min %.1f ms, avg %.1f ms, "
+		"p50 <%u ms, p95 <%u ms, p99 <%u ms, max %.1f ms",
+		static_cast<unsigned long long>(s_count), s_min_us / 1000.0,
+		s_sum_us / 1000.0 / s_count, Percentile(0.50), Percentile(0.95), Percentile(0.99),
+		s_max_us / 1000.0);
+}
+
+void LogReport()
+{
+	std::string report = GetReport();
+	if (!report.empty())
+		NOTICE_LOG(VIDEO, "%s", report.c_str());
+}
+
+}  // namespace LatencyTracker
@@ -0,0 +1,37 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// Measures input-sample-to-present latency over a session. SI timestamps every
+// host input poll; when VI requests a field swap the most recent poll time is
+// latched, and when the backend finishes presenting that frame the difference
+// is recorded. Using the last poll before the swap request makes the figure a
+// lower bound (a game may have read an earlier poll for the presented frame),
+// but the bound is consistent between builds, which is what makes it useful
+// for comparing latency-affecting changes.
+namespace LatencyTracker
+{
+void Reset();
+
+// CPU thread: an SI poll just sampled the host input devices.
+void OnInputPolled();
+
+// CPU thread: VI is presenting a field; latches the poll time the
+// presented frame is assumed to have consumed.
+void OnSwapRequested();
+
+// Video thread: the backend just finished presenting a frame.
+void OnFramePresented();
+
+// Distribution summary for the session; empty if nothing was measured.
+std::string GetReport();
+
+// Writes the summary to the log, for session-end reporting.
+void LogReport();
+}
@@ -2,6 +2,7 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <cstring>
 
 #include "Common/ChunkFile.h"
@@ -19,6 +20,7 @@
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/TessellationShaderManager.h"
 #include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/LatencyTracker.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/PixelEngine.h"
@@ -33,6 +35,11 @@
 
 static Common::Flag s_FifoShuttingDown;
 volatile u32 s_EFB_PCache_Frame;
+volatile u32 g_efb_peek_version = 1;
+
+// Last bounding box values fetched from the video thread, used when
+// BoundingBoxPrediction is enabled. Seeded with the hardware reset values.
+static u16 s_bbox_prediction_cache[4] = { 0x80, 0xA0, 0x80, 0xA0 };
 
 static volatile struct
 {
@@ -72,6 +79,9 @@ void VideoBackendBase::Video_BeginField(u32 xfbAddr, u32 fbWidth, u32 fbStride,
 		e.swap_event.fbWidth = fbWidth;
 		e.swap_event.fbStride = fbStride;
 		e.swap_event.fbHeight = fbHeight;
+		// Latch before pushing: in passthrough mode the event is presented
+		// synchronously inside PushEvent.
+		LatencyTracker::OnSwapRequested();
 		AsyncRequests::GetInstance()->PushEvent(e, false);
 	}
 }
@@ -95,6 +105,10 @@ VideoBackendBase::~VideoBackendBase()
 	{
 		delete[] m_EFB_PCache;
 	}
+	delete[] m_EFB_tile_color;
+	delete[] m_EFB_tile_depth;
+	delete[] m_EFB_tile_color_version;
+	delete[] m_EFB_tile_depth_version;
 }
 
 u32 VideoBackendBase::Video_AccessEFB(EFBAccessType type, u32 x, u32 y, u32 InputData)
@@ -114,6 +128,17 @@ u32 VideoBackendBase::Video_AccessEFB(EFBAccessType type, u32 x, u32 y, u32 Inpu
 		e.efb_poke.x = x;
 		e.efb_poke.y = y;
 		AsyncRequests::GetInstance()->PushEvent(e, false);
+
+		// Keep the poked value visible to later peeks of the same tile.
+		u32* tile_data = type == EFBAccessType::PokeColor ? m_EFB_tile_color : m_EFB_tile_depth;
+		u32* tile_version =
+			type == EFBAccessType::PokeColor ? m_EFB_tile_color_version : m_EFB_tile_depth_version;
+		const u32 tile_index =
+			(y / EFB_PEEK_TILE_SIZE) * m_EFB_tile_columns + (x / EFB_PEEK_TILE_SIZE);
+		if (tile_version[tile_index] == g_efb_peek_version)
+		{
+			tile_data[y * EFB_WIDTH + x] = InputData;
+		}
 	}
 	else
 	{
@@ -128,14 +153,37 @@ u32 VideoBackendBase::Video_AccessEFB(EFBAccessType type, u32 x, u32 y, u32 Inpu
 				return m_EFB_PCache[efb_p_cache_stride].DepthValue;
 			}
 		}
-		AsyncRequests::Event e;
 
-		e.type = type == EFBAccessType::PeekColor ? AsyncRequests::Event::EFB_PEEK_COLOR : AsyncRequests::Event::EFB_PEEK_Z;
-		e.time = 0;
-		e.efb_peek.x = x;
-		e.efb_peek.y = y;
-		e.efb_peek.data = &result;
-		AsyncRequests::GetInstance()->PushEvent(e, true);
+		// Region readers (photo modes, HUD effects) peek thousands of adjacent
+		// pixels; fetch the whole tile once and answer neighbours locally
+		// until the EFB is dirtied by new rendering.
+		const bool is_color = type == EFBAccessType::PeekColor;
+		u32* tile_data = is_color ? m_EFB_tile_color : m_EFB_tile_depth;
+		u32* tile_version = is_color ? m_EFB_tile_color_version : m_EFB_tile_depth_version;
+		const u32 tile_index =
+			(y / EFB_PEEK_TILE_SIZE) * m_EFB_tile_columns + (x / EFB_PEEK_TILE_SIZE);
+		if (tile_version[tile_index] != g_efb_peek_version)
+		{
+			// Tag with the version sampled before the readback; rendering that
+			// lands while the request is in flight invalidates the tile again.
+			const u32 version = g_efb_peek_version;
+			const u32 tile_x = (x / EFB_PEEK_TILE_SIZE) * EFB_PEEK_TILE_SIZE;
+			const u32 tile_y = (y / EFB_PEEK_TILE_SIZE) * EFB_PEEK_TILE_SIZE;
+
+			AsyncRequests::Event e;
+			e.type = is_color ? AsyncRequests::Event::EFB_PEEK_TILE_COLOR :
+				AsyncRequests::Event::EFB_PEEK_TILE_Z;
+			e.time = 0;
+			e.efb_peek_tile.x = tile_x;
+			e.efb_peek_tile.y = tile_y;
+			e.efb_peek_tile.w = std::min<u32>(u32(EFB_PEEK_TILE_SIZE), EFB_WIDTH - tile_x);
+			e.efb_peek_tile.h = std::min<u32>(u32(EFB_PEEK_TILE_SIZE), EFB_HEIGHT - tile_y);
+			e.efb_peek_tile.data = tile_data + tile_y * EFB_WIDTH + tile_x;
+			AsyncRequests::GetInstance()->PushEvent(e, true);
+
+			tile_version[tile_index] = version;
+		}
+		result = tile_data[y * EFB_WIDTH + x];
 	}
 	if (g_ActiveConfig.bEFBFastAccess)
 	{
@@ -176,6 +224,21 @@ u16 VideoBackendBase::Video_GetBoundingBox(int index)
 	if (g_ActiveConfig.iBBoxMode == BBoxNone)
 		return BoundingBox::coords[index];
 
+	if (g_ActiveConfig.bBBoxPrediction)
+	{
+		// Prediction mode: hand back the result of the last refresh right away
+		// and queue a non-blocking refresh, so games that poll the box every
+		// frame see values roughly one frame stale instead of paying a GPU
+		// sync per register read.
+		AsyncRequests::Event e;
+		e.time = 0;
+		e.type = AsyncRequests::Event::BBOX_READ;
+		e.bbox.index = index;
+		e.bbox.data = &s_bbox_prediction_cache[index];
+		AsyncRequests::GetInstance()->PushEvent(e, false);
+		return s_bbox_prediction_cache[index];
+	}
+
 	Fifo::SyncGPU(Fifo::SyncGPUReason::BBox);
 
 	AsyncRequests::Event e;
@@ -197,7 +260,21 @@ void VideoBackendBase::InitializeShared()
 	m_invalid = false;
 	memset(m_EFB_PCache, 0, m_EFB_PCache_Size * sizeof(EFBPeekCacheElement));
 	s_EFB_PCache_Frame = 1;
+	if (!m_EFB_tile_color)
+	{
+		m_EFB_tile_columns = (EFB_WIDTH + EFB_PEEK_TILE_SIZE - 1) / EFB_PEEK_TILE_SIZE;
+		m_EFB_tile_count =
+			m_EFB_tile_columns * ((EFB_HEIGHT + EFB_PEEK_TILE_SIZE - 1) / EFB_PEEK_TILE_SIZE);
+		m_EFB_tile_color = new u32[EFB_WIDTH * EFB_HEIGHT];
+		m_EFB_tile_depth = new u32[EFB_WIDTH * EFB_HEIGHT];
+		m_EFB_tile_color_version = new u32[m_EFB_tile_count];
+		m_EFB_tile_depth_version = new u32[m_EFB_tile_count];
+	}
+	memset(m_EFB_tile_color_version, 0, m_EFB_tile_count * sizeof(u32));
+	memset(m_EFB_tile_depth_version, 0, m_EFB_tile_count * sizeof(u32));
+	g_efb_peek_version = 1;
 	frameCount = 0;
+	LatencyTracker::Reset();
 	// Do our OSD callbacks
 	OSD::DoCallbacks(OSD::CallbackType::Initialization);
 
@@ -232,6 +309,8 @@ void VideoBackendBase::InitializeShared()
 
 void VideoBackendBase::ShutdownShared()
 {
+	LatencyTracker::LogReport();
+
 	// Do our OSD callbacks
 	OSD::DoCallbacks(OSD::CallbackType::Shutdown);
 
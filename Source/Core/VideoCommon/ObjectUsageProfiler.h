@@ -80,6 +80,7 @@ public:
 		{
 			item.usage_count++;
 		}
+		item.last_session = m_session_count;
 		if (m_categories.size() == 1)
 		{
 			return item.info;
@@ -122,6 +123,7 @@ public:
 		m_category_index = 0;
 		m_max_category_index = 0;
 		m_category_mask = 0;
+		m_session_count = 0;
 		m_version = 0;
 	}
 
@@ -140,6 +142,7 @@ public:
 		m_category_index = 0;
 		m_max_category_index = 0;
 		m_category_mask = 0;
+		m_session_count = 0;
 		m_version = 0;
 	}
 
@@ -224,6 +227,53 @@ public:
 		{
 			return;
 		}
+		if (!allcategories)
+		{
+			// Single-category (per game) profiles use the fixed-record format:
+			// one header, then a flat array of PersistedObject. Entries that
+			// have not been used for STALE_SESSION_LIMIT sessions are dropped
+			// here, so a profile stops accumulating UIDs from one-off captures.
+			pKey_t magic = FORMAT_MAGIC_V2;
+			bwrite(out, magic);
+			bwrite(out, m_version);
+			bwrite(out, m_session_count);
+			for (auto& item : m_categories)
+			{
+				if (item.second.Id == m_category_id)
+				{
+					bwrite(out, item.first);
+					bwrite(out, item.second);
+					break;
+				}
+			}
+			std::vector<PersistedObject> records;
+			records.reserve(m_objects.size());
+			for (auto& item : m_objects)
+			{
+				if (m_categories.size() > 1 &&
+					(item.second.category_mask[m_category_index] & m_category_mask) == 0)
+				{
+					continue;
+				}
+				if (item.second.last_session + STALE_SESSION_LIMIT < m_session_count)
+				{
+					continue;
+				}
+				PersistedObject record = {};
+				record.key = item.first;
+				record.usage_count = item.second.usage_count;
+				record.last_session = item.second.last_session;
+				records.push_back(record);
+			}
+			pKey_t record_count = records.size();
+			bwrite(out, record_count);
+			if (record_count > 0)
+			{
+				out.write(reinterpret_cast<const char*>(records.data()),
+					sizeof(PersistedObject) * record_count);
+			}
+			return;
+		}
 		bwrite(out, m_version);
 		size_t category_count = allcategories ? m_categories.size() : 1;
 		bwrite(out, category_count);
@@ -291,6 +341,11 @@ public:
 		}
 		pKey_t version = 0;
 		bread(input, version);
+		if (!multicategory && version == FORMAT_MAGIC_V2)
+		{
+			ReadFromFileV2(input);
+			return;
+		}
 		if (version != m_version)
 		{
 			return;
@@ -387,17 +442,30 @@ public:
 		}
 		output->SetCategory(catid);
 		output->SetStorage(profile_filename);
+		output->m_session_count++;
 		return output;
 	}
 
 private:
+	// Single-category profiles are persisted as a flat array of these, so the
+	// whole payload loads with one read instead of per-record stream parsing.
+	// Entries unused for STALE_SESSION_LIMIT sessions are dropped on persist.
+	static const pKey_t FORMAT_MAGIC_V2 = 0x32444955534F5550ULL;  // "PUSOUID2"
+	static const pKey_t STALE_SESSION_LIMIT = 20;
+	struct PersistedObject
+	{
+		Tobj key;
+		pKey_t usage_count;
+		pKey_t last_session;
+	};
 	struct ObjectMetadata
 	{
 		pKey_t category_count;
 		pKey_t usage_count;
+		pKey_t last_session;
 		std::vector<pKey_t> category_mask;
 		TInfo info;
-		ObjectMetadata() : category_count(0), usage_count(0)
+		ObjectMetadata() : category_count(0), usage_count(0), last_session(0)
 		{}
 	};
 	struct greater
@@ -420,12 +488,67 @@ private:
 		pKey_t Id;
 		pKey_t usage_count;
 	};
+	void ReadFromFileV2(std::ifstream& input)
+	{
+		pKey_t version = 0;
+		bread(input, version);
+		if (version != m_version)
+		{
+			return;
+		}
+		bread(input, m_session_count);
+		TCaterogry category_key;
+		bread(input, category_key);
+		CategoryMetadata category_data;
+		bread(input, category_data);
+		pKey_t category_count = m_categories.size() + 1;
+		pKey_t category_index = (category_count + 1) / (sizeof(pKey_t) * 8);
+		pKey_t category_mask = pKey_t(1) << (category_count % (sizeof(pKey_t) * 8));
+		if (m_max_category_index < category_index + 1)
+		{
+			m_max_category_index = category_index + 1;
+			for (auto& item : m_objects)
+			{
+				item.second.category_mask.resize(m_max_category_index);
+			}
+		}
+		category_data.Id = category_count;
+		m_categories.emplace(std::move(category_key), std::move(category_data));
+		pKey_t record_count = 0;
+		bread(input, record_count);
+		if (record_count == 0)
+		{
+			return;
+		}
+		std::vector<PersistedObject> records(record_count);
+		input.read(reinterpret_cast<char*>(records.data()), sizeof(PersistedObject) * record_count);
+		if (!input)
+		{
+			return;
+		}
+		m_objects.reserve(m_objects.size() + record_count);
+		for (const PersistedObject& record : records)
+		{
+			ObjectMetadata& data = m_objects[record.key];
+			data.usage_count = record.usage_count;
+			data.last_session = record.last_session;
+			data.category_count = 0;
+			data.category_mask.resize(m_max_category_index);
+			if ((data.category_mask[category_index] & category_mask) == 0)
+			{
+				data.category_count++;
+				data.category_mask[category_index] |= category_mask;
+			}
+		}
+	}
+
 	std::unordered_map<Tobj, ObjectMetadata, TobjHasher> m_objects;
 	std::map<TCaterogry, CategoryMetadata> m_categories;
 	pKey_t m_category_id = {};
 	pKey_t m_category_index = {};
 	pKey_t m_max_category_index = {};
 	pKey_t m_category_mask = {};
+	pKey_t m_session_count = {};
 	pKey_t m_version = {};
 	std::string m_storage;
 	template<typename T>
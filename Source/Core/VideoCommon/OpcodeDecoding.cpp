@@ -64,6 +64,7 @@ __forceinline u32 InterpretDisplayList(u32 address, u32 size)
 		Statistics::SwapDL();
 		OpcodeDecoder::Run<false, false>(g_VideoData, &cycles);
 		INCSTAT(stats.thisFrame.numDListsCalled);
+		ADDSTAT(stats.thisFrame.bytesDListsExecuted, size);
 		// un-swap
 		Statistics::SwapDL();
 		// reset to the old pointer
@@ -176,7 +177,15 @@ u8* Run(DataReader& reader, u32* cycles)
 		{
 		case GX_NOP:
 		{
-			totalCycles += GX_NOP_CYCLES; // Hm, this means that we scan over nop streams pretty slowly...
+			// Games pad both the fifo and display lists with runs of nops,
+			// so consume the whole run instead of scanning it byte by byte.
+			u32 run = 1;
+			while (reader.size() && *reader.GetReadPosition() == GX_NOP)
+			{
+				reader.ReadSkip(1);
+				run++;
+			}
+			totalCycles += GX_NOP_CYCLES * run;
 		}
 		break;
 		case GX_UNKNOWN_RESET:
@@ -20,6 +20,7 @@
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/PixelEngine.h"
+#include "VideoCommon/PixelShaderGen.h"
 
 namespace PixelEngine
 {
@@ -253,6 +254,7 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 			MMIO::ComplexRead<u16>([i](u32)
 		{
 			BoundingBox::active = false;
+			MarkPixelShaderUIDDirty();
 			return g_video_backend->Video_GetBoundingBox(i);
 		}),
 			MMIO::InvalidWrite<u16>()
@@ -460,8 +460,40 @@ float snoise(float2 v)
 
 // FIXME: Some of the video card's capabilities (BBox support, EarlyZ support, dstAlpha support) leak
 //        into this UID; This is really unhelpful if these UIDs ever move from one machine to another.
+// UID cache: between two relevant state writes (signalled through
+// MarkPixelShaderUIDDirty), the UID for a given render mode only depends on
+// the vertex components, so it can be copied instead of rebuilt from BP/XF
+// state. State-churny games resubmit the same registers over and over; the
+// no-op write filter in BPWritten keeps those from dirtying the cache.
+struct CachedPixelShaderUid
+{
+	PixelShaderUid uid;
+	u32 components = 0;
+	bool valid = false;
+};
+static CachedPixelShaderUid s_uid_cache[PSRM_DEPTH_ONLY + 1];
+static bool s_uid_dirty = true;
+
+void MarkPixelShaderUIDDirty()
+{
+	s_uid_dirty = true;
+}
+
 void GetPixelShaderUID(PixelShaderUid& out, PIXEL_SHADER_RENDER_MODE render_mode, u32 components, const XFMemory &xfr, const BPMemory &bpm)
 {
+	if (s_uid_dirty)
+	{
+		for (auto& entry : s_uid_cache)
+			entry.valid = false;
+		s_uid_dirty = false;
+	}
+	CachedPixelShaderUid& cache_entry = s_uid_cache[render_mode];
+	if (cache_entry.valid && cache_entry.components == components)
+	{
+		out = cache_entry.uid;
+		return;
+	}
+
 	out.ClearUID();
 	pixel_shader_uid_data& uid_data = out.GetUidData<pixel_shader_uid_data>();
 
@@ -488,6 +520,9 @@ void GetPixelShaderUID(PixelShaderUid& out, PIXEL_SHADER_RENDER_MODE render_mode
 	if (render_mode == PSRM_DEPTH_ONLY)
 	{
 		out.CalculateUIDHash();
+		cache_entry.uid = out;
+		cache_entry.components = components;
+		cache_entry.valid = true;
 		return;
 	}
 	uid_data.stereo = g_ActiveConfig.iStereoMode > 0;
@@ -646,6 +681,9 @@ void GetPixelShaderUID(PixelShaderUid& out, PIXEL_SHADER_RENDER_MODE render_mode
 	}
 
 	out.CalculateUIDHash();
+	cache_entry.uid = out;
+	cache_entry.components = components;
+	cache_entry.valid = true;
 }
 
 static char text[PIXELSHADERGEN_BUFFERSIZE];
@@ -223,6 +223,11 @@ typedef ShaderUid<pixel_shader_uid_data> PixelShaderUid;
 
 void GetPixelShaderUID(PixelShaderUid& object, PIXEL_SHADER_RENDER_MODE render_mode, u32 components, const XFMemory &xfr, const BPMemory &bpm);
 
+// GetPixelShaderUID caches the last UID computed per render mode and replays
+// it until a state write which can feed the UID happens. BPStructs/XFStructs
+// (and config updates/savestate loads) report those through this call.
+void MarkPixelShaderUIDDirty();
+
 void GeneratePixelShaderCodeD3D9(ShaderCode& object, const pixel_shader_uid_data& uid_data);
 
 void GeneratePixelShaderCodeD3D9SM2(ShaderCode& object, const pixel_shader_uid_data& uid_data);
@@ -12,22 +12,28 @@
 // Next frame, that one is scanned out and the other one gets the copy. = double buffering.
 // ---------------------------------------------------------------------------------------------
 
+#include <algorithm>
+#include <atomic>
 #include <cinttypes>
 #include <cmath>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
+#include "Common/EventTrace.h"
 #include "Common/FileUtil.h"
 #include "Common/Flag.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/PerformanceHud.h"
 #include "Common/Profiler.h"
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
+#include "Common/ThreadPool.h"
 #include "Common/Timer.h"
 
 #include "Core/ConfigManager.h"
@@ -76,6 +82,32 @@ static float AspectToWidescreen(float aspect)
 	return aspect * ((16.0f / 9.0f) / (4.0f / 3.0f));
 }
 
+// PNG encodes run on the worker pool from an owned copy of the frame. The
+// bound keeps a long capture burst from growing memory without limit when the
+// encoders fall behind; the producer stalls instead.
+static constexpr u32 MAX_PENDING_PNG_ENCODES = 8;
+static std::atomic<u32> s_pending_png_encodes{0};
+
+// Copy a frame (the stride may be negative for flipped images) into a tightly
+// packed buffer the encoder can own.
+static std::vector<u8> CopyFrameForEncode(const u8* data, int stride, int width, int height)
+{
+	std::vector<u8> copy(static_cast<size_t>(width) * height * 4);
+	for (int y = 0; y < height; y++)
+	{
+		memcpy(&copy[static_cast<size_t>(y) * width * 4], data + static_cast<s64>(y) * stride,
+			static_cast<size_t>(width) * 4);
+	}
+	return copy;
+}
+
+static void WaitForPendingEncodes(u32 limit)
+{
+	size_t loopcount = 0;
+	while (s_pending_png_encodes.load() > limit)
+		Common::cYield(loopcount++);
+}
+
 Renderer::Renderer()
 {
 	OSDChoice = 0;
@@ -311,7 +343,17 @@ void Renderer::DrawDebugText()
 	if (g_ActiveConfig.bShowFPS || SConfig::GetInstance().m_ShowFrameCount)
 	{
 		if (g_ActiveConfig.bShowFPS)
+		{
 			final_cyan += StringFromFormat("FPS: %u", m_fps_counter.GetFPS());
+			if (g_ActiveConfig.bFramePacing)
+			{
+				final_cyan += StringFromFormat(" (%.2f +- %.2f ms)",
+					m_frame_pacer.GetPresentIntervalUs() / 1000.0,
+					m_frame_pacer.GetPresentJitterUs() / 1000.0);
+			}
+			if (g_ActiveConfig.bWorkloadGovernor && m_workload_governor.GetLevel() > 0)
+				final_cyan += StringFromFormat(" [gov %d]", m_workload_governor.GetLevel());
+		}
 
 		if (g_ActiveConfig.bShowFPS && SConfig::GetInstance().m_ShowFrameCount)
 			final_cyan += " - ";
@@ -328,6 +370,13 @@ void Renderer::DrawDebugText()
 		final_yellow += "\n";
 	}
 
+	if (PerfHud::IsEnabled())
+	{
+		const std::string hud = PerfHud::Render(VideoInterface::GetTargetRefreshRate());
+		final_cyan += hud;
+		final_yellow.append(std::count(hud.begin(), hud.end(), '\n'), '\n');
+	}
+
 	if (SConfig::GetInstance().m_ShowLag)
 	{
 		final_cyan += StringFromFormat("Lag: %" PRIu64 "\n", Movie::GetCurrentLagCount());
@@ -737,6 +786,8 @@ void Renderer::RecordVideoMemory()
 
 void Renderer::Swap(u32 xfbAddr, u32 fbWidth, u32 fbStride, u32 fbHeight, const EFBRectangle& rc, u64 ticks, float Gamma)
 {
+	TRACE_EVENT("Renderer::Swap");
+
 	// Heuristic to detect if a GameCube game is in 16:9 anamorphic widescreen mode.
 	if (!SConfig::GetInstance().bWii)
 	{
@@ -753,15 +804,76 @@ void Renderer::Swap(u32 xfbAddr, u32 fbWidth, u32 fbStride, u32 fbHeight, const
 			m_aspect_wide = flush_count_anamorphic > 0.75 * flush_total;
 	}
 
-	// TODO: merge more generic parts into VideoCommon
-	SwapImpl(xfbAddr, fbWidth, fbStride, fbHeight, rc, ticks, Gamma);
+	// Deferred EFB copies must be in RAM before the frame is considered done;
+	// this also bounds how long a readback can stay in flight.
+	g_texture_cache->FlushEFBCopies();
+
+	// Hold the present to the next slot on the emulated refresh cadence, so
+	// displays running at a multiple of it show every frame for the same
+	// number of vsyncs (2:2 pulldown for 60Hz content on a 120Hz display).
+	if (!Core::GetIsThrottlerTempDisabled())
+	{
+		PerfHud::ScopedTimer pacer_timer(PerfHud::SLOT_PRESENT_WAIT);
+		m_frame_pacer.ScheduleNextPresent(VideoInterface::GetTargetRefreshRate());
+	}
+
+	// Verification turbo replay: nobody is watching, so don't present at all.
+	// The EFB copies above already reached RAM, which is all the emulated
+	// software can observe. Only the per-frame housekeeping the backends
+	// normally do in SwapImpl is kept, so long replays don't leak caches.
+	if (Movie::IsTurboPlayback())
+	{
+		g_texture_cache->Cleanup(frameCount);
+		UpdateActiveConfig();
+		g_texture_cache->OnConfigChanged(g_ActiveConfig);
+	}
+	else
+	{
+		PerfHud::ScopedTimer present_timer(PerfHud::SLOT_DRAW);
+		// TODO: merge more generic parts into VideoCommon
+		EFBRectangle direct_rc;
+		float direct_gamma;
+		if (g_ActiveConfig.bXFBDirectPresent && g_ActiveConfig.VirtualXFBEnabled() &&
+			FramebufferManagerBase::ConsumeDeferredXFBCopy(xfbAddr, fbStride, fbHeight, &direct_rc, &direct_gamma))
+		{
+			// The EFB->XFB copy for this present is still deferred and the EFB has
+			// not been written since, so the EFB itself is the presented image.
+			// Route the present through the backend's direct EFB path for this one
+			// frame, skipping both the copy and the XFB sampling pass.
+			g_ActiveConfig.bUseXFB = false;
+			SwapImpl(xfbAddr, fbWidth, fbStride, fbHeight, direct_rc, ticks, direct_gamma);
+			g_ActiveConfig.bUseXFB = true;
+		}
+		else
+		{
+			SwapImpl(xfbAddr, fbWidth, fbStride, fbHeight, rc, ticks, Gamma);
+		}
+	}
+
+	// Designated readback slot: any capture-class work queued while SwapImpl
+	// ran (frame dump / screenshot handoffs) executes here, right after
+	// present, so it never interleaves with draw submission.
+	ServiceReadbackWork();
 
 	if (m_xfb_written)
+	{
+		PerfHud::EndFrame();
 		m_fps_counter.Update();
+		m_frame_pacer.Update();
+		// Fast-forward frames are uncapped and would read as endless headroom.
+		if (!Core::GetIsThrottlerTempDisabled())
+			m_workload_governor.Update(VideoInterface::GetTargetRefreshRate());
+	}
 
 	frameCount++;
 	GFX_DEBUGGER_PAUSE_AT(NEXT_FRAME, true);
 
+	// Snapshot the per-frame statistics onto the trace timeline before they
+	// are reset, so each frame's counters line up with its Swap slice.
+	TRACE_COUNTER("draw calls", stats.thisFrame.numDrawCalls);
+	TRACE_COUNTER("primitives", stats.thisFrame.numPrims);
+	TRACE_COUNTER("vertex stream kB", stats.thisFrame.bytesVertexStreamed / 1024);
+
 	// Begin new frame
 	// Set default viewport and scissor, for the clear to work correctly
 	// New frame
@@ -790,16 +902,43 @@ void Renderer::ShutdownFrameDumping()
 	if (!m_frame_dump_thread_running.IsSet())
 		return;
 
-	FinishFrameData();
+	WaitForFrameData();
+	if (m_frame_dump_frames_dropped)
+	{
+		WARN_LOG(VIDEO, "Frame dump dropped %u frames behind a slow encode.",
+			m_frame_dump_frames_dropped);
+		m_frame_dump_frames_dropped = 0;
+	}
 	m_frame_dump_thread_running.Clear();
 	m_frame_dump_start.Set();
+
+	// Let the in-flight worker-pool encodes finish before reporting the dump
+	// as stopped (and before the renderer they capture goes away).
+	WaitForPendingEncodes(0);
 }
 
 void Renderer::DumpFrameData(const u8* data, int w, int h, int stride, const AVIDump::Frame& state, bool swap_upside_down, bool bgra)
 {
-	FinishFrameData();
+	if (m_frame_dump_frame_running)
+	{
+		// If the encoder is still chewing on the previous frame, drop this
+		// one instead of stalling emulation behind it. Screenshots are
+		// explicit user requests, so those always wait their turn.
+		if (m_frame_dump_busy.IsSet() && !m_screenshot_request.IsSet())
+		{
+			m_frame_dump_frames_dropped++;
+			return;
+		}
+		WaitForFrameData();
+	}
 
-	m_frame_dump_config = FrameDumpConfig{ data, w, h, stride, swap_upside_down, bgra, state };
+	// Copy the frame out of the backend's staging memory so it can be reused
+	// immediately and the encoder works from stable data.
+	std::vector<u8>& buffer = m_frame_dump_buffers[m_frame_dump_buffer_index];
+	m_frame_dump_buffer_index ^= 1;
+	buffer.assign(data, data + (size_t)stride * h);
+
+	m_frame_dump_config = FrameDumpConfig{ buffer.data(), w, h, stride, swap_upside_down, bgra, state };
 
 	if (!m_frame_dump_thread_running.IsSet())
 	{
@@ -809,11 +948,24 @@ void Renderer::DumpFrameData(const u8* data, int w, int h, int stride, const AVI
 		m_frame_dump_thread = std::thread(&Renderer::RunFrameDumps, this);
 	}
 
+	m_frame_dump_busy.Set();
 	m_frame_dump_start.Set();
 	m_frame_dump_frame_running = true;
 }
 
 void Renderer::FinishFrameData()
+{
+	if (!m_frame_dump_frame_running)
+		return;
+
+	// DumpFrameData already copied the frame out of the caller's staging
+	// memory, so nothing needs to complete before the backend reuses its
+	// buffers. Park the wait for the encoder in the post-present slot instead
+	// of stalling draw submission behind it here, mid-SwapImpl.
+	ScheduleReadbackWork([this]() { WaitForFrameData(); });
+}
+
+void Renderer::WaitForFrameData()
 {
 	if (!m_frame_dump_frame_running)
 		return;
@@ -822,6 +974,20 @@ void Renderer::FinishFrameData()
 	m_frame_dump_frame_running = false;
 }
 
+void Renderer::ScheduleReadbackWork(std::function<void()> work)
+{
+	m_readback_work.push_back(std::move(work));
+}
+
+void Renderer::ServiceReadbackWork()
+{
+	// Scheduled work may queue follow-up work; index-based so the vector can
+	// grow while we walk it.
+	for (size_t i = 0; i < m_readback_work.size(); i++)
+		m_readback_work[i]();
+	m_readback_work.clear();
+}
+
 void Renderer::RunFrameDumps()
 {
 	Common::SetCurrentThreadName("FrameDumping");
@@ -857,13 +1023,28 @@ void Renderer::RunFrameDumps()
 		{
 			std::lock_guard<std::mutex> lk(m_screenshot_lock);
 
-			if (TextureToPng(config.data, config.stride, m_screenshot_name, config.width, config.height,
-				false))
-				OSD::AddMessage("Screenshot saved to " + m_screenshot_name);
+			// Hand the encode to the worker pool with its own copy of the
+			// frame; this thread (and with it the video thread waiting in
+			// FinishFrameData) resumes after just a copy instead of stalling
+			// behind the PNG compressor.
+			auto image = std::make_shared<std::vector<u8>>(
+				CopyFrameForEncode(config.data, config.stride, config.width, config.height));
+			const std::string filename = m_screenshot_name;
+			const int width = config.width;
+			const int height = config.height;
+			WaitForPendingEncodes(MAX_PENDING_PNG_ENCODES - 1);
+			s_pending_png_encodes++;
+			Common::AsyncWorker::ExecuteAsync([this, image, filename, width, height]() {
+				if (TextureToPng(image->data(), width * 4, filename, width, height, false))
+					OSD::AddMessage("Screenshot saved to " + filename);
+				// Signalled once the file is written, so SaveScreenshot's
+				// wait_for_completion keeps meaning "on disk".
+				m_screenshot_completed.Set();
+				s_pending_png_encodes--;
+			});
 
 			// Reset settings
 			m_screenshot_name.clear();
-			m_screenshot_completed.Set();
 		}
 
 		if (SConfig::GetInstance().m_DumpFrames)
@@ -891,6 +1072,7 @@ void Renderer::RunFrameDumps()
 		}
 
 		m_frame_dump_done.Set();
+		m_frame_dump_busy.Clear();
 	}
 
 	if (frame_dump_started)
@@ -963,7 +1145,21 @@ bool Renderer::StartFrameDumpToImage(const FrameDumpConfig& config)
 void Renderer::DumpFrameToImage(const FrameDumpConfig& config)
 {
 	std::string filename = GetFrameDumpNextImageFileName();
-	TextureToPng(config.data, config.stride, filename, config.width, config.height, false);
+
+	// Sequence captures encode on the worker pool too, so several frames
+	// compress in parallel and this thread goes back to accepting frames
+	// after a copy. The bound makes a burst stall here rather than queue
+	// frames without limit.
+	auto image = std::make_shared<std::vector<u8>>(
+		CopyFrameForEncode(config.data, config.stride, config.width, config.height));
+	const int width = config.width;
+	const int height = config.height;
+	WaitForPendingEncodes(MAX_PENDING_PNG_ENCODES - 1);
+	s_pending_png_encodes++;
+	Common::AsyncWorker::ExecuteAsync([image, filename, width, height]() {
+		TextureToPng(image->data(), width * 4, filename, width, height, false);
+		s_pending_png_encodes--;
+	});
 	m_frame_dump_image_counter++;
 }
 
@@ -14,6 +14,7 @@
 
 #pragma once
 #include <condition_variable>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -29,6 +30,8 @@
 
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/FPSCounter.h"
+#include "VideoCommon/FramePacer.h"
+#include "VideoCommon/WorkloadGovernor.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoCommon.h"
 
@@ -150,17 +153,26 @@ public:
 	// This is called when the surface is resized (WX) or the window changes (Android).
 	virtual void ChangeSurface(void* new_surface_handle) {}
 	bool UseVertexDepthRange() const;
+
+	// Snapshots the live video register state into the FIFO recorder. Also
+	// called by the recorder itself when it rotates flight recording segments.
+	static void RecordVideoMemory();
 protected:
 	std::tuple<int, int> CalculateTargetScale(int x, int y) const;
 	bool CalculateTargetSize(int multiplier = 1);
 
 	static void CheckFifoRecording();
-	static void RecordVideoMemory();
 
 	bool IsFrameDumping();
 	void DumpFrameData(const u8* data, int w, int h, int stride, const AVIDump::Frame& state, bool swap_upside_down = false, bool bgra = false);
 	void FinishFrameData();
 
+	// Parks readback-class work (waiting on the frame dump encoder, etc.) in
+	// the designated post-present slot instead of running it in the middle of
+	// SwapImpl, where it would sit between draw submission and present. Video
+	// thread only.
+	void ScheduleReadbackWork(std::function<void()> work);
+
 	Common::Flag m_screenshot_request;
 	Common::Event m_screenshot_completed;
 	std::mutex m_screenshot_lock;
@@ -180,6 +192,8 @@ protected:
 	bool m_xfb_written{};
 
 	FPSCounter m_fps_counter;
+	FramePacer m_frame_pacer;
+	WorkloadGovernor m_workload_governor;
 
 	std::unique_ptr<PostProcessor> m_post_processor;
 
@@ -191,6 +205,8 @@ protected:
 private:
 	void RunFrameDumps();
 	void ShutdownFrameDumping();
+	void WaitForFrameData();
+	void ServiceReadbackWork();
 	PEControl::PixelFormat m_prev_efb_format = PEControl::INVALID_FMT;
 	unsigned int m_efb_scale_numeratorX = 1;
 	unsigned int m_efb_scale_numeratorY = 1;
@@ -202,13 +218,24 @@ private:
 	int m_last_window_request_width = 0;
 	int m_last_window_request_height = 0;
 
+	// Work queued via ScheduleReadbackWork, serviced once per frame in Swap()
+	// right after present. Video thread only, so no locking.
+	std::vector<std::function<void()>> m_readback_work;
+
 	// frame dumping
 	std::thread m_frame_dump_thread;
 	Common::Event m_frame_dump_start;
 	Common::Event m_frame_dump_done;
 	Common::Flag m_frame_dump_thread_running;
+	Common::Flag m_frame_dump_busy;
 	u32 m_frame_dump_image_counter = 0;
 	bool m_frame_dump_frame_running = false;
+	// Frames are copied out of the backend's staging memory into these
+	// rotating buffers, so the encoder never borrows backend storage and the
+	// handoff can drop frames instead of stalling behind a slow encode.
+	std::vector<u8> m_frame_dump_buffers[2];
+	int m_frame_dump_buffer_index = 0;
+	u32 m_frame_dump_frames_dropped = 0;
 
 	struct FrameDumpConfig
 	{
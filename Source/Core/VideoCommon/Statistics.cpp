@@ -44,6 +44,13 @@ std::string Statistics::ToString()
 	}
 	str += StringFromFormat("Textures created: %i\n", stats.numTexturesCreated);
 	str += StringFromFormat("Textures alive: %i\n", stats.numTexturesAlive);
+	str += StringFromFormat("Textures recycled: %i\n", stats.numTexturesRecycled);
+	str += StringFromFormat("Texture pool: %i entries (%i MB)\n", stats.numTexturesPooled,
+		stats.texturePoolMemoryMB);
+	str += StringFromFormat("Texture lookups: %i (%i fast, avg probe %.2f)\n",
+		stats.thisFrame.numTexCacheLookups, stats.thisFrame.numTexCacheHits,
+		stats.thisFrame.numTexCacheLookups ?
+		(float)stats.thisFrame.numTexCacheProbes / stats.thisFrame.numTexCacheLookups : 0.0f);
 	str += StringFromFormat("pshaders created: %i\n", stats.numPixelShadersCreated);
 	str += StringFromFormat("pshaders alive: %i\n", stats.numPixelShadersAlive);
 	str += StringFromFormat("vshaders created: %i\n", stats.numVertexShadersCreated);
@@ -56,8 +63,10 @@ std::string Statistics::ToString()
 	str += StringFromFormat("dshaders alive: %i\n", stats.numDomainShadersAlive);
 	str += StringFromFormat("shaders changes: %i\n", stats.thisFrame.numShaderChanges);
 	str += StringFromFormat("dlists called: %i\n", stats.thisFrame.numDListsCalled);
+	str += StringFromFormat("dlist bytes: %i kB\n", stats.thisFrame.bytesDListsExecuted / 1024);
 	str += StringFromFormat("Primitive joins: %i\n", stats.thisFrame.numPrimitiveJoins);
 	str += StringFromFormat("Draw calls: %i\n", stats.thisFrame.numDrawCalls);
+	str += StringFromFormat("EFB clears merged: %i\n", stats.thisFrame.numEFBClearsMerged);
 	str += StringFromFormat("Primitives: %i\n", stats.thisFrame.numPrims);
 	str += StringFromFormat("Primitives (DL): %i\n", stats.thisFrame.numDLPrims);
 	str += StringFromFormat("XF loads: %i\n", stats.thisFrame.numXFLoads);
@@ -68,6 +77,8 @@ std::string Statistics::ToString()
 	str += StringFromFormat("BP loads (DL): %i\n", stats.thisFrame.numBPLoadsInDL);
 	str += StringFromFormat("Vertex streamed: %i kB\n", stats.thisFrame.bytesVertexStreamed / 1024);
 	str += StringFromFormat("Index streamed: %i kB\n", stats.thisFrame.bytesIndexStreamed / 1024);
+	str += StringFromFormat("Vertex deduped: %i kB\n", stats.thisFrame.bytesVertexDeduplicated / 1024);
+	str += StringFromFormat("Index deduped: %i kB\n", stats.thisFrame.bytesIndexDeduplicated / 1024);
 	str += StringFromFormat("Uniform streamed: %i kB\n", stats.thisFrame.bytesUniformStreamed / 1024);
 	str += StringFromFormat("Vertex Loaders: %i\n", stats.numVertexLoaders);
 
@@ -21,6 +21,9 @@ struct Statistics
 
 	int numTexturesCreated;
 	int numTexturesAlive;
+	int numTexturesRecycled;
+	int numTexturesPooled;
+	int texturePoolMemoryMB;
 
 	int numVertexLoaders;
 
@@ -47,8 +50,10 @@ struct Statistics
 
 		int numPrimitiveJoins;
 		int numDrawCalls;
+		int numEFBClearsMerged;
 
 		int numDListsCalled;
+		int bytesDListsExecuted;
 
 		int bytesVertexStreamed;
 		int bytesIndexStreamed;
@@ -64,6 +69,13 @@ struct Statistics
 		int numVerticesLoaded;
 		int tevPixelsIn;
 		int tevPixelsOut;
+
+		int numTexCacheLookups;
+		int numTexCacheHits;
+		int numTexCacheProbes;
+
+		int bytesVertexDeduplicated;
+		int bytesIndexDeduplicated;
 	};
 	ThisFrame thisFrame;
 	void ResetFrame();
@@ -2,15 +2,19 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
 
 #include "Common/Align.h"
+#include "Common/CPUDetect.h"
 #include "Common/FileUtil.h"
 #include "Common/MemoryUtil.h"
+#include "Common/PerformanceHud.h"
 #include "Common/StringUtil.h"
+#include "Common/ThreadPool.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/FifoPlayer/FifoPlayer.h"
@@ -74,6 +78,59 @@ void TextureCacheBase::Invalidate()
 	}
 	textures_by_address.clear();
 	textures_by_hash.clear();
+	lookup_by_address.Clear();
+	lookup_by_hash.Clear();
+	hash_gates.clear();
+	efb_copy_usage.clear();
+}
+
+// Tiered re-hash for safe texture cache accuracy. With ColorSamples == 0 every
+// use of a texture pays a full hash over guest memory, which dominates Load()
+// in some games even though most textures never change. Hash a small sampled
+// subset first and only pay the full hash when the sample moves. Because a
+// sparse sample can miss a mutation, a gate that reports "unchanged" is only
+// trusted for verify_interval uses before being re-checked against a full
+// hash; stable textures earn longer intervals, and a texture whose mutation
+// slipped past the sample gets a denser sample and frequent verification.
+u64 TextureCacheBase::GatedTextureHash(const u8* data, u32 size, u32 address)
+{
+	// Gate only the expensive case: full hashing of textures that span many
+	// cache lines. Everything else goes through the configured path directly.
+	if (g_ActiveConfig.iSafeTextureCache_ColorSamples != 0 || size <= 2048)
+		return GetHash64(data, size, g_ActiveConfig.iSafeTextureCache_ColorSamples);
+
+	HashGate& gate = hash_gates[address];
+	const u64 sample_hash = GetHash64(data, size, gate.samples);
+
+	if (gate.size == size && gate.sample_hash == sample_hash)
+	{
+		if (++gate.uses_since_verify < gate.verify_interval)
+			return gate.full_hash;
+
+		gate.uses_since_verify = 0;
+		const u64 full_hash = GetHash64(data, size, 0);
+		if (full_hash == gate.full_hash)
+		{
+			// Stable texture: verify less often.
+			gate.verify_interval = std::min(gate.verify_interval * 2, 256u);
+		}
+		else
+		{
+			// The sample missed a mutation. Sample this address more densely
+			// from now on and drop back to frequent verification.
+			gate.samples = std::min(gate.samples * 2, 512u);
+			gate.verify_interval = 8;
+			gate.full_hash = full_hash;
+		}
+		return gate.full_hash;
+	}
+
+	// New texture, resize, or the sample caught a change: full hash, re-arm.
+	gate.size = size;
+	gate.sample_hash = sample_hash;
+	gate.full_hash = GetHash64(data, size, 0);
+	gate.uses_since_verify = 0;
+	return gate.full_hash;
 }
 
 TextureCacheBase::~TextureCacheBase()
@@ -187,6 +244,35 @@ void TextureCacheBase::Cleanup(s32 _frameCount)
 			++iter;
 		}
 	}
+	// Forget copy destinations the game stopped copying to, so a stale dead
+	// streak can't suppress a copy if the address is reused much later.
+	auto usage_iter = efb_copy_usage.begin();
+	while (usage_iter != efb_copy_usage.end())
+	{
+		if (usage_iter->second.last_copy_frame == FRAMECOUNT_INVALID)
+		{
+			usage_iter->second.last_copy_frame = _frameCount;
+		}
+		if (_frameCount > texture_kill_threshold + usage_iter->second.last_copy_frame)
+		{
+			usage_iter = efb_copy_usage.erase(usage_iter);
+		}
+		else
+		{
+			++usage_iter;
+		}
+	}
+	// While the pool is under half the memory limit keep entries warm for as
+	// long as live textures: a scene transition dumps its working set here and
+	// takes most of it back a moment later, and re-creating those objects is
+	// where the driver stalls. Frees of genuinely stale entries are spread
+	// over several frames for the same reason, unless the limit is exceeded.
+	s32 pool_kill_threshold = TEXTURE_POOL_KILL_THRESHOLD;
+	if (texture_pool_memory_usage < (TEXTURE_POOL_MEMORY_LIMIT / 2))
+	{
+		pool_kill_threshold = TEXTURE_KILL_THRESHOLD;
+	}
+	int frees_left = TEXTURE_POOL_FREES_PER_FRAME;
 	TexPool::iterator iter2 = texture_pool.begin();
 	TexPool::iterator tcend2 = texture_pool.end();
 	while (iter2 != tcend2)
@@ -195,8 +281,11 @@ void TextureCacheBase::Cleanup(s32 _frameCount)
 		{
 			iter2->second->frameCount = _frameCount;
 		}
-		if (_frameCount > TEXTURE_POOL_KILL_THRESHOLD + iter2->second->frameCount)
+		if (_frameCount > pool_kill_threshold + iter2->second->frameCount &&
+			(frees_left > 0 || texture_pool_memory_usage >= TEXTURE_POOL_MEMORY_LIMIT))
 		{
+			if (frees_left > 0)
+				frees_left--;
 			texture_pool_memory_usage -= iter2->second->native_size_in_bytes;
 			delete iter2->second;
 			iter2 = texture_pool.erase(iter2);
@@ -206,6 +295,8 @@ void TextureCacheBase::Cleanup(s32 _frameCount)
 			++iter2;
 		}
 	}
+	SETSTAT(stats.numTexturesPooled, texture_pool.size());
+	SETSTAT(stats.texturePoolMemoryMB, texture_pool_memory_usage / (1024 * 1024));
 }
 
 bool TextureCacheBase::TCacheEntryBase::OverlapsMemoryRange(u32 range_address, u32 range_size) const
@@ -247,6 +338,65 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::ApplyPaletteToEntry(TCacheE
 	return nullptr;
 }
 
+TextureCacheBase::TCacheEntryBase* TextureCacheBase::CreateIndexedEntry(u32 address, u32 texformat,
+	u64 tex_hash, u32 native_width, u32 native_height, u32 expanded_width, u32 expanded_height,
+	const u8* src_data, u32 texture_size)
+{
+	TCacheEntryConfig config;
+	config.width = native_width;
+	config.height = native_height;
+	config.pcformat = PC_TEX_FMT_RGBA32;
+	TCacheEntryBase* entry = AllocateTexture(config);
+	if (!entry)
+		return nullptr;
+
+	// Decode only the index plane. C4 and C8 share their memory layout with I4
+	// and I8, and the intensity expansion is exactly the red channel encoding
+	// Palettize() samples (red times 15 respectively 255 yields the index), so
+	// the regular decoder does the job without touching the TLUT.
+	TexDecoder_Decode(TextureCacheBase::temp, src_data, expanded_width, expanded_height,
+		texformat == GX_TF_C4 ? GX_TF_I4 : GX_TF_I8, 0, GX_TL_IA8, true, false);
+	entry->Load(TextureCacheBase::temp, native_width, native_height, expanded_width, 0);
+
+	entry->SetGeneralParameters(address, texture_size, texformat);
+	entry->SetDimensions(native_width, native_height, 1);
+	entry->SetHashes(tex_hash, tex_hash);
+	entry->is_index_texture = true;
+	textures_by_address.emplace(address, entry);
+	return entry;
+}
+
+TextureCacheBase::TCacheEntryBase* TextureCacheBase::ApplyPaletteToIndexedEntry(
+	TCacheEntryBase* index_entry, u64 full_hash, u32 full_format, u32 tlutaddr, u32 tlutfmt,
+	u32 palette_size)
+{
+	TCacheEntryConfig newconfig;
+	newconfig.rendertarget = true;
+	newconfig.pcformat = PC_TEX_FMT_RGBA32;
+	newconfig.width = index_entry->config.width;
+	newconfig.height = index_entry->config.height;
+	newconfig.layers = index_entry->config.layers;
+	TCacheEntryBase* decoded_entry = AllocateTexture(newconfig);
+	if (!decoded_entry)
+		return nullptr;
+
+	decoded_entry->SetGeneralParameters(index_entry->addr, index_entry->size_in_bytes, full_format);
+	decoded_entry->SetDimensions(index_entry->native_width, index_entry->native_height, 1);
+	decoded_entry->SetHashes(full_hash, index_entry->base_hash);
+	decoded_entry->frameCount = FRAMECOUNT_INVALID;
+	decoded_entry->is_efb_copy = false;
+	g_texture_cache->LoadLut(tlutfmt, &texMem[tlutaddr], palette_size);
+	auto iter = textures_by_address.emplace(index_entry->addr, decoded_entry);
+	if (g_texture_cache->Palettize(decoded_entry, index_entry))
+	{
+		// The index plane was useful this frame, keep it alive.
+		index_entry->frameCount = FRAMECOUNT_INVALID;
+		return decoded_entry;
+	}
+	InvalidateTexture(iter);
+	return nullptr;
+}
+
 void TextureCacheBase::ScaleTextureCacheEntryTo(TextureCacheBase::TCacheEntryBase** entry, u32 new_width, u32 new_height)
 {
 	if ((*entry)->config.width == new_width && (*entry)->config.height == new_height)
@@ -460,6 +610,18 @@ void TextureCacheBase::DumpTexture(TCacheEntryBase* entry, std::string basename,
 // Used by TextureCacheBase::Load
 TextureCacheBase::TCacheEntryBase* TextureCacheBase::ReturnEntry(u32 stage, TCacheEntryBase* entry)
 {
+	// A load from a tracked copy destination proves that destination live -
+	// whether it hit the VRAM copy itself or a texture decoded from the copy's
+	// RAM shadow - so dead-copy elimination must stop skipping it.
+	if (!efb_copy_usage.empty())
+	{
+		auto usage = efb_copy_usage.find(entry->addr);
+		if (usage != efb_copy_usage.end())
+		{
+			usage->second.sampled = true;
+			usage->second.dead_streak = 0;
+		}
+	}
 	entry->frameCount = FRAMECOUNT_INVALID;
 	bound_textures[stage] = entry;
 	s_last_texture = std::max(s_last_texture, stage);
@@ -480,8 +642,64 @@ void TextureCacheBase::UnbindTextures()
 	bound_textures.fill(nullptr);
 }
 
+// Resolves a large cache miss decode across the thread pool. The texture is
+// split into strips of whole tile rows and every strip decodes independently
+// into dst. The video thread claims strips as well, so completion never
+// depends on pool scheduling, and we only return once every strip has been
+// written - binds (and EFB-sourced partial updates) stay strictly ordered.
+static void DecodeTextureParallel(u8* dst, const u8* src, u32 expandedWidth, u32 expandedHeight,
+	u32 texformat, u32 tlutaddr, TlutFormat tlutfmt)
+{
+	struct DecodeState
+	{
+		std::atomic<u32> next_strip{ 0 };
+		std::atomic<u32> done_strips{ 0 };
+	};
+	const u32 bsh = TexDecoder_GetBlockHeightInTexels(texformat);
+	u32 strip_height = std::max(expandedHeight / static_cast<u32>(cpu_info.num_cores), 32u);
+	strip_height = Common::AlignUpSizePow2(strip_height, bsh);
+	const u32 num_strips = (expandedHeight + strip_height - 1) / strip_height;
+	const u32 src_stride = TexDecoder_GetTextureSizeInBytes(expandedWidth, strip_height, texformat);
+	const u32 dst_stride = expandedWidth * strip_height * sizeof(u32);
+	std::shared_ptr<DecodeState> state = std::make_shared<DecodeState>();
+	auto decode_strips = [=]()
+	{
+		u32 strip;
+		while ((strip = state->next_strip.fetch_add(1)) < num_strips)
+		{
+			const u32 row = strip * strip_height;
+			const u32 rows = std::min(strip_height, expandedHeight - row);
+			TexDecoder_Decode(dst + (size_t)strip * dst_stride, src + (size_t)strip * src_stride,
+				expandedWidth, rows, texformat, tlutaddr, tlutfmt, true, false);
+			state->done_strips.fetch_add(1);
+		}
+	};
+	for (u32 i = 1; i < num_strips; i++)
+	{
+		Common::AsyncWorker::ExecuteAsync(std::function<void()>(decode_strips));
+	}
+	decode_strips();
+	// Tasks that were still queued when we drained the strip counter exit
+	// without touching dst, so waiting on the strips actually decoded is enough.
+	u32 loopcount = 0;
+	while (state->done_strips.load() < num_strips)
+	{
+		Common::cYield(loopcount++);
+	}
+}
+
+// Parallel decoding pays off once the texture is large enough to amortize the
+// task hand-off, and is only implemented for plain RGBA32 output (the format
+// overlay would be drawn per strip).
+static bool UseParallelDecode(PC_TexFormat pcfmt, u32 expandedHeight)
+{
+	return pcfmt == PC_TEX_FMT_RGBA32 && expandedHeight >= 128 && cpu_info.num_cores > 2 &&
+		!g_ActiveConfig.bTexFmtOverlayEnable;
+}
+
 TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 {
+	PerfHud::ScopedTimer hud_timer(PerfHud::SLOT_TEXTURE);
 	const FourTexUnits &tex = bpmem.tex[stage >> 2];
 	const u32 id = stage & 3;
 	const u32 address = (tex.texImage3[id].image_base/* & 0x1FFFFF*/) << 5;
@@ -530,6 +748,16 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 											// e.g. 64x64 with 7 LODs would have the mipmap chain 64x64,32x32,16x16,8x8,4x4,2x2,1x1,0x0, so we limit the mipmap count to 6 there
 	tex_levels = std::min<u32>(IntLog2(std::max(width, height)) + 1, tex_levels);
 
+	// A C4/C8 texture whose TLUT is animated can keep its index plane on the
+	// GPU and convert each new palette with a shader pass; see below. Formats
+	// the Palettize() multiplier can't express (C14X2), mipmapped textures and
+	// anything hires/scaling/dumping might replace stay on the CPU decoder.
+	const bool use_index_fast_path =
+		(texformat == GX_TF_C4 || texformat == GX_TF_C8) && tex_levels == 1 && !from_tmem &&
+		g_ActiveConfig.backend_info.bSupportsPaletteConversion &&
+		!g_ActiveConfig.bHiresTextures && !g_ActiveConfig.bDumpTextures &&
+		!(g_ActiveConfig.iTexScalingType > 0 && width < 384 && height < 384);
+
 	for (u32 level = 1; level != tex_levels; ++level)
 	{
 		// We still need to calculate the original size of the mips
@@ -556,8 +784,13 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 	if (g_bRecordFifoData && !from_tmem)
 		FifoRecorder::GetInstance().UseMemory(address, texture_size + additional_mips_size, MemoryUpdate::TEXTURE_MAP);
 
-	// TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data from the low tmem bank than it should)	
-	tex_hash = GetHash64(src_data, texture_size, g_ActiveConfig.iSafeTextureCache_ColorSamples);
+	// TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data from the low tmem bank than it should)
+	// TMEM content is not tied to the guest address, so only RAM textures go
+	// through the tiered gate.
+	if (from_tmem)
+		tex_hash = GetHash64(src_data, texture_size, g_ActiveConfig.iSafeTextureCache_ColorSamples);
+	else
+		tex_hash = GatedTextureHash(src_data, texture_size, address);
 	u32 palette_size = std::min(TexDecoder_GetPaletteSize(texformat), TMEM_SIZE - tlutaddr);
 	if (isPaletteTexture)
 	{
@@ -568,6 +801,37 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 	{
 		full_hash = tex_hash;
 	}
+	// Fast path: probe the open-addressing memo of previous lookup results for
+	// this address. A hit still has to pass exactly the validation the multimap
+	// walk below would apply, since the memo can be stale in either direction.
+	if (TCacheEntryBase* fast_entry = lookup_by_address.Lookup(address))
+	{
+		if (fast_entry->addr == address)
+		{
+			if (fast_entry->IsEfbCopy())
+			{
+				if (!isPaletteTexture && fast_entry->native_width >= nativeW &&
+					fast_entry->native_height >= nativeH &&
+					fast_entry->memory_stride == fast_entry->BytesPerRow() &&
+					(g_ActiveConfig.bSkipEFBCopyToRam || tex_hash == fast_entry->hash ||
+						IsPlayingBackFifologWithBrokenEFBCopies))
+				{
+					return ReturnEntry(stage, fast_entry);
+				}
+			}
+			else if (fast_entry->hash == full_hash && fast_entry->format == full_format &&
+				fast_entry->native_levels >= tex_levels && fast_entry->native_width == nativeW &&
+				fast_entry->native_height == nativeH)
+			{
+				TCacheEntryBase* updated_entry =
+					DoPartialTextureUpdates(fast_entry, tlutaddr, tlutfmt, palette_size);
+				// Partial updates can replace the entry (rescaling), so refresh the memo.
+				lookup_by_address.Insert(address, updated_entry);
+				return ReturnEntry(stage, updated_entry);
+			}
+		}
+	}
+
 	// Search the texture cache for textures by address
 	//
 	// Find all texture cache entries for the current texture address, and decide whether to use one of
@@ -599,10 +863,22 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 	TexAddrCache::iterator oldest_entry = iter;
 	s32 temp_frameCount = 0x7fffffff;
 	TexAddrCache::iterator unconverted_copy = textures_by_address.end();
+	TCacheEntryBase* index_entry = nullptr;
+	bool has_palette_sibling = false;
 
 	while (iter != iter_range.second)
 	{
 		TCacheEntryBase* entry = iter->second;
+		// Index-plane entries only feed the palette fast path below; they never
+		// satisfy a lookup by themselves.
+		if (entry->is_index_texture)
+		{
+			if (use_index_fast_path && entry->base_hash == tex_hash &&
+				entry->native_width == nativeW && entry->native_height == nativeH)
+				index_entry = entry;
+			++iter;
+			continue;
+		}
 		// Do not load strided EFB copies, they are not meant to be used directly
 		if (entry->IsEfbCopy() && entry->native_width >= nativeW && entry->native_height >= nativeH &&
 			entry->memory_stride == entry->BytesPerRow())
@@ -617,7 +893,10 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 				// texture formats. I'm not sure what effect checking width/height/levels
 				// would have.
 				if (!isPaletteTexture)
+				{
+					lookup_by_address.Insert(address, entry);
 					return ReturnEntry(stage, entry);
+				}
 				// Note that we found an unconverted EFB copy, then continue. We'll
 				// perform the conversion later. Currently, we only convert EFB copies to
 				// palette textures; we could do other conversions if it proved to be
@@ -641,9 +920,14 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 				entry->native_width == nativeW && entry->native_height == nativeH)
 			{
 				entry = DoPartialTextureUpdates(iter->second, tlutaddr, tlutfmt, palette_size);
+				lookup_by_address.Insert(address, entry);
 				return ReturnEntry(stage, entry);
 			}
 		}
+		// The same index data seen with another TLUT means the palette is being
+		// animated; that unlocks the GPU conversion fast path below.
+		if (isPaletteTexture && entry->base_hash == tex_hash)
+			has_palette_sibling = true;
 		// Find the texture which hasn't been used for the longest time. Count paletted
 		// textures as the same texture here, when the texture itself is the same. This
 		// improves the performance a lot in some games that use paletted textures.
@@ -677,6 +961,17 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 	if (g_ActiveConfig.iSafeTextureCache_ColorSamples == 0 ||
 		std::max(texture_size, palette_size) <= (u32)g_ActiveConfig.iSafeTextureCache_ColorSamples * 8)
 	{
+		if (TCacheEntryBase* fast_entry = lookup_by_hash.Lookup(full_hash))
+		{
+			if (fast_entry->format == full_format && fast_entry->native_levels >= tex_levels &&
+				fast_entry->native_width == nativeW && fast_entry->native_height == nativeH)
+			{
+				TCacheEntryBase* updated_entry =
+					DoPartialTextureUpdates(fast_entry, tlutaddr, tlutfmt, palette_size);
+				lookup_by_hash.Insert(full_hash, updated_entry);
+				return ReturnEntry(stage, updated_entry);
+			}
+		}
 		auto hash_range = textures_by_hash.equal_range(full_hash);
 		TexHashCache::iterator hash_iter = hash_range.first;
 		while (hash_iter != hash_range.second)
@@ -687,12 +982,34 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 				entry->native_width == nativeW && entry->native_height == nativeH)
 			{
 				entry = DoPartialTextureUpdates(hash_iter->second, tlutaddr, tlutfmt, palette_size);
+				lookup_by_hash.Insert(full_hash, entry);
 				return ReturnEntry(stage, entry);
 			}
 			++hash_iter;
 		}
 	}
 
+	// Palette-animation fast path: once this C4/C8 texture has been seen with a
+	// second TLUT, its index plane gets cached as an entry of its own and every
+	// further palette costs one conversion pass on the GPU instead of a full
+	// CPU re-decode of the texture. Uploading the indices is paid once.
+	if (use_index_fast_path && (index_entry || has_palette_sibling))
+	{
+		if (!index_entry)
+			index_entry = CreateIndexedEntry(address, texformat, tex_hash, nativeW, nativeH,
+				expandedWidth, expandedHeight, src_data, texture_size);
+		if (index_entry)
+		{
+			TCacheEntryBase* decoded_entry = ApplyPaletteToIndexedEntry(
+				index_entry, full_hash, full_format, tlutaddr, tlutfmt, palette_size);
+			if (decoded_entry)
+			{
+				lookup_by_address.Insert(address, decoded_entry);
+				return ReturnEntry(stage, decoded_entry);
+			}
+		}
+	}
+
 	// If at least one entry was not used for the same frame, overwrite the oldest one
 	if (temp_frameCount != 0x7fffffff)
 	{
@@ -771,10 +1088,12 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 	GFX_DEBUGGER_PAUSE_AT(NEXT_NEW_TEXTURE, true);
 
 	iter = textures_by_address.emplace(address, entry);
+	lookup_by_address.Insert(address, entry);
 	if (g_ActiveConfig.iSafeTextureCache_ColorSamples == 0 ||
 		std::max(texture_size, palette_size) <= (u32)g_ActiveConfig.iSafeTextureCache_ColorSamples * 8)
 	{
 		entry->textures_by_hash_iter = textures_by_hash.emplace(full_hash, entry);
+		lookup_by_hash.Insert(full_hash, entry);
 	}
 
 	entry->SetGeneralParameters(address, texture_size, full_format);
@@ -838,6 +1157,12 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 				TexDecoder_DecodeRGBA8FromTmem(reinterpret_cast<u32*>(texturedata),
 					src_data, ptr_odd, expandedWidth, expandedHeight);
 			}
+			else if (UseParallelDecode(config.pcformat, expandedHeight))
+			{
+				DecodeTextureParallel(texturedata, src_data, expandedWidth,
+					expandedHeight, texformat, tlutaddr,
+					static_cast<TlutFormat>(tlutfmt));
+			}
 			else
 			{
 				TexDecoder_Decode(texturedata, src_data, expandedWidth,
@@ -1246,6 +1571,27 @@ void TextureCacheBase::CopyRenderTargetToTexture(u32 dstAddr, u32 dstFormat, u32
 		c_tex_h = g_renderer->EFBToScaledY(c_tex_h);
 	}
 
+	if (g_ActiveConfig.bSkipDeadEFBCopies)
+	{
+		EFBCopyUsage& usage = efb_copy_usage[dstAddr];
+		if (usage.sampled)
+			usage.dead_streak = 0;
+		else
+			usage.dead_streak++;
+		usage.sampled = false;
+		usage.last_copy_frame = FRAMECOUNT_INVALID;
+		if (usage.dead_streak > EFB_COPY_DEAD_THRESHOLD)
+		{
+			// Predicted dead: the last EFB_COPY_DEAD_THRESHOLD copies to this
+			// address were overwritten without ever being sampled, so skip the
+			// encode and the VRAM copy entirely. The previous copy's cache
+			// entry and RAM shadow stay in place - if the prediction is wrong
+			// the game samples last known data instead of garbage, and the
+			// streak reset in ReturnEntry() makes the next copy real again.
+			return;
+		}
+	}
+
 	// remove all texture cache entries at dstAddr
 	{
 		auto iter_range = textures_by_address.equal_range(dstAddr);
@@ -1394,6 +1740,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(u32 dstAddr, u32 dstFormat, u32
 			}
 
 			textures_by_address.emplace(dstAddr, entry);
+			lookup_by_address.Insert(dstAddr, entry);
 		}
 	}
 }
@@ -1406,6 +1753,7 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::AllocateTexture(const TCach
 	{
 		entry = iter->second;
 		texture_pool.erase(iter);
+		INCSTAT(stats.numTexturesRecycled);
 	}
 	else
 	{
@@ -1415,6 +1763,7 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::AllocateTexture(const TCach
 	}
 	entry->textures_by_hash_iter = textures_by_hash.end();
 	entry->may_have_overlapping_textures = true;
+	entry->is_index_texture = false;
 	return entry;
 }
 
@@ -1470,10 +1819,82 @@ TextureCacheBase::TexAddrCache::iterator TextureCacheBase::InvalidateTexture(Tex
 		return textures_by_address.end();
 
 	TCacheEntryBase* entry = iter->second;
+	// Drop any memo slots pointing at the dying entry. The hash-table memo is
+	// keyed by the lookup hash, which for scaled replacement entries ends up in
+	// base_hash (SetHashes swaps them), so probe under both.
+	lookup_by_address.Erase(entry->addr, entry);
+	lookup_by_hash.Erase(entry->hash, entry);
+	lookup_by_hash.Erase(entry->base_hash, entry);
 	DisposeTexture(iter->second);
 	return textures_by_address.erase(iter);
 }
 
+TextureCacheBase::TCacheEntryBase* TextureCacheBase::TexLookupTable::Lookup(u64 key)
+{
+	INCSTAT(stats.thisFrame.numTexCacheLookups);
+	const u32 first = FirstSlot(key);
+	for (u32 probe = 0; probe < MAX_PROBE_LENGTH; ++probe)
+	{
+		Slot& slot = m_slots[(first + probe) & (NUM_SLOTS - 1)];
+		if (slot.generation != m_generation)
+		{
+			// Never written this generation, so the key cannot be further along
+			// the probe chain either.
+			ADDSTAT(stats.thisFrame.numTexCacheProbes, probe + 1);
+			return nullptr;
+		}
+		if (slot.key == key)
+		{
+			INCSTAT(stats.thisFrame.numTexCacheHits);
+			ADDSTAT(stats.thisFrame.numTexCacheProbes, probe + 1);
+			return slot.entry;
+		}
+	}
+	ADDSTAT(stats.thisFrame.numTexCacheProbes, MAX_PROBE_LENGTH);
+	return nullptr;
+}
+
+void TextureCacheBase::TexLookupTable::Insert(u64 key, TCacheEntryBase* entry)
+{
+	const u32 first = FirstSlot(key);
+	for (u32 probe = 0; probe < MAX_PROBE_LENGTH; ++probe)
+	{
+		Slot& slot = m_slots[(first + probe) & (NUM_SLOTS - 1)];
+		if (slot.generation != m_generation || slot.key == key)
+		{
+			slot.key = key;
+			slot.generation = m_generation;
+			slot.entry = entry;
+			return;
+		}
+	}
+	// All probed slots hold live memos for other keys; evict the home slot.
+	// This is only a cache of the multimaps, so dropping a memo just means the
+	// next lookup for it goes the slow way once.
+	Slot& slot = m_slots[first];
+	slot.key = key;
+	slot.generation = m_generation;
+	slot.entry = entry;
+}
+
+void TextureCacheBase::TexLookupTable::Erase(u64 key, const TCacheEntryBase* entry)
+{
+	const u32 first = FirstSlot(key);
+	for (u32 probe = 0; probe < MAX_PROBE_LENGTH; ++probe)
+	{
+		Slot& slot = m_slots[(first + probe) & (NUM_SLOTS - 1)];
+		if (slot.generation != m_generation)
+			return;
+		if (slot.key == key && slot.entry == entry)
+		{
+			// Mark the slot stale. This cuts the probe chain for any memo that
+			// was pushed past it, which only costs those memos a slow lookup.
+			slot.generation = 0;
+			return;
+		}
+	}
+}
+
 std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
 TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
 {
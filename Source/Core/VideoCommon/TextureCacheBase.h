@@ -29,7 +29,13 @@ enum TextureCacheParams
 	TEXTURE_KILL_MULTIPLIER = 2,
 	TEXTURE_KILL_THRESHOLD = 120,
 	TEXTURE_POOL_KILL_THRESHOLD = 3,
-	TEXTURE_POOL_MEMORY_LIMIT = 64 * 1024 * 1024
+	TEXTURE_POOL_MEMORY_LIMIT = 64 * 1024 * 1024,
+	// Stale pool entries retired per Cleanup() call while under the memory
+	// limit; batching the frees is what shows up as a driver stall.
+	TEXTURE_POOL_FREES_PER_FRAME = 4,
+	// Consecutive unsampled copies to the same address before dead-copy
+	// elimination starts skipping them, see CopyRenderTargetToTexture().
+	EFB_COPY_DEAD_THRESHOLD = 8
 };
 
 class TextureCacheBase
@@ -116,6 +122,9 @@ public:
 
 		// common members
 		bool is_efb_copy = false;
+		// Holds only the index plane of a C4/C8 texture; feeds the GPU palette
+		// fast path and never satisfies a texture lookup by itself.
+		bool is_index_texture = false;
 		bool is_custom_tex = false;
 		bool is_scaled = false;
 		bool emissive_in_alpha = false;
@@ -255,6 +264,12 @@ public:
 		u32 num_blocks_y, u32 memory_stride,
 		bool is_depth_copy, const EFBRectangle& src_rect, bool scale_by_half) = 0;
 
+	// Called when the game is told the GPU is done (PE token/finish) and when a
+	// frame is presented. Backends that defer EFB-to-RAM readbacks must have
+	// written everything back to emulated RAM by the time this returns; the
+	// default is a no-op for backends whose CopyEFB is synchronous.
+	virtual void FlushEFBCopies() {}
+
 	virtual bool CompileShaders() = 0; // currently only implemented by OGL
 	virtual void DeleteShaders() = 0; // currently only implemented by OGL
 
@@ -291,8 +306,42 @@ private:
 	void CheckTempSize(size_t required_size);
 	TCacheEntryBase* DoPartialTextureUpdates(TCacheEntryBase* entry_to_update, u32 tlutaddr, u32 tlutfmt, u32 palette_size);
 	TextureCacheBase::TCacheEntryBase* ApplyPaletteToEntry(TCacheEntryBase* entry, u32 tlutaddr, u32 tlutfmt, u32 palette_size);
+	TCacheEntryBase* CreateIndexedEntry(u32 address, u32 texformat, u64 tex_hash, u32 native_width,
+		u32 native_height, u32 expanded_width, u32 expanded_height, const u8* src_data, u32 texture_size);
+	TCacheEntryBase* ApplyPaletteToIndexedEntry(TCacheEntryBase* index_entry, u64 full_hash,
+		u32 full_format, u32 tlutaddr, u32 tlutfmt, u32 palette_size);
 	void DumpTexture(TCacheEntryBase* entry, std::string basename, u32 level);
 
+	// Per-address state for the tiered re-hash gate, see GatedTextureHash().
+	struct HashGate
+	{
+		u64 sample_hash = 0;
+		u64 full_hash = 0;
+		u32 size = 0;
+		// How many 8-byte chunks the sampled pre-hash reads; grows when the
+		// sample is caught missing a mutation.
+		u32 samples = 32;
+		u32 uses_since_verify = 0;
+		// Full-hash re-verification period; grows while the texture is stable.
+		u32 verify_interval = 8;
+	};
+	u64 GatedTextureHash(const u8* data, u32 size, u32 address);
+
+	// Cross-frame usage history of one EFB copy destination. Many games issue
+	// copies whose result is overwritten by the next copy without ever being
+	// sampled; once EFB_COPY_DEAD_THRESHOLD copies in a row to an address went
+	// unsampled, CopyRenderTargetToTexture() predicts the next one is dead too
+	// and skips it. ReturnEntry() clears the streak as soon as the address is
+	// sampled again, so a wrong prediction self-corrects on the next copy.
+	struct EFBCopyUsage
+	{
+		u32 dead_streak = 0;
+		// Set when a texture load hit this address since the last copy.
+		bool sampled = false;
+		// Used to age entries out of the map, same scheme as TCacheEntryBase.
+		s32 last_copy_frame = FRAMECOUNT_INVALID;
+	};
+
 	TexPool::iterator FindMatchingTextureFromPool(const TCacheEntryConfig& config);
 	TexAddrCache::iterator GetTexCacheIter(TCacheEntryBase* entry);
 	TexAddrCache::iterator InvalidateTexture(TexAddrCache::iterator t_iter);
@@ -303,9 +352,47 @@ private:
 	std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
 		FindOverlappingTextures(u32 addr, u32 size_in_bytes);
 
+	// Open-addressing exact-match front table for the indices below. The
+	// multimaps stay authoritative - overlap invalidation needs their ordered
+	// range scans - but the hot Load() lookups probe here first: inline
+	// key+entry records with linear probing, so a hit costs a couple of cache
+	// lines instead of a tree walk. Slots are memos, never owners; a probe hit
+	// still has to pass the same validation as the multimap paths, and a full
+	// invalidation is one generation bump instead of an iteration.
+	class TexLookupTable
+	{
+	public:
+		TCacheEntryBase* Lookup(u64 key);
+		void Insert(u64 key, TCacheEntryBase* entry);
+		void Erase(u64 key, const TCacheEntryBase* entry);
+		void Clear() { m_generation++; }
+
+	private:
+		struct Slot
+		{
+			u64 key;
+			u32 generation;
+			TCacheEntryBase* entry;
+		};
+		static const u32 NUM_SLOTS = 2048;  // must stay a power of two
+		static const u32 MAX_PROBE_LENGTH = 8;
+		static u32 FirstSlot(u64 key)
+		{
+			return static_cast<u32>((key * 0x9E3779B97F4A7C15ull) >> 32) & (NUM_SLOTS - 1);
+		}
+		std::array<Slot, NUM_SLOTS> m_slots{};
+		// Slots stamped with an older generation read as empty, so bumping the
+		// counter empties the whole table in O(1).
+		u32 m_generation = 1;
+	};
+
 	TexAddrCache textures_by_address;
 	TexHashCache textures_by_hash;
+	TexLookupTable lookup_by_address;
+	TexLookupTable lookup_by_hash;
 	TexPool texture_pool;
+	std::unordered_map<u32, HashGate> hash_gates;
+	std::unordered_map<u32, EFBCopyUsage> efb_copy_usage;
 	size_t texture_pool_memory_usage = {};
 	
 	u32 s_last_texture = {};
@@ -121,6 +121,12 @@ PC_TexFormat GetPC_TexFormat(u32 texformat, TlutFormat tlutfmt, bool compressed_
 PC_TexFormat TexDecoder_DecodeRGBA8FromTmem(u32* dst, const u8 *src_ar, const u8 *src_gb, u32 width, u32 height);
 PC_TexFormat TexDecoder_DecodeBGRA8FromTmem(u32* dst, const u8 *src_ar, const u8 *src_gb, u32 width, u32 height);
 void TexDecoder_DecodeTexel(u8 *dst, const u8 *src, u32 s, u32 t, u32 imageWidth, u32 texformat, const u16 *tlut, TlutFormat tlutfmt);
+
+// Resolves the texel decoder for a (texture format, TLUT format) pair once, so
+// samplers that decode many texels from one texture can skip the per-texel
+// format dispatch inside TexDecoder_DecodeTexel.
+typedef void (*TexelDecoderFn)(u8* dst, const u8* src, u32 s, u32 t, u32 imageWidth, const u16* tlut);
+TexelDecoderFn TexDecoder_GetTexelDecoder(u32 texformat, TlutFormat tlutfmt);
 void TexDecoder_DecodeTexelRGBA8FromTmem(u8 *dst, const u8 *src_ar, const u8* src_gb, u32 s, u32 t, u32 imageWidth);
 void TexDecoder_DecodeTexelBGRA8FromTmem(u8 *dst, const u8 *src_ar, const u8* src_gb, u32 s, u32 t, u32 imageWidth);
 void TexDecoder_SetTexFmtOverlayOptions(bool enable, bool center);
\ No newline at end of file
@@ -21,18 +21,27 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <cmath>
+#include <functional>
+#include <memory>
+#include <vector>
 #include <xbrz.h>
 
 
 #include "Common/Common.h"
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/CommonFuncs.h"
+#include "Common/StringUtil.h"
 #include "Common/ThreadPool.h"
 #include "Common/CPUDetect.h"
 #include "Common/Intrinsics.h"
+#include "Core/ConfigManager.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/TextureScalerCommon.h"
 
@@ -51,6 +60,54 @@
 /////////////////////////////////////// Helper Functions (mostly math for parallelization)
 
 namespace {
+
+// Runs loop(l, u) over [lower, upper) split into row strips across the thread
+// pool, replacing the GlobalThreadPool::Loop the scalers were written against.
+// The video thread claims strips as well, so completion never depends on pool
+// scheduling, and we only return once every strip has been processed - the
+// scaled output is complete when the caller uploads it.
+void ParallelLoop(const std::function<void(int, int)>& loop, int lower, int upper)
+{
+	const int range = upper - lower;
+	const int min_strip = 16;
+	if (range <= 0)
+		return;
+	if (cpu_info.num_cores < 3 || range < min_strip * 2)
+	{
+		loop(lower, upper);
+		return;
+	}
+	struct LoopState
+	{
+		std::atomic<int> next_strip{ 0 };
+		std::atomic<int> done_strips{ 0 };
+	};
+	const int strip_height = std::max(range / cpu_info.num_cores, min_strip);
+	const int num_strips = (range + strip_height - 1) / strip_height;
+	std::shared_ptr<LoopState> state = std::make_shared<LoopState>();
+	auto run_strips = [=]()
+	{
+		int strip;
+		while ((strip = state->next_strip.fetch_add(1)) < num_strips)
+		{
+			const int l = lower + strip * strip_height;
+			loop(l, std::min(l + strip_height, upper));
+			state->done_strips.fetch_add(1);
+		}
+	};
+	for (int i = 1; i < num_strips; i++)
+	{
+		Common::AsyncWorker::ExecuteAsync(std::function<void()>(run_strips));
+	}
+	run_strips();
+	// Tasks still queued when the strip counter drained exit without doing
+	// work, so waiting on the strips actually processed is enough.
+	u32 loopcount = 0;
+	while (state->done_strips.load() < num_strips)
+	{
+		Common::cYield(loopcount++);
+	}
+}
 //////////////////////////////////////////////////////////////////// Various image processing
 
 #define R(_col) ((_col>> 0)&0xFF)
@@ -1652,6 +1709,28 @@ u32* TextureScaler::Scale(u32* data, int width, int height)
 	u32 *inputBuf = data;
 	u32 *outputBuf = bufOutput.data();
 
+	// The scaled result only depends on the source pixels and the scaler
+	// settings, so it can be cached on disk keyed by both and reused across
+	// runs - each texture is then only ever scaled once per install.
+	std::string cache_filename;
+	const size_t output_bytes = (size_t)width * height * factor * factor * sizeof(u32);
+	if (g_ActiveConfig.bCacheScaledTextures)
+	{
+		const u64 hash = GetHash64(reinterpret_cast<u8*>(data), u32(width * height * sizeof(u32)), 0);
+		const std::string cache_path = File::GetUserPath(D_CACHE_IDX) + "TextureScaler" DIR_SEP +
+			SConfig::GetInstance().GetGameID() + DIR_SEP;
+		cache_filename = cache_path + StringFromFormat("%016llx_%dx%d_t%d_f%d_d%d.raw",
+			(unsigned long long)hash, width, height, g_ActiveConfig.iTexScalingType, factor,
+			g_ActiveConfig.bTexDeposterize ? 1 : 0);
+		File::IOFile cached(cache_filename, "rb");
+		if (cached.IsOpen() && cached.GetSize() == output_bytes &&
+			cached.ReadBytes(outputBuf, output_bytes))
+		{
+			return outputBuf;
+		}
+		File::CreateFullPath(cache_path);
+	}
+
 	// deposterize
 	if (g_ActiveConfig.bTexDeposterize)
 	{
@@ -1696,6 +1775,25 @@ u32* TextureScaler::Scale(u32* data, int width, int height)
 	default:
 		ERROR_LOG(VIDEO, "Unknown scaling type: %d", g_ActiveConfig.iTexScalingType);
 	}
+
+	if (!cache_filename.empty())
+	{
+		// Write the result from the pool so the upload path never waits on
+		// disk; the temp-then-rename keeps half-written files out of the cache.
+		std::shared_ptr<std::vector<u32>> payload =
+			std::make_shared<std::vector<u32>>(outputBuf, outputBuf + width * height * factor * factor);
+		std::string filename = cache_filename;
+		auto write_result = [payload, filename, output_bytes]()
+		{
+			File::IOFile out(filename + ".tmp", "wb");
+			if (out.IsOpen() && out.WriteBytes(payload->data(), output_bytes))
+			{
+				out.Close();
+				File::Rename(filename + ".tmp", filename);
+			}
+		};
+		Common::AsyncWorker::ExecuteAsync(std::function<void()>(write_result));
+	}
 #ifdef SCALING_MEASURE_TIME
 	if (width*height > 64 * 64 * factor*factor)
 	{
@@ -1711,30 +1809,42 @@ void TextureScaler::ScaleXBRZ(int factor, u32* source, u32* dest, int width, int
 {
 	xbrz::ScalerCfg cfg;
 	xbrz::init();
-	//GlobalThreadPool::Loop(std::bind(&xbrz::scale, factor, source, dest, width, height, xbrz::ColorFormat::ARGB, cfg, placeholder::_1, placeholder::_2), 0, height);
-	xbrz::scale(factor, source, dest, width, height, xbrz::ColorFormat::ARGB, cfg, 0, height);
+	// Non-overlapping [yFirst, yLast) slices of the same image are explicitly
+	// thread-safe in xbrz, so every strip scales independently.
+	ParallelLoop([&](int l, int u)
+	{
+		xbrz::scale(factor, source, dest, width, height, xbrz::ColorFormat::ARGB, cfg, l, u);
+	}, 0, height);
 }
 
 void TextureScaler::ScaleBilinear(int factor, u32* source, u32* dest, int width, int height)
 {
 	bufTmp1.resize(width*height*factor);
 	u32 *tmpBuf = bufTmp1.data();
-	//GlobalThreadPool::Loop(std::bind(&bilinearH, factor, source, tmpBuf, width, placeholder::_1, placeholder::_2), 0, height);
-	//GlobalThreadPool::Loop(std::bind(&bilinearV, factor, tmpBuf, dest, width, 0, height, placeholder::_1, placeholder::_2), 0, height);
-	bilinearH(factor, source, tmpBuf, width, 0, height);
-	bilinearV(factor, tmpBuf, dest, width, 0, height, 0, height);
+	ParallelLoop([&](int l, int u)
+	{
+		bilinearH(factor, source, tmpBuf, width, l, u);
+	}, 0, height);
+	ParallelLoop([&](int l, int u)
+	{
+		bilinearV(factor, tmpBuf, dest, width, 0, height, l, u);
+	}, 0, height);
 }
 
 void TextureScaler::ScaleBicubicBSpline(int factor, u32* source, u32* dest, int width, int height)
 {
-	//GlobalThreadPool::Loop(std::bind(&scaleBicubicBSpline, factor, source, dest, width, height, placeholder::_1, placeholder::_2), 0, height);
-	scaleBicubicBSpline(factor, source, dest, width, height, 0, height);
+	ParallelLoop([&](int l, int u)
+	{
+		scaleBicubicBSpline(factor, source, dest, width, height, l, u);
+	}, 0, height);
 }
 
 void TextureScaler::ScaleBicubicMitchell(int factor, u32* source, u32* dest, int width, int height)
 {
-	//GlobalThreadPool::Loop(std::bind(&scaleBicubicMitchell, factor, source, dest, width, height, placeholder::_1, placeholder::_2), 0, height);
-	scaleBicubicMitchell(factor, source, dest, width, height, 0, height);
+	ParallelLoop([&](int l, int u)
+	{
+		scaleBicubicMitchell(factor, source, dest, width, height, l, u);
+	}, 0, height);
 }
 
 void TextureScaler::ScaleHybrid(int factor, u32* source, u32* dest, int width, int height, bool bicubic)
@@ -1751,10 +1861,14 @@ void TextureScaler::ScaleHybrid(int factor, u32* source, u32* dest, int width, i
 	bufTmp1.resize(width*height);
 	bufTmp2.resize(width*height*factor*factor);
 	bufTmp3.resize(width*height*factor*factor);
-	//GlobalThreadPool::Loop(std::bind(&generateDistanceMask, source, bufTmp1.data(), width, height, placeholder::_1, placeholder::_2), 0, height);
-	//GlobalThreadPool::Loop(std::bind(&convolve3x3, bufTmp1.data(), bufTmp2.data(), KERNEL_SPLAT, width, height, placeholder::_1, placeholder::_2), 0, height);
-	generateDistanceMask(source, bufTmp1.data(), width, height, 0, height);
-	convolve3x3(bufTmp1.data(), bufTmp2.data(), KERNEL_SPLAT, width, height, 0, height);
+	ParallelLoop([&](int l, int u)
+	{
+		generateDistanceMask(source, bufTmp1.data(), width, height, l, u);
+	}, 0, height);
+	ParallelLoop([&](int l, int u)
+	{
+		convolve3x3(bufTmp1.data(), bufTmp2.data(), KERNEL_SPLAT, width, height, l, u);
+	}, 0, height);
 
 	ScaleBilinear(factor, bufTmp2.data(), bufTmp3.data(), width, height);
 	// mask C is now in bufTmp3
@@ -1768,8 +1882,10 @@ void TextureScaler::ScaleHybrid(int factor, u32* source, u32* dest, int width, i
 
 	// Now we can mix it all together
 	// The factor 8192 was found through practical testing on a variety of textures
-	//GlobalThreadPool::Loop(std::bind(&mix, dest, bufTmp2.data(), bufTmp3.data(), 8192, width*factor, placeholder::_1, placeholder::_2), 0, height*factor);
-	mix(dest, bufTmp2.data(), bufTmp3.data(), 8192, width*factor, 0, height*factor);
+	ParallelLoop([&](int l, int u)
+	{
+		mix(dest, bufTmp2.data(), bufTmp3.data(), 8192, width*factor, l, u);
+	}, 0, height*factor);
 }
 
 void TextureScaler::ScaleJinc(int factor, u32* source, u32* dest, int width, int height)
@@ -1811,12 +1927,20 @@ void TextureScaler::ScaleDDTSharp(int factor, u32* source, u32* dest, int width,
 void TextureScaler::DePosterize(u32* source, u32* dest, int width, int height)
 {
 	bufTmp3.resize(width*height);
-	//GlobalThreadPool::Loop(std::bind(&deposterizeH, source, bufTmp3.data(), width, placeholder::_1, placeholder::_2), 0, height);
-	//GlobalThreadPool::Loop(std::bind(&deposterizeV, bufTmp3.data(), dest, width, height, placeholder::_1, placeholder::_2), 0, height);
-	//GlobalThreadPool::Loop(std::bind(&deposterizeH, dest, bufTmp3.data(), width, placeholder::_1, placeholder::_2), 0, height);
-	//GlobalThreadPool::Loop(std::bind(&deposterizeV, bufTmp3.data(), dest, width, height, placeholder::_1, placeholder::_2), 0, height);
-	deposterizeH(source, bufTmp3.data(), width, 0, height);
-	deposterizeV(bufTmp3.data(), dest, width, height, 0, height);
-	deposterizeH(dest, bufTmp3.data(), width, 0, height);
-	deposterizeV(bufTmp3.data(), dest, width, height, 0, height);
+	ParallelLoop([&](int l, int u)
+	{
+		deposterizeH(source, bufTmp3.data(), width, l, u);
+	}, 0, height);
+	ParallelLoop([&](int l, int u)
+	{
+		deposterizeV(bufTmp3.data(), dest, width, height, l, u);
+	}, 0, height);
+	ParallelLoop([&](int l, int u)
+	{
+		deposterizeH(dest, bufTmp3.data(), width, l, u);
+	}, 0, height);
+	ParallelLoop([&](int l, int u)
+	{
+		deposterizeV(bufTmp3.data(), dest, width, height, l, u);
+	}, 0, height);
 }
@@ -141,13 +141,40 @@ void ConvertRGBA_BGRA(u32 *dst, const s32 dstPitch, u32 *pIn, const s32 width, c
 }
 
 
+// Expands the 565 components of 8 texels to 8 bits each in the 16-bit lanes.
+// Bit replication ((x << 3) | (x >> 2)) produces the same values as the
+// Convert5To8/Convert6To8 tables, so the SSE2 rows match the scalar tail.
+static inline void Expand565_SSE2(const __m128i val, __m128i* r8, __m128i* g8, __m128i* b8)
+{
+	const __m128i b5 = _mm_and_si128(val, _mm_set1_epi16(0x1f));
+	const __m128i g6 = _mm_and_si128(_mm_srli_epi16(val, 5), _mm_set1_epi16(0x3f));
+	const __m128i r5 = _mm_srli_epi16(val, 11);
+	*b8 = _mm_or_si128(_mm_slli_epi16(b5, 3), _mm_srli_epi16(b5, 2));
+	*g8 = _mm_or_si128(_mm_slli_epi16(g6, 2), _mm_srli_epi16(g6, 4));
+	*r8 = _mm_or_si128(_mm_slli_epi16(r5, 3), _mm_srli_epi16(r5, 2));
+}
+
 void ConvertRGBA565_BGRA(u32 *dst, const s32 dstPitch, u16 *pIn, const s32 width, const s32 height, const s32 pitch)
 {
 	u16 *currentsrc = pIn;
 	u32 *currentdst = dst;
+	const s32 sse2width = width & ~7;
 	for (s32 i = 0; i < height; i++)
 	{
-		for (s32 j = 0; j < width; j++)
+		// Convert 8 texels per iteration: expand the components in 16-bit
+		// lanes, then interleave low (blue/green) and high (red/alpha) halves
+		// into 32-bit pixels.
+		for (s32 j = 0; j < sse2width; j += 8)
+		{
+			const __m128i val = _mm_loadu_si128((const __m128i*)(currentsrc + j));
+			__m128i r8, g8, b8;
+			Expand565_SSE2(val, &r8, &g8, &b8);
+			const __m128i bg = _mm_or_si128(b8, _mm_slli_epi16(g8, 8));
+			const __m128i ra = _mm_or_si128(r8, _mm_set1_epi16((short)0xFF00));
+			_mm_storeu_si128((__m128i*)(currentdst + j), _mm_unpacklo_epi16(bg, ra));
+			_mm_storeu_si128((__m128i*)(currentdst + j + 4), _mm_unpackhi_epi16(bg, ra));
+		}
+		for (s32 j = sse2width; j < width; j++)
 		{
 			u16 val = currentsrc[j];
 			u32 output = Convert5To8((val) & 0x1f);//blue
@@ -165,9 +192,21 @@ void ConvertRGBA565_RGBA(u32 *dst, const s32 dstPitch, u16 *pIn, const s32 width
 {
 	u16 *currentsrc = pIn;
 	u32 *currentdst = dst;
+	const s32 sse2width = width & ~7;
 	for (s32 i = 0; i < height; i++)
 	{
-		for (s32 j = 0; j < width; j++)
+		// Same as the BGRA variant with the red and blue lanes exchanged.
+		for (s32 j = 0; j < sse2width; j += 8)
+		{
+			const __m128i val = _mm_loadu_si128((const __m128i*)(currentsrc + j));
+			__m128i r8, g8, b8;
+			Expand565_SSE2(val, &r8, &g8, &b8);
+			const __m128i rg = _mm_or_si128(r8, _mm_slli_epi16(g8, 8));
+			const __m128i ba = _mm_or_si128(b8, _mm_set1_epi16((short)0xFF00));
+			_mm_storeu_si128((__m128i*)(currentdst + j), _mm_unpacklo_epi16(rg, ba));
+			_mm_storeu_si128((__m128i*)(currentdst + j + 4), _mm_unpackhi_epi16(rg, ba));
+		}
+		for (s32 j = sse2width; j < width; j++)
 		{
 			u16 val = currentsrc[j];
 			u32 output = Convert5To8((val >> 11) & 0x1f);//red
@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 // Modified for Ishiiruka by Tino
 
+#include <cstring>
 #include <map>
 #include <memory>
 #include <unordered_map>
@@ -32,6 +33,25 @@ namespace VertexLoaderManager
 static VertexLoaderMap s_vertex_loader_map;
 static NativeVertexFormatMap s_native_vertex_map;
 static NativeVertexFormat* s_current_vtx_fmt;
+
+// Direct-mapped front cache keyed on the raw VCD/VAT words, checked before
+// the UID is even built: constructing a VertexLoaderUID masks out unused
+// components and hashes, which shows up in decode profiles on games that
+// cycle through attribute configurations. Keying on the raw words is
+// conservative (frac-only changes occupy separate slots even though they
+// share a loader) but always maps a given state to the loader the map lookup
+// would have produced. Entries stay valid for the whole session - loaders are
+// never evicted from s_vertex_loader_map before Shutdown.
+struct CachedLoader
+{
+	u64 desc_hex;
+	u32 vat0;
+	u32 vat1;
+	u32 vat2;
+	VertexLoaderBase* loader;
+};
+static constexpr size_t LOADER_CACHE_SIZE = 128;  // must be a power of two
+static CachedLoader s_loader_cache[LOADER_CACHE_SIZE];
 u32 g_current_components;
 // TODO - change into array of pointers. Keep a map of all seen so far.
 // Used in D3D12 backend, to populate input layouts used by cached-to-disk PSOs.
@@ -186,6 +206,7 @@ void AppendListToString(std::string *dest)
 
 void Init()
 {
+	memset(s_loader_cache, 0, sizeof(s_loader_cache));
 	MarkAllDirty();
 	for (VertexLoaderBase*& vertexLoader : g_main_cp_state.vertex_loaders)
 		vertexLoader = nullptr;
@@ -196,6 +217,8 @@ void Shutdown()
 {
 	if (s_vertex_loader_map.size() > 0 && g_ActiveConfig.bDumpVertexLoaders)
 		DumpLoadersCode();
+	// The front cache points into the loader map; drop it alongside.
+	memset(s_loader_cache, 0, sizeof(s_loader_cache));
 	s_vertex_loader_map.clear();
 	s_native_vertex_map.clear();
 }
@@ -239,14 +262,29 @@ void MarkAllDirty()
 	g_preprocess_cp_state.bases_dirty = true;
 }
 
+static inline size_t LoaderCacheIndex(u64 desc_hex, const VAT& VtxAttr)
+{
+	u64 fp = desc_hex ^ VtxAttr.g0.Hex ^ ((u64)VtxAttr.g1.Hex << 9) ^ ((u64)VtxAttr.g2.Hex << 18);
+	fp *= 0x9E3779B97F4A7C15ull;
+	return (size_t)(fp >> 32) & (LOADER_CACHE_SIZE - 1);
+}
+
 inline VertexLoaderBase *GetOrAddLoader(const TVtxDesc &VtxDesc, const VAT &VtxAttr)
 {
+	CachedLoader& slot = s_loader_cache[LoaderCacheIndex(VtxDesc.Hex, VtxAttr)];
+	if (slot.loader && slot.desc_hex == VtxDesc.Hex && slot.vat0 == VtxAttr.g0.Hex &&
+		slot.vat1 == VtxAttr.g1.Hex && slot.vat2 == VtxAttr.g2.Hex)
+	{
+		return slot.loader;
+	}
+
 	VertexLoaderUID uid(VtxDesc, VtxAttr);
 	VertexLoaderMap::iterator iter = s_vertex_loader_map.find(uid);
+	VertexLoaderBase* loader;
 	if (iter == s_vertex_loader_map.end())
 	{
 		s_vertex_loader_map[uid] = VertexLoaderBase::CreateVertexLoader(VtxDesc, VtxAttr);
-		VertexLoaderBase* loader = s_vertex_loader_map[uid].get();
+		loader = s_vertex_loader_map[uid].get();
 		loader->m_native_vertex_format = GetNativeVertexFormat(loader->m_native_vtx_decl);
 		VertexLoaderBase * fallback = loader->GetFallback();
 		if (fallback)
@@ -254,9 +292,18 @@ inline VertexLoaderBase *GetOrAddLoader(const TVtxDesc &VtxDesc, const VAT &VtxA
 			fallback->m_native_vertex_format = GetNativeVertexFormat(fallback->m_native_vtx_decl);
 		}
 		INCSTAT(stats.numVertexLoaders);
-		return loader;
 	}
-	return iter->second.get();
+	else
+	{
+		loader = iter->second.get();
+	}
+
+	slot.desc_hex = VtxDesc.Hex;
+	slot.vat0 = VtxAttr.g0.Hex;
+	slot.vat1 = VtxAttr.g1.Hex;
+	slot.vat2 = VtxAttr.g2.Hex;
+	slot.loader = loader;
+	return loader;
 }
 
 void GetVertexSizeAndComponents(const VertexLoaderParameters &parameters, u32 &vertexsize, u32 &components)
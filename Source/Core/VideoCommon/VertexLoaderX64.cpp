@@ -23,6 +23,7 @@ static const X64Reg scratch2 = ABI_PARAM3;
 static const X64Reg scratch3 = ABI_PARAM4;
 static const X64Reg count_reg = R10;
 static const X64Reg skipped_reg = R11;
+static const X64Reg posmtx_reg = R12;
 static const u32 MASKINDEXED = INDEX8 & INDEX16;
 static const X64Reg base_reg = RBX;
 
@@ -369,7 +370,7 @@ void VertexLoaderX64::ReadColor(OpArg data, u64 attribute, int format)
 
 void VertexLoaderX64::GenerateVertexLoader()
 {
-	BitSet32 regs = { src_reg, dst_reg, scratch1, scratch2, scratch3, count_reg, skipped_reg, base_reg };
+	BitSet32 regs = { src_reg, dst_reg, scratch1, scratch2, scratch3, count_reg, skipped_reg, posmtx_reg, base_reg };
 	regs &= ABI_ALL_CALLEE_SAVED;
 	ABI_PushRegistersAndAdjustStack(regs, 0);
 
@@ -413,6 +414,14 @@ void VertexLoaderX64::GenerateVertexLoader()
 	if (m_VtxDesc.Position & MASKINDEXED)
 		XOR(32, R(skipped_reg), R(skipped_reg));
 
+	if (!m_VtxDesc.PosMatIdx)
+	{
+		// Without a per-vertex index the posmtx value is loop invariant,
+		// so compute it once instead of once per vertex.
+		MOV(32, R(posmtx_reg), MPIC(&g_main_cp_state.matrix_index_a));
+		AND(32, R(posmtx_reg), Imm8(0x3F));
+	}
+
 	const u8* loop_start = GetCodePtr();
 
 	if (m_VtxDesc.PosMatIdx)
@@ -431,22 +440,80 @@ void VertexLoaderX64::GenerateVertexLoader()
 			texmatidx_ofs[i] = m_src_ofs++;
 	}
 
-	OpArg data = GetVertexAddr(ARRAY_POSITION, m_VtxDesc.Position);
-	ReadVertex(data, m_VtxDesc.Position, m_VtxAttr.PosFormat, m_VtxAttr.PosElements + 2, 3,
-		m_VtxAttr.ByteDequant, &m_native_vtx_decl.position, XMM2);
+	// Runs of adjacent direct float attributes need no conversion at all,
+	// just a 32bit byteswap of both streams. Fuse them and emit 16 byte
+	// shuffles over the whole run instead of loading and storing every
+	// attribute on its own.
+	static const __m128i bswap32_mask = _mm_set_epi32(0x0C0D0E0FL, 0x08090A0BL, 0x04050607L, 0x00010203L);
+	const bool can_fuse_floats = cpu_info.bSSSE3;
+	u32 run_src = 0, run_dst = 0, run_bytes = 0;
+	auto AddToFloatRun = [&](AttributeFormat* native_format, int count)
+	{
+		if (!run_bytes)
+		{
+			run_src = m_src_ofs;
+			run_dst = m_dst_ofs;
+		}
+		native_format->components = count;
+		native_format->enable = true;
+		native_format->offset = m_dst_ofs;
+		native_format->type = FORMAT_FLOAT;
+		m_src_ofs += sizeof(float) * count;
+		m_dst_ofs += sizeof(float) * count;
+		run_bytes += sizeof(float) * count;
+	};
+	auto FlushFloatRun = [&]()
+	{
+		u32 off = 0;
+		while (run_bytes - off >= 16)
+		{
+			MOVDQU(XMM0, MDisp(src_reg, run_src + off));
+			PSHUFB(XMM0, MPIC(&bswap32_mask));
+			MOVUPS(MDisp(dst_reg, run_dst + off), XMM0);
+			off += 16;
+		}
+		for (; off < run_bytes; off += 4)
+		{
+			LoadAndSwap(32, scratch3, MDisp(src_reg, run_src + off));
+			MOV(32, MDisp(dst_reg, run_dst + off), R(scratch3));
+		}
+		run_bytes = 0;
+	};
+
+	OpArg data;
+	if (can_fuse_floats && m_VtxDesc.Position == DIRECT &&
+		m_VtxAttr.PosFormat == FORMAT_FLOAT && m_VtxAttr.PosElements)
+	{
+		AddToFloatRun(&m_native_vtx_decl.position, 3);
+	}
+	else
+	{
+		data = GetVertexAddr(ARRAY_POSITION, m_VtxDesc.Position);
+		ReadVertex(data, m_VtxDesc.Position, m_VtxAttr.PosFormat, m_VtxAttr.PosElements + 2, 3,
+			m_VtxAttr.ByteDequant, &m_native_vtx_decl.position, XMM2);
+	}
 
 	if (m_VtxDesc.Normal)
 	{
-		for (int i = 0; i < (m_VtxAttr.NormalElements ? 3 : 1); i++)
+		if (can_fuse_floats && m_VtxDesc.Normal == DIRECT && m_VtxAttr.NormalFormat == FORMAT_FLOAT)
 		{
-			if (!i || m_VtxAttr.NormalIndex3)
+			for (int i = 0; i < (m_VtxAttr.NormalElements ? 3 : 1); i++)
+				AddToFloatRun(&m_native_vtx_decl.normals[i], 3);
+		}
+		else
+		{
+			FlushFloatRun();
+			for (int i = 0; i < (m_VtxAttr.NormalElements ? 3 : 1); i++)
 			{
-				data = GetVertexAddr(ARRAY_NORMAL, m_VtxDesc.Normal);
-				int elem_size = 1 << (m_VtxAttr.NormalFormat / 2);
-				data.AddMemOffset(i * elem_size * 3);
+				if (!i || m_VtxAttr.NormalIndex3)
+				{
+					data = GetVertexAddr(ARRAY_NORMAL, m_VtxDesc.Normal);
+					int elem_size = 1 << (m_VtxAttr.NormalFormat / 2);
+					data.AddMemOffset(i * elem_size * 3);
+				}
+				data.AddMemOffset(ReadVertex(data, m_VtxDesc.Normal, m_VtxAttr.NormalFormat, 3, 3,
+					true, &m_native_vtx_decl.normals[i], XMM3));
 			}
-			data.AddMemOffset(ReadVertex(data, m_VtxDesc.Normal, m_VtxAttr.NormalFormat, 3, 3,
-				true, &m_native_vtx_decl.normals[i], XMM3));
 		}
 
 		m_native_components |= VB_HAS_NRM0;
@@ -459,6 +526,7 @@ void VertexLoaderX64::GenerateVertexLoader()
 	{
 		if (col[i])
 		{
+			FlushFloatRun();
 			data = GetVertexAddr(ARRAY_COLOR + i, col[i]);
 			ReadColor(data, col[i], m_VtxAttr.color[i].Comp);
 			m_native_components |= VB_HAS_COL0 << i;
@@ -475,13 +543,23 @@ void VertexLoaderX64::GenerateVertexLoader()
 		int elements = m_VtxAttr.texCoord[i].Elements + 1;
 		if (tc[i])
 		{
-			data = GetVertexAddr(ARRAY_TEXCOORD0 + i, tc[i]);
-			ReadVertex(data, tc[i], m_VtxAttr.texCoord[i].Format, elements, tm[i] ? 2 : elements,
-				m_VtxAttr.ByteDequant, &m_native_vtx_decl.texcoords[i], treg[i]);
+			if (can_fuse_floats && tc[i] == DIRECT && m_VtxAttr.texCoord[i].Format == FORMAT_FLOAT &&
+				(!tm[i] || elements == 2))
+			{
+				AddToFloatRun(&m_native_vtx_decl.texcoords[i], elements);
+			}
+			else
+			{
+				FlushFloatRun();
+				data = GetVertexAddr(ARRAY_TEXCOORD0 + i, tc[i]);
+				ReadVertex(data, tc[i], m_VtxAttr.texCoord[i].Format, elements, tm[i] ? 2 : elements,
+					m_VtxAttr.ByteDequant, &m_native_vtx_decl.texcoords[i], treg[i]);
+			}
 			m_native_components |= VB_HAS_UV0 << i;
 		}
 		if (tm[i])
 		{
+			FlushFloatRun();
 			m_native_components |= (VB_HAS_TEXMTXIDX0 | VB_HAS_UV0) << i;
 			m_native_vtx_decl.texcoords[i].components = 3;
 			m_native_vtx_decl.texcoords[i].enable = true;
@@ -504,16 +582,17 @@ void VertexLoaderX64::GenerateVertexLoader()
 			}
 		}
 	}
+	FlushFloatRun();
 	if (m_VtxDesc.PosMatIdx)
 	{
 		MOVZX(32, 8, scratch1, MDisp(src_reg, 0));
+		AND(32, R(scratch1), Imm8(0x3F));
+		MOV(32, MDisp(dst_reg, m_dst_ofs), R(scratch1));
 	}
 	else
 	{
-		MOV(32, R(scratch1), MPIC(&g_main_cp_state.matrix_index_a));
+		MOV(32, MDisp(dst_reg, m_dst_ofs), R(posmtx_reg));
 	}
-	AND(32, R(scratch1), Imm8(0x3F));
-	MOV(32, MDisp(dst_reg, m_dst_ofs), R(scratch1));
 	m_native_vtx_decl.posmtx.components = 4;
 	m_native_vtx_decl.posmtx.enable = true;
 	m_native_vtx_decl.posmtx.offset = m_dst_ofs;
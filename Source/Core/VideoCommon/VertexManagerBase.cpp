@@ -8,8 +8,10 @@
 #include "Common/CommonTypes.h"
 #include "Core/ConfigManager.h"
 
+#include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/BPStructs.h"
 #include "VideoCommon/Debugger.h"
+#include "VideoCommon/FramebufferManagerBase.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/TessellationShaderManager.h"
 #include "VideoCommon/IndexGenerator.h"
@@ -134,6 +136,14 @@ std::pair<size_t, size_t> VertexManagerBase::ResetFlushAspectRatioCount()
 
 void VertexManagerBase::DoFlush()
 {
+	// A pending clear and a deferred XFB copy both have to land before this
+	// draw does (the clear flush takes care of the copy ordering itself).
+	BPFunctions::FlushPendingEFBClear();
+	FramebufferManagerBase::FlushDeferredXFBCopy();
+
+	// This draw invalidates any EFB peek tiles cached on the CPU side.
+	g_efb_peek_version++;
+
 	// loading a state will invalidate BP, so check for it
 	NativeVertexFormat* current_vertex_format = VertexLoaderManager::GetCurrentVertexFormat();
 	g_video_backend->CheckInvalidState();
@@ -258,6 +268,8 @@ void VertexManagerBase::DoFlush()
 		bpmem.blendmode.alphaupdate &&
 		bpmem.zcontrol.pixel_format == PEControl::RGBA6_Z24;
 
+	GFXStateRecorder::OnDraw(IndexGenerator::GetIndexLen());
+
 	if (PerfQueryBase::ShouldEmulate())
 		g_perf_query->EnableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
 	g_vertex_manager->vFlush(useDstAlpha);
@@ -13,6 +13,7 @@
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DriverDetails.h"
+#include "VideoCommon/GeometryShaderGen.h"
 #include "VideoCommon/LightingShaderGen.h"
 #include "VideoCommon/VertexShaderGen.h"
 #include "VideoCommon/VideoConfig.h"
@@ -126,6 +127,18 @@ inline void GenerateVertexShader(ShaderCode& out, const vertex_shader_uid_data&
 	if (!(api_type == API_D3D9))
 		out.Write("};\n");
 
+	if (api_type == API_OPENGL && uid_data.stereo_layer)
+	{
+		// Only cstereo is read here, but the full block keeps the std140 layout
+		// identical to the buffer GeometryShaderManager uploads at binding 3.
+		out.Write("UBO_BINDING(std140, 3) uniform GSBlock {\n");
+		out.Write(
+			"\tfloat4 " I_STEREOPARAMS";\n"
+			"\tfloat4 " I_LINEPTPARAMS";\n"
+			"\tint4 " I_TEXOFFSET";\n"
+			"};\n");
+	}
+
 	out.Write("struct VS_OUTPUT {\n");
 	GenerateVSOutputMembers<api_type>(out, uid_data.pixel_lighting, uid_data.numTexGens);
 	out.Write("};\n");
@@ -157,6 +170,12 @@ inline void GenerateVertexShader(ShaderCode& out, const vertex_shader_uid_data&
 		{
 			out.Write("VARYING_LOCATION(0) out VertexData {\n");
 			GenerateVSOutputMembers<api_type>(out, uid_data.pixel_lighting, uid_data.numTexGens, GetInterpolationQualifier(api_type, uid_data.msaa, uid_data.ssaa, false, true));
+
+			// The geometry shader normally adds this member; without one the
+			// pixel shader still expects it for stereoscopic texture fetches.
+			if (uid_data.stereo_layer)
+				out.Write("\tflat int layer;\n");
+
 			out.Write("} vs;\n");
 		}
 		else
@@ -524,9 +543,23 @@ inline void GenerateVertexShader(ShaderCode& out, const vertex_shader_uid_data&
 
 	if (api_type == API_OPENGL || api_type == API_VULKAN)
 	{
+		if (uid_data.stereo_layer)
+		{
+			// Instanced stereoscopy: one instance per eye, applying the same
+			// horizontal parallax offset the geometry shader path computes (see
+			// GeometryShaderGen for the derivation of this formula).
+			out.Write("int eye = gl_InstanceID & 1;\n");
+			out.Write("float hoffset = (eye == 0) ? " I_STEREOPARAMS ".x : " I_STEREOPARAMS ".y;\n");
+			out.Write("o.pos.x += hoffset * (o.pos.w - " I_STEREOPARAMS ".z);\n");
+		}
 		if (g_ActiveConfig.backend_info.bSupportsGeometryShaders || api_type == API_VULKAN)
 		{
 			AssignVSOutputMembers<api_type>(out, "vs", "o", uid_data.pixel_lighting, uid_data.numTexGens);
+			if (uid_data.stereo_layer)
+			{
+				out.Write("vs.layer = eye;\n");
+				out.Write("gl_Layer = eye;\n");
+			}
 		}
 		else
 		{
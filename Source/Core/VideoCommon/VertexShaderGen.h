@@ -80,7 +80,8 @@ struct vertex_shader_uid_data
 	u32 ssaa : 1;
 
 	u32 texMtxInfo_n_projection : 16; // Stored separately to guarantee that the texMtxInfo struct is 8 bits wide
-	u32 pad0 : 16;
+	u32 stereo_layer : 1; // Instanced stereoscopy: select eye and layer in the vertex shader
+	u32 pad0 : 15;
 
 	struct
 	{
@@ -102,7 +103,7 @@ struct vertex_shader_uid_data
 };
 #pragma pack()
 #define VERTEXSHADERGEN_BUFFERSIZE 32768
-#define VERTEXSHADERGEN_UID_VERSION 1
+#define VERTEXSHADERGEN_UID_VERSION 2
 typedef ShaderUid<vertex_shader_uid_data> VertexShaderUid;
 
 void GetVertexShaderUID(VertexShaderUid& object, u32 components, const XFMemory &xfr, const BPMemory &bpm);
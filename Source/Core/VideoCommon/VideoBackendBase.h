@@ -116,6 +116,20 @@ protected:
 
 	bool m_initialized = false;
 	bool m_invalid = false;
+
+	// Exact-value peek tiles: a peek that misses fetches its whole tile from
+	// the video thread in one blocking request, and later peeks inside the
+	// tile are answered locally until the EFB is dirtied (see
+	// g_efb_peek_version). Separate planes for color and depth; allocated in
+	// InitializeShared so only the active backend pays for the buffers.
+	static const u32 EFB_PEEK_TILE_SIZE = 32;
+	u32 m_EFB_tile_columns = 0;
+	u32 m_EFB_tile_count = 0;
+	u32* m_EFB_tile_color = nullptr;
+	u32* m_EFB_tile_depth = nullptr;
+	u32* m_EFB_tile_color_version = nullptr;
+	u32* m_EFB_tile_depth_version = nullptr;
+
 	u32 m_EFB_PCache_Width;
 	u32 m_EFB_PCache_Height;
 	u32 m_EFB_PCache_Size;
@@ -125,4 +139,9 @@ protected:
 };
 
 extern std::vector<std::unique_ptr<VideoBackendBase>> g_available_video_backends;
-extern VideoBackendBase* g_video_backend;
\ No newline at end of file
+extern VideoBackendBase* g_video_backend;
+
+// Bumped by the video thread whenever guest rendering writes to the EFB
+// (draw flushes, clears, pixel format reinterpretation). CPU-side peek tiles
+// tagged with an older version are refetched on the next peek.
+extern volatile u32 g_efb_peek_version;
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include "Core/Core.h"
 #include "Core/Movie.h"
 #include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -25,6 +26,9 @@ void UpdateActiveConfig()
 	if (Movie::IsPlayingInput() && Movie::IsConfigSaved())
 		Movie::SetGraphicsConfig();
 	g_ActiveConfig = g_Config;
+	// Several config fields (stereo, MSAA, depth options, ...) feed the
+	// pixel shader UID, so the cached one cannot be reused.
+	MarkPixelShaderUIDDirty();
 }
 
 VideoConfig::VideoConfig()
@@ -49,6 +53,7 @@ VideoConfig::VideoConfig()
 	iStereoConvergence = 20;
 	bUseScalingFilter = false;
 	bTexDeposterize = false;
+	bCacheScaledTextures = false;
 	iTexScalingType = 0;
 	iTexScalingFactor = 2;
 	backend_info.bSupportsMultithreading = false;
@@ -65,6 +70,8 @@ void VideoConfig::Load(const std::string& ini_file)
 
 	IniFile::Section* hardware = iniFile.GetOrCreateSection("Hardware");
 	hardware->Get("VSync", &bVSync, 0);
+	hardware->Get("FramePacing", &bFramePacing, false);
+	hardware->Get("WorkloadGovernor", &bWorkloadGovernor, false);
 	hardware->Get("Adapter", &iAdapter, 0);
 
 	IniFile::Section* settings = iniFile.GetOrCreateSection("Settings");
@@ -88,6 +95,7 @@ void VideoConfig::Load(const std::string& ini_file)
 	settings->Get("HiresMaterialMapsBuild", &bHiresMaterialMapsBuild, false);
 	settings->Get("ConvertHiresTextures", &bConvertHiresTextures, 0);
 	settings->Get("CacheHiresTextures", &bCacheHiresTextures, 0);
+	settings->Get("CacheHiresTexturesBudgetMB", &iCacheHiresTexturesBudgetMB, 0);
 	settings->Get("DumpEFBTarget", &bDumpEFBTarget, 0);
 	settings->Get("DumpFramesAsImages", &bDumpFramesAsImages, 0);
 	settings->Get("FreeLook", &bFreeLook, 0);
@@ -147,6 +155,7 @@ void VideoConfig::Load(const std::string& ini_file)
 	enhancements->Get("TextureScalingType", &iTexScalingType, 0);
 	enhancements->Get("TextureScalingFactor", &iTexScalingFactor, 2);
 	enhancements->Get("UseDePosterize", &bTexDeposterize, true);
+	enhancements->Get("CacheScaledTextures", &bCacheScaledTextures, false);
 	enhancements->Get("Tessellation", &bTessellation, 0);
 	enhancements->Get("TessellationEarlyCulling", &bTessellationEarlyCulling, 0);
 	enhancements->Get("TessellationDistance", &iTessellationDistance, 0);
@@ -176,7 +185,10 @@ void VideoConfig::Load(const std::string& ini_file)
 	hacks->Get("EnableComputeTextureEncoding", &bEnableComputeTextureEncoding, false);
 	hacks->Get("PredictiveFifo", &bPredictiveFifo, false);
 	hacks->Get("BoundingBoxMode", &iBBoxMode, (int)BBoxMode::BBoxNone);
+	hacks->Get("BoundingBoxPrediction", &bBBoxPrediction, false);
+	hacks->Get("XFBDirectPresent", &bXFBDirectPresent, false);
 	hacks->Get("LastStoryEFBToRam", &bLastStoryEFBToRam, false);
+	hacks->Get("SkipDeadEFBCopies", &bSkipDeadEFBCopies, false);
 	hacks->Get("ForceLogicOpBlend", &bForceLogicOpBlend, false);
 	hacks->Get("VertexRounding", &bVertexRounding, false);
 	
@@ -222,6 +234,8 @@ void VideoConfig::GameIniLoad()
 	IniFile iniFile = SConfig::GetInstance().LoadGameIni();
 
 	CHECK_SETTING("Video_Hardware", "VSync", bVSync);
+	CHECK_SETTING("Video_Hardware", "FramePacing", bFramePacing);
+	CHECK_SETTING("Video_Hardware", "WorkloadGovernor", bWorkloadGovernor);
 
 	CHECK_SETTING("Video_Settings", "wideScreenHack", bWidescreenHack);
 	CHECK_SETTING("Video_Settings", "AspectRatio", iAspectRatio);
@@ -294,6 +308,7 @@ void VideoConfig::GameIniLoad()
 	CHECK_SETTING("Video_Enhancements", "TextureScalingType", iTexScalingType);
 	CHECK_SETTING("Video_Enhancements", "TextureScalingFactor", iTexScalingFactor);
 	CHECK_SETTING("Video_Enhancements", "UseDePosterize", bTexDeposterize);
+	CHECK_SETTING("Video_Enhancements", "CacheScaledTextures", bCacheScaledTextures);
 	CHECK_SETTING("Video_Enhancements", "Tessellation", bTessellation);
 	CHECK_SETTING("Video_Enhancements", "TessellationEarlyCulling", bTessellationEarlyCulling);
 	CHECK_SETTING("Video_Enhancements", "TessellationDistance", iTessellationDistance);
@@ -318,7 +333,10 @@ void VideoConfig::GameIniLoad()
 	CHECK_SETTING("Video_Hacks", "EFBScaledCopy", bCopyEFBScaled);
 	CHECK_SETTING("Video_Hacks", "EFBEmulateFormatChanges", bEFBEmulateFormatChanges);
 	CHECK_SETTING("Video_Hacks", "BoundingBoxMode", iBBoxMode);
+	CHECK_SETTING("Video_Hacks", "BoundingBoxPrediction", bBBoxPrediction);
+	CHECK_SETTING("Video_Hacks", "XFBDirectPresent", bXFBDirectPresent);
 	CHECK_SETTING("Video_Hacks", "LastStoryEFBToRam", bLastStoryEFBToRam);
+	CHECK_SETTING("Video_Hacks", "SkipDeadEFBCopies", bSkipDeadEFBCopies);
 	CHECK_SETTING("Video_Hacks", "VertexRounding", bVertexRounding);
 
 	CHECK_SETTING("Video", "ProjectionHack", iPhackvalue[0]);
@@ -411,6 +429,8 @@ void VideoConfig::Save(const std::string& ini_file)
 
 	IniFile::Section* hardware = iniFile.GetOrCreateSection("Hardware");
 	hardware->Set("VSync", bVSync);
+	hardware->Set("FramePacing", bFramePacing);
+	hardware->Set("WorkloadGovernor", bWorkloadGovernor);
 	hardware->Set("Adapter", iAdapter);
 
 	IniFile::Section* settings = iniFile.GetOrCreateSection("Settings");
@@ -434,6 +454,7 @@ void VideoConfig::Save(const std::string& ini_file)
 	settings->Set("HiresMaterialMapsBuild", bHiresMaterialMapsBuild);
 	settings->Set("ConvertHiresTextures", bConvertHiresTextures);
 	settings->Set("CacheHiresTextures", bCacheHiresTextures);
+	settings->Set("CacheHiresTexturesBudgetMB", iCacheHiresTexturesBudgetMB);
 	settings->Set("DumpEFBTarget", bDumpEFBTarget);
 	settings->Set("DumpFramesAsImages", bDumpFramesAsImages);
 	settings->Set("FreeLook", bFreeLook);
@@ -494,6 +515,7 @@ void VideoConfig::Save(const std::string& ini_file)
 	enhancements->Set("TextureScalingType", iTexScalingType);
 	enhancements->Set("TextureScalingFactor", iTexScalingFactor);
 	enhancements->Set("UseDePosterize", bTexDeposterize);
+	enhancements->Set("CacheScaledTextures", bCacheScaledTextures);
 	enhancements->Set("Tessellation", bTessellation);
 	enhancements->Set("TessellationEarlyCulling", bTessellationEarlyCulling);
 	enhancements->Set("TessellationDistance", iTessellationDistance);
@@ -523,7 +545,10 @@ void VideoConfig::Save(const std::string& ini_file)
 	hacks->Set("EnableComputeTextureEncoding", bEnableComputeTextureEncoding);
 	hacks->Set("PredictiveFifo", bPredictiveFifo);
 	hacks->Set("BoundingBoxMode", iBBoxMode);
+	hacks->Set("BoundingBoxPrediction", bBBoxPrediction);
+	hacks->Set("XFBDirectPresent", bXFBDirectPresent);
 	hacks->Set("LastStoryEFBToRam", bLastStoryEFBToRam);
+	hacks->Set("SkipDeadEFBCopies", bSkipDeadEFBCopies);
 	hacks->Set("ForceLogicOpBlend", bForceLogicOpBlend);
 	hacks->Set("VertexRounding", bVertexRounding);
 
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/XFMemory.h"
 
@@ -86,12 +87,15 @@ struct VideoConfig final
 
 	// General
 	bool bVSync;
+	bool bFramePacing;
+	bool bWorkloadGovernor;
 	bool bRunning;
 	bool bWidescreenHack;
 	int iAspectRatio;
 	bool bCrop;   // Aspect ratio controls.
 	bool bUseXFB;
 	bool bUseRealXFB;
+	bool bXFBDirectPresent;
 
 	// OpenCL/OpenMP
 	bool bEnableOpenCL;
@@ -111,6 +115,7 @@ struct VideoConfig final
 	std::string sStereoShader;
 	bool bUseScalingFilter;
 	bool bTexDeposterize;
+	bool bCacheScaledTextures;
 	int iTexScalingType;
 	int iTexScalingFactor;
 	bool bTessellation;
@@ -145,6 +150,8 @@ struct VideoConfig final
 	bool bHiresMaterialMapsBuild;
 	bool bConvertHiresTextures;
 	bool bCacheHiresTextures;
+	// RAM budget for the custom texture cache in MB, 0 picks one automatically
+	int iCacheHiresTexturesBudgetMB;
 	bool bDumpEFBTarget;
 	bool bDumpFramesAsImages;
 	bool bUseFFV1;
@@ -183,6 +190,9 @@ struct VideoConfig final
 	int iRimBase;
 	int iSpecularMultiplier;
 	bool bLastStoryEFBToRam;
+	// Skip EFB copies whose destination keeps being overwritten without ever
+	// being sampled, see TextureCacheBase::EFBCopyUsage. Speculative speedhack.
+	bool bSkipDeadEFBCopies;
 	bool bForceLogicOpBlend;
 
 	bool bSimBumpEnabled;
@@ -194,6 +204,7 @@ struct VideoConfig final
 	bool bFastDepthCalc;
 	bool bVertexRounding;
 	int iBBoxMode;
+	bool bBBoxPrediction;
 	//for dx9-backend
 	bool bForceDualSourceBlend;
 	int iLog; // CONF_ bits
@@ -259,6 +270,7 @@ struct VideoConfig final
 		bool bSupportsExclusiveFullscreen;
 		bool bSupportsBBox;
 		bool bSupportsGSInstancing; // Needed by GeometryShaderGen, so must stay in VideoCommon
+		bool bSupportsVertexShaderLayer; // Writing gl_Layer from the vertex shader, used for stereoscopy
 		bool bSupportsPaletteConversion;
 		bool bSupportsClipControl; // Needed by VertexShaderGen, so must stay in VideoCommon		
 		bool bSupportsSSAA;
@@ -299,6 +311,15 @@ struct VideoConfig final
 	{
 		return backend_info.bSupportsGPUTextureDecoding && bEnableGPUTextureDecoding;
 	}
+	// Render stereoscopic triangles as two instances with the vertex shader
+	// selecting the eye, instead of expanding them in a geometry shader. Only
+	// worth it where the geometry stage is known to be slow; lines and points
+	// keep the geometry shader since they need it for widening anyway.
+	inline bool UseVertexShaderLayerStereo() const
+	{
+		return iStereoMode > 0 && backend_info.bSupportsVertexShaderLayer &&
+			DriverDetails::HasBug(DriverDetails::BUG_SLOW_GEOMETRY_SHADERS);
+	}
 };
 
 extern VideoConfig g_Config;
@@ -11,6 +11,7 @@
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/TessellationShaderManager.h"
 #include "VideoCommon/PixelEngine.h"
+#include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/VertexManagerBase.h"
@@ -64,6 +65,9 @@ void VideoCommon_DoState(PointerWrap &p)
 	BoundingBox::DoState(p);
 	p.DoMarker("BoundingBox");
 
+	// Loading replaces bpmem/xfmem wholesale, so any cached shader UID is stale.
+	if (p.GetMode() == PointerWrap::MODE_READ)
+		MarkPixelShaderUIDDirty();
 
 	// TODO: search for more data that should be saved and add it here
 }
\ No newline at end of file
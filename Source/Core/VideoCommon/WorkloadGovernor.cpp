@@ -0,0 +1,138 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+
+#include "Common/StringUtil.h"
+#include "Common/Timer.h"
+#include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/VideoConfig.h"
+#include "VideoCommon/WorkloadGovernor.h"
+
+// Missing the target by more than 4% (58fps against 60) counts as slow;
+// stepping back up additionally requires 10% of headroom, so the restored
+// level starts with some slack.
+static const u32 SLOW_NUM = 26, SLOW_DEN = 25;
+static const u32 FAST_NUM = 9, FAST_DEN = 10;
+
+// Seconds of sustained headroom before the first step-up attempt, and the cap
+// the dwell grows to when step-ups keep getting reverted.
+static const u32 STEPUP_DWELL_MIN_SECONDS = 5;
+static const u32 STEPUP_DWELL_MAX_SECONDS = 60;
+
+// A degradation this soon after a step-up means the step-up was premature.
+static const u64 STEPUP_REGRET_WINDOW_US = 5000000;
+
+void WorkloadGovernor::Update(u32 target_refresh_rate)
+{
+	if (!g_Config.bWorkloadGovernor || target_refresh_rate == 0)
+	{
+		if (m_active)
+		{
+			if (m_level != 0)
+				ApplyLevel(0, 1);
+			m_active = false;
+		}
+		return;
+	}
+
+	const u64 now = Common::Timer::GetTimeUs();
+	if (!m_active)
+	{
+		m_active = true;
+		m_base_efb_scale = g_Config.iEFBScale;
+		m_base_copy_efb_scaled = g_Config.bCopyEFBScaled;
+		m_base_skip_efb_to_ram = g_Config.bSkipEFBCopyToRam;
+		m_level = 0;
+		m_avg_interval = 0;
+		m_slow_frames = 0;
+		m_fast_frames = 0;
+		m_cooldown = target_refresh_rate;  // let the first second settle
+		m_stepup_dwell = STEPUP_DWELL_MIN_SECONDS * target_refresh_rate;
+		m_last_stepup_time = 0;
+		m_last_frame_time = now;
+		return;
+	}
+
+	const u32 target_interval = 1000000 / target_refresh_rate;
+	// Clamp outliers (savestate loads, shader compilation stalls) so a single
+	// spike cannot dominate the average.
+	const u32 interval =
+		static_cast<u32>(std::min<u64>(now - m_last_frame_time, target_interval * 4));
+	m_last_frame_time = now;
+
+	// Exponential moving average over roughly a quarter second of frames.
+	if (m_avg_interval == 0)
+		m_avg_interval = interval;
+	else
+		m_avg_interval += ((s32)interval - (s32)m_avg_interval) / 16;
+
+	if (m_cooldown > 0)
+	{
+		m_cooldown--;
+		return;
+	}
+
+	const bool slow = (u64)m_avg_interval * SLOW_DEN > (u64)target_interval * SLOW_NUM;
+	const bool fast = (u64)m_avg_interval * FAST_DEN < (u64)target_interval * FAST_NUM;
+	m_slow_frames = slow ? m_slow_frames + 1 : 0;
+	m_fast_frames = fast ? m_fast_frames + 1 : 0;
+
+	if (m_slow_frames >= target_refresh_rate / 2 && m_level < MaxLevel())
+	{
+		// Dropping again right after a step-up means that step-up was
+		// premature: make the next attempt wait longer for its headroom.
+		if (m_last_stepup_time != 0 && now - m_last_stepup_time < STEPUP_REGRET_WINDOW_US)
+		{
+			m_stepup_dwell = std::min(m_stepup_dwell * 2,
+				STEPUP_DWELL_MAX_SECONDS * target_refresh_rate);
+		}
+		ApplyLevel(m_level + 1, target_refresh_rate);
+	}
+	else if (m_fast_frames >= m_stepup_dwell && m_level > 0)
+	{
+		m_last_stepup_time = now;
+		ApplyLevel(m_level - 1, target_refresh_rate);
+	}
+}
+
+void WorkloadGovernor::ApplyLevel(int level, u32 target_refresh_rate)
+{
+	g_Config.bCopyEFBScaled = level >= 1 ? false : m_base_copy_efb_scaled;
+	g_Config.bSkipEFBCopyToRam = level >= 2 ? true : m_base_skip_efb_to_ram;
+
+	// Each level past 2 steps the internal resolution down one notch; auto
+	// scales can only drop straight to native.
+	int scale = m_base_efb_scale;
+	for (int step = 0; step < level - 2; step++)
+		scale = scale > SCALE_1X ? scale - 1 : SCALE_1X;
+	g_Config.iEFBScale = scale;
+
+	if (level == 0)
+		OSD::AddMessage("Workload governor: restored full fidelity", 4000);
+	else
+	{
+		OSD::AddMessage(StringFromFormat("Workload governor: fidelity %d/%d (%s)",
+			level, MaxLevel(), level > m_level ? "reduced" : "restoring"), 4000);
+	}
+
+	m_level = level;
+	m_slow_frames = 0;
+	m_fast_frames = 0;
+	// Ignore the transition itself (framebuffer reallocation, texture cache
+	// churn) before judging the new level.
+	m_cooldown = 2 * target_refresh_rate;
+}
+
+int WorkloadGovernor::MaxLevel() const
+{
+	int scale_steps;
+	if (m_base_efb_scale > SCALE_1X)
+		scale_steps = m_base_efb_scale - SCALE_1X;
+	else if (m_base_efb_scale < SCALE_1X)
+		scale_steps = 1;  // auto -> native
+	else
+		scale_steps = 0;
+	return 2 + scale_steps;
+}
@@ -0,0 +1,52 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+// Watches frame timing and trades fidelity for a stable frame rate when the
+// GPU cannot keep up (battery-limited laptops and handhelds). Degradation
+// walks a small ladder of options that are safe to flip at runtime: scaled
+// EFB copies first, then EFB-to-RAM copies, then the internal resolution one
+// notch at a time down to native. Recovery is deliberately slower than
+// degradation, and a level that has to be re-degraded soon after being
+// restored waits progressively longer before the next attempt, so the image
+// settles at a sustainable level instead of oscillating around the target.
+class WorkloadGovernor
+{
+public:
+	// Called once per presented frame from the video thread. Does nothing
+	// unless g_Config.bWorkloadGovernor is set; restores the user's settings
+	// when it gets switched off.
+	void Update(u32 target_refresh_rate);
+
+	// Current degradation level for the debug overlay (0 = user settings).
+	int GetLevel() const
+	{
+		return m_level;
+	}
+
+private:
+	void ApplyLevel(int level, u32 target_refresh_rate);
+	int MaxLevel() const;
+
+	bool m_active = false;
+
+	// The user's settings, captured when the governor engages and restored as
+	// it steps back up.
+	int m_base_efb_scale = 0;
+	bool m_base_copy_efb_scaled = true;
+	bool m_base_skip_efb_to_ram = false;
+
+	int m_level = 0;
+	u64 m_last_frame_time = 0;
+	u32 m_avg_interval = 0;  // moving average of the frame interval, in us
+
+	u32 m_slow_frames = 0;
+	u32 m_fast_frames = 0;
+	u32 m_cooldown = 0;       // frames to ignore after any level change
+	u32 m_stepup_dwell = 0;   // consecutive fast frames required to step up
+	u64 m_last_stepup_time = 0;
+};
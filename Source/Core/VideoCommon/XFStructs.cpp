@@ -11,6 +11,7 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/GeometryShaderManager.h"
+#include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/XFMemory.h"
 #include "VideoCommon/VertexManagerBase.h"
@@ -30,6 +31,11 @@ inline void XFRegWritten(int transferSize, u32 baseAddress)
 	u32 address = baseAddress;
 	u32 dataIndex = 0;
 
+	// XF register writes are rare compared to matrix loads, so any of them
+	// conservatively invalidates the cached pixel shader UID (channel
+	// configuration and the projection type feed it).
+	MarkPixelShaderUIDDirty();
+
 	while (transferSize > 0 && address < 0x1058)
 	{
 		u32 newValue = g_VideoData.Peek<u32>(dataIndex * sizeof(u32));
@@ -2,6 +2,8 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <cstring>
+
 #include "Common/Common.h"
 #include "Common/FileUtil.h"
 #include "Common/StringUtil.h"
@@ -14,6 +16,10 @@ u8 DSP::Host::ReadHostMemory(u32 addr)
 {
 	return 0;
 }
+void DSP::Host::ReadHostMemoryBlock(u8* dst, u32 addr, u32 size)
+{
+	memset(dst, 0, size);
+}
 void DSP::Host::WriteHostMemory(u8 value, u32 addr)
 {
 }